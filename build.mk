@@ -37,6 +37,7 @@ SED            := sed
 ZIP            := zip
 VALGRIND       := valgrind
 XXD            := xxd
+TEE            := tee
 
 # Toolchain (prefer environment variables over the defaults here; ignore Make's defaults for CC and LD)
 ifeq ($(origin CC),default)
@@ -47,6 +47,7 @@
 #endif
 
 #include "ff_debug.h"
+#include "ff_trace.h"
 #include "config.h"
 #include "platform.hpp"
 
@@ -178,6 +179,7 @@ int main(int argc, char **argv)
 
     // TODO: this is not good enough yet
     std::string configName = "cfggui";
+    std::string traceName;
     bool argOk = true;
     while (true)
     {
@@ -189,19 +191,21 @@ int main(int argc, char **argv)
             { "verbose",         no_argument,       NULL, 'v' },
             { "quiet",           no_argument,       NULL, 'q' },
             { "config",          required_argument, NULL, 'c' },
+            { "trace",           required_argument, NULL, 'T' },
             { NULL, 0, NULL, 0 },
         };  // clang-format on
-        const char* shortOpts = ":hvqc:";
+        const char* shortOpts = ":hvqc:T:";
         const char *usageHelp =
             "\n"
             "Usage:\n"
             "\n"
-            "    cfggui [-v] [-q] [-c <name>]\n"
+            "    cfggui [-v] [-q] [-c <name>] [-T <tracefile>]\n"
             "\n"
             "Where:\n"
             "\n"
             "    -v / -q             Increase / decrease verbosity\n"
             "    -c <name>           Config name to use (/^[a-z0-9]{3,20}$/, default: 'cfggui')\n"
+            "    -T <tracefile>      Record trace events and write them to <tracefile> (Chrome trace JSON) on exit\n"
             "\n";
             // Process all command line options
         int optIx = 0;
@@ -237,6 +241,9 @@ int main(int argc, char **argv)
                     argOk = false;
                 }
                 break;
+            case 'T':
+                traceName = optarg;
+                break;
             // Special getopt_long() cases
             case '?':
                 WARNING("Invalid option '-%c'!", optopt);
@@ -254,6 +261,12 @@ int main(int argc, char **argv)
         exit(EXIT_FAILURE);
     }
 
+    if (!traceName.empty())
+    {
+        traceThreadName("gui");
+        traceEnable(true);
+    }
+
     if (!Platform::Init())
     {
         ERROR("Failed initialising stuff!");
@@ -537,6 +550,26 @@ int main(int argc, char **argv)
         app = nullptr;
     }
 
+    // Write trace
+    if (!traceName.empty())
+    {
+        traceEnable(false);
+        std::FILE *traceFile = std::fopen(traceName.c_str(), "w");
+        const int nEvents = traceExportJson(traceFile);
+        if ( (traceFile == NULL) || (nEvents < 0) )
+        {
+            WARNING("Failed writing trace to '%s'!", traceName.c_str());
+        }
+        else
+        {
+            NOTICE("Wrote %d trace events to '%s'", nEvents, traceName.c_str());
+        }
+        if (traceFile != NULL)
+        {
+            std::fclose(traceFile);
+        }
+    }
+
     DEBUG("Adios!");
 
     // Save settings
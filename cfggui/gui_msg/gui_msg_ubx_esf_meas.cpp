@@ -15,10 +15,10 @@
 // You should have received a copy of the GNU General Public License along with this program.
 // If not, see <https://www.gnu.org/licenses/>.
 
-#include <cstring>
 #include <algorithm>
 
 #include "ff_ubx.h"
+#include "ff_ubx_view.h"
 
 #include "gui_inc.hpp"
 
@@ -92,32 +92,31 @@ GuiMsgUbxEsfMeas::MeasInfo::MeasInfo() :
 
 void GuiMsgUbxEsfMeas::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
 {
-    if (UBX_ESF_MEAS_V0_SIZE(msg->data) != msg->size)
+    UBX_VIEW_t view;
+    if ( (UBX_ESF_MEAS_V0_SIZE(msg->data) != msg->size) || !UBX_ESF_MEAS_V0_view(&view, msg->data, msg->size) )
     {
         return;
     }
 
-    UBX_ESF_MEAS_V0_GROUP0_t head;
-    std::memcpy(&head, &msg->data[UBX_HEAD_SIZE], sizeof(head));
-    const int numMeas = UBX_ESF_MEAS_V0_FLAGS_NUMMEAS_GET(head.flags);
-    const int timeMarkSent = UBX_ESF_MEAS_V0_FLAGS_TIMEMARKSENT_GET(head.flags);
-    const bool calibTtagValid = CHKBITS(head.flags, UBX_ESF_MEAS_V0_FLAGS_CALIBTTAGVALID);
+    const uint8_t *head = view.head;
+    const uint16_t flags = UBX_ESF_MEAS_V0_GROUP0_flags(head);
+    const int numMeas = UBX_ESF_MEAS_V0_FLAGS_NUMMEAS_GET(flags);
+    const int timeMarkSent = UBX_ESF_MEAS_V0_FLAGS_TIMEMARKSENT_GET(flags);
+    const bool calibTtagValid = CHKBITS(flags, UBX_ESF_MEAS_V0_FLAGS_CALIBTTAGVALID);
+    view.numGroups = numMeas; // The number of measurements is in the flags, the view doesn't know it
 
     uint32_t calibTtag = 0;
     if (calibTtagValid)
     {
-        UBX_ESF_MEAS_V0_GROUP2_t ttag;
-        std::memcpy(&ttag, &msg->data[UBX_HEAD_SIZE + sizeof(UBX_ESF_MEAS_V0_GROUP0_t) + (numMeas * sizeof(UBX_ESF_MEAS_V0_GROUP1_t))] , sizeof(ttag));
-        calibTtag = ttag.calibTtag;
+        const uint8_t *ttag = UBX_VIEW_GROUP(&view, numMeas);
+        calibTtag = UBX_ESF_MEAS_V0_GROUP2_calibTtag(ttag);
     }
 
-    for (int measIx = 0, offs = UBX_HEAD_SIZE + (int)sizeof(UBX_ESF_MEAS_V0_GROUP0_t); measIx < numMeas;
-            measIx++, offs += (int)sizeof(UBX_ESF_MEAS_V0_GROUP1_t))
+    for (const uint8_t *meas: Ff::UbxGroups(view))
     {
-        UBX_ESF_MEAS_V0_GROUP1_t meas;
-        std::memcpy(&meas, &msg->data[offs], sizeof(meas));
-        const int      dataType  = UBX_ESF_MEAS_V0_DATA_DATATYPE_GET(meas.data);
-        const uint32_t dataField = UBX_ESF_MEAS_V0_DATA_DATAFIELD_GET(meas.data);
+        const uint32_t data      = UBX_ESF_MEAS_V0_GROUP1_data(meas);
+        const int      dataType  = UBX_ESF_MEAS_V0_DATA_DATATYPE_GET(data);
+        const uint32_t dataField = UBX_ESF_MEAS_V0_DATA_DATAFIELD_GET(data);
 
         auto *measDef = (dataType < (int)MEAS_DEFS.size()) && MEAS_DEFS[dataType].name ? &MEAS_DEFS[dataType] : nullptr;
 
@@ -143,9 +142,9 @@ void GuiMsgUbxEsfMeas::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
         info->lastTs   = msg->ts;
         info->name     = name;
         info->rawHex   = Ff::Sprintf("0x%06x", dataField);
-        info->ttagSens = Ff::Sprintf("%.3f", (double)head.timeTag * UBX_ESF_MEAS_V0_CALIBTTAG_SCALE);
+        info->ttagSens = Ff::Sprintf("%.3f", (double)UBX_ESF_MEAS_V0_GROUP0_timeTag(head) * UBX_ESF_MEAS_V0_CALIBTTAG_SCALE);
         info->ttagRx   = calibTtagValid ? Ff::Sprintf("%.3f", (double)calibTtag * UBX_ESF_MEAS_V0_CALIBTTAG_SCALE) : "";
-        info->provider = std::to_string(head.id);
+        info->provider = std::to_string(UBX_ESF_MEAS_V0_GROUP0_id(head));
 
         if (measDef)
         {
@@ -15,10 +15,10 @@
 // You should have received a copy of the GNU General Public License along with this program.
 // If not, see <https://www.gnu.org/licenses/>.
 
-#include <cstring>
 #include <algorithm>
 
 #include "ff_ubx.h"
+#include "ff_ubx_view.h"
 
 #include "gui_inc.hpp"
 
@@ -77,10 +77,11 @@ void GuiMsgUbxEsfStatus::Clear()
 
 GuiMsgUbxEsfStatus::Sensor::Sensor(const uint8_t *groupData)
 {
-    UBX_ESF_STATUS_V2_GROUP1_t sensor;
-    std::memcpy(&sensor, groupData, sizeof(sensor));
+    const uint8_t sensStatus1 = UBX_ESF_STATUS_V2_GROUP1_sensStatus1(groupData);
+    const uint8_t sensStatus2 = UBX_ESF_STATUS_V2_GROUP1_sensStatus2(groupData);
+    const uint8_t sensFaults  = UBX_ESF_STATUS_V2_GROUP1_faults(groupData);
 
-    const int sensorType = UBX_ESF_STATUS_V2_SENSSTATUS1_TYPE_GET(sensor.sensStatus1);
+    const int sensorType = UBX_ESF_STATUS_V2_SENSSTATUS1_TYPE_GET(sensStatus1);
     if (sensorType < (int)GuiMsgUbxEsfMeas::MEAS_DEFS.size() && GuiMsgUbxEsfMeas::MEAS_DEFS[sensorType].name)
     {
         type = Ff::Sprintf("%s##%p", GuiMsgUbxEsfMeas::MEAS_DEFS[sensorType].name, groupData);
@@ -90,34 +91,34 @@ GuiMsgUbxEsfStatus::Sensor::Sensor(const uint8_t *groupData)
         type = Ff::Sprintf("Unknown (type %d)##%p", sensorType, groupData);
     }
 
-    used = CHKBITS(sensor.sensStatus1, UBX_ESF_STATUS_V2_SENSSTATUS1_USED);
-    ready = CHKBITS(sensor.sensStatus1, UBX_ESF_STATUS_V2_SENSSTATUS1_READY);
+    used = CHKBITS(sensStatus1, UBX_ESF_STATUS_V2_SENSSTATUS1_USED);
+    ready = CHKBITS(sensStatus1, UBX_ESF_STATUS_V2_SENSSTATUS1_READY);
 
     constexpr const char * const calibStatusStrs[] = { "not calibrated", "calibrating", "calibrated", "calibrated!" };
-    const int cIx = UBX_ESF_STATUS_V2_SENSSTATUS2_CALIBSTATUS_GET(sensor.sensStatus2);
+    const int cIx = UBX_ESF_STATUS_V2_SENSSTATUS2_CALIBSTATUS_GET(sensStatus2);
     calibStatus = cIx < NUMOF(calibStatusStrs) ? calibStatusStrs[cIx] : "?";
     calibrated = cIx > 1;
 
     constexpr const char  * const timeStatusStrs[] = { "no data", "first byte", "event input", "time tag" };
-    const int tIx = UBX_ESF_STATUS_V2_SENSSTATUS2_TIMESTATUS_GET(sensor.sensStatus2);
+    const int tIx = UBX_ESF_STATUS_V2_SENSSTATUS2_TIMESTATUS_GET(sensStatus2);
     timeStatus = tIx < NUMOF(timeStatusStrs) ? timeStatusStrs[tIx] : "?";
 
-    freq = Ff::Sprintf("%d", sensor.freq);
+    freq = Ff::Sprintf("%d", UBX_ESF_STATUS_V2_GROUP1_freq(groupData));
 
     faults = "";
-    if (CHKBITS(sensor.faults, UBX_ESF_STATUS_V2_FAULTS_BADMEAS))
+    if (CHKBITS(sensFaults, UBX_ESF_STATUS_V2_FAULTS_BADMEAS))
     {
         faults += "meas ";
     }
-    if (CHKBITS(sensor.faults, UBX_ESF_STATUS_V2_FAULTS_BADTTAG))
+    if (CHKBITS(sensFaults, UBX_ESF_STATUS_V2_FAULTS_BADTTAG))
     {
         faults += "ttag ";
     }
-    if (CHKBITS(sensor.faults, UBX_ESF_STATUS_V2_FAULTS_MISSINGMEAS))
+    if (CHKBITS(sensFaults, UBX_ESF_STATUS_V2_FAULTS_MISSINGMEAS))
     {
         faults += "missing ";
     }
-    if (CHKBITS(sensor.faults, UBX_ESF_STATUS_V2_FAULTS_NOISYMEAS))
+    if (CHKBITS(sensFaults, UBX_ESF_STATUS_V2_FAULTS_NOISYMEAS))
     {
         faults += "noisy ";
     }
@@ -128,26 +129,26 @@ GuiMsgUbxEsfStatus::Sensor::Sensor(const uint8_t *groupData)
 void GuiMsgUbxEsfStatus::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
 {
     Clear();
-    if ( (UBX_ESF_STATUS_VERSION_GET(msg->data) != UBX_ESF_STATUS_V2_VERSION) || (UBX_ESF_STATUS_V2_SIZE(msg->data) != msg->size) )
+    UBX_VIEW_t view;
+    if (!UBX_ESF_STATUS_V2_view(&view, msg->data, msg->size))
     {
         return;
     }
 
-    UBX_ESF_STATUS_V2_GROUP0_t status;
-    std::memcpy(&status, &msg->data[UBX_HEAD_SIZE], sizeof(status));
+    const uint8_t *status = view.head;
+    const uint8_t initStatus1 = UBX_ESF_STATUS_V2_GROUP0_initStatus1(status);
 
     _valid         = true;
-    _iTow          = Ff::Sprintf("%10.3f", (double)status.iTOW * UBX_ESF_STATUS_V2_ITOW_SCALE);
-    _wtInitStatus  = UBX_ESF_STATUS_V2_INITSTATUS1_WTINITSTATUS_GET(status.initStatus1);
-    _mntAlgStatus  = UBX_ESF_STATUS_V2_INITSTATUS1_MNTALGSTATUS_GET(status.initStatus1);
-    _insInitStatus = UBX_ESF_STATUS_V2_INITSTATUS1_INSINITSTATUS_GET(status.initStatus1);
-    _imuInitStatus = UBX_ESF_STATUS_V2_INITSTATUS2_IMUINITSTATUS_GET(status.initStatus2);
-    _fusionMode    = status.fusionMode;
-
-    for (int sensIx = 0, offs = UBX_HEAD_SIZE + (int)sizeof(UBX_ESF_STATUS_V2_GROUP0_t); sensIx < (int)status.numSens;
-            sensIx++, offs += (int)sizeof(UBX_ESF_STATUS_V2_GROUP1_t))
+    _iTow          = Ff::Sprintf("%10.3f", (double)UBX_ESF_STATUS_V2_GROUP0_iTOW(status) * UBX_ESF_STATUS_V2_ITOW_SCALE);
+    _wtInitStatus  = UBX_ESF_STATUS_V2_INITSTATUS1_WTINITSTATUS_GET(initStatus1);
+    _mntAlgStatus  = UBX_ESF_STATUS_V2_INITSTATUS1_MNTALGSTATUS_GET(initStatus1);
+    _insInitStatus = UBX_ESF_STATUS_V2_INITSTATUS1_INSINITSTATUS_GET(initStatus1);
+    _imuInitStatus = UBX_ESF_STATUS_V2_INITSTATUS2_IMUINITSTATUS_GET(UBX_ESF_STATUS_V2_GROUP0_initStatus2(status));
+    _fusionMode    = UBX_ESF_STATUS_V2_GROUP0_fusionMode(status);
+
+    for (const uint8_t *sensor: Ff::UbxGroups(view))
     {
-        _sensors.emplace_back(Sensor(&msg->data[offs]));
+        _sensors.emplace_back(Sensor(sensor));
     }
 
     std::sort(_sensors.begin(), _sensors.end(), [](const Sensor &a, const Sensor &b) { return a.type < b.type; });
@@ -190,9 +191,6 @@ bool GuiMsgUbxEsfStatus::Render(const std::shared_ptr<Ff::ParserMsg> &msg, const
         return false;
     }
 
-    UBX_ESF_STATUS_V2_GROUP0_t status;
-    std::memcpy(&status, &msg->data[UBX_HEAD_SIZE], sizeof(status));
-
     const ImVec2 topSize = _CalcTopSize(6);
     const float dataOffs = 25 * GuiSettings::charSize.x;
 
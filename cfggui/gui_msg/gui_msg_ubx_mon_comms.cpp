@@ -15,10 +15,10 @@
 // You should have received a copy of the GNU General Public License along with this program.
 // If not, see <https://www.gnu.org/licenses/>.
 
-#include <cstring>
 #include <cmath>
 
 #include "ff_ubx.h"
+#include "ff_ubx_view.h"
 
 #include "gui_inc.hpp"
 
@@ -60,16 +60,16 @@ void GuiMsgUbxMonComms::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
 {
     _table.ClearRows();
 
-    if ( (UBX_MON_COMMS_VERSION_GET(msg->data) != UBX_MON_COMMS_V0_VERSION) || (UBX_MON_COMMS_V0_SIZE(msg->data) != msg->size) )
+    UBX_VIEW_t view;
+    if (!UBX_MON_COMMS_V0_view(&view, msg->data, msg->size))
     {
         return;
     }
 
-    UBX_MON_COMMS_V0_GROUP0_t comms;
-    std::memcpy(&comms, &msg->data[UBX_HEAD_SIZE], sizeof(comms));
+    const uint8_t *comms = view.head;
 
     _valid = true;
-    _txErrors = comms.txErrors;
+    _txErrors = UBX_MON_COMMS_V0_GROUP0_txErrors(comms);
 
     int msgsIxUbx    = -1;
     int msgsIxNmea   = -1;
@@ -77,9 +77,10 @@ void GuiMsgUbxMonComms::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
     int msgsIxRtcm3  = -1;
     int msgsIxSpartn = -1;
     int msgsIxOther  = -1;
-    for (int ix = 0; ix < NUMOF(comms.protIds); ix++)
+    const uint8_t *protIds = UBX_MON_COMMS_V0_GROUP0_protIds(comms);
+    for (int ix = 0; ix < NUMOF(UBX_MON_COMMS_V0_GROUP0_t::protIds); ix++)
     {
-        switch (comms.protIds[ix])
+        switch (protIds[ix])
         {
             case UBX_MON_COMMS_V0_PROTIDS_UBX:    msgsIxUbx    = ix; break;
             case UBX_MON_COMMS_V0_PROTIDS_NMEA:   msgsIxNmea   = ix; break;
@@ -91,32 +92,29 @@ void GuiMsgUbxMonComms::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
     }
 
     _table.ClearRows();
-    for (int portIx = 0, offs = UBX_HEAD_SIZE + (int)sizeof(UBX_MON_COMMS_V0_GROUP0_t); portIx < (int)comms.nPorts;
-            portIx++, offs += (int)sizeof(UBX_MON_COMMS_V0_GROUP1_t))
+    for (const uint8_t *port: Ff::UbxGroups(view))
     {
-        UBX_MON_COMMS_V0_GROUP1_t port;
-        std::memcpy(&port, &msg->data[offs], sizeof(port));
-
-        const uint8_t portBank = port.portId & 0xff;
-        const uint8_t portNo   = (port.portId >> 8) & 0xff;
+        const uint16_t portId   = UBX_MON_COMMS_V0_GROUP1_portId(port);
+        const uint8_t  portBank = portId & 0xff;
+        const uint8_t  portNo   = (portId >> 8) & 0xff;
         const char * const portNames[] = { "I2C", "UART1", "UART2", "USB", "SPI" };
 
         _table.AddCellTextF("%u %s", portBank, portNo < NUMOF(portNames) ? portNames[portNo] : "?");
-        _table.AddCellTextF("%u", port.txPending);
-        _table.AddCellTextF("%u", port.txBytes);
-        _table.AddCellTextF("%u%% (%3u%%)", port.txUsage, port.txPeakUsage);
-        _table.AddCellTextF("%u", port.rxPending);
-        _table.AddCellTextF("%u", port.rxBytes);
-        _table.AddCellTextF("%u%% (%3u%%)", port.rxUsage, port.rxPeakUsage);
-        _table.AddCellTextF("%u", port.overrunErrors);
-        _table.AddCellTextF("%u", port.skipped);
+        _table.AddCellTextF("%u", UBX_MON_COMMS_V0_GROUP1_txPending(port));
+        _table.AddCellTextF("%u", UBX_MON_COMMS_V0_GROUP1_txBytes(port));
+        _table.AddCellTextF("%u%% (%3u%%)", UBX_MON_COMMS_V0_GROUP1_txUsage(port), UBX_MON_COMMS_V0_GROUP1_txPeakUsage(port));
+        _table.AddCellTextF("%u", UBX_MON_COMMS_V0_GROUP1_rxPending(port));
+        _table.AddCellTextF("%u", UBX_MON_COMMS_V0_GROUP1_rxBytes(port));
+        _table.AddCellTextF("%u%% (%3u%%)", UBX_MON_COMMS_V0_GROUP1_rxUsage(port), UBX_MON_COMMS_V0_GROUP1_rxPeakUsage(port));
+        _table.AddCellTextF("%u", UBX_MON_COMMS_V0_GROUP1_overrunErrors(port));
+        _table.AddCellTextF("%u", UBX_MON_COMMS_V0_GROUP1_skipped(port));
         if (msgsIxUbx < 0)
         {
             _table.AddCellEmpty();
         }
         else
         {
-            _table.AddCellTextF("%u", port.msgs[msgsIxUbx]);
+            _table.AddCellTextF("%u", UBX_MON_COMMS_V0_GROUP1_msgs(port, msgsIxUbx));
         }
         if (msgsIxNmea < 0)
         {
@@ -124,7 +122,7 @@ void GuiMsgUbxMonComms::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
         }
         else
         {
-            _table.AddCellTextF("%u", port.msgs[msgsIxNmea]);
+            _table.AddCellTextF("%u", UBX_MON_COMMS_V0_GROUP1_msgs(port, msgsIxNmea));
         }
         if (msgsIxRtcm3 < 0)
         {
@@ -132,7 +130,7 @@ void GuiMsgUbxMonComms::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
         }
         else
         {
-            _table.AddCellTextF("%u", port.msgs[msgsIxRtcm3]);
+            _table.AddCellTextF("%u", UBX_MON_COMMS_V0_GROUP1_msgs(port, msgsIxRtcm3));
         }
         if (msgsIxOther < 0)
         {
@@ -140,7 +138,7 @@ void GuiMsgUbxMonComms::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
         }
         else
         {
-            _table.AddCellTextF("%u", port.msgs[msgsIxOther]);
+            _table.AddCellTextF("%u", UBX_MON_COMMS_V0_GROUP1_msgs(port, msgsIxOther));
         }
         if (msgsIxSpartn < 0)
         {
@@ -148,9 +146,9 @@ void GuiMsgUbxMonComms::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
         }
         else
         {
-            _table.AddCellTextF("%u", port.msgs[msgsIxSpartn]);
+            _table.AddCellTextF("%u", UBX_MON_COMMS_V0_GROUP1_msgs(port, msgsIxSpartn));
         }
-        _table.SetRowUid(port.portId);
+        _table.SetRowUid(UBX_MON_COMMS_V0_GROUP1_portId(port));
     }
 }
 
@@ -15,9 +15,8 @@
 // You should have received a copy of the GNU General Public License along with this program.
 // If not, see <https://www.gnu.org/licenses/>.
 
-#include <cstring>
-
 #include "ff_ubx.h"
+#include "ff_ubx_view.h"
 
 #include "gui_inc.hpp"
 
@@ -86,44 +85,53 @@ GuiMsgUbxMonHw::GuiMsgUbxMonHw(std::shared_ptr<InputReceiver> receiver, std::sha
 
 void GuiMsgUbxMonHw::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
 {
-    if (msg->size != UBX_MON_HW_V0_SIZE)
+    UBX_VIEW_t view;
+    if (!UBX_MON_HW_V0_view(&view, msg->data, msg->size))
     {
         return;
     }
-    UBX_MON_HW_V0_GROUP0_t hw;
-    std::memcpy(&hw, &msg->data[UBX_HEAD_SIZE], sizeof(hw));
+    const uint8_t *hw       = view.head;
+    const uint8_t *vp       = UBX_MON_HW_V0_GROUP0_VP(hw);
+    const uint32_t pinSel   = UBX_MON_HW_V0_GROUP0_pinSel(hw);
+    const uint32_t pinBank  = UBX_MON_HW_V0_GROUP0_pinBank(hw);
+    const uint32_t pinDir   = UBX_MON_HW_V0_GROUP0_pinDir(hw);
+    const uint32_t pinVal   = UBX_MON_HW_V0_GROUP0_pinVal(hw);
+    const uint32_t pinIrq   = UBX_MON_HW_V0_GROUP0_pinIrq(hw);
+    const uint32_t pullL    = UBX_MON_HW_V0_GROUP0_pullL(hw);
+    const uint32_t pullH    = UBX_MON_HW_V0_GROUP0_pullH(hw);
+    const uint32_t usedMask = UBX_MON_HW_V0_GROUP0_usedMask(hw);
 
     _table.ClearRows();
-    for (uint32_t pinIx = 0, pinMask = 0x00000001; pinIx < NUMOF(hw.VP); pinIx++, pinMask <<= 1)
+    for (uint32_t pinIx = 0, pinMask = 0x00000001; pinIx < NUMOF(UBX_MON_HW_V0_GROUP0_t::VP); pinIx++, pinMask <<= 1)
     {
         _table.AddCellText(_pinNames[pinIx]);
-        const uint8_t vPinIx = hw.VP[pinIx];
-        if (CHKBITS(hw.pinSel, pinMask))
+        const uint8_t vPinIx = vp[pinIx];
+        if (CHKBITS(pinSel, pinMask))
         {
             _table.AddCellText(_pioNames[pinIx]);
         }
         else
         {
-            _table.AddCellText(CHKBITS(hw.pinBank, pinMask) ? _periphBfuncs[pinIx] : _periphAfuncs[pinIx]);
+            _table.AddCellText(CHKBITS(pinBank, pinMask) ? _periphBfuncs[pinIx] : _periphAfuncs[pinIx]);
         }
 
         // (G)PIO
-        if (CHKBITS(hw.pinSel, pinMask))
+        if (CHKBITS(pinSel, pinMask))
         {
-            _table.AddCellText(CHKBITS(hw.pinDir, pinMask) ? "PIO_OUT" : "PIO_IN" );
+            _table.AddCellText(CHKBITS(pinDir, pinMask) ? "PIO_OUT" : "PIO_IN" );
         }
         // PERIPH function
         else
         {
-            _table.AddCellText(CHKBITS(hw.pinBank, pinMask) ? "PERIPH_B" : "PERIPH_A" );
+            _table.AddCellText(CHKBITS(pinBank, pinMask) ? "PERIPH_B" : "PERIPH_A" );
         }
 
-        _table.AddCellText(CHKBITS(hw.pinVal, pinMask) ? "HIGH" : "LOW");
-        _table.AddCellText(CHKBITS(hw.pinIrq, pinMask) ? "yes" : "no"); // FIXME: correct?
-        const bool pullLo = CHKBITS(hw.pullL, pinMask);
-        const bool pullHi = CHKBITS(hw.pullH, pinMask);
+        _table.AddCellText(CHKBITS(pinVal, pinMask) ? "HIGH" : "LOW");
+        _table.AddCellText(CHKBITS(pinIrq, pinMask) ? "yes" : "no"); // FIXME: correct?
+        const bool pullLo = CHKBITS(pullL, pinMask);
+        const bool pullHi = CHKBITS(pullH, pinMask);
         _table.AddCellText(pullLo && pullHi ? "LOW HIGH" : (pullLo ? "LOW" : (pullHi ? "HIGH" : "")));
-        if (CHKBITS(hw.usedMask, pinMask))
+        if (CHKBITS(usedMask, pinMask))
         {
             _table.AddCellTextF("%u - %s", vPinIx, (vPinIx < NUMOF(_virtFuncs)) && _virtFuncs[vPinIx] ? _virtFuncs[vPinIx] : "?");
         }
@@ -139,12 +147,15 @@ void GuiMsgUbxMonHw::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
 
 bool GuiMsgUbxMonHw::Render(const std::shared_ptr<Ff::ParserMsg> &msg, const FfVec2f &sizeAvail)
 {
-    if (msg->size != UBX_MON_HW_V0_SIZE)
+    UBX_VIEW_t view;
+    if (!UBX_MON_HW_V0_view(&view, msg->data, msg->size))
     {
         return false;
     }
-    UBX_MON_HW_V0_GROUP0_t hw;
-    std::memcpy(&hw, &msg->data[UBX_HEAD_SIZE], sizeof(hw));
+    const uint8_t *hw     = view.head;
+    const uint8_t flags   = UBX_MON_HW_V0_GROUP0_flags(hw);
+    const uint8_t aStatus = UBX_MON_HW_V0_GROUP0_aStatus(hw);
+    const uint8_t aPower  = UBX_MON_HW_V0_GROUP0_aPower(hw);
 
     const ImVec2 topSize = _CalcTopSize(6);
     const ImVec2 topSize2 = ImVec2(0.5 * (sizeAvail.x - GuiSettings::style->ItemSpacing.x), topSize.y);
@@ -152,12 +163,12 @@ bool GuiMsgUbxMonHw::Render(const std::shared_ptr<Ff::ParserMsg> &msg, const FfV
 
     if (ImGui::BeginChild("##Status", topSize2))
     {
-        _RenderStatusFlag(_rtcFlags,      CHKBITS(hw.flags, UBX_MON_HW_V0_FLAGS_RTCCALIB),   "RTC mode",       dataOffs);
-        _RenderStatusFlag(_xtalFlags,     CHKBITS(hw.flags, UBX_MON_HW_V0_FLAGS_XTALABSENT), "RTC XTAL",       dataOffs);
-        _RenderStatusFlag(_aStatusFlags,  hw.aStatus,                                        "Antenna status", dataOffs);
-        _RenderStatusFlag(_aPowerFlags,   hw.aPower,                                         "Antenna power",  dataOffs);
-        _RenderStatusFlag(_safebootFlags, CHKBITS(hw.flags, UBX_MON_HW_V0_FLAGS_SAFEBOOT),   "Safeboot mode",  dataOffs);
-        _RenderStatusFlag(_jammingFlags,  UBX_MON_HW_V0_FLAGS_JAMMINGSTATE_GET(hw.flags),    "Jamming status", dataOffs);
+        _RenderStatusFlag(_rtcFlags,      CHKBITS(flags, UBX_MON_HW_V0_FLAGS_RTCCALIB),   "RTC mode",       dataOffs);
+        _RenderStatusFlag(_xtalFlags,     CHKBITS(flags, UBX_MON_HW_V0_FLAGS_XTALABSENT), "RTC XTAL",       dataOffs);
+        _RenderStatusFlag(_aStatusFlags,  aStatus,                                        "Antenna status", dataOffs);
+        _RenderStatusFlag(_aPowerFlags,   aPower,                                         "Antenna power",  dataOffs);
+        _RenderStatusFlag(_safebootFlags, CHKBITS(flags, UBX_MON_HW_V0_FLAGS_SAFEBOOT),   "Safeboot mode",  dataOffs);
+        _RenderStatusFlag(_jammingFlags,  UBX_MON_HW_V0_FLAGS_JAMMINGSTATE_GET(flags),    "Jamming status", dataOffs);
     }
     ImGui::EndChild();
 
@@ -171,21 +182,21 @@ bool GuiMsgUbxMonHw::Render(const std::shared_ptr<Ff::ParserMsg> &msg, const FfV
         ImGui::AlignTextToFramePadding();
         ImGui::TextUnformatted("Noise level");
         ImGui::SameLine(dataOffs);
-        const float noise = (float)hw.noisePerMS / (float)UBX_MON_HW_V0_NOISEPERMS_MAX;
-        snprintf(str, sizeof(str), "%u", hw.noisePerMS);
+        const float noise = (float)UBX_MON_HW_V0_GROUP0_noisePerMS(hw) / (float)UBX_MON_HW_V0_NOISEPERMS_MAX;
+        snprintf(str, sizeof(str), "%u", UBX_MON_HW_V0_GROUP0_noisePerMS(hw));
         ImGui::ProgressBar(noise, ImVec2(-1.0f,0.0f), str);
 
         ImGui::AlignTextToFramePadding();
         ImGui::TextUnformatted("AGC monitor");
         ImGui::SameLine(dataOffs);
-        const float agc = (float)hw.agcCnt / (float)UBX_MON_HW_V0_AGCCNT_MAX;
+        const float agc = (float)UBX_MON_HW_V0_GROUP0_agcCnt(hw) / (float)UBX_MON_HW_V0_AGCCNT_MAX;
         snprintf(str, sizeof(str), "%.1f%%", agc * 1e2f);
         ImGui::ProgressBar(agc, ImVec2(-1.0f,0.0f), str);
 
         ImGui::AlignTextToFramePadding();
         ImGui::TextUnformatted("CW jamming");
         ImGui::SameLine(dataOffs);
-        const float jam = (float)hw.jamInd / (float)UBX_MON_HW_V0_JAMIND_MAX;
+        const float jam = (float)UBX_MON_HW_V0_GROUP0_jamInd(hw) / (float)UBX_MON_HW_V0_JAMIND_MAX;
         snprintf(str, sizeof(str), "%.1f%%", jam * 1e2f);
         ImGui::ProgressBar(jam, ImVec2(-1.0f,0.0f), str);
     }
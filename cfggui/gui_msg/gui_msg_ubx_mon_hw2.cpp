@@ -15,10 +15,10 @@
 // You should have received a copy of the GNU General Public License along with this program.
 // If not, see <https://www.gnu.org/licenses/>.
 
-#include <cstring>
 #include <cmath>
 
 #include "ff_ubx.h"
+#include "ff_ubx_view.h"
 
 #include "gui_inc.hpp"
 
@@ -35,14 +35,14 @@ GuiMsgUbxMonHw2::GuiMsgUbxMonHw2(std::shared_ptr<InputReceiver> receiver, std::s
 
 void GuiMsgUbxMonHw2::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
 {
-    if (msg->size == UBX_MON_HW2_V0_SIZE)
+    UBX_VIEW_t view;
+    if (UBX_MON_HW2_V0_view(&view, msg->data, msg->size))
     {
-        UBX_MON_HW2_V0_GROUP0_t hw;
-        std::memcpy(&hw, &msg->data[UBX_HEAD_SIZE], sizeof(hw));
+        const uint8_t *hw = view.head;
 
         // Measurement
-        _iqs.emplace_back((float)hw.magI * (1.0f/255.0f), (float)hw.magQ * (1.0f/255.0f),
-                          (float)hw.ofsI * (2.0f/255.0f), (float)hw.ofsQ * (2.0f/255.0f));
+        _iqs.emplace_back((float)UBX_MON_HW2_V0_GROUP0_magI(hw) * (1.0f/255.0f), (float)UBX_MON_HW2_V0_GROUP0_magQ(hw) * (1.0f/255.0f),
+                          (float)UBX_MON_HW2_V0_GROUP0_ofsI(hw) * (2.0f/255.0f), (float)UBX_MON_HW2_V0_GROUP0_ofsQ(hw) * (2.0f/255.0f));
 
         while (_iqs.size() > NUM_IQS)
         {
@@ -18,6 +18,7 @@
 #include <cstring>
 
 #include "ff_ubx.h"
+#include "ff_ubx_view.h"
 
 #include "gui_inc.hpp"
 
@@ -63,44 +64,45 @@ GuiMsgUbxMonHw3::GuiMsgUbxMonHw3(std::shared_ptr<InputReceiver> receiver, std::s
 
 void GuiMsgUbxMonHw3::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
 {
-    if ( (UBX_MON_HW3_VERSION_GET(msg->data) != UBX_MON_HW3_V0_VERSION) || (UBX_MON_HW3_V0_SIZE(msg->data) != msg->size) )
+    UBX_VIEW_t view;
+    if (!UBX_MON_HW3_V0_view(&view, msg->data, msg->size))
     {
         return;
     }
-    UBX_MON_HW3_V0_GROUP0_t hw;
-    std::memcpy(&hw, &msg->data[UBX_HEAD_SIZE], sizeof(hw));
+    const Ff::UbxGroups pins(view);
 
     _table.ClearRows();
-    for (int pinIx = 0, offs = UBX_HEAD_SIZE + (int)sizeof(UBX_MON_HW3_V0_GROUP0_t); pinIx < (int)hw.nPins;
-            pinIx++, offs += (int)sizeof(UBX_MON_HW3_V0_GROUP1_t))
+    for (int pinIx = 0; pinIx < pins.size(); pinIx++)
     {
-        UBX_MON_HW3_V0_GROUP1_t pin;
-        std::memcpy(&pin, &msg->data[offs], sizeof(pin));
+        const uint8_t *pin     = pins[pinIx];
+        const uint16_t pinId   = UBX_MON_HW3_V0_GROUP1_pinId(pin);
+        const uint16_t pinMask = UBX_MON_HW3_V0_GROUP1_pinMask(pin);
+        const uint8_t  vp      = UBX_MON_HW3_V0_GROUP1_VP(pin);
 
-        const uint8_t pinBank = pin.pinId & 0xff;
-        const uint8_t pinNo   = (pin.pinId >> 8) & 0xff;
+        const uint8_t pinBank = pinId & 0xff;
+        const uint8_t pinNo   = (pinId >> 8) & 0xff;
         _table.AddCellTextF("%d %2d##%d", pinBank, pinNo, pinIx);
-        _table.AddCellText(CHKBITS(pin.pinMask, UBX_MON_HW3_V0_PINMASK_DIRECTION) ? "output" : "input");
-        _table.AddCellText(CHKBITS(pin.pinMask, UBX_MON_HW3_V0_PINMASK_VALUE) ? "high" : "low");
-        if (CHKBITS(pin.pinMask, UBX_MON_HW3_V0_PINMASK_PERIPHPIO))
+        _table.AddCellText(CHKBITS(pinMask, UBX_MON_HW3_V0_PINMASK_DIRECTION) ? "output" : "input");
+        _table.AddCellText(CHKBITS(pinMask, UBX_MON_HW3_V0_PINMASK_VALUE) ? "high" : "low");
+        if (CHKBITS(pinMask, UBX_MON_HW3_V0_PINMASK_PERIPHPIO))
         {
             _table.AddCellText("PIO");
         }
         else
         {
-            const uint8_t periph = UBX_MON_HW3_V0_PINMASK_PINBANK_GET(pin.pinMask);
+            const uint8_t periph = UBX_MON_HW3_V0_PINMASK_PINBANK_GET(pinMask);
             const char periphChars[] = { 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H' };
             _table.AddCellTextF("%c", periph < NUMOF(periphChars) ? periphChars[periph] : '?');
         }
-        _table.AddCellText(CHKBITS(pin.pinMask, UBX_MON_HW3_V0_PINMASK_PIOIRQ) ? "yes" : "no");
-        const bool pullLo = CHKBITS(pin.pinMask, UBX_MON_HW3_V0_PINMASK_PIOPULLLOW);
-        const bool pullHi = CHKBITS(pin.pinMask, UBX_MON_HW3_V0_PINMASK_PIOPULLHIGH);
+        _table.AddCellText(CHKBITS(pinMask, UBX_MON_HW3_V0_PINMASK_PIOIRQ) ? "yes" : "no");
+        const bool pullLo = CHKBITS(pinMask, UBX_MON_HW3_V0_PINMASK_PIOPULLLOW);
+        const bool pullHi = CHKBITS(pinMask, UBX_MON_HW3_V0_PINMASK_PIOPULLHIGH);
         _table.AddCellText(pullLo && pullHi ? "low high" : (pullLo ? "low" : (pullHi ? "high" : "")));
-        if (CHKBITS(pin.pinMask, UBX_MON_HW3_V0_PINMASK_VPMANAGER))
+        if (CHKBITS(pinMask, UBX_MON_HW3_V0_PINMASK_VPMANAGER))
         {
-            _table.AddCellTextF("%u - %s", pin.VP,
-                (pin.VP < NUMOF(GuiMsgUbxMonHw::_virtFuncs)) && GuiMsgUbxMonHw::_virtFuncs[pin.VP] ?
-                GuiMsgUbxMonHw::_virtFuncs[pin.VP] : "?");
+            _table.AddCellTextF("%u - %s", vp,
+                (vp < NUMOF(GuiMsgUbxMonHw::_virtFuncs)) && GuiMsgUbxMonHw::_virtFuncs[vp] ?
+                GuiMsgUbxMonHw::_virtFuncs[vp] : "?");
         }
         else
         {
@@ -114,23 +116,23 @@ void GuiMsgUbxMonHw3::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
 
 bool GuiMsgUbxMonHw3::Render(const std::shared_ptr<Ff::ParserMsg> &msg, const FfVec2f &sizeAvail)
 {
-    if ( (UBX_MON_HW3_VERSION_GET(msg->data) != UBX_MON_HW3_V0_VERSION) || (UBX_MON_HW3_V0_SIZE(msg->data) != msg->size) )
+    UBX_VIEW_t view;
+    if (!UBX_MON_HW3_V0_view(&view, msg->data, msg->size))
     {
         return false;
     }
-    UBX_MON_HW3_V0_GROUP0_t hw;
-    std::memcpy(&hw, &msg->data[UBX_HEAD_SIZE], sizeof(hw));
+    const uint8_t flags = UBX_MON_HW3_V0_GROUP0_flags(view.head);
 
     const ImVec2 topSize = _CalcTopSize(4);
     const float dataOffs = 20 * GuiSettings::charSize.x;
 
     ImGui::BeginChild("##Status", topSize);
     {
-        _RenderStatusFlag(_rtcFlags,       CHKBITS(hw.flags, UBX_MON_HW3_V0_FLAGS_RTCCALIB),   "RTC mode",      dataOffs);
-        _RenderStatusFlag(_xtalFlags,      CHKBITS(hw.flags, UBX_MON_HW3_V0_FLAGS_XTALABSENT), "RTC XTAL",      dataOffs);
-        _RenderStatusFlag(_safebootFlags,  CHKBITS(hw.flags, UBX_MON_HW3_V0_FLAGS_SAFEBOOT),   "Safeboot mode", dataOffs);
-        char str[sizeof(hw.hwVersion) + 1];
-        std::memcpy(str, hw.hwVersion, sizeof(hw.hwVersion));
+        _RenderStatusFlag(_rtcFlags,       CHKBITS(flags, UBX_MON_HW3_V0_FLAGS_RTCCALIB),   "RTC mode",      dataOffs);
+        _RenderStatusFlag(_xtalFlags,      CHKBITS(flags, UBX_MON_HW3_V0_FLAGS_XTALABSENT), "RTC XTAL",      dataOffs);
+        _RenderStatusFlag(_safebootFlags,  CHKBITS(flags, UBX_MON_HW3_V0_FLAGS_SAFEBOOT),   "Safeboot mode", dataOffs);
+        char str[sizeof(UBX_MON_HW3_V0_GROUP0_t::hwVersion) + 1];
+        std::memcpy(str, UBX_MON_HW3_V0_GROUP0_hwVersion(view.head), sizeof(UBX_MON_HW3_V0_GROUP0_t::hwVersion));
         str[sizeof(str) - 1] = '\0';
         _RenderStatusText("Hardware version", str, dataOffs);
     }
@@ -15,10 +15,10 @@
 // You should have received a copy of the GNU General Public License along with this program.
 // If not, see <https://www.gnu.org/licenses/>.
 
-#include <cstring>
 #include <cmath>
 
 #include "ff_ubx.h"
+#include "ff_ubx_view.h"
 
 #include "gui_inc.hpp"
 
@@ -35,27 +35,25 @@ GuiMsgUbxMonRf::GuiMsgUbxMonRf(std::shared_ptr<InputReceiver> receiver, std::sha
 
 void GuiMsgUbxMonRf::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
 {
-    if ( (UBX_MON_RF_VERSION_GET(msg->data) != UBX_MON_RF_V0_VERSION) || (UBX_MON_RF_V0_SIZE(msg->data) != msg->size) )
+    UBX_VIEW_t view;
+    if (!UBX_MON_RF_V0_view(&view, msg->data, msg->size))
     {
         return;
     }
-    UBX_MON_RF_V0_GROUP0_t rf;
-    std::memcpy(&rf, &msg->data[UBX_HEAD_SIZE], sizeof(rf));
+    const Ff::UbxGroups blocks(view);
 
-    if (_blockIqs.size() != rf.nBlocks)
+    if ((int)_blockIqs.size() != blocks.size())
     {
-        _blockIqs.resize(rf.nBlocks);
+        _blockIqs.resize(blocks.size());
     }
 
-    for (int blockIx = 0, offs = UBX_HEAD_SIZE + (int)sizeof(UBX_MON_RF_V0_GROUP0_t); blockIx < (int)rf.nBlocks;
-            blockIx++, offs += (int)sizeof(UBX_MON_RF_V0_GROUP1_t))
+    for (int blockIx = 0; blockIx < blocks.size(); blockIx++)
     {
-        UBX_MON_RF_V0_GROUP1_t block;
-        std::memcpy(&block, &msg->data[offs], sizeof(block));
+        const uint8_t *block = blocks[blockIx];
 
         _blockIqs[blockIx].emplace_back(
-            (float)block.magI * (1.0f/255.0f), (float)block.magQ * (1.0f/255.0f),
-            (float)block.ofsI * (2.0f/255.0f), (float)block.ofsQ * (2.0f/255.0f));
+            (float)UBX_MON_RF_V0_GROUP1_magI(block) * (1.0f/255.0f), (float)UBX_MON_RF_V0_GROUP1_magQ(block) * (1.0f/255.0f),
+            (float)UBX_MON_RF_V0_GROUP1_ofsI(block) * (2.0f/255.0f), (float)UBX_MON_RF_V0_GROUP1_ofsQ(block) * (2.0f/255.0f));
 
         while (_blockIqs[blockIx].size() > NUM_IQS)
         {
@@ -101,56 +99,55 @@ void GuiMsgUbxMonRf::Clear()
 
 bool GuiMsgUbxMonRf::Render(const std::shared_ptr<Ff::ParserMsg> &msg, const FfVec2f &sizeAvail)
 {
-    if ( (UBX_MON_RF_VERSION_GET(msg->data) != UBX_MON_RF_V0_VERSION) || (UBX_MON_RF_V0_SIZE(msg->data) != msg->size) )
+    UBX_VIEW_t view;
+    if (!UBX_MON_RF_V0_view(&view, msg->data, msg->size))
     {
         return false;
     }
 
     const ImVec2 blockSize { 0.5f * (sizeAvail.x - GuiSettings::style->ItemSpacing.x), sizeAvail.y };
 
-    UBX_MON_RF_V0_GROUP0_t rf;
-    std::memcpy(&rf, &msg->data[UBX_HEAD_SIZE], sizeof(rf));
-    const int nBlocks = CLIP(rf.nBlocks, 0, 3);
+    const Ff::UbxGroups blocks(view);
+    const int nBlocks = CLIP(blocks.size(), 0, 3);
 
     const float dataOffs = GuiSettings::charSize.x * 16;
 
-    for (int blockIx = 0, offs = UBX_HEAD_SIZE + (int)sizeof(UBX_MON_RF_V0_GROUP0_t); blockIx < nBlocks;
-            blockIx++, offs += (int)sizeof(UBX_MON_RF_V0_GROUP1_t))
+    for (int blockIx = 0; blockIx < nBlocks; blockIx++)
     {
-        UBX_MON_RF_V0_GROUP1_t block;
-        std::memcpy(&block, &msg->data[offs], sizeof(block));
+        const uint8_t *block = blocks[blockIx];
+        const uint8_t  flags = UBX_MON_RF_V0_GROUP1_flags(block);
 
-        if (ImGui::BeginChild(offs, blockSize))
+        if (ImGui::BeginChild(blockIx + 1, blockSize))
         {
             Gui::TextTitleF("RF block #%u", blockIx);
 
-            _RenderStatusFlag(_aStatusFlags,  block.antStatus,                                   "Antenna status", dataOffs);
-            _RenderStatusFlag(_aPowerFlags,   block.antPower,                                    "Antenna power",  dataOffs);
-            _RenderStatusFlag(_jammingFlags,  UBX_MON_RF_V0_FLAGS_JAMMINGSTATE_GET(block.flags), "Jamming status", dataOffs);
+            _RenderStatusFlag(_aStatusFlags,  UBX_MON_RF_V0_GROUP1_antStatus(block),      "Antenna status", dataOffs);
+            _RenderStatusFlag(_aPowerFlags,   UBX_MON_RF_V0_GROUP1_antPower(block),       "Antenna power",  dataOffs);
+            _RenderStatusFlag(_jammingFlags,  UBX_MON_RF_V0_FLAGS_JAMMINGSTATE_GET(flags), "Jamming status", dataOffs);
 
             char str[100];
 
-            snprintf(str, sizeof(str), "0x%08x", block.postStatus);
+            snprintf(str, sizeof(str), "0x%08x", UBX_MON_RF_V0_GROUP1_postStatus(block));
             _RenderStatusText("POST status", str, dataOffs);
 
             ImGui::AlignTextToFramePadding();
             ImGui::TextUnformatted("Noise level");
             ImGui::SameLine(dataOffs);
-            const float noise = (float)block.noisePerMS / (float)UBX_MON_RF_V0_NOISEPERMS_MAX;
-            snprintf(str, sizeof(str), "%u", block.noisePerMS);
+            const float noise = (float)UBX_MON_RF_V0_GROUP1_noisePerMS(block) / (float)UBX_MON_RF_V0_NOISEPERMS_MAX;
+            snprintf(str, sizeof(str), "%u", UBX_MON_RF_V0_GROUP1_noisePerMS(block));
             ImGui::ProgressBar(noise, ImVec2(-1.0f,0.0f), str);
 
             ImGui::AlignTextToFramePadding();
             ImGui::TextUnformatted("AGC monitor");
             ImGui::SameLine(dataOffs);
-            const float agc = (float)block.agcCnt / (float)UBX_MON_RF_V0_AGCCNT_MAX;
+            const float agc = (float)UBX_MON_RF_V0_GROUP1_agcCnt(block) / (float)UBX_MON_RF_V0_AGCCNT_MAX;
             snprintf(str, sizeof(str), "%.1f%%", agc * 1e2f);
             ImGui::ProgressBar(agc, ImVec2(-1.0f,0.0f), str);
 
             ImGui::AlignTextToFramePadding();
             ImGui::TextUnformatted("CW jamming");
             ImGui::SameLine(dataOffs);
-            const float jam = (float)block.jamInd / (float)UBX_MON_RF_V0_JAMIND_MAX;
+            const float jam = (float)UBX_MON_RF_V0_GROUP1_jamInd(block) / (float)UBX_MON_RF_V0_JAMIND_MAX;
             snprintf(str, sizeof(str), "%.1f%%", jam * 1e2f);
             ImGui::ProgressBar(jam, ImVec2(-1.0f,0.0f), str);
 
@@ -158,7 +155,7 @@ bool GuiMsgUbxMonRf::Render(const std::shared_ptr<Ff::ParserMsg> &msg, const FfV
         }
         ImGui::EndChild();
 
-        if (blockIx < ((int)rf.nBlocks - 1))
+        if (blockIx < (blocks.size() - 1))
         {
             ImGui::SameLine();
         }
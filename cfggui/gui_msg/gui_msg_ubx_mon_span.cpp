@@ -15,9 +15,8 @@
 // You should have received a copy of the GNU General Public License along with this program.
 // If not, see <https://www.gnu.org/licenses/>.
 
-#include <cstring>
-
 #include "ff_ubx.h"
+#include "ff_ubx_view.h"
 
 #include "gui_inc.hpp"
 
@@ -65,36 +64,38 @@ void GuiMsgUbxMonSpan::Clear()
 
 void GuiMsgUbxMonSpan::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
 {
-    if ( (UBX_MON_SPAN_VERSION_GET(msg->data) != UBX_MON_SPAN_V0_VERSION) || (msg->size < UBX_MON_SPAN_V0_SIZE(msg->data)) )
+    UBX_VIEW_t view;
+    if (!UBX_MON_SPAN_V0_view(&view, msg->data, msg->size))
     {
         return;
     }
 
-    UBX_MON_SPAN_V0_GROUP0_t head;
-    std::memcpy(&head, &msg->data[UBX_HEAD_SIZE], sizeof(head));
-    const int numRfBlocks = CLIP(head.numRfBlocks, 0, 5);
+    const Ff::UbxGroups blocks(view);
+    const int numRfBlocks = CLIP(blocks.size(), 0, 5);
     _spects.resize(numRfBlocks);
 
-    for (int spectIx = 0, offs = UBX_HEAD_SIZE + (int)sizeof(UBX_MON_SPAN_V0_GROUP0_t); spectIx < (int)numRfBlocks;
-            spectIx++, offs += (int)sizeof(UBX_MON_SPAN_V0_GROUP1_t))
+    for (int spectIx = 0; spectIx < numRfBlocks; spectIx++)
     {
-        UBX_MON_SPAN_V0_GROUP1_t block;
-        std::memcpy(&block, &msg->data[offs], sizeof(block));
-        const int numBins = NUMOF(block.spectrum);
+        const uint8_t *block    = blocks[spectIx];
+        const uint8_t *spectrum = UBX_MON_SPAN_V0_GROUP1_spectrum(block);
+        const double   center   = (double)UBX_MON_SPAN_V0_GROUP1_center(block);
+        const double   span     = (double)UBX_MON_SPAN_V0_GROUP1_span(block);
+        const int numBins = NUMOF(UBX_MON_SPAN_V0_GROUP1_t::spectrum);
         auto &spect = _spects[spectIx];
         spect.freq.resize(numBins, NAN);
         spect.ampl.resize(numBins, NAN);
         spect.min.resize(numBins, NAN);
         spect.max.resize(numBins, NAN);
         spect.mean.resize(numBins, NAN);
-        spect.center = (double)block.center * 1e-6; // [MHz]
-        spect.span   = (double)block.span   * 1e-6; // [MHz]
-        spect.res    = (double)block.res    * 1e-6; // [MHz]
-        spect.pga    = (double)block.pga;
+        spect.center = center * 1e-6; // [MHz]
+        spect.span   = span   * 1e-6; // [MHz]
+        spect.res    = (double)UBX_MON_SPAN_V0_GROUP1_res(block)    * 1e-6; // [MHz]
+        spect.pga    = (double)UBX_MON_SPAN_V0_GROUP1_pga(block);
         for (int binIx = 0; binIx < numBins; binIx++)
         {
-            spect.freq[binIx] = (UBX_MON_SPAN_BIN_CENT_FREQ(block, binIx) * 1e-6) - spect.center; // [MHz]
-            const double ampl = (double)block.spectrum[binIx] * (100.0/255.0); // [%]
+            const double freq = center + (span * (((double)binIx - 128.0) / 256.0)); // See UBX_MON_SPAN_BIN_CENT_FREQ()
+            spect.freq[binIx] = (freq * 1e-6) - spect.center; // [MHz]
+            const double ampl = (double)spectrum[binIx] * (100.0/255.0); // [%]
             spect.ampl[binIx] = ampl;
             if (std::isnan(spect.min[binIx]) || (ampl < spect.min[binIx]))
             {
@@ -15,9 +15,8 @@
 // You should have received a copy of the GNU General Public License along with this program.
 // If not, see <https://www.gnu.org/licenses/>.
 
-#include <cstring>
-
 #include "ff_ubx.h"
+#include "ff_ubx_view.h"
 
 #include "gui_inc.hpp"
 
@@ -35,27 +34,18 @@ GuiMsgUbxMonVer::GuiMsgUbxMonVer(std::shared_ptr<InputReceiver> receiver, std::s
 bool GuiMsgUbxMonVer::Render(const std::shared_ptr<Ff::ParserMsg> &msg, const FfVec2f &sizeAvail)
 {
     UNUSED(sizeAvail);
-    if (msg->size >= UBX_MON_VER_V0_MIN_SIZE)
+    UBX_VIEW_t view;
+    if (UBX_MON_VER_V0_view(&view, msg->data, msg->size))
     {
-        UBX_MON_VER_V0_GROUP0_t gr0;
-        int offs = UBX_HEAD_SIZE;
-        std::memcpy(&gr0, &msg->data[offs], sizeof(gr0));
-        gr0.swVersion[sizeof(gr0.swVersion) - 1] = '\0';
-        gr0.hwVersion[sizeof(gr0.hwVersion) - 1] = '\0';
-
-        ImGui::Text("swVersion = %s", gr0.swVersion);
-        ImGui::Text("hwVersion = %s", gr0.hwVersion);
+        // The strings are not necessarily nul-terminated, the last char is always ignored
+        ImGui::Text("swVersion = %.*s", (int)sizeof(UBX_MON_VER_V0_GROUP0_t::swVersion) - 1, UBX_MON_VER_V0_GROUP0_swVersion(view.head));
+        ImGui::Text("hwVersion = %.*s", (int)sizeof(UBX_MON_VER_V0_GROUP0_t::hwVersion) - 1, UBX_MON_VER_V0_GROUP0_hwVersion(view.head));
 
-        offs += sizeof(gr0);
         int extIx = 0;
-        UBX_MON_VER_V0_GROUP1_t gr1;
-        while (offs <= (msg->size - 2 - (int)sizeof(gr1)))
+        for (const uint8_t *ext: Ff::UbxGroups(view))
         {
-            std::memcpy(&gr1, &msg->data[offs], sizeof(gr1));
-            gr1.extension[sizeof(gr1.extension) - 1] = '\0';
-            ImGui::Text("extension[%d] = %s", extIx, gr1.extension);
+            ImGui::Text("extension[%d] = %.*s", extIx, (int)sizeof(UBX_MON_VER_V0_GROUP1_t::extension) - 1, UBX_MON_VER_V0_GROUP1_extension(ext));
             extIx++;
-            offs += sizeof(gr1);
         }
     }
     // Poll message
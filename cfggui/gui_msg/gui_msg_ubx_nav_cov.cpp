@@ -15,10 +15,10 @@
 // You should have received a copy of the GNU General Public License along with this program.
 // If not, see <https://www.gnu.org/licenses/>.
 
-#include <cstring>
 #include <cmath>
 
 #include "ff_ubx.h"
+#include "ff_ubx_view.h"
 
 #include "gui_inc.hpp"
 
@@ -36,26 +36,25 @@ GuiMsgUbxNavCov::GuiMsgUbxNavCov(std::shared_ptr<InputReceiver> receiver, std::s
 bool GuiMsgUbxNavCov::Render(const std::shared_ptr<Ff::ParserMsg> &msg, const FfVec2f &sizeAvail)
 {
     UNUSED(sizeAvail);
-    if ( (UBX_NAV_COV_VERSION_GET(msg->data) != UBX_NAV_COV_V0_VERSION) || (msg->size != UBX_NAV_COV_V0_SIZE) )
+    UBX_VIEW_t view;
+    if (!UBX_NAV_COV_V0_view(&view, msg->data, msg->size))
     {
         return false;
     }
-
-    UBX_NAV_COV_V0_GROUP0_t cov;
-    std::memcpy(&cov, &msg->data[UBX_HEAD_SIZE], sizeof(cov));
+    const uint8_t *cov = view.head;
 
     const float valuesPos[] =
     {
-        cov.posCovNN, cov.posCovNE, cov.posCovND,
-        cov.posCovNE, cov.posCovEE, cov.posCovED,
-        cov.posCovND, cov.posCovED, cov.posCovDD,
+        UBX_NAV_COV_V0_GROUP0_posCovNN(cov), UBX_NAV_COV_V0_GROUP0_posCovNE(cov), UBX_NAV_COV_V0_GROUP0_posCovND(cov),
+        UBX_NAV_COV_V0_GROUP0_posCovNE(cov), UBX_NAV_COV_V0_GROUP0_posCovEE(cov), UBX_NAV_COV_V0_GROUP0_posCovED(cov),
+        UBX_NAV_COV_V0_GROUP0_posCovND(cov), UBX_NAV_COV_V0_GROUP0_posCovED(cov), UBX_NAV_COV_V0_GROUP0_posCovDD(cov),
     };
 
     const float valuesVel[] =
     {
-        cov.velCovNN, cov.velCovNE, cov.velCovND,
-        cov.velCovNE, cov.velCovEE, cov.velCovED,
-        cov.velCovND, cov.velCovED, cov.velCovDD,
+        UBX_NAV_COV_V0_GROUP0_velCovNN(cov), UBX_NAV_COV_V0_GROUP0_velCovNE(cov), UBX_NAV_COV_V0_GROUP0_velCovND(cov),
+        UBX_NAV_COV_V0_GROUP0_velCovNE(cov), UBX_NAV_COV_V0_GROUP0_velCovEE(cov), UBX_NAV_COV_V0_GROUP0_velCovED(cov),
+        UBX_NAV_COV_V0_GROUP0_velCovND(cov), UBX_NAV_COV_V0_GROUP0_velCovED(cov), UBX_NAV_COV_V0_GROUP0_velCovDD(cov),
     };
 
     const float valuesFail[] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
@@ -80,7 +79,7 @@ bool GuiMsgUbxNavCov::Render(const std::shared_ptr<Ff::ParserMsg> &msg, const Ff
         ImPlot::SetupAxis(ImAxis_X1, nullptr, axesFlags);
         ImPlot::SetupAxis(ImAxis_Y1, nullptr, axesFlags);
         ImPlot::SetupFinish();
-        ImPlot::PlotHeatmap("heat", cov.posCovValid ? valuesPos : valuesFail, 3, 3, scaleMin, scaleMax, numFmt);
+        ImPlot::PlotHeatmap("heat", UBX_NAV_COV_V0_GROUP0_posCovValid(cov) ? valuesPos : valuesFail, 3, 3, scaleMin, scaleMax, numFmt);
         ImPlot::EndPlot();
     }
 
@@ -94,7 +93,7 @@ bool GuiMsgUbxNavCov::Render(const std::shared_ptr<Ff::ParserMsg> &msg, const Ff
         ImPlot::SetupAxis(ImAxis_X1, nullptr, axesFlags);
         ImPlot::SetupAxis(ImAxis_Y1, nullptr, axesFlags);
         ImPlot::SetupFinish();
-        ImPlot::PlotHeatmap("heat", cov.velCovValid ? valuesVel : valuesFail, 3, 3, scaleMin, scaleMax, numFmt);
+        ImPlot::PlotHeatmap("heat", UBX_NAV_COV_V0_GROUP0_velCovValid(cov) ? valuesVel : valuesFail, 3, 3, scaleMin, scaleMax, numFmt);
         ImPlot::EndPlot();
     }
 
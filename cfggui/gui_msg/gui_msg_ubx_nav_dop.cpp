@@ -15,10 +15,10 @@
 // You should have received a copy of the GNU General Public License along with this program.
 // If not, see <https://www.gnu.org/licenses/>.
 
-#include <cstring>
 #include <cmath>
 
 #include "ff_ubx.h"
+#include "ff_ubx_view.h"
 
 #include "gui_inc.hpp"
 
@@ -36,39 +36,38 @@ GuiMsgUbxNavDop::GuiMsgUbxNavDop(std::shared_ptr<InputReceiver> receiver, std::s
 
 void GuiMsgUbxNavDop::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
 {
-    if (msg->size != UBX_NAV_DOP_V0_SIZE)
+    UBX_VIEW_t view;
+    if (!UBX_NAV_DOP_V0_view(&view, msg->data, msg->size))
     {
         return;
     }
+    const uint8_t *dop = view.head;
 
-    UBX_NAV_DOP_V0_GROUP0_t dop;
-    std::memcpy(&dop, &msg->data[UBX_HEAD_SIZE], sizeof(dop));
-
-    const float gDop = dop.gDOP * UBX_NAV_DOP_V0_XDOP_SCALE;
+    const float gDop = UBX_NAV_DOP_V0_GROUP0_gDOP(dop) * UBX_NAV_DOP_V0_XDOP_SCALE;
     _gDopStr  = Ff::Sprintf("%.2f", gDop);
     _gDopFrac = std::log10(CLIP(gDop, LOG_SCALE, MAX_DOP) * (1.0/LOG_SCALE)) / MAX_LOG;
 
-    const float pDop = dop.pDOP * UBX_NAV_DOP_V0_XDOP_SCALE;
+    const float pDop = UBX_NAV_DOP_V0_GROUP0_pDOP(dop) * UBX_NAV_DOP_V0_XDOP_SCALE;
     _pDopStr  = Ff::Sprintf("%.2f", pDop);
     _pDopFrac = std::log10(CLIP(pDop, LOG_SCALE, MAX_DOP) * (1.0/LOG_SCALE)) / MAX_LOG;
 
-    const float tDop = dop.tDOP * UBX_NAV_DOP_V0_XDOP_SCALE;
+    const float tDop = UBX_NAV_DOP_V0_GROUP0_tDOP(dop) * UBX_NAV_DOP_V0_XDOP_SCALE;
     _tDopStr  = Ff::Sprintf("%.2f", tDop);
     _tDopFrac = std::log10(CLIP(tDop, LOG_SCALE, MAX_DOP) * (1.0/LOG_SCALE)) / MAX_LOG;
 
-    const float vDop = dop.vDOP * UBX_NAV_DOP_V0_XDOP_SCALE;
+    const float vDop = UBX_NAV_DOP_V0_GROUP0_vDOP(dop) * UBX_NAV_DOP_V0_XDOP_SCALE;
     _vDopStr  = Ff::Sprintf("%.2f", vDop);
     _vDopFrac = std::log10(CLIP(vDop, LOG_SCALE, MAX_DOP) * (1.0/LOG_SCALE)) / MAX_LOG;
 
-    const float hDop = dop.hDOP * UBX_NAV_DOP_V0_XDOP_SCALE;
+    const float hDop = UBX_NAV_DOP_V0_GROUP0_hDOP(dop) * UBX_NAV_DOP_V0_XDOP_SCALE;
     _hDopStr  = Ff::Sprintf("%.2f", hDop);
     _hDopFrac = std::log10(CLIP(hDop, LOG_SCALE, MAX_DOP) * (1.0/LOG_SCALE)) / MAX_LOG;
 
-    const float nDop = dop.nDOP * UBX_NAV_DOP_V0_XDOP_SCALE;
+    const float nDop = UBX_NAV_DOP_V0_GROUP0_nDOP(dop) * UBX_NAV_DOP_V0_XDOP_SCALE;
     _nDopStr  = Ff::Sprintf("%.2f", nDop);
     _nDopFrac = std::log10(CLIP(nDop, LOG_SCALE, MAX_DOP) * (1.0/LOG_SCALE)) / MAX_LOG;
 
-    const float eDop = dop.eDOP * UBX_NAV_DOP_V0_XDOP_SCALE;
+    const float eDop = UBX_NAV_DOP_V0_GROUP0_eDOP(dop) * UBX_NAV_DOP_V0_XDOP_SCALE;
     _eDopStr  = Ff::Sprintf("%.2f", eDop);
     _eDopFrac = std::log10(CLIP(eDop, LOG_SCALE, MAX_DOP) * (1.0/LOG_SCALE)) / MAX_LOG;
 }
@@ -78,14 +77,12 @@ void GuiMsgUbxNavDop::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
 bool GuiMsgUbxNavDop::Render(const std::shared_ptr<Ff::ParserMsg> &msg, const FfVec2f &sizeAvail)
 {
     UNUSED(sizeAvail);
-    if (msg->size != UBX_NAV_DOP_V0_SIZE)
+    UBX_VIEW_t view;
+    if (!UBX_NAV_DOP_V0_view(&view, msg->data, msg->size))
     {
         return false;
     }
 
-    UBX_NAV_DOP_V0_GROUP0_t dop;
-    std::memcpy(&dop, &msg->data[UBX_HEAD_SIZE], sizeof(dop));
-
     const float charWidth = GuiSettings::charSize.x;
     const float dataOffs = 16 * charWidth;
     const float width = ImGui::GetContentRegionAvail().x - dataOffs;
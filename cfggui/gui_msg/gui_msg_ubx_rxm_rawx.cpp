@@ -15,9 +15,8 @@
 // You should have received a copy of the GNU General Public License along with this program.
 // If not, see <https://www.gnu.org/licenses/>.
 
-#include <cstring>
-
 #include "ff_ubx.h"
+#include "ff_ubx_view.h"
 
 #include "gui_inc.hpp"
 
@@ -51,35 +50,41 @@ void GuiMsgUbxRxmRawx::Clear()
 
 GuiMsgUbxRxmRawx::RawInfo::RawInfo(const uint8_t *groupData)
 {
-    UBX_RXM_RAWX_V1_GROUP1_t meas;
-    std::memcpy(&meas, groupData, sizeof(meas));
+    const uint8_t gnssId  = UBX_RXM_RAWX_V1_GROUP1_gnssId(groupData);
+    const uint8_t svId    = UBX_RXM_RAWX_V1_GROUP1_svId(groupData);
+    const uint8_t sigId   = UBX_RXM_RAWX_V1_GROUP1_sigId(groupData);
+    const uint8_t freqId  = UBX_RXM_RAWX_V1_GROUP1_freqId(groupData);
+    const uint8_t trkStat = UBX_RXM_RAWX_V1_GROUP1_trkStat(groupData);
 
-    uid = ((uint32_t)meas.gnssId << 24) |
-          ((uint32_t)meas.svId   << 16) |
-          ((uint32_t)meas.freqId <<  8) |
-           (uint32_t)meas.sigId;
+    uid = ((uint32_t)gnssId << 24) |
+          ((uint32_t)svId   << 16) |
+          ((uint32_t)freqId <<  8) |
+           (uint32_t)sigId;
 
-    prValid    = CHKBITS(meas.trkStat, UBX_RXM_RAWX_V1_TRKSTAT_PRVALID);
-    cpValid    = CHKBITS(meas.trkStat, UBX_RXM_RAWX_V1_TRKSTAT_CPVALID);
-    halfCyc    = CHKBITS(meas.trkStat, UBX_RXM_RAWX_V1_TRKSTAT_HALFCYC);
-    subHalfCyc = CHKBITS(meas.trkStat, UBX_RXM_RAWX_V1_TRKSTAT_SUBHALFCYC);
+    prValid    = CHKBITS(trkStat, UBX_RXM_RAWX_V1_TRKSTAT_PRVALID);
+    cpValid    = CHKBITS(trkStat, UBX_RXM_RAWX_V1_TRKSTAT_CPVALID);
+    halfCyc    = CHKBITS(trkStat, UBX_RXM_RAWX_V1_TRKSTAT_HALFCYC);
+    subHalfCyc = CHKBITS(trkStat, UBX_RXM_RAWX_V1_TRKSTAT_SUBHALFCYC);
 
-    sv = Ff::Sprintf("%s##%p", ubxSvStr(meas.gnssId, meas.svId), groupData);
+    sv = Ff::Sprintf("%s##%p", ubxSvStr(gnssId, svId), groupData);
 
-    if (meas.gnssId == UBX_GNSSID_GLO)
+    if (gnssId == UBX_GNSSID_GLO)
     {
-        signal = Ff::Sprintf("%s (%+d)", ubxSigStr(meas.gnssId, meas.sigId), (int)meas.freqId - 7);
+        signal = Ff::Sprintf("%s (%+d)", ubxSigStr(gnssId, sigId), (int)freqId - 7);
     }
     else
     {
-        signal = ubxSigStr(meas.gnssId, meas.sigId);
+        signal = ubxSigStr(gnssId, sigId);
     }
 
-    cno = Ff::Sprintf("%u", meas.cno);
-    pseudoRange = Ff::Sprintf("%.2f %6.2f", meas.prMeas, UBX_RXM_RAWX_V1_PRSTD_SCALE(UBX_RXM_RAWX_V1_PRSTDEV_PRSTD_GET(meas.prStdev)));
-    carrierPhase = Ff::Sprintf("%.2f %6.3f", meas.cpMeas, UBX_RXM_RAWX_V1_CPSTD_SCALE(UBX_RXM_RAWX_V1_CPSTDEV_CPSTD_GET(meas.cpStdev)));
-    doppler = Ff::Sprintf("%.1f %6.3f", meas.doMeas, UBX_RXM_RAWX_V1_DOSTD_SCALE(UBX_RXM_RAWX_V1_DOSTDEV_DOSTD_GET(meas.doStdev)));
-    lockTime = Ff::Sprintf("%.3f", (double)meas.locktime * UBX_RXM_RAWX_V1_LOCKTIME_SCALE);
+    cno = Ff::Sprintf("%u", UBX_RXM_RAWX_V1_GROUP1_cno(groupData));
+    pseudoRange = Ff::Sprintf("%.2f %6.2f", UBX_RXM_RAWX_V1_GROUP1_prMeas(groupData),
+        UBX_RXM_RAWX_V1_PRSTD_SCALE(UBX_RXM_RAWX_V1_PRSTDEV_PRSTD_GET(UBX_RXM_RAWX_V1_GROUP1_prStdev(groupData))));
+    carrierPhase = Ff::Sprintf("%.2f %6.3f", UBX_RXM_RAWX_V1_GROUP1_cpMeas(groupData),
+        UBX_RXM_RAWX_V1_CPSTD_SCALE(UBX_RXM_RAWX_V1_CPSTDEV_CPSTD_GET(UBX_RXM_RAWX_V1_GROUP1_cpStdev(groupData))));
+    doppler = Ff::Sprintf("%.1f %6.3f", UBX_RXM_RAWX_V1_GROUP1_doMeas(groupData),
+        UBX_RXM_RAWX_V1_DOSTD_SCALE(UBX_RXM_RAWX_V1_DOSTDEV_DOSTD_GET(UBX_RXM_RAWX_V1_GROUP1_doStdev(groupData))));
+    lockTime = Ff::Sprintf("%.3f", (double)UBX_RXM_RAWX_V1_GROUP1_locktime(groupData) * UBX_RXM_RAWX_V1_LOCKTIME_SCALE);
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -87,26 +92,24 @@ GuiMsgUbxRxmRawx::RawInfo::RawInfo(const uint8_t *groupData)
 void GuiMsgUbxRxmRawx::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
 {
     Clear();
-    if ( (UBX_RXM_RAWX_VERSION_GET(msg->data) != UBX_RXM_RAWX_V1_VERSION) || (UBX_RXM_RAWX_V1_SIZE(msg->data) != msg->size) )
+    UBX_VIEW_t view;
+    if (!UBX_RXM_RAWX_V1_view(&view, msg->data, msg->size))
     {
         return;
     }
 
-    UBX_RXM_RAWX_V1_GROUP0_t rawx;
-    std::memcpy(&rawx, &msg->data[UBX_HEAD_SIZE], sizeof(rawx));
-
     _valid  = true;
 
-    _week         = rawx.week;
-    _rcvTow       = rawx.rcvTow;
-    _leapSec      = rawx.leapS;
-    _leapSecValid = CHKBITS(rawx.recStat, UBX_RXM_RAWX_V1_RECSTAT_LEAPSEC);
-    _clkReset     = CHKBITS(rawx.recStat, UBX_RXM_RAWX_V1_RECSTAT_CLKRESET);
+    const uint8_t recStat = UBX_RXM_RAWX_V1_GROUP0_recStat(view.head);
+    _week         = UBX_RXM_RAWX_V1_GROUP0_week(view.head);
+    _rcvTow       = UBX_RXM_RAWX_V1_GROUP0_rcvTow(view.head);
+    _leapSec      = UBX_RXM_RAWX_V1_GROUP0_leapS(view.head);
+    _leapSecValid = CHKBITS(recStat, UBX_RXM_RAWX_V1_RECSTAT_LEAPSEC);
+    _clkReset     = CHKBITS(recStat, UBX_RXM_RAWX_V1_RECSTAT_CLKRESET);
 
-    for (int measIx = 0, offs = UBX_HEAD_SIZE + (int)sizeof(UBX_RXM_RAWX_V1_GROUP0_t); measIx < (int)rawx.numMeas;
-            measIx++, offs += (int)sizeof(UBX_RXM_RAWX_V1_GROUP1_t))
+    for (const uint8_t *meas: Ff::UbxGroups(view))
     {
-        _rawInfos.emplace_back(RawInfo(&msg->data[offs]));
+        _rawInfos.emplace_back(RawInfo(meas));
     }
 
     std::sort(_rawInfos.begin(), _rawInfos.end(), [](const RawInfo &a, const RawInfo &b) { return a.uid < b.uid; });
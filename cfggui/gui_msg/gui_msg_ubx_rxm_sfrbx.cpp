@@ -15,9 +15,8 @@
 // You should have received a copy of the GNU General Public License along with this program.
 // If not, see <https://www.gnu.org/licenses/>.
 
-#include <cstring>
-
 #include "ff_ubx.h"
+#include "ff_ubx_view.h"
 
 #include "gui_inc.hpp"
 
@@ -53,17 +52,17 @@ GuiMsgUbxRxmSfrbx::SfrbxInfo::SfrbxInfo(
 
 void GuiMsgUbxRxmSfrbx::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
 {
-    if ( (msg->size >= UBX_RXM_SFRBX_V2_MIN_SIZE) && (UBX_RXM_SFRBX_VERSION_GET(msg->data) == UBX_RXM_SFRBX_V2_VERSION) )
+    UBX_VIEW_t view;
+    if (UBX_RXM_SFRBX_V2_view(&view, msg->data, msg->size))
     {
-        UBX_RXM_SFRBX_V2_GROUP0_t sfrbx;
-        std::memcpy(&sfrbx, &msg->data[UBX_HEAD_SIZE], sizeof(sfrbx));
+        const uint8_t *sfrbx = view.head;
 
         // UID for this entry, also the std::map sort
         const uint32_t uid =
-            ((uint32_t)sfrbx.gnssId  << 24) |
-            ((uint32_t)sfrbx.svId    << 16) |
-            ((uint32_t)sfrbx.freqId  <<  8) |
-             (uint32_t)sfrbx.sigId;
+            ((uint32_t)UBX_RXM_SFRBX_V2_GROUP0_gnssId(sfrbx)  << 24) |
+            ((uint32_t)UBX_RXM_SFRBX_V2_GROUP0_svId(sfrbx)    << 16) |
+            ((uint32_t)UBX_RXM_SFRBX_V2_GROUP0_freqId(sfrbx)  <<  8) |
+             (uint32_t)UBX_RXM_SFRBX_V2_GROUP0_sigId(sfrbx);
 
         SfrbxInfo *info = nullptr;
         auto entry = _sfrbxInfos.find(uid);
@@ -73,18 +72,18 @@ void GuiMsgUbxRxmSfrbx::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
         }
         else
         {
-            auto foo = _sfrbxInfos.insert({ uid, SfrbxInfo(sfrbx.gnssId, sfrbx.svId, sfrbx.sigId, sfrbx.freqId) });
+            auto foo = _sfrbxInfos.insert({ uid, SfrbxInfo(UBX_RXM_SFRBX_V2_GROUP0_gnssId(sfrbx), UBX_RXM_SFRBX_V2_GROUP0_svId(sfrbx), UBX_RXM_SFRBX_V2_GROUP0_sigId(sfrbx), UBX_RXM_SFRBX_V2_GROUP0_freqId(sfrbx)) });
             info = &foo.first->second;
             info->uid = uid;
         }
 
-        const uint32_t *dwrds = (uint32_t *)&msg->data[UBX_HEAD_SIZE + sizeof(sfrbx)];
-        info->dwrds.assign(dwrds, &dwrds[sfrbx.numWords]);
-
+        info->dwrds.clear();
         info->dwrdsHex.clear();
-        for (int ix = 0; ix < sfrbx.numWords; ix++)
+        for (const uint8_t *grp: Ff::UbxGroups(view))
         {
-            info->dwrdsHex += Ff::Sprintf("%08x ", dwrds[ix]);
+            const uint32_t dwrd = UBX_RXM_SFRBX_V2_GROUP1_dwrd(grp);
+            info->dwrds.push_back(dwrd);
+            info->dwrdsHex += Ff::Sprintf("%08x ", dwrd);
         }
 
         char str[200];
@@ -15,9 +15,8 @@
 // You should have received a copy of the GNU General Public License along with this program.
 // If not, see <https://www.gnu.org/licenses/>.
 
-#include <cstring>
-
 #include "ff_ubx.h"
+#include "ff_ubx_view.h"
 #include "ff_spartn.h"
 
 #include "gui_inc.hpp"
@@ -66,15 +65,15 @@ void GuiMsgUbxRxmSpartn::Clear()
 
 void GuiMsgUbxRxmSpartn::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
 {
-    if ( (msg->size == UBX_RXM_SPARTN_V1_SIZE) && (UBX_RXM_RTCM_VERSION_GET(msg->data) == UBX_RXM_SPARTN_V1_VERSION) )
+    UBX_VIEW_t view;
+    if (UBX_RXM_SPARTN_V1_view(&view, msg->data, msg->size))
     {
-        UBX_RXM_SPARTN_V1_GROUP0_t rtcm;
-        std::memcpy(&rtcm, &msg->data[UBX_HEAD_SIZE], sizeof(rtcm));
+        const uint8_t *rtcm = view.head;
 
         // UID for this entry, also the std::map sort
         const uint32_t uid =
-            ((uint32_t)rtcm.subType) |
-             (uint32_t)rtcm.msgType << 12;
+            ((uint32_t)UBX_RXM_SPARTN_V1_GROUP0_subType(rtcm)) |
+             (uint32_t)UBX_RXM_SPARTN_V1_GROUP0_msgType(rtcm) << 12;
 
         SpartnInfo *info = nullptr;
         auto entry = _spartnInfos.find(uid);
@@ -84,20 +83,20 @@ void GuiMsgUbxRxmSpartn::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
         }
         else
         {
-            auto foo = _spartnInfos.insert({ uid, SpartnInfo(rtcm.msgType, rtcm.subType) });
+            auto foo = _spartnInfos.insert({ uid, SpartnInfo(UBX_RXM_SPARTN_V1_GROUP0_msgType(rtcm), UBX_RXM_SPARTN_V1_GROUP0_subType(rtcm)) });
             info = &foo.first->second;
             info->uid = uid;
         }
 
         // Update statistics
-        // const bool crcFailed = CHKBITS(rtcm.flags, UBX_RXM_SPARTN_V1_FLAGS_CRCFAILED);
+        // const bool crcFailed = CHKBITS(UBX_RXM_SPARTN_V1_GROUP0_flags(rtcm), UBX_RXM_SPARTN_V1_FLAGS_CRCFAILED);
         // if (crcFailed)
         // {
         //     info->nCrcFailed++;
         // }
         // else
         {
-            switch (UBX_RXM_SPARTN_V1_FLAGS_MSGUSED_GET(rtcm.flags))
+            switch (UBX_RXM_SPARTN_V1_FLAGS_MSGUSED_GET(UBX_RXM_SPARTN_V1_GROUP0_flags(rtcm)))
             {
                 case UBX_RXM_SPARTN_V1_FLAGS_MSGUSED_UNUSED:  info->nUnused++;  break;
                 case UBX_RXM_SPARTN_V1_FLAGS_MSGUSED_USED:    info->nUsed++;    break;
@@ -15,13 +15,13 @@
 // You should have received a copy of the GNU General Public License along with this program.
 // If not, see <https://www.gnu.org/licenses/>.
 
-#include <cstring>
 #include <cmath>
 #include <algorithm>
 
 #include "implot.h"
 
 #include "ff_ubx.h"
+#include "ff_ubx_view.h"
 
 #include "gui_inc.hpp"
 
@@ -55,18 +55,19 @@ void GuiMsgUbxTimTm2::Clear()
 
 void GuiMsgUbxTimTm2::Update(const std::shared_ptr<Ff::ParserMsg> &msg)
 {
-    if (msg->size != UBX_TIM_TM2_V0_SIZE)
+    UBX_VIEW_t view;
+    if (!UBX_TIM_TM2_V0_view(&view, msg->data, msg->size))
     {
         return;
     }
 
-    UBX_TIM_TM2_V0_GROUP0_t tm2;
-    std::memcpy(&tm2, &msg->data[UBX_HEAD_SIZE], sizeof(tm2));
+    const uint8_t *tm2 = view.head;
+    const uint8_t flags = UBX_TIM_TM2_V0_GROUP0_flags(tm2);
 
-    const bool   newRisingEdge  = CHKBITS(tm2.flags, UBX_TIM_TM2_V0_FLAGS_NEWRISINGEDGE);
-    const bool   newFallingEdge = CHKBITS(tm2.flags, UBX_TIM_TM2_V0_FLAGS_NEWFALLINGEDGE);
-    const double towRisingEdge  = ((double)tm2.towMsR * UBX_TIM_TM2_V0_TOW_SCALE) + ((double)tm2.towSubMsR * UBX_TIM_TM2_V0_SUBMS_SCALE);
-    const double towFallingEdge = ((double)tm2.towMsF * UBX_TIM_TM2_V0_TOW_SCALE) + ((double)tm2.towSubMsF * UBX_TIM_TM2_V0_SUBMS_SCALE);
+    const bool   newRisingEdge  = CHKBITS(flags, UBX_TIM_TM2_V0_FLAGS_NEWRISINGEDGE);
+    const bool   newFallingEdge = CHKBITS(flags, UBX_TIM_TM2_V0_FLAGS_NEWFALLINGEDGE);
+    const double towRisingEdge  = ((double)UBX_TIM_TM2_V0_GROUP0_towMsR(tm2) * UBX_TIM_TM2_V0_TOW_SCALE) + ((double)UBX_TIM_TM2_V0_GROUP0_towSubMsR(tm2) * UBX_TIM_TM2_V0_SUBMS_SCALE);
+    const double towFallingEdge = ((double)UBX_TIM_TM2_V0_GROUP0_towMsF(tm2) * UBX_TIM_TM2_V0_TOW_SCALE) + ((double)UBX_TIM_TM2_V0_GROUP0_towSubMsF(tm2) * UBX_TIM_TM2_V0_SUBMS_SCALE);
 
     if (newRisingEdge)
     {
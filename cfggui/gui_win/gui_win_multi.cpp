@@ -18,6 +18,7 @@
 #include <algorithm>
 
 #include "gui_inc.hpp"
+#include "gui_notify.hpp"
 
 #include "gui_win_multi.hpp"
 
@@ -25,26 +26,40 @@
 
 GuiWinMulti::GuiWinMulti(const std::string &name) :
     GuiWin(name),
-    _guiDataSerial { 0 }
+    _guiDataSerial { 0 },
+    _align         { NULL },
+    _outTime       { NAN }
 {
     _winSize = { 70, 30 };
     DEBUG("GuiWinMulti(%s)", _winName.c_str());
 
     _map.SetSettings( GuiSettings::GetValue(_winName + ".map") );
+    GuiSettings::GetValue(_winName + ".toleranceMs", _toleranceMs, 10.0f);
 }
 
 GuiWinMulti::~GuiWinMulti()
 {
     DEBUG("~GuiWinMulti(%s)", _winName.c_str());
     GuiSettings::SetValue( _winName + ".map", _map.GetSettings() );
+    GuiSettings::SetValue( _winName + ".toleranceMs", _toleranceMs);
+    if (_align != NULL)
+    {
+        alignFree(_align);
+    }
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
 
 void GuiWinMulti::_Clear(const bool refresh)
 {
-    _points.clear();
-    _pointKeys.clear();
+    _tuples.clear();
+    _sources.clear();
+    _outTime = NAN;
+    if (_align != NULL)
+    {
+        alignFree(_align);
+        _align = NULL;
+    }
     if (refresh)
     {
         _guiDataSerial = 0;
@@ -106,47 +121,176 @@ void GuiWinMulti::Loop(const uint32_t &frame, const double &now)
         }
     }
 
-    if (changed)
+    if (changed || (_align == NULL))
     {
-        _Clear();
+        _Update();
+    }
 
-        // All databases
-        GuiData::DatabaseList databases;
-        for (auto &receiver: _usedReceivers)
-        {
-            databases.push_back(receiver->GetDatabase());
-        }
-        for (auto &logfile: _usedLogfiles)
+    // Tuples waiting for missing sources are output once the late window expired
+    _GetTuples();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void GuiWinMulti::_Update()
+{
+    // All databases (_DrawControls() doesn't allow enabling more than ALIGN_MAX_SOURCES)
+    GuiData::DatabaseList databases;
+    for (auto &receiver: _usedReceivers)
+    {
+        databases.push_back(receiver->GetDatabase());
+    }
+    for (auto &logfile: _usedLogfiles)
+    {
+        databases.push_back(logfile->GetDatabase());
+    }
+    if (databases.size() > ALIGN_MAX_SOURCES)
+    {
+        databases.resize(ALIGN_MAX_SOURCES);
+    }
+
+    // Start over if the sources changed, or if a database was cleared or went back in time (e.g. seek in logfile)
+    bool restart = (_align == NULL) || (_sources.size() != databases.size());
+    for (std::size_t ix = 0; !restart && (ix < databases.size()); ix++)
+    {
+        const auto &source = _sources[ix];
+        const double latest = source.database->LatestRow().time_posix;
+        if ( (source.database != databases[ix]) || (source.database->Size() < source.size) ||
+             (!std::isnan(source.lastTime) && (latest < source.lastTime)) )
         {
-            databases.push_back(logfile->GetDatabase());
+            restart = true;
         }
+    }
 
-        // Collect all points, index by timestamp with some tolerance
-        for (auto &database: databases)
+    // Collect the new points (that have a time) of each database
+    struct TimePoint
+    {
+        TimePoint(const double _time, const Point &_point) : time { _time }, point { _point } {}
+        double time;
+        Point  point;
+    };
+    std::vector< std::vector<TimePoint> > newPoints;
+    auto collect = [&]()
+    {
+        newPoints.assign(_sources.size(), std::vector<TimePoint>());
+        double minTime = NAN;
+        for (std::size_t ix = 0; ix < _sources.size(); ix++)
         {
-            database->ProcRows([&](const Database::Row &row)
+            auto &source = _sources[ix];
+            auto &points = newPoints[ix];
+            source.database->ProcRows([&](const Database::Row &row)
             {
-                if (row.pos_avail)
+                if (!std::isnan(source.lastTime) && (row.time_posix <= source.lastTime))
+                {
+                    return false;
+                }
+                if (row.pos_avail && !std::isnan(row.time_posix))
                 {
-                    const uint64_t key = std::isnan(row.time_posix) ? 0 : (uint64_t)((row.time_posix * 1e2) + 0.5) * 10;
-                    auto entry = _points.find(key);
-                    if (entry == _points.end())
-                    {
-                        auto iter = _points.emplace(key, std::vector<Point>());
-                        entry = iter.first;
-                    }
-                    entry->second.emplace_back(row.pos_llh_lat, row.pos_llh_lon, row.fix_colour);
+                    points.emplace_back(row.time_posix, Point(row.pos_llh_lat, row.pos_llh_lon, row.fix_colour));
                 }
                 return true;
-            }, false);
+            }, true);
+            source.size = source.database->Size();
+            std::reverse(points.begin(), points.end());
+            std::stable_sort(points.begin(), points.end(),
+                [](const TimePoint &a, const TimePoint &b) { return a.time < b.time; });
+            if (!points.empty())
+            {
+                source.lastTime = points.back().time;
+                if (std::isnan(minTime) || (points.front().time < minTime))
+                {
+                    minTime = points.front().time;
+                }
+            }
+        }
+        return minTime;
+    };
+
+    if (!restart)
+    {
+        // Points older than the tuples output already would be dropped by the aligner
+        const double minTime = collect();
+        if (!std::isnan(minTime) && !std::isnan(_outTime) && (minTime <= (_outTime + (_toleranceMs * 1e-3))))
+        {
+            restart = true;
+        }
+    }
+    if (restart)
+    {
+        _Clear();
+        if (databases.empty())
+        {
+            return;
+        }
+        const ALIGN_CFG_t alignCfg =
+        {
+            .numSources   = (int)databases.size(),
+            .itemSize     = sizeof(Point),
+            .numSlots     = ALIGN_NUM_SLOTS_DEFAULT,
+            .tolerance    = _toleranceMs * 1e-3,
+            .lateWindowNs = 1000000000,
+        };
+        _align = alignInit(&alignCfg);
+        if (_align == NULL)
+        {
+            return;
         }
+        for (auto &database: databases)
+        {
+            _sources.emplace_back(database);
+        }
+        collect();
+    }
 
-        // Ordered list of all keys (timestamps)
-        for (auto &entry: _points)
+    // Feed new points in time order to the aligner and collect the time-aligned tuples
+    const uint64_t nowNs = TIME_NS();
+    std::vector<std::size_t> heads(newPoints.size(), 0);
+    while (true)
+    {
+        int source = -1;
+        for (int ix = 0; ix < (int)newPoints.size(); ix++)
         {
-            _pointKeys.push_back(entry.first);
+            if ( (heads[ix] < newPoints[ix].size()) && ( (source < 0) ||
+                    (newPoints[ix][heads[ix]].time < newPoints[source][heads[source]].time) ) )
+            {
+                source = ix;
+            }
         }
-        std::sort(_pointKeys.begin(), _pointKeys.end(), [](const uint64_t a, const uint64_t b){ return a < b; });
+        if (source < 0)
+        {
+            break;
+        }
+        const auto &tp = newPoints[source][heads[source]++];
+        alignAdd(_align, source, tp.time, &tp.point, nowNs);
+        _GetTuples();
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void GuiWinMulti::_GetTuples()
+{
+    if (_align == NULL)
+    {
+        return;
+    }
+    const uint64_t nowNs = TIME_NS();
+    const ALIGN_TUPLE_t *tuple = NULL;
+    while ( (tuple = alignGet(_align, nowNs)) != NULL )
+    {
+        _tuples.emplace_back();
+        for (int ix = 0; ix < (int)_sources.size(); ix++)
+        {
+            if (tuple->items[ix] != NULL)
+            {
+                _tuples.back().push_back(*static_cast<const Point *>(tuple->items[ix]));
+            }
+        }
+        _outTime = tuple->time;
+    }
+    while ((int)_tuples.size() > GuiSettings::dbNumRows)
+    {
+        _tuples.pop_front();
     }
 }
 
@@ -213,11 +357,11 @@ void GuiWinMulti::_DrawControls()
             ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(0,0)); // smaller radio and checkbox
             if (ImGui::Checkbox(receiver->GetName().c_str(), &enabled))
             {
-                if (enabled)
+                if (enabled && _CanAddSource())
                 {
                     _usedReceivers.push_back(receiver);
                 }
-                else
+                else if (!enabled)
                 {
                     _usedReceivers.erase(iter);
                     _Clear();
@@ -241,11 +385,11 @@ void GuiWinMulti::_DrawControls()
             ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(0,0)); // smaller radio and checkbox
             if (ImGui::Checkbox(logfile->GetName().c_str(), &enabled))
             {
-                if (enabled)
+                if (enabled && _CanAddSource())
                 {
                     _usedLogfiles.push_back(logfile);
                 }
-                else
+                else if (!enabled)
                 {
                     _usedLogfiles.erase(iter);
                     _Clear();
@@ -358,6 +502,18 @@ void GuiWinMulti::_DrawControls()
             }
         }
         ImGui::EndDisabled();
+
+        ImGui::Separator();
+        ImGui::AlignTextToFramePadding();
+        ImGui::TextUnformatted("Tolerance");
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(-1);
+        if (ImGui::InputFloat("##Tolerance", &_toleranceMs, 0.0f, 0.0f, "%.0f ms", ImGuiInputTextFlags_EnterReturnsTrue))
+        {
+            _toleranceMs = CLIP(_toleranceMs, 0.0f, 500.0f);
+            _Clear();
+        }
+        Gui::ItemTooltip("Maximum time difference of the positions of a tuple");
     }
 
     ImGui::EndChild();
@@ -365,6 +521,18 @@ void GuiWinMulti::_DrawControls()
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+bool GuiWinMulti::_CanAddSource()
+{
+    if ((_usedReceivers.size() + _usedLogfiles.size()) < ALIGN_MAX_SOURCES)
+    {
+        return true;
+    }
+    GuiNotify::Warning("Multiview", Ff::Sprintf("Cannot use more than %d sources", ALIGN_MAX_SOURCES));
+    return false;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 void GuiWinMulti::_DrawMap()
 {
     if (!_map.BeginDraw())
@@ -373,9 +541,8 @@ void GuiWinMulti::_DrawMap()
     }
 
     ImDrawList *draw = ImGui::GetWindowDrawList();
-    for (const auto key: _pointKeys)
+    for (const auto &points: _tuples)
     {
-        const auto &points = _points[key];
         for (auto iter = points.cbegin(); iter != points.cend(); iter++)
         {
             const auto &point = *iter;
@@ -22,8 +22,10 @@
 #include <deque>
 #include <memory>
 #include <vector>
-#include <unordered_map>
 #include <cstdint>
+#include <cmath>
+
+#include "ff_align.h"
 
 #include "gui_win.hpp"
 #include "gui_data.hpp"
@@ -61,10 +63,27 @@ class GuiWinMulti : public GuiWin
             ImU32  colour;
         };
 
-        std::unordered_map<uint64_t, std::vector<Point>> _points;
-        std::vector<uint64_t> _pointKeys;
+        std::deque< std::vector<Point> > _tuples; // Time-aligned points, in time order
+
+        // Points are fed to the aligner incrementally, as new rows show up in the databases
+        struct Source
+        {
+            Source(std::shared_ptr<Database> _database) :
+                database { _database }, size { 0 }, lastTime { NAN }
+            {}
+            std::shared_ptr<Database> database;
+            int                       size;     // Number of rows in the database when last fed
+            double                    lastTime; // Time of the last point fed, NAN if none
+        };
+        std::vector<Source> _sources;
+        ALIGN_t            *_align;
+        double              _outTime;   // Time of the last tuple output, NAN if none
+        float               _toleranceMs;
 
         void _Clear(const bool refresh = false);
+        void _Update();
+        void _GetTuples();
+        bool _CanAddSource();
         void _DrawControls();
         void _DrawMap();
 };
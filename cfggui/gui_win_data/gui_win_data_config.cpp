@@ -20,6 +20,7 @@
 
 #include "ff_ubx.h"
 #include "ff_cpp.hpp"
+#include "platform.hpp"
 
 #include "gui_inc.hpp"
 #include "gui_notify.hpp"
@@ -50,7 +51,9 @@ GuiWinDataConfig::GuiWinDataConfig(const std::string &name, std::shared_ptr<Data
     _dbItemOrder{DB_ORDER_BY_NAME}, _dbShowUnknown{false},
     _chValueRef{REF_DEFAULT}, _dbItemDispCount{},
     _dbFilterWidget{kDbItemsFilterHelp}, _dbFilterUpdate{false},
-    _cfgSaveFileDialog{_winName + "SaveCfgFileDialog"}
+    _cfgSaveFileDialog{_winName + "SaveCfgFileDialog"},
+    _snapSaveFileDialog{_winName + "SaveSnapFileDialog"},
+    _snapLoadFileDialog{_winName + "LoadSnapFileDialog"}
 {
     _winSize = { 155, 40 };
 
@@ -204,9 +207,15 @@ void GuiWinDataConfig::_DbSet(const Ff::KeyVal &keyval)
     }
     if (layerIx != -1)
     {
+        // Stringify all values at once, which is much faster than one by one
+        // (fall back to doing it one by one if that fails)
+        std::vector<const char *> strs(keyval.kv.size(), NULL);
+        char *strsBuf = ubloxcfg_stringifyValues(keyval.kv.data(), keyval.kv.size(), strs.data());
+
         // Process all key-value pairs in the response and store to the database
-        for (auto &kv: keyval.kv)
+        for (std::size_t kvIx = 0; kvIx < keyval.kv.size(); kvIx++)
         {
+            const auto &kv = keyval.kv[kvIx];
             // Create/add new item
             auto dbitem = _DbGetItem(kv.id);
             if (dbitem == _dbItems.end())
@@ -216,7 +225,11 @@ void GuiWinDataConfig::_DbSet(const Ff::KeyVal &keyval)
                 dbitem = _dbItems.end() - 1;
             }
             // Store key-value for this layer
-            dbitem->SetValue(kv.val, static_cast<enum DbItemLayer_e>(layerIx));
+            dbitem->SetValue(kv.val, static_cast<enum DbItemLayer_e>(layerIx), strs[kvIx]);
+        }
+        if (strsBuf != NULL)
+        {
+            std::free(strsBuf);
         }
 
         _DbSync();
@@ -238,6 +251,11 @@ void GuiWinDataConfig::_DbSet(const Ff::KeyVal &keyval)
 
 void GuiWinDataConfig::_ProcessData(const InputData &data)
 {
+    if (data.type == InputData::RXVERSTR)
+    {
+        _rxVerStr = data.info;
+    }
+
     if (_dbPollState == POLL_WAIT)
     {
         // Handle timeout
@@ -323,14 +341,18 @@ GuiWinDataConfig::DbItem::DbItem(const uint32_t _id) :
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-void GuiWinDataConfig::DbItem::SetValue(const UBLOXCFG_VALUE_t &val, const enum DbItemLayer_e layerIx)
+void GuiWinDataConfig::DbItem::SetValue(const UBLOXCFG_VALUE_t &val, const enum DbItemLayer_e layerIx, const char *str)
 {
     if ( (layerIx >= IX_RAM) && (layerIx < NUM_LAYERS) )
     {
-        char str[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
-        if (!ubloxcfg_stringifyValue(str, sizeof(str), type, defitem, &val))
+        char tmp[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
+        if (str == NULL)
         {
-            std::strcpy(str, "wtf?!");
+            if (!ubloxcfg_stringifyValue(tmp, sizeof(tmp), type, defitem, &val))
+            {
+                std::strcpy(tmp, "wtf?!");
+            }
+            str = tmp;
         }
         values[layerIx].val   = val;
         values[layerIx].str   = str;
@@ -1082,6 +1104,53 @@ bool GuiWinDataConfig::_DrawControls()
         ImGui::EndDisabled();
     }
 
+    ImGui::SameLine();
+
+    // Save snapshot
+    {
+        const bool disable = !_dbPollDataAvail;
+        ImGui::BeginDisabled(disable);
+        if (ImGui::Button(ICON_FK_CAMERA "##SaveSnap", GuiSettings::iconSize))
+        {
+            if (!_snapSaveFileDialog.IsInit())
+            {
+                _snapSaveFileDialog.InitDialog(GuiWinFileDialog::FILE_SAVE);
+                _snapSaveFileDialog.SetFilename( Ff::Strftime("config_%Y%m%d_%H%M.snap") );
+                _snapSaveFileDialog.WinSetTitle(_winTitle + " - Save snapshot...");
+                _snapSaveFileDialog.SetFileFilter("\\.(snap)", true);
+            }
+            else
+            {
+                _snapSaveFileDialog.WinFocus();
+            }
+        }
+        Gui::ItemTooltip("Save snapshot of current configuration (RAM layer)");
+        ImGui::EndDisabled();
+    }
+
+    ImGui::SameLine();
+
+    // Load snapshot
+    {
+        const bool disable = (_dbSetState != SET_IDLE);
+        ImGui::BeginDisabled(disable);
+        if (ImGui::Button(ICON_FK_FOLDER_OPEN "##LoadSnap", GuiSettings::iconSize))
+        {
+            if (!_snapLoadFileDialog.IsInit())
+            {
+                _snapLoadFileDialog.InitDialog(GuiWinFileDialog::FILE_OPEN);
+                _snapLoadFileDialog.WinSetTitle(_winTitle + " - Load snapshot...");
+                _snapLoadFileDialog.SetFileFilter("\\.(snap)", true);
+            }
+            else
+            {
+                _snapLoadFileDialog.WinFocus();
+            }
+        }
+        Gui::ItemTooltip("Load snapshot into configuration changes");
+        ImGui::EndDisabled();
+    }
+
     Gui::VerticalSeparator();
 
     // Clear everything
@@ -1184,11 +1253,111 @@ bool GuiWinDataConfig::_DrawControls()
         }
     }
 
+    // Handle snapshots
+    if (_snapSaveFileDialog.IsInit() && _snapSaveFileDialog.DrawDialog())
+    {
+        _SaveSnapshot(_snapSaveFileDialog.GetPath());
+    }
+    if (_snapLoadFileDialog.IsInit() && _snapLoadFileDialog.DrawDialog())
+    {
+        if (_LoadSnapshot(_snapLoadFileDialog.GetPath()))
+        {
+            somethingChanged = true;
+        }
+    }
+
     return somethingChanged;
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+void GuiWinDataConfig::_SaveSnapshot(const std::string &path)
+{
+    // Current configuration (RAM layer), sorted by ID
+    std::vector<UBLOXCFG_KEYVAL_t> kv;
+    for (const auto &dbitem: _dbItems)
+    {
+        if (dbitem.values[IX_RAM].valid)
+        {
+            UBLOXCFG_KEYVAL_t keyval;
+            keyval.id = dbitem.id;
+            keyval.val._raw = dbitem.values[IX_RAM].val._raw;
+            kv.push_back(keyval);
+        }
+    }
+    std::sort(kv.begin(), kv.end(),
+        [](const UBLOXCFG_KEYVAL_t &a, const UBLOXCFG_KEYVAL_t &b) { return a.id < b.id; });
+
+    UBLOXCFG_SNAPSHOT_t info;
+    std::memset(&info, 0, sizeof(info));
+    info.haveLayer = true;
+    info.layer = UBLOXCFG_LAYER_RAM;
+    std::snprintf(info.rxInfo, sizeof(info.rxInfo), "%s", _rxVerStr.c_str());
+
+    std::vector<uint8_t> data(UBLOXCFG_SNAPSHOT_MAX_SIZE(kv.size()));
+    int size = 0;
+    if (!ubloxcfg_makeSnapshot(data.data(), (int)data.size(), &info, kv.data(), (int)kv.size(), &size))
+    {
+        ERROR("Failed making snapshot!");
+        GuiNotify::Error("Failed making snapshot", path);
+    }
+    else if (Platform::FileSpew(path, data.data(), size))
+    {
+        PRINT("Snapshot (%d items) written to %s", (int)kv.size(), path.c_str());
+        GuiNotify::Success("Snapshot written", path);
+    }
+    else
+    {
+        GuiNotify::Error("Failed writing snapshot", std::strerror(errno));
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool GuiWinDataConfig::_LoadSnapshot(const std::string &path)
+{
+    std::ifstream in(path, std::ifstream::binary);
+    const std::vector<uint8_t> data { std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>() };
+    if (!in.good() && !in.eof())
+    {
+        ERROR("Failed reading %s: %s", path.c_str(), std::strerror(errno));
+        GuiNotify::Error("Failed reading snapshot", std::strerror(errno));
+        return false;
+    }
+
+    UBLOXCFG_SNAPSHOT_t info;
+    std::vector<UBLOXCFG_KEYVAL_t> kv;
+    int nKv = 0;
+    if (ubloxcfg_parseSnapshot(data.data(), (int)data.size(), &info, NULL, 0, NULL))
+    {
+        kv.resize(info.nKeyVal);
+    }
+    if (!ubloxcfg_parseSnapshot(data.data(), (int)data.size(), &info, kv.data(), (int)kv.size(), &nKv))
+    {
+        ERROR("Bad snapshot %s", path.c_str());
+        GuiNotify::Error("Bad snapshot", path);
+        return false;
+    }
+
+    // Apply values to changes, ignore items this receiver doesn't have
+    int nApplied = 0;
+    for (int ix = 0; ix < nKv; ix++)
+    {
+        auto dbitem = _DbGetItem(kv[ix].id);
+        if ( (dbitem != _dbItems.end()) && dbitem->valueValid )
+        {
+            dbitem->chValue._raw = kv[ix].val._raw;
+            dbitem->ChSync();
+            nApplied++;
+        }
+    }
+    PRINT("Snapshot %s: %d items, %d applied", path.c_str(), nKv, nApplied);
+    GuiNotify::Success("Snapshot loaded", Ff::Sprintf("%d of %d items applied", nApplied, nKv));
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 void GuiWinDataConfig::_DrawDb()
 {
     // TODO: Switch this to the new ImGui table API, once it's available..
@@ -90,7 +90,7 @@ class GuiWinDataConfig : public GuiWinData
             Value                  values[NUM_LAYERS];
             bool                   valueChanged; //!< One or more values changed?
             bool                   valueValid;   //!< One or more values valid (available)? Implies: available on this receiver
-            void                   SetValue(const UBLOXCFG_VALUE_t &val, const enum DbItemLayer_e layerIx);
+            void                   SetValue(const UBLOXCFG_VALUE_t &val, const enum DbItemLayer_e layerIx, const char *str = NULL); //!< str: stringified value (or NULL)
             void                   ClearValues();//!< Clear (invalidate) all values
             void                   _SyncValues(); //!< Update (filterString, changed flags)
 
@@ -148,6 +148,11 @@ class GuiWinDataConfig : public GuiWinData
         void                 _UpdateChanges();
 
         GuiWinFileDialog     _cfgSaveFileDialog;
+        GuiWinFileDialog     _snapSaveFileDialog;
+        GuiWinFileDialog     _snapLoadFileDialog;
+        std::string          _rxVerStr;          //!< Receiver version, for snapshot info
+        void                 _SaveSnapshot(const std::string &path);
+        bool                 _LoadSnapshot(const std::string &path);
 
         // Draw window
         bool                 _DrawControls();
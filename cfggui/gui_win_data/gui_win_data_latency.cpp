@@ -0,0 +1,170 @@
+/* ************************************************************************************************/ // clang-format off
+// flipflip's cfggui
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <cstring>
+
+#include "gui_inc.hpp"
+
+#include "gui_win_data_latency.hpp"
+
+/* ****************************************************************************************************************** */
+
+GuiWinDataLatency::GuiWinDataLatency(const std::string &name, std::shared_ptr<Database> database) :
+    GuiWinData(name, database),
+    _tabbar  { WinName(), ImGuiTabBarFlags_FittingPolicyResizeDown | ImGuiTabBarFlags_TabListPopupButton },
+    _latency { std::make_unique<LATENCY_t>() }
+{
+    _winSize = { 100, 25 };
+    _latestEpochEna = false;
+
+    latencyInit(_latency.get());
+
+    _table.AddColumn("Stage / message");
+    _table.AddColumn("Count", 0.0f, GuiWidgetTable::ALIGN_RIGHT);
+    _table.AddColumn("Min",   0.0f, GuiWidgetTable::ALIGN_RIGHT);
+    _table.AddColumn("Mean",  0.0f, GuiWidgetTable::ALIGN_RIGHT);
+    _table.AddColumn("P50",   0.0f, GuiWidgetTable::ALIGN_RIGHT);
+    _table.AddColumn("P90",   0.0f, GuiWidgetTable::ALIGN_RIGHT);
+    _table.AddColumn("P99",   0.0f, GuiWidgetTable::ALIGN_RIGHT);
+    _table.AddColumn("P99.9", 0.0f, GuiWidgetTable::ALIGN_RIGHT);
+    _table.AddColumn("Max",   0.0f, GuiWidgetTable::ALIGN_RIGHT);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void GuiWinDataLatency::_ProcessData(const InputData &data)
+{
+    // Latency statistics are updated with every epoch
+    if ( (data.type == InputData::DATA_EPOCH) && _receiver )
+    {
+        _receiver->GetLatency(*_latency);
+        _table.ClearRows();
+
+        for (int ix = 0; ix < LATENCY_NUM_STAGES; ix++)
+        {
+            _AddRow(latencyStageName((LATENCY_STAGE_t)ix), &_latency->stages[ix]);
+            _table.SetRowUid(ix + 1);
+            _table.SetRowSort(ix);
+        }
+        for (int ix = 0; ix < _latency->numMsgs; ix++)
+        {
+            _AddRow(_latency->msgs[ix].name, &_latency->msgs[ix].hist);
+            _table.SetRowUid(LATENCY_NUM_STAGES + ix + 1);
+            _table.SetRowSort(LATENCY_NUM_STAGES + ix);
+        }
+    }
+}
+
+void GuiWinDataLatency::_AddRow(const char *name, const LATHIST_t *hist)
+{
+    _table.AddCellText(name);
+    _table.AddCellTextF("%u", hist->count);
+    _table.AddCellTextF("%.3f", (double)hist->min * 1e-6);
+    _table.AddCellTextF("%.3f", hist->count > 0 ? hist->sum / (double)hist->count * 1e-6 : 0.0);
+    _table.AddCellTextF("%.3f", (double)latHistPercentile(hist, 50.0) * 1e-6);
+    _table.AddCellTextF("%.3f", (double)latHistPercentile(hist, 90.0) * 1e-6);
+    _table.AddCellTextF("%.3f", (double)latHistPercentile(hist, 99.0) * 1e-6);
+    _table.AddCellTextF("%.3f", (double)latHistPercentile(hist, 99.9) * 1e-6);
+    _table.AddCellTextF("%.3f", (double)hist->max * 1e-6);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void GuiWinDataLatency::_ClearData()
+{
+    _table.ClearRows();
+    if (_latency)
+    {
+        latencyInit(_latency.get());
+    }
+    if (_receiver)
+    {
+        _receiver->ClearLatency();
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void GuiWinDataLatency::_DrawContent()
+{
+    if (!_receiver)
+    {
+        ImGui::TextUnformatted("Latency statistics are only available for receivers");
+        return;
+    }
+
+    bool drawTable = false;
+    bool drawPlot = false;
+    if (_tabbar.Begin())
+    {
+        if (_tabbar.Item("Statistics [ms]"))
+        {
+            drawTable = true;
+        }
+        if (_tabbar.Item("Histograms"))
+        {
+            drawPlot = true;
+        }
+        _tabbar.End();
+    }
+    if (drawTable)
+    {
+        _table.DrawTable();
+    }
+    if (drawPlot)
+    {
+        _DrawHistogramPlot();
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void GuiWinDataLatency::_DrawHistogramPlot()
+{
+    if (ImPlot::BeginPlot("##Latency", ImVec2(-1,-1), ImPlotFlags_Crosshairs | ImPlotFlags_NoMenus | ImPlotFlags_NoFrame))
+    {
+        ImPlot::SetupAxis(ImAxis_X1, "Latency [ms]", ImPlotAxisFlags_NoHighlight);
+        ImPlot::SetupAxis(ImAxis_Y1, "Fraction [%]", ImPlotAxisFlags_NoHighlight | ImPlotAxisFlags_AutoFit);
+        ImPlot::SetupAxisScale(ImAxis_X1, ImPlotScale_Log10);
+        ImPlot::SetupFinish();
+
+        // Per stage the fraction of values in each bucket from min to max, plotted at the bucket's lower bound
+        for (int stage = 0; stage < LATENCY_NUM_STAGES; stage++)
+        {
+            const LATHIST_t *hist = &_latency->stages[stage];
+            if (hist->count == 0)
+            {
+                continue;
+            }
+            std::vector<double> xs;
+            std::vector<double> ys;
+            const int ix0 = latHistBucketIx(hist->min);
+            const int ix1 = latHistBucketIx(hist->max);
+            for (int ix = ix0; ix <= ix1; ix++)
+            {
+                const uint64_t lo = ix > 0 ? latHistBucketMax(ix - 1) + 1 : 0;
+                xs.push_back(std::max((double)lo * 1e-6, 1e-6));
+                ys.push_back((double)hist->counts[ix] / (double)hist->count * 1e2);
+            }
+            ImPlot::PlotStairs(latencyStageName((LATENCY_STAGE_t)stage), xs.data(), ys.data(), xs.size());
+        }
+
+        ImPlot::EndPlot();
+    }
+}
+
+/* ****************************************************************************************************************** */
@@ -0,0 +1,51 @@
+/* ************************************************************************************************/ // clang-format off
+// flipflip's cfggui
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef __GUI_WIN_DATA_LATENCY_HPP__
+#define __GUI_WIN_DATA_LATENCY_HPP__
+
+#include <memory>
+
+#include "ff_latency.h"
+
+#include "gui_win_data.hpp"
+#include "gui_widget_table.hpp"
+#include "gui_widget_tabbar.hpp"
+
+/* ***** Latency statistics ***************************************************************************************** */
+
+class GuiWinDataLatency : public GuiWinData
+{
+    public:
+        GuiWinDataLatency(const std::string &name, std::shared_ptr<Database> database);
+
+    private:
+
+        void _ProcessData(const InputData &data) final;
+        void _DrawContent() final;
+        void _ClearData() final;
+
+        GuiWidgetTabbar _tabbar;
+        GuiWidgetTable _table;
+        std::unique_ptr<LATENCY_t> _latency;
+
+        void _AddRow(const char *name, const LATHIST_t *hist);
+        void _DrawHistogramPlot();
+};
+
+/* ****************************************************************************************************************** */
+#endif // __GUI_WIN_DATA_LATENCY_HPP__
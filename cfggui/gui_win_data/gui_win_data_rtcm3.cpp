@@ -0,0 +1,171 @@
+/* ************************************************************************************************/ // clang-format off
+// flipflip's cfggui
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <cstring>
+
+#include "ff_rtcm3.h"
+#include "ff_time.h"
+
+#include "gui_inc.hpp"
+
+#include "gui_win_data_rtcm3.hpp"
+
+/* ****************************************************************************************************************** */
+
+GuiWinDataRtcm3::GuiWinDataRtcm3(const std::string &name, std::shared_ptr<Database> database) :
+    GuiWinData(name, database),
+    _stats { std::make_unique<RTCM3_STATS_t>() },
+    _dirty { false }
+{
+    _winSize = { 120, 25 };
+    _latestEpochEna = false;
+
+    rtcm3StatsInit(_stats.get());
+
+    _table.AddColumn("Message");
+    _table.AddColumn("Ref");
+    _table.AddColumn("Count",    0.0f, GuiWidgetTable::ALIGN_RIGHT);
+    _table.AddColumn("Rate",     0.0f, GuiWidgetTable::ALIGN_RIGHT);
+    _table.AddColumn("Bytes/s",  0.0f, GuiWidgetTable::ALIGN_RIGHT);
+    _table.AddColumn("Interval", 0.0f, GuiWidgetTable::ALIGN_RIGHT);
+    _table.AddColumn("Jitter",   0.0f, GuiWidgetTable::ALIGN_RIGHT);
+    _table.AddColumn("Period",   0.0f, GuiWidgetTable::ALIGN_RIGHT);
+    _table.AddColumn("Gaps",     0.0f, GuiWidgetTable::ALIGN_RIGHT);
+    _table.AddColumn("Missing",  0.0f, GuiWidgetTable::ALIGN_RIGHT);
+    _table.AddColumn("Age",      0.0f, GuiWidgetTable::ALIGN_RIGHT);
+    _table.AddColumn("Age range", 0.0f, GuiWidgetTable::ALIGN_RIGHT);
+    _table.AddColumn("Sat/sig");
+    _table.AddColumn("Desc");
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void GuiWinDataRtcm3::_ProcessData(const InputData &data)
+{
+    if ( (data.type == InputData::DATA_MSG) && (data.msg->type == Ff::ParserMsg::RTCM3) )
+    {
+        PARSER_MSG_t msg;
+        std::memset(&msg, 0, sizeof(msg));
+        msg.type = PARSER_MSGTYPE_RTCM3;
+        msg.data = data.msg->data;
+        msg.size = data.msg->size;
+
+        // Arrival times are only meaningful for live data, for logfiles use the epoch times of the messages
+        if (_receiver)
+        {
+            rtcm3StatsAdd(_stats.get(), &msg, data.msg->tsNs, posixNow());
+        }
+        else
+        {
+            rtcm3StatsAdd(_stats.get(), &msg, 0, 0.0);
+        }
+        _dirty = true;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void GuiWinDataRtcm3::_UpdateTable()
+{
+    _table.ClearRows();
+    for (int ix = 0; ix < _stats->numTypes; ix++)
+    {
+        const RTCM3_STATS_TYPE_t *type = &_stats->types[ix];
+        char name[20];
+        rtcm3StatsName(type, name, sizeof(name));
+        _table.AddCellText(name);
+        _table.SetRowUid(ix + 1);
+        if (type->refStaId >= 0)
+        {
+            _table.AddCellTextF("%d", type->refStaId);
+        }
+        else
+        {
+            _table.AddCellEmpty();
+        }
+        _table.AddCellTextF("%u", type->count);
+        _table.AddCellTextF("%.2f", rtcm3StatsRate(type));
+        _table.AddCellTextF("%.0f", rtcm3StatsByteRate(type));
+        _table.AddCellTextF("%.3f", type->interval);
+        _table.AddCellTextF("%.3f", type->jitter);
+        if (type->haveTime)
+        {
+            _table.AddCellTextF("%.3f", type->period);
+        }
+        else
+        {
+            _table.AddCellEmpty();
+        }
+        _table.AddCellTextF("%u", type->numGaps);
+        if (type->numGaps > 0)
+        {
+            _table.SetCellColour(GUI_COLOUR(TEXT_WARNING));
+        }
+        _table.AddCellTextF("%u", type->numMissing);
+        if (type->numAge > 0)
+        {
+            _table.AddCellTextF("%.3f", type->ageLast);
+            _table.AddCellTextF("%.3f..%.3f", type->ageMin, type->ageMax);
+        }
+        else
+        {
+            _table.AddCellEmpty();
+            _table.AddCellEmpty();
+        }
+        if (type->numCell > 0)
+        {
+            _table.AddCellTextF("%d/%d", type->numSat, type->numSig);
+        }
+        else
+        {
+            _table.AddCellEmpty();
+        }
+        const char *desc = rtcm3TypeDesc(type->msgType, type->subType);
+        _table.AddCellText(desc != NULL ? desc : "Unknown RTCM3 message");
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void GuiWinDataRtcm3::_ClearData()
+{
+    _table.ClearRows();
+    if (_stats)
+    {
+        rtcm3StatsInit(_stats.get());
+    }
+    _dirty = false;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void GuiWinDataRtcm3::_DrawContent()
+{
+    // Update the table at most once per frame
+    if (_dirty)
+    {
+        _UpdateTable();
+        _dirty = false;
+    }
+
+    ImGui::Text("Messages: %u, bytes: %llu, dropped: %u", _stats->count, (unsigned long long)_stats->bytes, _stats->numDropped);
+    ImGui::Separator();
+
+    _table.DrawTable();
+}
+
+/* ****************************************************************************************************************** */
@@ -40,6 +40,8 @@
 #include "gui_win_data_custom.hpp"
 #include "gui_win_data_epoch.hpp"
 #include "gui_win_data_3d.hpp"
+#include "gui_win_data_latency.hpp"
+#include "gui_win_data_rtcm3.hpp"
 
 #include "gui_win_input.hpp"
 
@@ -305,6 +307,8 @@ void GuiWinInput::DataWinMenu()
     { "Fwupdate",   "Firmware update", ICON_FK_DOWNLOAD       "##Fwupdate",   DataWinDef::Cap_e::ACTIVE, _MK_CREATE(GuiWinDataFwupdate)   },
     { "Custom",     "Custom message",  ICON_FK_TERMINAL       "##Custom",     DataWinDef::Cap_e::ALL,    _MK_CREATE(GuiWinDataCustom)     },
     { "Threed",     "3d view",         ICON_FK_SPINNER        "##3dView",     DataWinDef::Cap_e::ALL,    _MK_CREATE(GuiWinData3d)     },
+    { "Latency",    "Latency",         ICON_FK_CLOCK_O        "##Latency",    DataWinDef::Cap_e::ACTIVE, _MK_CREATE(GuiWinDataLatency) },
+    { "Rtcm3",      "RTCM3 stats",     ICON_FK_TACHOMETER     "##Rtcm3",      DataWinDef::Cap_e::ALL,    _MK_CREATE(GuiWinDataRtcm3)   },
 };
 
 void GuiWinInput::_DrawDataWinButtons()
@@ -130,7 +130,7 @@ void GuiWinInputLogfile::_DrawControls()
             {
                 _fileDialog.InitDialog(GuiWinFileDialog::FILE_OPEN);
                 _fileDialog.WinSetTitle(_winTitle + " - Open logfile...");
-                _fileDialog.SetFileFilter("\\.(ubx|raw|ubz|ubx\\.gz)", true);
+                _fileDialog.SetFileFilter("\\.(ubx|raw|ubz|ubt|ubx\\.gz|ubt\\.gz)", true);
             }
             else
             {
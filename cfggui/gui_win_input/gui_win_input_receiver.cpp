@@ -147,7 +147,7 @@ void GuiWinInputReceiver::_ProcessData(const InputData &data)
         case InputData::DATA_MSG:
             if (_recordLog.IsOpen())
             {
-                if (_recordLog.Write(data.msg->data, data.msg->size))
+                if (_recordLog.Write(data.msg->data, data.msg->size, data.msg->tsNs))
                 {
                     _recordSize += data.msg->size;
                 }
@@ -283,16 +283,16 @@ void GuiWinInputReceiver::_DrawActionButtons()
                 auto &io = ImGui::GetIO();
                 _recordFilePath = "";
                 _recordFileDialog.InitDialog(GuiWinFileDialog::FILE_SAVE);
-                _recordFileDialog.SetFilename( Ff::Strftime("log_%Y%m%d_%H%M") + (io.KeyCtrl ? ".ubx.gz" : ".ubx") );
+                _recordFileDialog.SetFilename( Ff::Strftime("log_%Y%m%d_%H%M") + (io.KeyShift ? ".ubt" : ".ubx") + (io.KeyCtrl ? ".gz" : "") );
                 _recordFileDialog.WinSetTitle(_winTitle + " - Record logfile...");
-                _recordFileDialog.SetFileFilter("\\.(ubx|raw|ubz|ubx\\.gz)", true);
+                _recordFileDialog.SetFileFilter("\\.(ubx|raw|ubz|ubt|ubx\\.gz|ubt\\.gz)", true);
             }
             else
             {
                 _recordFileDialog.WinFocus();
             }
         }
-        Gui::ItemTooltip("Record logfile\n(CTRL+click for compressed file)");
+        Gui::ItemTooltip("Record logfile\n(CTRL+click for compressed file,\nSHIFT+click for timestamped file)");
     }
     else
     {
@@ -413,14 +413,14 @@ void InputLogfile::_Thread(Ff::Thread *thread)
 {
     PARSER_t parser;
     PARSER_MSG_t msg;
-    EPOCH_t coll;
-    EPOCH_t epoch;
+    EPOCH_COLLECTOR_t collector;
     bool stepEpoch = false;
     bool stepMsg = false;
     std::string stepMsgName = "";
+    uint64_t lastEpochMono = 0;
 
     parserInit(&parser);
-    epochInit(&coll);
+    epochCollectorInit(&collector, EPOCH_FLAGS_NONE);
 
     while (!thread->ShouldAbort())
     {
@@ -454,6 +454,7 @@ void InputLogfile::_Thread(Ff::Thread *thread)
                     _playPos = 0;
                     _playPosRel = 0.0;
                     parserInit(&parser);
+                    lastEpochMono = 0;
                     _playState = STOPPED;
                     break;
                 case LogfileCommand::PAUSE:
@@ -502,6 +503,7 @@ void InputLogfile::_Thread(Ff::Thread *thread)
                     }
                     _logfile.Seek(_playPos);
                     parserInit(&parser);
+                    lastEpochMono = 0;
                     break;
                 }
             }
@@ -525,13 +527,14 @@ void InputLogfile::_Thread(Ff::Thread *thread)
             msg.src = PARSER_MSGSRC_LOG;
 
             // Collect epochs
-            if (epochCollect(&coll, &msg, &epoch))
+            const EPOCH_t *epoch = epochCollectorAdd(&collector, &msg);
+            if (epoch != NULL)
             {
                 // Update database
-                _inputDatabase->AddEpoch(epoch);
+                _inputDatabase->AddEpoch(*epoch);
 
                 // Send epoch
-                _SEND_EVENT(LogfileEventEpoch, &epoch);
+                _SEND_EVENT(LogfileEventEpoch, epoch);
 
                 // Pause now if we stepped here
                 if (stepEpoch)
@@ -542,13 +545,25 @@ void InputLogfile::_Thread(Ff::Thread *thread)
                     break;
                 }
 
-                // Throttle playback
+                // Throttle playback, using the recorded arrival time of the data if available
+                double epochPeriod = 1000.0;
+                uint64_t epochMono = 0;
+                uint64_t epochWall = 0;
+                if (_logfile.GetReadTime(epochMono, epochWall))
+                {
+                    if ( (lastEpochMono != 0) && (epochMono >= lastEpochMono) )
+                    {
+                        epochPeriod = CLIP((double)(epochMono - lastEpochMono) * 1e-6, 0.0, EPOCH_PERIOD_MAX);
+                    }
+                    lastEpochMono = epochMono;
+                }
                 if ( (_playSpeed > 0.0) && !stepMsg && !stepEpoch )
                 {
-                    thread->Sleep(1000.0 / _playSpeed);
+                    thread->Sleep(epochPeriod / _playSpeed);
 
                     // Message timestamp is no longer valid after sleeping
                     msg.ts = TIME();
+                    msg.tsNs = TIME_NS();
                 }
             }
 
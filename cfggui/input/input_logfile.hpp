@@ -85,6 +85,7 @@ class InputLogfile : public Input
         Logfile                        _logfile;
 
         static constexpr uint32_t      EVENT_QUEUE_MAX_SIZE = 1000; // FIXME: ??
+        static constexpr double        EPOCH_PERIOD_MAX = 5000.0; // [ms] max. replay delay between epochs of timestamped logs
         void _ThreadPrepare() final;
         void _Thread(Ff::Thread *thread) final;
         void _ThreadCleanup() final;
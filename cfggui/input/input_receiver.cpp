@@ -155,9 +155,11 @@ InputReceiver::InputReceiver(const std::string &name, std::shared_ptr<Database>
     Input(name, database),
     _state                 { IDLE },
     _baudrate              { 0 },
+    _latency               { std::make_unique<LATENCY_t>() },
     _eventQueueSaturation  { false }
 {
     DEBUG("InputReceiver(%s)", _inputName.c_str());
+    latencyInit(_latency.get());
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -287,6 +289,20 @@ void InputReceiver::Reset(const RX_RESET_t reset)
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+void InputReceiver::GetLatency(LATENCY_t &latency)
+{
+    std::lock_guard<std::mutex> lock(_latencyMutex);
+    std::memcpy(&latency, _latency.get(), sizeof(latency));
+}
+
+void InputReceiver::ClearLatency()
+{
+    std::lock_guard<std::mutex> lock(_latencyMutex);
+    latencyInit(_latency.get());
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 void InputReceiver::Loop(const double &now)
 {
     (void)now;
@@ -344,6 +360,10 @@ void InputReceiver::Loop(const double &now)
             case ReceiverEvent::EPOCH:
             {
                 auto e = static_cast<ReceiverEventEpoch *>( event.get() );
+                {
+                    std::lock_guard<std::mutex> lock(_latencyMutex);
+                    latencyAddOutput(_latency.get(), &e->epoch.epoch, TIME_NS());
+                }
                 _CallDataCb( InputData(std::move(e->epoch)) );
                 break;
             }
@@ -422,9 +442,8 @@ void InputReceiver::_ThreadCleanup()
 
 void InputReceiver::_Thread(Ff::Thread *thread)
 {
-    EPOCH_t coll;
-    EPOCH_t epoch;
-    epochInit(&coll);
+    EPOCH_COLLECTOR_t collector;
+    epochCollectorInit(&collector, EPOCH_FLAGS_NONE);
 
     // Open connection to receiver, abort thread if that fails..
     {
@@ -486,14 +505,35 @@ void InputReceiver::_Thread(Ff::Thread *thread)
             PARSER_MSG_t *msg = rxGetNextMessage(_rx->rx);
             if (msg == NULL)
             {
+                // Complete the epoch if the receiver went quiet (for example, the last message of the epoch was lost)
+                const EPOCH_t *epoch = epochCollectorTimeout(&collector, TIME_NS(), EPOCH_TIMEOUT_NS_DEFAULT);
+                if (epoch != NULL)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(_latencyMutex);
+                        latencyAddEpoch(_latency.get(), epoch);
+                    }
+                    _inputDatabase->AddEpoch(*epoch);
+                    _SendEvent(std::make_unique<ReceiverEventEpoch>(epoch));
+                }
                 break;
             }
+            const uint64_t msgNs = TIME_NS();
             lastMsg = std::chrono::steady_clock::now();
             msg->seq = ++_msgSeq;
-            if (epochCollect(&coll, msg, &epoch))
+            const EPOCH_t *epoch = epochCollectorAdd(&collector, msg);
+            {
+                std::lock_guard<std::mutex> lock(_latencyMutex);
+                latencyAddMsg(_latency.get(), msg, msgNs);
+                if (epoch != NULL)
+                {
+                    latencyAddEpoch(_latency.get(), epoch);
+                }
+            }
+            if (epoch != NULL)
             {
-                _inputDatabase->AddEpoch(epoch);
-                _SendEvent(std::make_unique<ReceiverEventEpoch>(&epoch));
+                _inputDatabase->AddEpoch(*epoch);
+                _SendEvent(std::make_unique<ReceiverEventEpoch>(epoch));
             }
             _SEND_EVENT(ReceiverEventMsg, msg);
 
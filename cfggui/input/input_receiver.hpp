@@ -28,6 +28,7 @@
 
 #include "ubloxcfg.h"
 #include "ff_parser.h"
+#include "ff_latency.h"
 #include "ff_cpp.hpp"
 
 #include "input.hpp"
@@ -58,6 +59,8 @@ class InputReceiver : public Input
         void SetConfig(const bool ram, const bool bbr, const bool flash, const bool apply, const std::vector<UBLOXCFG_KEYVAL_t> &keys, SetConfigCb_t cb = nullptr);
         void SetBaudrate(const int baudrate);
         int GetBaudrate();
+        void GetLatency(LATENCY_t &latency); // Get copy of latency statistics
+        void ClearLatency();
 
         void Loop(const double &now) final;
 
@@ -78,6 +81,8 @@ class InputReceiver : public Input
         std::atomic<int>     _baudrate;
         std::string          _port;
         std::unique_ptr<Ff::Rx> _rx;
+        std::unique_ptr<LATENCY_t> _latency;
+        std::mutex           _latencyMutex;
 
         GetConfigCb_t _getConfigCb;
         SetConfigCb_t _setConfigCb;
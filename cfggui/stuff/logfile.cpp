@@ -18,6 +18,7 @@
 #include <cstring>
 #include <cerrno>
 #include <fstream>
+#include <algorithm>
 
 #include "zfstream.hpp"
 
@@ -47,6 +48,13 @@ void Logfile::_Clear()
     _out    = nullptr;
     _isOpen = false;
     _size   = 0;
+    _isCompressed  = false;
+    _isTimestamped = false;
+    _pending.clear();
+    _tsDec  = nullptr;
+    tslogEncInit(&_tsEnc);
+    std::memset(&_tsRec, 0, sizeof(_tsRec));
+    _tsRecOffs = 0;
     _path.clear();
     _errorStr = "No file opened!";
 }
@@ -85,6 +93,19 @@ bool Logfile::_IsCompressed(const std::string &path)
     return (path.size() > 4) && ((path.substr(path.size() - 4) == ".ubz") || (path.substr(path.size() - 3) == ".gz"));
 }
 
+bool Logfile::_IsTimestamped(const std::string &path)
+{
+    return ((path.size() > 4) && (path.substr(path.size() - 4) == ".ubt")) ||
+           ((path.size() > 7) && (path.substr(path.size() - 7) == ".ubt.gz"));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool Logfile::IsTimestamped()
+{
+    return _isTimestamped;
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 
 bool Logfile::OpenRead(const std::string &path)
@@ -121,6 +142,22 @@ bool Logfile::OpenRead(const std::string &path)
 
     _size = Platform::FileSize(path);
 
+    // Detect timestamped logfile, for normal logfiles keep the data for the first Read()
+    uint8_t head[TSLOG_MAGIC_SIZE];
+    _in->read((char *)head, sizeof(head));
+    const int num = _in->gcount();
+    if (tslogDetect(head, num))
+    {
+        DEBUG("Logfile::OpenRead(%s) timestamped", path.c_str());
+        _isTimestamped = true;
+        _tsDec = std::make_unique<TSLOG_DEC_t>();
+        tslogDecInit(_tsDec.get());
+    }
+    else
+    {
+        _pending.assign(head, head + num);
+    }
+
     return true;
 }
 
@@ -157,6 +194,7 @@ bool Logfile::OpenWrite(const std::string &path)
 
     _isOpen = true;
     _path = path;
+    _isTimestamped = _IsTimestamped(path);
 
     return true;
 }
@@ -170,12 +208,43 @@ const std::string &Logfile::Path()
 // ---------------------------------------------------------------------------------------------------------------------
 
 bool Logfile::Write(const uint8_t *data, const uint64_t size)
+{
+    return Write(data, size, TIME_NS());
+}
+
+bool Logfile::Write(const uint8_t *data, const uint64_t size, const uint64_t mono)
 {
     if (!_isOpen || !_out || !data)
     {
         return false;
     }
 
+    if (_isTimestamped)
+    {
+        // Wall-clock time of the data, from the current offset between the two clocks
+        uint64_t nowMono;
+        uint64_t nowWall;
+        tslogTime(&nowMono, &nowWall);
+        const uint64_t wall = nowWall - (nowMono - mono);
+        uint64_t offs = 0;
+        while (offs < size)
+        {
+            const int chunkSize = std::min(size - offs, (uint64_t)TSLOG_MAX_DATA_SIZE);
+            uint8_t head[TSLOG_MAX_ENC_SIZE];
+            const int headSize = tslogEncode(&_tsEnc, head, chunkSize, mono, wall);
+            _out->write((const char *)head, headSize);
+            _out->write((const char *)&data[offs], chunkSize);
+            if (_out->fail())
+            {
+                _errorStr = std::strerror(errno);
+                return false;
+            }
+            offs  += chunkSize;
+            _size += headSize + chunkSize;
+        }
+        return true;
+    }
+
     _out->write((const char *)data, size);
     if (_out->fail())
     {
@@ -199,14 +268,75 @@ uint64_t Logfile::Read(uint8_t *data, const uint64_t size)
     {
         return 0;
     }
+    else if (_isTimestamped)
+    {
+        return _ReadTimestamped(data, size);
+    }
     else
     {
-        _in->read((char *)data, size);
-        return _in->gcount();
+        uint64_t num = 0;
+        if (!_pending.empty())
+        {
+            num = std::min(size, (uint64_t)_pending.size());
+            std::memcpy(data, _pending.data(), num);
+            _pending.erase(_pending.begin(), _pending.begin() + num);
+            if (num >= size)
+            {
+                return num;
+            }
+        }
+        _in->read((char *)&data[num], size - num);
+        return num + _in->gcount();
         //return _in->readsome((char *)data, size); // doesn't work for compressed logs
     }
 }
 
+uint64_t Logfile::_ReadTimestamped(uint8_t *data, const uint64_t size)
+{
+    // Get next record
+    while (_tsRecOffs >= _tsRec.size)
+    {
+        if (tslogDecProcess(_tsDec.get(), &_tsRec))
+        {
+            _tsRecOffs = 0;
+            break;
+        }
+        uint8_t buf[TSLOG_MAX_DATA_SIZE];
+        _in->read((char *)buf, sizeof(buf));
+        const int num = _in->gcount();
+        if (num <= 0)
+        {
+            return 0;
+        }
+        // This shouldn't happen (see TSLOG_DEC_BUF_SIZE), but if it does, drop the stuck data and resync
+        if (!tslogDecAdd(_tsDec.get(), buf, num))
+        {
+            WARNING("Logfile: timestamped log decoder overflow, data lost");
+            tslogDecResync(_tsDec.get());
+            tslogDecAdd(_tsDec.get(), buf, num);
+        }
+    }
+
+    // Return (remaining) data of the record
+    const uint64_t num = std::min(size, (uint64_t)(_tsRec.size - _tsRecOffs));
+    std::memcpy(data, &_tsRec.data[_tsRecOffs], num);
+    _tsRecOffs += num;
+    return num;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool Logfile::GetReadTime(uint64_t &mono, uint64_t &wall)
+{
+    if (!_isOpen || !_isTimestamped || (_tsRec.data == NULL))
+    {
+        return false;
+    }
+    mono = _tsRec.mono;
+    wall = _tsRec.wall;
+    return true;
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 
 bool Logfile::CanSeek()
@@ -232,6 +362,14 @@ void Logfile::Seek(const uint64_t pos)
         {
             WARNING("seek %lu fail: %s", pos, std::strerror(errno));
         }
+        _pending.clear();
+        if (_isTimestamped)
+        {
+            // Skip data until the next SYNC record
+            tslogDecResync(_tsDec.get());
+            std::memset(&_tsRec, 0, sizeof(_tsRec));
+            _tsRecOffs = 0;
+        }
     }
 }
 
@@ -24,6 +24,8 @@
 #include <vector>
 #include <cstdint>
 
+#include "ff_tslog.h"
+
 /* ****************************************************************************************************************** */
 
 class Logfile
@@ -38,9 +40,12 @@ class Logfile
         uint64_t Size();
         void     Seek(const uint64_t pos);
         bool     CanSeek();
+        bool     IsTimestamped();
+        bool     GetReadTime(uint64_t &mono, uint64_t &wall); // arrival time [ns] of data last returned by Read()
 
-        bool     OpenWrite(const std::string &path);
+        bool     OpenWrite(const std::string &path); // *.ubt[.gz] files are written timestamped
         bool     Write(const uint8_t *data, const uint64_t size);
+        bool     Write(const uint8_t *data, const uint64_t size, const uint64_t mono); // mono = arrival time [ns] (TIME_NS())
         bool     Write(const std::vector<uint8_t> data);
 
         bool     Close();
@@ -59,8 +64,16 @@ class Logfile
         std::string    _errorStr;
         uint64_t       _size;
         bool           _isCompressed;
+        bool           _isTimestamped;
+        std::vector<uint8_t>         _pending;  // data peeked from non-timestamped file
+        std::unique_ptr<TSLOG_DEC_t> _tsDec;
+        TSLOG_ENC_t    _tsEnc;
+        TSLOG_REC_t    _tsRec;
+        int            _tsRecOffs;
 
         bool _IsCompressed(const std::string &path);
+        bool _IsTimestamped(const std::string &path);
+        uint64_t _ReadTimestamped(uint8_t *data, const uint64_t size);
         void _Clear();
 };
 
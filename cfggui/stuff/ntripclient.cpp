@@ -399,6 +399,7 @@ PARSER_MSG_t NtripClient::_MakeGga()
         .size = 0,
         .seq  = 0,
         .ts   = TIME(),
+        .tsNs = TIME_NS(),
         .src  = PARSER_MSGSRC_TO_RX,
         .name = "NMEA-GN-GGA",
         .info = _ggaInfo,
@@ -25,6 +25,8 @@
 
 #include "ff_debug.h"
 #include "ff_stuff.h"
+#include "ff_trace.h"
+#include "ff_rx.h"
 
 #include "cfgtool_util.h"
 #include "cfgtool_cfg2ubx.h"
@@ -37,6 +39,7 @@
 #include "cfgtool_reset.h"
 #include "cfgtool_status.h"
 #include "cfgtool_bin2hex.h"
+#include "cfgtool_snap.h"
 #include "config.h"
 
 /* ****************************************************************************************************************** */
@@ -55,6 +58,7 @@ typedef struct CMD_s
     bool          may_n;
     bool          may_e;
     bool          may_u;
+    bool          may_j;
     const char   *info;
     const char *(*help)(void);
     int         (*run)(void);
@@ -73,6 +77,9 @@ typedef struct ARGS_s
     bool         outOverwrite;
 
     const char  *rxPort;
+    const char  *rxPorts[100];
+    int          numRxPorts;
+    const char  *numWorkers;
     const char  *cfgLayer;
     const char  *resetType;
     bool         useUnknown;
@@ -81,6 +88,7 @@ typedef struct ARGS_s
     bool         noProbe;
     bool         doEpoch;
     bool         updateOnly;
+    const char  *traceName;
 
 } ARGS_t;
 
@@ -88,7 +96,7 @@ static ARGS_t gArgs;
 
 static int rx2cfg(void)  { return rx2cfgRun( gArgs.rxPort, gArgs.cfgLayer, gArgs.useUnknown); }
 static int rx2list(void) { return rx2listRun(gArgs.rxPort, gArgs.cfgLayer, gArgs.useUnknown); }
-static int cfg2rx(void)  { return cfg2rxRun( gArgs.rxPort, gArgs.cfgLayer, gArgs.resetType, gArgs.applyConfig, gArgs.updateOnly); }
+static int cfg2rx(void)  { return cfg2rxRun( gArgs.rxPorts, gArgs.numRxPorts, gArgs.numWorkers, gArgs.cfgLayer, gArgs.resetType, gArgs.applyConfig, gArgs.updateOnly); }
 static int cfg2ubx(void) { return cfg2ubxRun(gArgs.cfgLayer, gArgs.extraInfo); }
 static int cfg2hex(void) { return cfg2hexRun(gArgs.cfgLayer, gArgs.extraInfo); }
 static int cfg2c(void)   { return cfg2cRun(  gArgs.cfgLayer, gArgs.extraInfo); }
@@ -98,52 +106,64 @@ static int dump(void)    { return dumpRun( gArgs.rxPort, gArgs.extraInfo, gArgs.
 static int parse(void)   { return parseRun(  gArgs.extraInfo, gArgs.doEpoch ); }
 static int reset(void)   { return resetRun(  gArgs.rxPort, gArgs.resetType); }
 static int status(void)  { return statusRun( gArgs.rxPort, gArgs.extraInfo, gArgs.noProbe); }
+static int rx2snap(void) { return rx2snapRun(gArgs.rxPort, gArgs.cfgLayer, gArgs.useUnknown); }
+static int cfg2snap(void) { return cfg2snapRun(); }
+static int snap2cfg(void) { return snap2cfgRun(gArgs.extraInfo); }
 static int bin2hex(void) { return bin2hexRun(); }
 static int hex2bin(void) { return hex2binRun(); }
 
 const CMD_t kCmds[] =
 {
     { .name = "cfg2rx",  .info = "Configure a receiver from a configuration file",             .help = cfg2rxHelp,  .run = cfg2rx,
-      .need_i = true,  .need_o = false, .need_p = true,  .need_l = true,  .may_r  = true,  .may_n = false, .may_e = false, .may_u = true  },
+      .need_i = true,  .need_o = false, .need_p = true,  .need_l = true,  .may_r  = true,  .may_n = false, .may_e = false, .may_u = true,  .may_j = true  },
 
     { .name = "rx2cfg",  .info = "Create configuration file from config in a receiver",        .help = rx2cfgHelp,  .run = rx2cfg,
-      .need_i = false, .need_o = true,  .need_p = true,  .need_l = true,  .need_r = false, .may_n = false, .may_e = false, .may_u = false },
+      .need_i = false, .need_o = true,  .need_p = true,  .need_l = true,  .need_r = false, .may_n = false, .may_e = false, .may_u = false, .may_j = false },
 
     { .name = "rx2list", .info = "Like rx2cfg but output a flat list of key-value pairs",      .help = rx2listHelp, .run = rx2list,
-      .need_i = false, .need_o = true,  .need_p = true,  .need_l = true,  .need_r = false, .may_n = false, .may_e = false, .may_u = false },
+      .need_i = false, .need_o = true,  .need_p = true,  .need_l = true,  .need_r = false, .may_n = false, .may_e = false, .may_u = false, .may_j = false },
+
+    { .name = "rx2snap", .info = "Like rx2cfg but output a binary configuration snapshot",     .help = rx2snapHelp, .run = rx2snap,
+      .need_i = false, .need_o = true,  .need_p = true,  .need_l = true,  .need_r = false, .may_n = false, .may_e = false, .may_u = false, .may_j = false },
+
+    { .name = "cfg2snap", .info = "Convert config file to configuration snapshot",           .help = cfg2snapHelp, .run = cfg2snap,
+      .need_i = true,  .need_o = true,  .need_p = false, .need_l = false, .need_r = false, .may_n = false, .may_e = false, .may_u = false, .may_j = false },
+
+    { .name = "snap2cfg", .info = "Convert configuration snapshot to config file",           .help = snap2cfgHelp, .run = snap2cfg,
+      .need_i = true,  .need_o = true,  .need_p = false, .need_l = false, .need_r = false, .may_n = false, .may_e = false, .may_u = false, .may_j = false },
 
     { .name = "cfg2ubx", .info = "Convert config file to UBX-CFG-VALSET message(s)",           .help = cfg2ubxHelp, .run = cfg2ubx,
-      .need_i = true,  .need_o = true,  .need_p = false, .need_l = true,  .need_r = false, .may_n = false, .may_e = false, .may_u = false },
+      .need_i = true,  .need_o = true,  .need_p = false, .need_l = true,  .need_r = false, .may_n = false, .may_e = false, .may_u = false, .may_j = false },
 
     { .name = "cfg2hex", .info = "Like cfg2ubx but prints a hex dump of the message(s)",       .help = NULL,        .run = cfg2hex,
-      .need_i = true,  .need_o = true,  .need_p = false, .need_l = true,  .need_r = false, .may_n = false, .may_e = false, .may_u = false },
+      .need_i = true,  .need_o = true,  .need_p = false, .need_l = true,  .need_r = false, .may_n = false, .may_e = false, .may_u = false, .may_j = false },
 
     { .name = "cfg2c",   .info = "Like cfg2ubx but prints a c source code of the message(s)",  .help = NULL,        .run = cfg2c,
-      .need_i = true,  .need_o = true,  .need_p = false, .need_l = true,  .need_r = false, .may_n = false, .may_e = false, .may_u = false },
+      .need_i = true,  .need_o = true,  .need_p = false, .need_l = true,  .need_r = false, .may_n = false, .may_e = false, .may_u = false, .may_j = false },
 
     { .name = "uc2cfg",  .info = "Convert u-center config file to sane config file",           .help = uc2cfgHelp,  .run = uc2cfg,
-      .need_i = true,  .need_o = true,  .need_p = false, .need_l = false, .need_r = false, .may_n = false, .may_e = false, .may_u = false },
+      .need_i = true,  .need_o = true,  .need_p = false, .need_l = false, .need_r = false, .may_n = false, .may_e = false, .may_u = false, .may_j = false },
 
     { .name = "cfginfo", .info = "Print information about known configuration items etc.",     .help = cfginfoHelp, .run = cfginfo,
-      .need_i = false, .need_o = true,  .need_p = false, .need_l = false, .need_r = false, .may_n = false, .may_e = false, .may_u = false },
+      .need_i = false, .need_o = true,  .need_p = false, .need_l = false, .need_r = false, .may_n = false, .may_e = false, .may_u = false, .may_j = false },
 
     { .name = "dump",    .info = "Connects to receiver and prints received message frames",    .help = dumpHelp,    .run = dump,
-      .need_i = false, .need_o = true,  .need_p = true,  .need_l = false, .need_r = false, .may_n = true,  .may_e = false, .may_u = false },
+      .need_i = false, .need_o = true,  .need_p = true,  .need_l = false, .need_r = false, .may_n = true,  .may_e = false, .may_u = false, .may_j = false },
 
     { .name = "parse",   .info = "Parse file and output message frames",                       .help = parseHelp,   .run = parse,
-      .need_i = true,  .need_o = true,  .need_p = false, .need_l = false, .need_r = false, .may_n = false, .may_e = true,  .may_u = false },
+      .need_i = true,  .need_o = true,  .need_p = false, .need_l = false, .need_r = false, .may_n = false, .may_e = true,  .may_u = false, .may_j = false },
 
     { .name = "reset",   .info = "Reset receiver",                                             .help = resetHelp,   .run = reset,
-      .need_i = false, .need_o = false, .need_p = true,  .need_l = false, .need_r = true,  .may_n = false, .may_e = false, .may_u = false },
+      .need_i = false, .need_o = false, .need_p = true,  .need_l = false, .need_r = true,  .may_n = false, .may_e = false, .may_u = false, .may_j = false },
 
     { .name = "status",  .info = "Connects to receiver and prints status",                     .help = statusHelp,  .run = status,
-      .need_i = false, .need_o = true,  .need_p = true,  .need_l = false, .need_r = false, .may_n = true,  .may_e = false, .may_u = false },
+      .need_i = false, .need_o = true,  .need_p = true,  .need_l = false, .need_r = false, .may_n = true,  .may_e = false, .may_u = false, .may_j = false },
 
     { .name = "bin2hex", .info = "Convert to hex dump",                                        .help = bin2hexHelp, .run = bin2hex,
-      .need_i = true,  .need_o = true,  .need_p = false, .need_l = false, .need_r = false, .may_n = false, .may_e = false, .may_u = false },
+      .need_i = true,  .need_o = true,  .need_p = false, .need_l = false, .need_r = false, .may_n = false, .may_e = false, .may_u = false, .may_j = false },
 
     { .name = "hex2bin", .info = "Convert from hex dump",                                      .help = NULL,        .run = hex2bin,
-      .need_i = true,  .need_o = true,  .need_p = false, .need_l = false, .need_r = false, .may_n = false, .may_e = false, .may_u = false },
+      .need_i = true,  .need_o = true,  .need_p = false, .need_l = false, .need_r = false, .may_n = false, .may_e = false, .may_u = false, .may_j = false },
 
 };
 
@@ -188,9 +208,12 @@ const char * const kHelpStr =
     "    -o <outfile>   Output file (default: '-', i.e. standard output)\n"
     "    -y             Overwrite output file if it already exists\n"
     "    -p <serial>    Serial port where the receiver is connected:\n"
-    "                       [ser://]<device>[:<baudrate>]\n"
-    "                       tcp://<host>:<port>[:<baudrate>]\n"
-    "                       telnet://<host>:<port>[:<baudrate>]\n"
+    "                       [ser://]<device>[:<baudrate>][,<option>...]\n"
+    "                       tcp://<host>:<port>[:<baudrate>][,reconnect]\n"
+    "                       telnet://<host>:<port>[:<baudrate>][,reconnect]\n"
+    "                   Some commands accept several '-p <port>' and/or\n"
+    "                   '-p @<file>' with a list of ports, one per line\n"
+    "    -j <num>       Number of receivers to handle in parallel (default: all)\n"
     "    -l <layer(s)>  Configuration layer(s) to use:\n"
     "                       RAM, BBR, Flash, Default\n"
     "    -r <reset>     Reset mode to use to reset the receiver:\n"
@@ -201,6 +224,9 @@ const char * const kHelpStr =
     "    -a             Activate configuration after storing\n"
     "    -n             Do not probe/autobaud receiver, use passive reading only.\n"
     "                   For example, for other receivers or read-only connection.\n"
+    "    -T <tracefile> Record trace events (port, parser, epoch, etc.) and write\n"
+    "                   them to <tracefile> in Chrome trace format (JSON) on exit,\n"
+    "                   see chrome://tracing or https://ui.perfetto.dev\n"
     "\n"
     // -----------------------------------------------------------------------------
     "    Available <commands>s:\n"
@@ -232,7 +258,7 @@ const char * const kLicenseHelp =
 const char * const kPortHelp =
     "Serial ports:\n"
     "\n"
-    "    Local serial ports: [ser://]<device>[@<baudrate>], where:\n"
+    "    Local serial ports: [ser://]<device>[@<baudrate>][,<option>...], where:\n"
     "\n"
 #ifdef _WIN
     "        <device>     COM1, COM23, etc.\n"
@@ -240,10 +266,29 @@ const char * const kPortHelp =
     "        <device>     /dev/ttyUSB0, /dev/ttyACM1, /dev/serial/..., etc.\n"
 #endif
     "        <baudrate>   Baudrate (optional)\n"
+    "        <option>     Options (optional):\n"
+    "                       lowlat      Low-latency mode (also sets the latency\n"
+    "                                   timer of FTDI USB adapters to 1ms)\n"
+    "                       vtime=<n>   Read waits up to n * 100ms for data\n"
+    "                       vmin=<n>    Read waits for n bytes (or vtime after\n"
+    "                                   the first byte, requires vtime)\n"
+    "\n"
+#ifdef _WIN
+    "        Non-standard baudrates (e.g. 2000000) are supported. The lowlat\n"
+    "        and vmin options have no effect.\n"
+#else
+    "        Non-standard baudrates (e.g. 2000000) are supported on Linux. The\n"
+    "        lowlat option is for Linux only.\n"
+#endif
     "\n"
     "        Note that 'ser://' is the default and can be omitted. If no <baudrate>\n"
     "        is specified, it is be automatically detected. That is, '-p <device>'\n"
-    "        works in most cases.\n"
+    "        works in most cases. The detected baudrate is remembered (in\n"
+#ifdef _WIN
+    "        %LOCALAPPDATA%\\ubloxcfg\\baudrates) and tried first the next time.\n"
+#else
+    "        ~/.cache/ubloxcfg/baudrates) and tried first the next time.\n"
+#endif
     "\n"
 #ifndef _WIN
     "        It is recommended to use /dev/serial/by-path/... device names for USB\n"
@@ -251,12 +296,12 @@ const char * const kPortHelp =
     "        USB re-enumeration. See the 'reset' command.\n"
     "\n"
 #endif
-    "    Raw TCP/IP ports: tcp://<addr>:<port>, where:\n"
+    "    Raw TCP/IP ports: tcp://<addr>:<port>[,reconnect], where:\n"
     "\n"
     "        <addr>       Hostname or IP address\n"
     "        <port>       Port number\n"
     "\n"
-    "    Telnet TCP/IP ports: telnet://<addr>:<port>[@<baudrate>], where\n"
+    "    Telnet TCP/IP ports: telnet://<addr>:<port>[@<baudrate>][,reconnect], where\n"
     "\n"
     "        <addr>       Hostname or IP address\n"
     "        <port>       Port number\n"
@@ -269,6 +314,9 @@ const char * const kPortHelp =
     "        A minimal ser2net command line that should work is:\n"
     "           ser2net -d -C \"12345:telnet:0:/dev/ttyUSB0: remctl\"\n"
     "        This should allow using '-p telnet://localhost:12345'.\n"
+    "\n"
+    "    With the reconnect option TCP/IP and telnet ports reconnect automatically\n"
+    "    (with increasing delays) if the connection is lost.\n"
     "\n";
 
 const char * const kLayersHelp =
@@ -407,9 +455,23 @@ int main(int argc, char **argv)
         }
         _ARGS_STR("-i", gArgs.inName)
         _ARGS_STR("-o", gArgs.outName)
-        _ARGS_STR("-p", gArgs.rxPort)
+        else if (strcmp("-p", argv[argIx]) == 0)
+        {
+            if ( ((argIx + 1) < argc) && (gArgs.numRxPorts < NUMOF(gArgs.rxPorts)) )
+            {
+                gArgs.rxPorts[gArgs.numRxPorts++] = argv[argIx + 1];
+                gArgs.rxPort = gArgs.rxPorts[0];
+                argIx++;
+            }
+            else
+            {
+                argOk = false;
+            }
+        }
+        _ARGS_STR("-j", gArgs.numWorkers)
         _ARGS_STR("-l", gArgs.cfgLayer)
         _ARGS_STR("-r", gArgs.resetType)
+        _ARGS_STR("-T", gArgs.traceName)
         _ARGS_BOOL("-u", gArgs.useUnknown, true)
         _ARGS_BOOL("-x", gArgs.extraInfo, true)
         _ARGS_BOOL("-a", gArgs.applyConfig, true)
@@ -558,6 +620,19 @@ int main(int argc, char **argv)
         res = false;
     }
 
+    // May use several -p or -p @<file>, and -j arg?
+    if ( (gArgs.cmd != NULL) && !gArgs.cmd->may_j && (gArgs.rxPort != NULL) &&
+         ( (gArgs.numRxPorts > 1) || (gArgs.rxPort[0] == '@') ) )
+    {
+        WARNING("Command supports only one '-p <port>' argument!");
+        res = false;
+    }
+    if ( (gArgs.cmd != NULL) && !gArgs.cmd->may_j && (gArgs.numWorkers != NULL) )
+    {
+        WARNING("Illegal argument '-j %s'!", gArgs.numWorkers);
+        res = false;
+    }
+
     // Require -l arg?
     if ((gArgs.cmd != NULL) && gArgs.cmd->need_l)
     {
@@ -618,8 +693,47 @@ int main(int argc, char **argv)
     // Execute
     DEBUG("args: inName=%s outName=%s rxPort=%s cfgLayer=%s useUnknown=%d",
         gArgs.inName, gArgs.outName, gArgs.rxPort, gArgs.cfgLayer, gArgs.useUnknown);
+    if (gArgs.traceName != NULL)
+    {
+        traceThreadName("main");
+        traceEnable(true);
+    }
+
+    // Autobaud tries the last known baudrate of a port first
+    char baudCacheFile[1000];
+    const bool baudCache = gArgs.cmd->need_p && cacheFilePath(baudCacheFile, sizeof(baudCacheFile), "baudrates");
+    if (baudCache)
+    {
+        rxBaudrateCacheLoad(baudCacheFile);
+    }
+
     const int exitCode = gArgs.cmd->run();
 
+    if (baudCache && !rxBaudrateCacheSave(baudCacheFile))
+    {
+        DEBUG("Failed writing %s: %s", baudCacheFile, strerror(errno));
+    }
+    if (gArgs.traceName != NULL)
+    {
+        traceEnable(false);
+        FILE *traceFile = fopen(gArgs.traceName, "w");
+        const int nEvents = traceExportJson(traceFile);
+        if ( (traceFile == NULL) || (nEvents < 0) )
+        {
+            WARNING("Failed writing trace to '%s'!", gArgs.traceName);
+        }
+        else
+        {
+            uint32_t nDropped = 0;
+            traceStats(NULL, &nDropped);
+            PRINT("Wrote %d trace events (%u dropped) to '%s'", nEvents, nDropped, gArgs.traceName);
+        }
+        if (traceFile != NULL)
+        {
+            fclose(traceFile);
+        }
+    }
+
     return exitCode;
 }
 
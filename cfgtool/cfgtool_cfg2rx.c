@@ -19,6 +19,8 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include <inttypes.h>
+#include <stdio.h>
+#include <errno.h>
 
 #include "ubloxcfg.h"
 
@@ -29,6 +31,7 @@
 #include "ff_parser.h"
 
 #include "cfgtool_reset.h"
+#include "cfgtool_snap.h"
 
 #include "cfgtool_cfg2rx.h"
 
@@ -40,7 +43,8 @@ const char *cfg2rxHelp(void)
 // -----------------------------------------------------------------------------
 "Command 'cfg2rx':\n"
 "\n"
-"    Usage: cfgtool cfg2rx [-i <infile>] -p <port> -l <layers> [-r <reset>] [-a] [-U]\n"
+"    Usage: cfgtool cfg2rx [-i <infile>] -p <port> [-p <port> ...] [-j <num>]\n"
+"                          -l <layers> [-r <reset>] [-a] [-U]\n"
 "\n"
 "    This configures a receiver from a configuration file. The configuration is\n"
 "    stored to one or more (comma-separated) of the following <layers>: 'RAM',\n"
@@ -56,8 +60,12 @@ const char *cfg2rxHelp(void)
 "    The -U switch makes the command only update the receiver configuration if\n"
 "    necessary. If the current configuration of the receiver already contains all\n"
 "    the configuration from <infile>, no action is taken and the command finishes\n"
-"    early. Additionally, with '-r factory', the items not covered by <infile>\n"
-"    are checked against the default configuration.\n"
+"    early. Otherwise only the items that differ from the current configuration\n"
+"    of the given layers are stored. With '-r factory' or '-r default' the\n"
+"    given layers must have the default configuration with the configuration\n"
+"    from <infile> applied to be up to date. Otherwise the receiver is reset and\n"
+"    the items that differ from the default configuration are stored. Items\n"
+"    from <infile> that the receiver does not know are ignored.\n"
 "\n"
 "    A configuration file consists of one or more lines of configuration\n"
 "    parameters. Leading and trailing whitespace, empty lines as well as comments\n"
@@ -99,6 +107,17 @@ const char *cfg2rxHelp(void)
 "            that configure the communication ports (e.g. CFG-UART1-..., etc.).\n"
 "            See the note on changing baudrate below.\n"
 "\n"
+"    Several receivers can be configured at once by giving more than one\n"
+"    '-p <port>' argument, and/or a '-p @<file>' argument where <file> lists\n"
+"    the ports, one per line ('#' comments are allowed). The receivers are then\n"
+"    configured in parallel, with up to <num> (-j, default: all) receivers at\n"
+"    the same time. After storing the configuration it is read back from each\n"
+"    receiver and verified. A summary with the result and the durations for\n"
+"    each receiver is printed at the end.\n"
+"\n"
+"    Instead of a configuration file a configuration snapshot (see the 'rx2snap'\n"
+"    command) can be used as <infile>.\n"
+"\n"
 "    Example configuration file:\n"
 "\n"
 "        # Set some navigation parameters:\n"
@@ -129,6 +148,7 @@ const char *cfg2rxHelp(void)
 #else
 "        cfgtool cfg2rx -p /dev/ttyUSB0 -r factory -l Flash -a -i some.cfg\n"
 #endif
+"        cfgtool cfg2rx -p @ports.txt -j 8 -l BBR,Flash -U -a -i some.cfg\n"
 "\n"
 "    Notes:\n"
 "\n"
@@ -157,132 +177,198 @@ const char *cfg2rxHelp(void)
 
 /* ****************************************************************************************************************** */
 
-int cfg2rxRun(const char *portArg, const char *layerArg, const char *resetArg, const bool applyConfig, const bool updateOnly)
+#define CFG2RX_MAX_PORTS 256
+
+// Expand '@<file>' port arguments to the ports listed in the file, returns the number of ports (-1 on failure), the
+// ports in ports[] must be free()d
+static int _cfg2rxGetPorts(const char * const *portArgs, const int numPortArgs, char **ports, const int maxPorts)
 {
-    bool ram = false;
-    bool bbr = false;
-    bool flash = false;
-    if (!layersStringToFlags(layerArg, &ram, &bbr, &flash, NULL) || !(ram || bbr || flash))
+    int numPorts = 0;
+    bool res = true;
+    for (int argIx = 0; res && (argIx < numPortArgs); argIx++)
     {
-        return EXIT_BADARGS;
+        if (portArgs[argIx][0] != '@')
+        {
+            if (numPorts >= maxPorts)
+            {
+                WARNING("Too many ports!");
+                res = false;
+                break;
+            }
+            ports[numPorts++] = strdup(portArgs[argIx]);
+            continue;
+        }
+
+        // One port per line, ignore empty lines and comments
+        const char *listFile = &portArgs[argIx][1];
+        FILE *file = fopen(listFile, "r");
+        if (file == NULL)
+        {
+            WARNING("Failed opening '%s' for reading: %s!", listFile, strerror(errno));
+            res = false;
+            break;
+        }
+        char line[1000];
+        int lineNr = 0;
+        while (res && (fgets(line, sizeof(line), file) != NULL))
+        {
+            lineNr++;
+            char *comment = strchr(line, '#');
+            if (comment != NULL)
+            {
+                *comment = '\0';
+            }
+            const char *port = strtok(line, " \t\r\n");
+            if (port == NULL)
+            {
+                continue;
+            }
+            if (strtok(NULL, " \t\r\n") != NULL)
+            {
+                WARNING("%s:%d: Expected one port!", listFile, lineNr);
+                res = false;
+            }
+            else if (numPorts >= maxPorts)
+            {
+                WARNING("%s:%d: Too many ports!", listFile, lineNr);
+                res = false;
+            }
+            else
+            {
+                ports[numPorts++] = strdup(port);
+            }
+        }
+        fclose(file);
     }
 
-    RX_RESET_t reset;
-    if ((resetArg != NULL) && !resetTypeFromStr(resetArg, &reset))
+    if (res && (numPorts < 1))
     {
-        return EXIT_BADARGS;
+        WARNING("No ports!");
+        res = false;
     }
+    if (!res)
+    {
+        for (int ix = 0; ix < numPorts; ix++)
+        {
+            free(ports[ix]);
+        }
+        return -1;
+    }
+    return numPorts;
+}
 
-    PRINT("Loading configuration");
-    int nAllKvCfg = 0;
-    UBLOXCFG_KEYVAL_t *allKvCfg = cfgToKeyVal(&nAllKvCfg);
-    if (allKvCfg == NULL)
+// Configure many receivers in parallel
+static int _cfg2rxFleet(char **ports, const int numPorts, const int numWorkers, const RX_FLEET_CFG_t *cfg)
+{
+    RX_FLEET_JOB_t *jobs = calloc(numPorts, sizeof(*jobs));
+    if (jobs == NULL)
     {
+        WARNING("malloc fail");
         return EXIT_OTHERFAIL;
     }
+    for (int ix = 0; ix < numPorts; ix++)
+    {
+        jobs[ix].port = ports[ix];
+    }
 
-    RX_t *rx = rxInit(portArg, NULL);
+    const int nWorkers = numWorkers > 0 ? MIN(numWorkers, numPorts) : numPorts;
+    PRINT("Configuring %d receivers (%d in parallel)", numPorts, MIN(nWorkers, RX_FLEET_MAX_WORKERS));
+    const uint32_t t0 = TIME();
+    const RX_ARGS_t args = RX_ARGS_DEFAULT();
+    rxFleetRun(jobs, numPorts, nWorkers, &args, rxFleetSetConfig, (void *)cfg);
+    const uint32_t dur = TIME() - t0;
+
+    // Summary
+    int nOk = 0;
+    int nRxFail = 0;
+    uint32_t durSum = 0;
+    PRINT("%-30s %-30s %8s %8s %6s %s", "Port", "Receiver", "Open [s]", "Cfg [s]", "Items", "Result");
+    for (int ix = 0; ix < numPorts; ix++)
+    {
+        const RX_FLEET_JOB_t *job = &jobs[ix];
+        if (job->ok)
+        {
+            nOk++;
+        }
+        else if (job->verStr[0] == '\0')
+        {
+            nRxFail++;
+        }
+        durSum += job->durOpen + job->durRun;
+        char items[20];
+        snprintf(items, sizeof(items), job->ok ? "%d" : "-", job->result);
+        PRINT("%-30s %-30s %8.1f %8.1f %6s %s", job->port, job->verStr[0] != '\0' ? job->verStr : "-",
+            (double)job->durOpen * 1e-3, (double)job->durRun * 1e-3, items, job->ok ? "OK" : job->error);
+    }
+    PRINT("%d of %d receivers configured, %d failed, duration %.1fs (%.1fs sequentially)",
+        nOk, numPorts, numPorts - nOk, (double)dur * 1e-3, (double)durSum * 1e-3);
+
+    free(jobs);
+    return nOk == numPorts ? EXIT_SUCCESS : (nRxFail > 0 ? EXIT_RXFAIL : EXIT_OTHERFAIL);
+}
+
+/* ****************************************************************************************************************** */
+
+// Configure one receiver
+static int _cfg2rxSingle(const char *port, const bool ram, const bool bbr, const bool flash, const RX_RESET_t reset,
+    const bool applyConfig, const bool updateOnly, const UBLOXCFG_KEYVAL_t *allKvCfg, const int nAllKvCfg)
+{
+    RX_t *rx = rxInit(port, NULL);
     if ( (rx == NULL) || !rxOpen(rx) )
     {
-        free(allKvCfg);
         free(rx);
         return EXIT_RXFAIL;
     }
 
-    // Check current config
+    // Reduce config to the items that need to be changed
+    const UBLOXCFG_KEYVAL_t *kvCfg = allKvCfg;
+    int nKvCfg = nAllKvCfg;
+    UBLOXCFG_KEYVAL_t *kvSet = NULL;
     if (updateOnly)
     {
-        bool configNeedsUpdate = false;
-        // Get current and default config
-        const uint32_t keys[] = { UBX_CFG_VALGET_V0_ALL_WILDCARD };
-        UBLOXCFG_KEYVAL_t allKvRam[3000];
-        const int nAllKvRam = rxGetConfig(rx, UBLOXCFG_LAYER_RAM, keys, NUMOF(keys), allKvRam, NUMOF(allKvRam));
-        UBLOXCFG_KEYVAL_t allKvDef[NUMOF(allKvRam)];
-        const int nAllKvDef = reset == RX_RESET_FACTORY ?
-            rxGetConfig(rx, UBLOXCFG_LAYER_DEFAULT, keys, NUMOF(keys), allKvDef, NUMOF(allKvDef)) : 0;
-
-        // Check current configuration
-        for (int ixKvRam = 0; ixKvRam < nAllKvRam; ixKvRam++)
-        {
-            const UBLOXCFG_KEYVAL_t *kvRam = &allKvRam[ixKvRam];
-
-            // Check all items from config file
-            bool itemIsInCfg = false;
-            for (int ixKvCfg = 0; ixKvCfg < nAllKvCfg; ixKvCfg++)
-            {
-                const UBLOXCFG_KEYVAL_t *kvCfg = &allKvCfg[ixKvCfg];
-                if (kvRam->id == kvCfg->id)
-                {
-                    itemIsInCfg = true;
-                    if (kvRam->val._raw != kvCfg->val._raw)
-                    {
-                        configNeedsUpdate = true;
-                        char strCfg[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
-                        char strRam[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
-                        if ( ubloxcfg_stringifyKeyVal(strCfg, sizeof(strCfg), kvCfg) &&
-                             ubloxcfg_stringifyKeyVal(strRam, sizeof(strRam), kvRam) )
-                        {
-                            DEBUG("Config (%s) differs from current config (%s)", strCfg, strRam);
-                        }
-                    }
-                }
-            }
-
-            // Check if different from config, if factory reset requested, and unless item set by cfg file
-            if (!itemIsInCfg && (nAllKvDef > 0))
-            {
-                for (int ixKvDef = 0; ixKvDef < nAllKvDef; ixKvDef++)
-                {
-                    const UBLOXCFG_KEYVAL_t *kvDef = &allKvDef[ixKvDef];
-                    if (kvRam->id == kvDef->id)
-                    {
-                        if (kvRam->val._raw != kvDef->val._raw)
-                        {
-                            configNeedsUpdate = true;
-                            char strDef[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
-                            char strRam[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
-                            if ( ubloxcfg_stringifyKeyVal(strDef, sizeof(strDef), kvDef) &&
-                                 ubloxcfg_stringifyKeyVal(strRam, sizeof(strRam), kvRam) )
-                            {
-                                DEBUG("Default (%s) differs from current config (%s)", strDef, strRam);
-                            }
-                        }
-                    }
-                }
-            }
-        }
-
-        // reset == RX_RESET_FACTORY
-        if (configNeedsUpdate)
-        {
-            PRINT("Current configuration differs from requestd config.");
+        kvSet = malloc(CFG_SET_MAX_KV * sizeof(*kvSet));
+        const bool resetToDefault = (reset == RX_RESET_FACTORY) || (reset == RX_RESET_DEFAULT);
+        bool upToDate = false;
+        const int nKvSet = kvSet == NULL ? -1 :
+            rxGetConfigUpdate(rx, allKvCfg, nAllKvCfg, resetToDefault, ram, bbr, flash, kvSet, CFG_SET_MAX_KV, &upToDate);
+        if (nKvSet < 0)
+        {
+            WARNING("Failed determining configuration update!");
+            free(kvSet);
+            rxClose(rx);
+            free(rx);
+            return EXIT_RXFAIL;
         }
-        else
+        else if (upToDate)
         {
             PRINT("Current configuration is up to date. Skipping configuring receiver.");
-            free(allKvCfg);
+            free(kvSet);
             rxClose(rx);
             free(rx);
             return EXIT_SUCCESS;
         }
+        PRINT("Current configuration differs from requested config (%d of %d items to set)", nKvSet, nAllKvCfg);
+        kvCfg = kvSet;
+        nKvCfg = nKvSet;
     }
 
-    if ( (resetArg != NULL) && !rxReset(rx, reset))
+    if ( (reset != RX_RESET_NONE) && !rxReset(rx, reset))
     {
-        free(allKvCfg);
+        free(kvSet);
         rxClose(rx);
         free(rx);
         return EXIT_RXFAIL;
     }
 
-    bool res = rxSetConfig(rx, allKvCfg, nAllKvCfg, ram, bbr, flash);
+    // Nothing to set if the receiver must only be reset to the default configuration
+    bool res = (nKvCfg == 0) || rxSetConfig(rx, kvCfg, nKvCfg, ram, bbr, flash);
 
     if (res && applyConfig)
     {
         PRINT("Applying configuration");
         if (!rxReset(rx, RX_RESET_SOFT))
         {
-            free(allKvCfg);
+            free(kvSet);
             rxClose(rx);
             free(rx);
             return EXIT_RXFAIL;
@@ -296,10 +382,81 @@ int cfg2rxRun(const char *portArg, const char *layerArg, const char *resetArg, c
 
     rxClose(rx);
     free(rx);
-    free(allKvCfg);
+    free(kvSet);
     return res ? EXIT_SUCCESS : EXIT_OTHERFAIL;
 }
 
+int cfg2rxRun(const char * const *portArgs, const int numPortArgs, const char *workersArg, const char *layerArg,
+    const char *resetArg, const bool applyConfig, const bool updateOnly)
+{
+    bool ram = false;
+    bool bbr = false;
+    bool flash = false;
+    if (!layersStringToFlags(layerArg, &ram, &bbr, &flash, NULL) || !(ram || bbr || flash))
+    {
+        return EXIT_BADARGS;
+    }
+
+    RX_RESET_t reset = RX_RESET_NONE;
+    if ((resetArg != NULL) && !resetTypeFromStr(resetArg, &reset))
+    {
+        return EXIT_BADARGS;
+    }
+
+    int numWorkers = 0;
+    if (workersArg != NULL)
+    {
+        int numChar = 0;
+        if ( (sscanf(workersArg, "%d%n", &numWorkers, &numChar) != 1) || (numChar != (int)strlen(workersArg)) ||
+             (numWorkers < 1) )
+        {
+            WARNING("Bad number of parallel receivers '%s'!", workersArg);
+            return EXIT_BADARGS;
+        }
+    }
+
+    char *ports[CFG2RX_MAX_PORTS];
+    const int numPorts = _cfg2rxGetPorts(portArgs, numPortArgs, ports, NUMOF(ports));
+    if (numPorts < 1)
+    {
+        return EXIT_BADARGS;
+    }
+
+    PRINT("Loading configuration");
+    int nAllKvCfg = 0;
+    UBLOXCFG_KEYVAL_t *allKvCfg = cfgToKeyVal(&nAllKvCfg);
+    if (allKvCfg == NULL)
+    {
+        for (int ix = 0; ix < numPorts; ix++)
+        {
+            free(ports[ix]);
+        }
+        return EXIT_OTHERFAIL;
+    }
+
+    int res = EXIT_SUCCESS;
+    if (numPorts == 1)
+    {
+        res = _cfg2rxSingle(ports[0], ram, bbr, flash, reset, applyConfig, updateOnly, allKvCfg, nAllKvCfg);
+    }
+    else
+    {
+        const RX_FLEET_CFG_t cfg =
+        {
+            .kv = allKvCfg, .nKv = nAllKvCfg, .ram = ram, .bbr = bbr, .flash = flash, .reset = reset,
+            .updateOnly = updateOnly, .verify = true, .apply = applyConfig
+        };
+        res = _cfg2rxFleet(ports, numPorts, numWorkers, &cfg);
+    }
+
+    for (int ix = 0; ix < numPorts; ix++)
+    {
+        free(ports[ix]);
+    }
+    free(allKvCfg);
+    return res;
+}
+
 /* ****************************************************************************************************************** */
 
 typedef struct CFG_DB_s
@@ -313,6 +470,12 @@ static bool _cfgDbAdd(CFG_DB_t *db, IO_LINE_t *line);
 
 UBLOXCFG_KEYVAL_t *cfgToKeyVal(int *nKv)
 {
+    // Binary configuration snapshot instead of a configuration file
+    if (snapIsInput())
+    {
+        return snapToKeyVal(nKv, NULL);
+    }
+
     const int kvSize = CFG_SET_MAX_KV * sizeof(UBLOXCFG_KEYVAL_t);
     UBLOXCFG_KEYVAL_t *kv = malloc(kvSize);
     if (kv == NULL)
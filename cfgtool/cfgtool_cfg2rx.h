@@ -28,7 +28,8 @@
 /* ****************************************************************************************************************** */
 
 const char *cfg2rxHelp(void);
-int cfg2rxRun(const char *portArg, const char *layerArg, const char *resetArg, const bool applyConfig, const bool updateOnly);
+int cfg2rxRun(const char * const *portArgs, const int numPortArgs, const char *workersArg, const char *layerArg,
+    const char *resetArg, const bool applyConfig, const bool updateOnly);
 
 // ---------------------------------------------------------------------------------------------------------------------
 
@@ -24,6 +24,8 @@
 #include "ff_ubx.h"
 #include "ff_parser.h"
 #include "ff_epoch.h"
+#include "ff_tslog.h"
+#include "ff_rtcm3stats.h"
 
 #include "cfgtool_parse.h"
 
@@ -43,6 +45,16 @@ const char *parseHelp(void)
 "    or SIGTERM is received.\n"
 "\n"
 "    Add -e to enable epoch detection and to output detected epochs.\n"
+"\n"
+"    Timestamped logs (e.g. *.ubt files recorded by cfggui) are detected\n"
+"    automatically. The message output then includes the monotonic and the\n"
+"    wall-clock (POSIX) time [s] at which the data of the message arrived.\n"
+"\n"
+"    If there are RTCM3 messages, statistics for each message type and\n"
+"    reference station are output at the end: rate, interval (min/mean/max),\n"
+"    jitter, epoch period, gaps (missing epochs) and, for timestamped logs,\n"
+"    age (arrival time minus epoch time, last/min/mean/max). Without arrival\n"
+"    times the rate, interval and jitter are derived from the epoch times.\n"
 "\n";
 }
 
@@ -59,6 +71,38 @@ static void _sigHandler(int signal)
     }
 }
 
+// RTCM3 statistics, with arrival times if available
+static RTCM3_STATS_t gRtcm3Stats;
+
+static void _addRtcm3Stats(const PARSER_MSG_t *msg, const TSLOG_REC_t *rec)
+{
+    if (msg->type == PARSER_MSGTYPE_RTCM3)
+    {
+        rtcm3StatsAdd(&gRtcm3Stats, msg, rec != NULL ? rec->mono : 0, rec != NULL ? (double)rec->wall * 1e-9 : 0.0);
+    }
+}
+
+static void _outputMsg(const PARSER_MSG_t *msg, const TSLOG_REC_t *rec, const bool extraInfo)
+{
+    if (rec != NULL)
+    {
+        ioOutputStr("message %4u, size %4d, time %llu.%09llu %llu.%09llu, %-8s %-20s %s\n",
+            msg->seq, msg->size,
+            (unsigned long long)(rec->mono / 1000000000), (unsigned long long)(rec->mono % 1000000000),
+            (unsigned long long)(rec->wall / 1000000000), (unsigned long long)(rec->wall % 1000000000),
+            parserMsgtypeName(msg->type), msg->name, msg->info != NULL ? msg->info : "n/a");
+    }
+    else
+    {
+        ioOutputStr("message %4u, size %4d, %-8s %-20s %s\n",
+            msg->seq, msg->size, parserMsgtypeName(msg->type), msg->name, msg->info != NULL ? msg->info : "n/a");
+    }
+    if (extraInfo)
+    {
+        ioAddOutputHexdump(msg->data, msg->size);
+    }
+}
+
 int parseRun(const bool extraInfo, const bool doEpoch)
 {
     uint32_t nEpochs = 0;
@@ -75,6 +119,17 @@ int parseRun(const bool extraInfo, const bool doEpoch)
     EPOCH_t epoch;
     PARSER_MSG_t msg;
     epochInit(&coll);
+    rtcm3StatsInit(&gRtcm3Stats);
+
+    // Timestamped log input (detected on the first chunk of data)
+    TSLOG_DEC_t tslog;
+    TSLOG_REC_t rec;
+    bool isTslog = false;
+    bool first = true;
+    tslogDecInit(&tslog);
+    memset(&rec, 0, sizeof(rec));
+
+    bool res = true;
     bool done = false;
     while (!(gAbort || done))
     {
@@ -91,39 +146,78 @@ int parseRun(const bool extraInfo, const bool doEpoch)
         }
         if (num > 0)
         {
-            parserAdd(&parser, buf, num);
+            if (first)
+            {
+                isTslog = tslogDetect(buf, num);
+                first = false;
+            }
+            if (isTslog)
+            {
+                if (!tslogDecAdd(&tslog, buf, num))
+                {
+                    WARNING("Timestamped log decoder overflow, data lost");
+                    tslogDecResync(&tslog);
+                    tslogDecAdd(&tslog, buf, num);
+                }
+            }
+            else
+            {
+                parserAdd(&parser, buf, num);
+            }
         }
 
-        while (parserProcess(&parser, &msg, true))
+        // Messages complete with the last chunk of data, so they get the arrival time of that chunk
+        bool more = true;
+        while (more)
         {
-            if (doEpoch && epochCollect(&coll, &msg, &epoch))
+            if (isTslog)
             {
-                nEpochs++;
-                ioOutputStr("epoch   %4d, size    0, NONE     EPOCH                %s\n", nEpochs, epoch.str);
+                more = tslogDecProcess(&tslog, &rec);
+                if (!more)
+                {
+                    break;
+                }
+                parserAddTs(&parser, rec.data, rec.size, rec.mono);
             }
-            ioOutputStr("message %4u, size %4d, %-8s %-20s %s\n",
-                msg.seq, msg.size, parserMsgtypeName(msg.type), msg.name, msg.info != NULL ? msg.info : "n/a");
-            if (extraInfo)
+            else
             {
-                ioAddOutputHexdump(msg.data, msg.size);
+                more = false;
             }
-            if (!ioWriteOutput(parser.nMsgs == 1 ? false : true))
+
+            while (parserProcess(&parser, &msg, true))
             {
-                break;
+                if (doEpoch && epochCollect(&coll, &msg, &epoch))
+                {
+                    nEpochs++;
+                    ioOutputStr("epoch   %4d, size    0, NONE     EPOCH                %s\n", nEpochs, epoch.str);
+                }
+                _addRtcm3Stats(&msg, isTslog ? &rec : NULL);
+                _outputMsg(&msg, isTslog ? &rec : NULL, extraInfo);
+                if (!ioWriteOutput(parser.nMsgs == 1 ? false : true))
+                {
+                    res = false;
+                    more = false;
+                    done = true;
+                    break;
+                }
             }
         }
     }
+    if (!res)
+    {
+        return EXIT_OTHERFAIL;
+    }
 
-    // Anything left in parser?
+    // Anything left in parser? That data came with the last record (if any)
     if (parserFlush(&parser, &msg))
     {
-        ioOutputStr("message %4u, size %4d, %-8s %-20s %s\n",
-            msg.seq, msg.size, parserMsgtypeName(msg.type), msg.name, msg.info != NULL ? msg.info : "n/a");
-        if (extraInfo)
+        const TSLOG_REC_t *lastRec = (isTslog && (rec.size > 0)) ? &rec : NULL;
+        _addRtcm3Stats(&msg, lastRec);
+        _outputMsg(&msg, lastRec, extraInfo);
+        if (!ioWriteOutput(true))
         {
-            ioAddOutputHexdump(msg.data, msg.size);
+            return EXIT_OTHERFAIL;
         }
-        ioWriteOutput(true);
     }
 
     ioOutputStr("stats UBX      count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", parser.nUbx,     parser.nMsgs > 0 ? (double)parser.nUbx     / (double)parser.nMsgs * 1e2 : 0.0, parser.sUbx,     parser.sMsgs > 0 ? (double)parser.sUbx     / (double)parser.sMsgs * 1e2 : 0.0);
@@ -137,6 +231,18 @@ int parseRun(const bool extraInfo, const bool doEpoch)
     {
         ioOutputStr("stats EPOCH    count %6u (%5.1f%%)\n", nEpochs, parser.nMsgs > 0 ? (double)nEpochs / (double)parser.nMsgs * 1e2 : 0.0);
     }
+    if (isTslog)
+    {
+        ioOutputStr("stats TSLOG    data %6u  sync %6u  skipped %10u\n", tslog.nData, tslog.nSync, tslog.nSkip);
+    }
+    for (int ix = 0; ix < gRtcm3Stats.numTypes; ix++)
+    {
+        char name[20];
+        char str[300];
+        rtcm3StatsName(&gRtcm3Stats.types[ix], name, sizeof(name));
+        rtcm3StatsStr(&gRtcm3Stats.types[ix], str, sizeof(str));
+        ioOutputStr("stats RTCM3 %-8s %4d %s\n", name, gRtcm3Stats.types[ix].refStaId, str);
+    }
 
     return ioWriteOutput(true) ? EXIT_SUCCESS : EXIT_OTHERFAIL;
 }
@@ -85,7 +85,7 @@ typedef struct CFG_DB_s
 } CFG_DB_t;
 
 // Forward declarations
-static CFG_DB_t *_getCfgDb(RX_t *rx, const UBLOXCFG_LAYER_t layer);
+static bool _getCfgDbs(RX_t *rx, const UBLOXCFG_LAYER_t layer, CFG_DB_t **dbLayer, CFG_DB_t **dbDefault);
 static const UBLOXCFG_KEYVAL_t *_dbFindKeyVal(const CFG_DB_t *db, const uint32_t id);
 static void _dbFlag(CFG_DB_t *db, const uint32_t id);
 
@@ -123,9 +123,10 @@ int rx2cfgRun(const char *portArg, const char *layerArg, const bool useUnknownIt
         return EXIT_RXFAIL;
     }
 
-    // Get configuration
-    CFG_DB_t *dbLayer = _getCfgDb(rx, layer);
-    if (dbLayer == NULL)
+    // Get configuration, and the default configuration, too
+    CFG_DB_t *dbLayer = NULL;
+    CFG_DB_t *dbDefault = NULL;
+    if (!_getCfgDbs(rx, layer, &dbLayer, &dbDefault))
     {
         rxClose(rx);
         free(rx);
@@ -139,16 +140,10 @@ int rx2cfgRun(const char *portArg, const char *layerArg, const bool useUnknownIt
     if (!generateOutput)
     {
         WARNING("No configuration available in layer %s!", layerName);
-        free(dbLayer);
-        rxClose(rx);
-        free(rx);
-        return EXIT_RXNODATA;
-    }
-
-    // Maybe get default configuration, too
-    CFG_DB_t *dbDefault = layer == UBLOXCFG_LAYER_DEFAULT ? dbLayer : _getCfgDb(rx, UBLOXCFG_LAYER_DEFAULT);
-    if (dbDefault == NULL)
-    {
+        if (dbDefault != dbLayer)
+        {
+            free(dbDefault);
+        }
         free(dbLayer);
         rxClose(rx);
         free(rx);
@@ -365,7 +360,7 @@ int rx2cfgRun(const char *portArg, const char *layerArg, const bool useUnknownIt
 
 /* ****************************************************************************************************************** */
 
-static void _addOutputKeyValuePair(const UBLOXCFG_KEYVAL_t *kv, const UBLOXCFG_ITEM_t *item, const UBLOXCFG_KEYVAL_t *defaultKv);
+static void _addOutputKeyValuePair(const UBLOXCFG_KEYVAL_t *kv, const UBLOXCFG_ITEM_t *item, const UBLOXCFG_KEYVAL_t *defaultKv, const char *valueStr);
 
 int rx2listRun(const char *portArg, const char *layerArg, const bool useUnknownItems)
 {
@@ -385,9 +380,10 @@ int rx2listRun(const char *portArg, const char *layerArg, const bool useUnknownI
         return EXIT_RXFAIL;
     }
 
-    // Get configuration
-    CFG_DB_t *dbLayer = _getCfgDb(rx, layer);
-    if (dbLayer == NULL)
+    // Get configuration, and the default configuration, too
+    CFG_DB_t *dbLayer = NULL;
+    CFG_DB_t *dbDefault = NULL;
+    if (!_getCfgDbs(rx, layer, &dbLayer, &dbDefault))
     {
         rxClose(rx);
         free(rx);
@@ -399,16 +395,10 @@ int rx2listRun(const char *portArg, const char *layerArg, const bool useUnknownI
     if (!generateOutput)
     {
         WARNING("No configuration available in layer %s!", layerName);
-        free(dbLayer);
-        rxClose(rx);
-        free(rx);
-        return EXIT_RXNODATA;
-    }
-
-    // Maybe get default configuration, too
-    CFG_DB_t *dbDefault = layer == UBLOXCFG_LAYER_DEFAULT ? dbLayer : _getCfgDb(rx, UBLOXCFG_LAYER_DEFAULT);
-    if (dbDefault == NULL)
-    {
+        if (dbDefault != dbLayer)
+        {
+            free(dbDefault);
+        }
         free(dbLayer);
         rxClose(rx);
         free(rx);
@@ -421,6 +411,20 @@ int rx2listRun(const char *portArg, const char *layerArg, const bool useUnknownI
     rxGetVerStr(rx, verStr, sizeof(verStr));
     ioOutputStr("# %s, layer %s (%d/%d items)\n", verStr,
         layerName, useUnknownItems ? dbLayer->nKv : dbLayer->nKvKnown, dbLayer->nKv);
+
+    // Stringify all values at once, which is much faster than one by one (fall back to that if this fails)
+    UBLOXCFG_KEYVAL_t *kvs = dbLayer->nKv > 0 ? malloc(dbLayer->nKv * sizeof(*kvs)) : NULL;
+    const char **strs = dbLayer->nKv > 0 ? calloc(dbLayer->nKv, sizeof(*strs)) : NULL;
+    char *strsBuf = NULL;
+    if ( (kvs != NULL) && (strs != NULL) )
+    {
+        for (int ix = 0; ix < dbLayer->nKv; ix++)
+        {
+            kvs[ix] = dbLayer->recs[ix].kv;
+        }
+        strsBuf = ubloxcfg_stringifyValues(kvs, dbLayer->nKv, strs);
+    }
+
     for (int ix = 0; ix < dbLayer->nKv; ix++)
     {
         const UBLOXCFG_KEYVAL_t *kv = &dbLayer->recs[ix].kv;
@@ -435,10 +439,22 @@ int rx2listRun(const char *portArg, const char *layerArg, const bool useUnknownI
         const UBLOXCFG_KEYVAL_t *defaultKv = dbLayer != dbDefault ?
             _dbFindKeyVal(dbDefault, kv->id) : NULL;
 
-        _addOutputKeyValuePair(kv, item, defaultKv);
+        _addOutputKeyValuePair(kv, item, defaultKv, strsBuf != NULL ? strs[ix] : NULL);
     }
 
     // Clean up
+    if (strsBuf != NULL)
+    {
+        free(strsBuf);
+    }
+    if (strs != NULL)
+    {
+        free(strs);
+    }
+    if (kvs != NULL)
+    {
+        free(kvs);
+    }
     if (dbDefault != dbLayer)
     {
         free(dbDefault);
@@ -462,40 +478,72 @@ int rx2listRun(const char *portArg, const char *layerArg, const bool useUnknownI
 
 static int _dbSortFunc(const void *a, const void *b);
 
-static CFG_DB_t *_getCfgDb(RX_t *rx, UBLOXCFG_LAYER_t layer)
+static void _fillCfgDb(CFG_DB_t *db, const UBLOXCFG_KEYVAL_t *kv, const int nKv);
+
+// Poll layer and default layer (both at once), dbDefault is dbLayer for layer Default
+static bool _getCfgDbs(RX_t *rx, const UBLOXCFG_LAYER_t layer, CFG_DB_t **dbLayer, CFG_DB_t **dbDefault)
 {
-    CFG_DB_t *db = malloc(sizeof(CFG_DB_t));
-    UBLOXCFG_KEYVAL_t *kv = malloc(sizeof(UBLOXCFG_KEYVAL_t) * NUMOF(db->recs));
-    if ( (db == NULL) || (kv == NULL) )
-    {
-        WARNING("_getCfgDb() malloc fail");
-        free(db);
+    const int numLayers = layer == UBLOXCFG_LAYER_DEFAULT ? 1 : 2;
+    CFG_DB_t *dbs[2] = { malloc(sizeof(CFG_DB_t)), NULL };
+    dbs[1] = numLayers > 1 ? malloc(sizeof(CFG_DB_t)) : dbs[0];
+    UBLOXCFG_KEYVAL_t *kv = malloc(numLayers * sizeof(UBLOXCFG_KEYVAL_t) * MAX_ITEMS);
+    if ( (dbs[0] == NULL) || (dbs[1] == NULL) || (kv == NULL) )
+    {
+        WARNING("_getCfgDbs() malloc fail");
+        if (dbs[1] != dbs[0])
+        {
+            free(dbs[1]);
+        }
+        free(dbs[0]);
         free(kv);
-        return NULL;
+        return false;
     }
-    memset(db, 0, sizeof(*db));
-    db->layer = layer;
-    const char *layerName = ubloxcfg_layerName(layer);
 
     // Poll all configuration items
-    PRINT("Polling receiver configuration for layer %s", layerName);
-
-
+    PRINT("Polling receiver configuration for layer %s%s", ubloxcfg_layerName(layer),
+        numLayers > 1 ? " and layer Default" : "");
+    RX_GETCONFIG_t layers[] =
+    {
+        { .layer = layer,                  .kv = &kv[0],         .maxKv = MAX_ITEMS },
+        { .layer = UBLOXCFG_LAYER_DEFAULT, .kv = &kv[MAX_ITEMS], .maxKv = MAX_ITEMS },
+    };
     const uint32_t keys[] = { UBX_CFG_VALGET_V0_ALL_WILDCARD };
-    db->nKv = rxGetConfig(rx, layer, keys, NUMOF(keys), kv, NUMOF(db->recs));
+    const bool res = rxGetConfigLayers(rx, keys, NUMOF(keys), layers, numLayers);
+    for (int ix = 0; res && (ix < numLayers); ix++)
+    {
+        dbs[ix]->layer = layers[ix].layer;
+        _fillCfgDb(dbs[ix], layers[ix].kv, layers[ix].numKv);
+    }
+    free(kv);
 
-    if (db->nKv < 0)
+    if (res)
     {
-        free(db);
-        free(kv);
-        return NULL;
+        *dbLayer = dbs[0];
+        *dbDefault = dbs[1];
+    }
+    else
+    {
+        if (dbs[1] != dbs[0])
+        {
+            free(dbs[1]);
+        }
+        free(dbs[0]);
     }
+    return res;
+}
+
+static void _fillCfgDb(CFG_DB_t *db, const UBLOXCFG_KEYVAL_t *kv, const int nKv)
+{
+    db->nKv = nKv;
+    db->nKvKnown = 0;
+    db->nKvUnknown = 0;
 
     // Check items, stringify and mark known ones
     for (int ix = 0; ix < db->nKv; ix++)
     {
         db->recs[ix].kv   = kv[ix];
         db->recs[ix].item = ubloxcfg_getItemById(kv[ix].id);
+        db->recs[ix].flag = false;
         if (db->recs[ix].item != NULL)
         {
             db->nKvKnown++;
@@ -509,11 +557,8 @@ static CFG_DB_t *_getCfgDb(RX_t *rx, UBLOXCFG_LAYER_t layer)
     // Sort
     qsort(db->recs, db->nKv, sizeof(*db->recs), _dbSortFunc);
 
-    PRINT("Layer %s: %d items (%d known, %d unknown)", layerName,
+    PRINT("Layer %s: %d items (%d known, %d unknown)", ubloxcfg_layerName(db->layer),
         db->nKv, db->nKvKnown, db->nKvUnknown);
-
-    free(kv);
-    return db;
 }
 
 static int _dbSortFunc(const void *a, const void *b)
@@ -732,7 +777,7 @@ static bool _itemCfgStr(const UBLOXCFG_KEYVAL_t *kv, const UBLOXCFG_ITEM_t *item
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-static void _addOutputKeyValuePair(const UBLOXCFG_KEYVAL_t *kv, const UBLOXCFG_ITEM_t *item, const UBLOXCFG_KEYVAL_t *defaultKv)
+static void _addOutputKeyValuePair(const UBLOXCFG_KEYVAL_t *kv, const UBLOXCFG_ITEM_t *item, const UBLOXCFG_KEYVAL_t *defaultKv, const char *valueStr)
 {
     UBLOXCFG_TYPE_t type = UBLOXCFG_TYPE_X8; // stringification format
 
@@ -776,7 +821,17 @@ static void _addOutputKeyValuePair(const UBLOXCFG_KEYVAL_t *kv, const UBLOXCFG_I
     // Stringify value
     char valStr[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
     char *valConstStr = NULL;
-    if (ubloxcfg_stringifyValue(valStr, sizeof(valStr), type, item, &kv->val))
+    bool valStrOk = false;
+    if (valueStr != NULL)
+    {
+        snprintf(valStr, sizeof(valStr), "%s", valueStr);
+        valStrOk = true;
+    }
+    else
+    {
+        valStrOk = ubloxcfg_stringifyValue(valStr, sizeof(valStr), type, item, &kv->val);
+    }
+    if (valStrOk)
     {
         // Prefer pretty value
         char *dummy;
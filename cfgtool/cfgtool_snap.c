@@ -0,0 +1,330 @@
+/* ************************************************************************************************/ // clang-format off
+// u-blox 9 positioning receivers configuration tool
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <string.h>
+#include <stddef.h>
+#include <inttypes.h>
+
+#include "ubloxcfg.h"
+
+#include "cfgtool_util.h"
+#include "cfgtool_cfg2rx.h"
+
+#include "ff_rx.h"
+#include "ff_ubx.h"
+
+#include "cfgtool_snap.h"
+
+/* ****************************************************************************************************************** */
+
+const char *rx2snapHelp(void)
+{
+    return
+// -----------------------------------------------------------------------------
+"Command 'rx2snap':\n"
+"\n"
+"    Usage: cfgtool rx2snap [-o <outfile>] [-y] -p <port> -l <layer> [-u]\n"
+"\n"
+"    This reads the configuration of a layer in the receiver and saves it as a\n"
+"    configuration snapshot. A snapshot is a compact binary file with the\n"
+"    (sorted) item IDs and (packed) values, the layer, the receiver version and\n"
+"    a hash of the content. Snapshots with the same items and values have the\n"
+"    same hash, regardless of the receiver and layer they were taken from. The\n"
+"    hash can be shown using the 'snap2cfg' command.\n"
+"\n"
+"    Snapshots can be used as the <infile> for the 'cfg2rx' (and 'cfg2ubx',\n"
+"    etc.) commands.\n"
+"\n"
+"    The '-u' flag adds all unknown (to this tool) configuration items as well.\n"
+"\n";
+}
+
+const char *cfg2snapHelp(void)
+{
+    return
+// -----------------------------------------------------------------------------
+"Command 'cfg2snap':\n"
+"\n"
+"    Usage: cfgtool cfg2snap [-i <infile>] [-o <outfile>] [-y]\n"
+"\n"
+"    This converts a configuration file (see the 'cfg2rx' command) to a\n"
+"    configuration snapshot (see the 'rx2snap' command).\n"
+"\n";
+}
+
+const char *snap2cfgHelp(void)
+{
+    return
+// -----------------------------------------------------------------------------
+"Command 'snap2cfg':\n"
+"\n"
+"    Usage: cfgtool snap2cfg [-i <infile>] [-o <outfile>] [-y] [-x]\n"
+"\n"
+"    This converts a configuration snapshot (see the 'rx2snap' command) to a\n"
+"    configuration file with one <key> <value> pair per line. The first line\n"
+"    is a comment with the information from the snapshot (receiver, layer,\n"
+"    number of items and content hash). The '-x' flag adds the raw values and\n"
+"    the item types as comments.\n"
+"\n";
+}
+
+/* ****************************************************************************************************************** */
+
+#define MAX_ITEMS 3000
+
+int rx2snapRun(const char *portArg, const char *layerArg, const bool useUnknownItems)
+{
+    // Check parameters
+    UBLOXCFG_LAYER_t layer;
+    if (!ubloxcfg_layerFromName(layerArg, &layer))
+    {
+        return EXIT_BADARGS;
+    }
+    const char *layerName = ubloxcfg_layerName(layer);
+
+    UBLOXCFG_KEYVAL_t *kv = malloc(MAX_ITEMS * sizeof(*kv));
+    uint8_t *data = malloc(UBLOXCFG_SNAPSHOT_MAX_SIZE(MAX_ITEMS));
+    if ( (kv == NULL) || (data == NULL) )
+    {
+        WARNING("malloc fail");
+        free(kv);
+        free(data);
+        return EXIT_OTHERFAIL;
+    }
+
+    // Connect and detect receiver
+    RX_t *rx = rxInit(portArg, NULL);
+    if ( (rx == NULL) || !rxOpen(rx) )
+    {
+        free(rx);
+        free(kv);
+        free(data);
+        return EXIT_RXFAIL;
+    }
+
+    // Poll all configuration items
+    PRINT("Polling receiver configuration for layer %s", layerName);
+    const uint32_t keys[] = { UBX_CFG_VALGET_V0_ALL_WILDCARD };
+    const int nAllKv = rxGetConfig(rx, layer, keys, NUMOF(keys), kv, MAX_ITEMS);
+    UBLOXCFG_SNAPSHOT_t info = { .haveLayer = true, .layer = layer };
+    snprintf(info.rxInfo, sizeof(info.rxInfo), "unknown receiver");
+    rxGetVerStr(rx, info.rxInfo, sizeof(info.rxInfo));
+    rxClose(rx);
+    free(rx);
+    if (nAllKv < 0)
+    {
+        free(kv);
+        free(data);
+        return EXIT_RXNODATA;
+    }
+
+    // Remove unknown items unless we want them
+    int nKv = 0;
+    int nKvUnknown = 0;
+    for (int ix = 0; ix < nAllKv; ix++)
+    {
+        const bool known = (ubloxcfg_getItemById(kv[ix].id) != NULL);
+        if (!known)
+        {
+            nKvUnknown++;
+        }
+        if (known || useUnknownItems)
+        {
+            kv[nKv++] = kv[ix];
+        }
+    }
+    PRINT("Layer %s: %d items (%d known, %d unknown)", layerName, nAllKv, nAllKv - nKvUnknown, nKvUnknown);
+    nKv = ubloxcfg_sortKeyVal(kv, nKv);
+
+    int dataSize = 0;
+    const bool res = ubloxcfg_makeSnapshot(data, UBLOXCFG_SNAPSHOT_MAX_SIZE(MAX_ITEMS), &info, kv, nKv, &dataSize);
+    if (res)
+    {
+        PRINT("Snapshot: %d items, %d bytes, hash 0x%016" PRIx64, nKv, dataSize, ubloxcfg_hashKeyVal(kv, nKv));
+        ioAddOutputBin(data, dataSize);
+    }
+    else
+    {
+        WARNING("Failed making snapshot!");
+    }
+    free(kv);
+    free(data);
+
+    return res && ioWriteOutput(false) ? EXIT_SUCCESS : EXIT_OTHERFAIL;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+int cfg2snapRun(void)
+{
+    int nKv = 0;
+    UBLOXCFG_KEYVAL_t *kv = cfgToKeyVal(&nKv);
+    if (kv == NULL)
+    {
+        return EXIT_OTHERFAIL;
+    }
+    nKv = ubloxcfg_sortKeyVal(kv, nKv);
+
+    const int size = UBLOXCFG_SNAPSHOT_MAX_SIZE(nKv);
+    uint8_t *data = malloc(size);
+    int dataSize = 0;
+    const bool res = (data != NULL) && ubloxcfg_makeSnapshot(data, size, NULL, kv, nKv, &dataSize);
+    if (res)
+    {
+        PRINT("Snapshot: %d items, %d bytes, hash 0x%016" PRIx64, nKv, dataSize, ubloxcfg_hashKeyVal(kv, nKv));
+        ioAddOutputBin(data, dataSize);
+    }
+    else
+    {
+        WARNING("Failed making snapshot!");
+    }
+    free(kv);
+    free(data);
+
+    return res && ioWriteOutput(false) ? EXIT_SUCCESS : EXIT_OTHERFAIL;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+int snap2cfgRun(const bool extraInfo)
+{
+    UBLOXCFG_SNAPSHOT_t info;
+    int nKv = 0;
+    UBLOXCFG_KEYVAL_t *kv = snapToKeyVal(&nKv, &info);
+    if (kv == NULL)
+    {
+        return EXIT_OTHERFAIL;
+    }
+
+    const char **strs = malloc((nKv + 1) * sizeof(*strs));
+    char *buf = strs != NULL ? ubloxcfg_stringifyValues(kv, nKv, strs) : NULL;
+    if ( (buf == NULL) && (nKv > 0) )
+    {
+        WARNING("Failed stringifying values!");
+        free(strs);
+        free(kv);
+        return EXIT_OTHERFAIL;
+    }
+
+    ioOutputStr("# %s, %s%s, %d items, hash 0x%016" PRIx64 "\n", info.rxInfo[0] != '\0' ? info.rxInfo : "unknown receiver",
+        info.haveLayer ? "layer " : "no layer", info.haveLayer ? ubloxcfg_layerName(info.layer) : "", nKv, info.hash);
+    for (int ix = 0; ix < nKv; ix++)
+    {
+        // Prefer pretty value (like rx2list)
+        char str[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
+        snprintf(str, sizeof(str), "%s", strs[ix]);
+        char *valueStr = NULL;
+        char *prettyStr = NULL;
+        if (!ubloxcfg_splitValueStr(str, &valueStr, &prettyStr))
+        {
+            valueStr = str;
+        }
+
+        const UBLOXCFG_ITEM_t *item = ubloxcfg_getItemById(kv[ix].id);
+        char itemName[20];
+        if (item == NULL)
+        {
+            snprintf(itemName, sizeof(itemName), "0x%08" PRIx32, kv[ix].id);
+        }
+        ioOutputStr("%-40s %-25s", item != NULL ? item->name : itemName, prettyStr != NULL ? prettyStr : valueStr);
+        if (extraInfo)
+        {
+            ioOutputStr(" # %s (%s)", strs[ix], item != NULL ? ubloxcfg_typeStr(item->type) : "unknown item");
+        }
+        ioOutputStr("\n");
+    }
+
+    free(buf);
+    free(strs);
+    free(kv);
+
+    return ioWriteOutput(false) ? EXIT_SUCCESS : EXIT_OTHERFAIL;
+}
+
+/* ****************************************************************************************************************** */
+
+bool snapIsInput(void)
+{
+    // Snapshots start with 0x89, which is not valid in configuration files (see ubloxcfg_makeSnapshot())
+    return ioPeekInput() == 0x89;
+}
+
+UBLOXCFG_KEYVAL_t *snapToKeyVal(int *nKv, UBLOXCFG_SNAPSHOT_t *info)
+{
+    // Read all input
+    int size = 0;
+    int maxSize = UBLOXCFG_SNAPSHOT_MAX_SIZE(1000);
+    uint8_t *data = malloc(maxSize);
+    while (data != NULL)
+    {
+        if (size >= maxSize)
+        {
+            maxSize *= 2;
+            uint8_t *newData = realloc(data, maxSize);
+            if (newData == NULL)
+            {
+                free(data);
+                data = NULL;
+                break;
+            }
+            data = newData;
+        }
+        const int num = ioReadInput(&data[size], maxSize - size);
+        if (num < 0) // eof
+        {
+            break;
+        }
+        else if (num == 0) // wait
+        {
+            SLEEP(5);
+            continue;
+        }
+        size += num;
+    }
+    if (data == NULL)
+    {
+        WARNING("malloc fail");
+        return NULL;
+    }
+
+    // Parse snapshot
+    UBLOXCFG_SNAPSHOT_t snapInfo;
+    UBLOXCFG_KEYVAL_t *kv = NULL;
+    bool res = ubloxcfg_parseSnapshot(data, size, &snapInfo, NULL, 0, NULL);
+    if (res)
+    {
+        kv = malloc((snapInfo.nKeyVal + 1) * sizeof(*kv));
+        res = (kv != NULL) && ubloxcfg_parseSnapshot(data, size, &snapInfo, kv, snapInfo.nKeyVal, nKv);
+    }
+    free(data);
+    if (!res)
+    {
+        WARNING("Failed reading snapshot!");
+        free(kv);
+        return NULL;
+    }
+    DEBUG("Snapshot: %s, layer %s, %d items, hash 0x%016" PRIx64, snapInfo.rxInfo,
+        snapInfo.haveLayer ? ubloxcfg_layerName(snapInfo.layer) : "-", snapInfo.nKeyVal, snapInfo.hash);
+    if (info != NULL)
+    {
+        *info = snapInfo;
+    }
+    return kv;
+}
+
+/* ****************************************************************************************************************** */
+// eof
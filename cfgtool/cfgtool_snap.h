@@ -0,0 +1,43 @@
+/* ************************************************************************************************/ // clang-format off
+// u-blox 9 positioning receivers configuration tool
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "ubloxcfg.h"
+
+#ifndef __CFGTOOL_SNAP_H__
+#define __CFGTOOL_SNAP_H__
+
+/* ****************************************************************************************************************** */
+
+const char *rx2snapHelp(void);
+int rx2snapRun(const char *portArg, const char *layerArg, const bool useUnknownItems);
+
+const char *cfg2snapHelp(void);
+int cfg2snapRun(void);
+
+const char *snap2cfgHelp(void);
+int snap2cfgRun(const bool extraInfo);
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool snapIsInput(void);
+UBLOXCFG_KEYVAL_t *snapToKeyVal(int *nKv, UBLOXCFG_SNAPSHOT_t *info);
+
+/* ****************************************************************************************************************** */
+#endif // __CFGTOOL_SNAP_H__
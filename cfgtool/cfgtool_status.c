@@ -25,6 +25,9 @@
 #include "ff_rx.h"
 #include "ff_ubx.h"
 #include "ff_epoch.h"
+#include "ff_latency.h"
+#include "ff_rtcm3stats.h"
+#include "ff_time.h"
 
 #include "cfgtool_status.h"
 
@@ -42,6 +45,17 @@ const char *statusHelp(void)
 "    detected epoch. This requires navigation messages, such as UBX-NAV-PVT to\n"
 "    be enabled. The program stops when SIGINT (e.g. CTRL-C)"NOT_WIN(", SIGHUP")"\n"
 "    or SIGTERM is received.\n"
+"\n"
+"    Add -x to output latency statistics [ms] once a minute and at the end.\n"
+"    The stages are: data arrival to message (parser), arrival of the last\n"
+"    message of an epoch to epoch complete (epoch), epoch complete to output\n"
+"    (output) and arrival of the last message to output (total). The parser\n"
+"    stage is also shown for each message type.\n"
+"\n"
+"    With -x RTCM3 correction data statistics are output as well, for each\n"
+"    message type and reference station: message and byte rate, interval\n"
+"    (min/mean/max) and jitter [s], epoch period, gaps (missing epochs) and\n"
+"    age (arrival time minus epoch time, last/min/mean/max) [s].\n"
 "\n";
 }
 
@@ -115,6 +129,39 @@ static void _statusColour(const STATUS_COLOUR_t colour)
 
 #define COLOUR(col) if (colours) { _statusColour(CONCAT(STATUS_COLOUR_, col)); }
 
+static LATENCY_t gLatency;
+
+static bool _printLatency(const LATENCY_t *lat)
+{
+    char str[200];
+    for (int ix = 0; ix < LATENCY_NUM_STAGES; ix++)
+    {
+        latHistStr(&lat->stages[ix], str, sizeof(str));
+        ioOutputStr("latency %-20s %s\n", latencyStageName((LATENCY_STAGE_t)ix), str);
+    }
+    for (int ix = 0; ix < lat->numMsgs; ix++)
+    {
+        latHistStr(&lat->msgs[ix].hist, str, sizeof(str));
+        ioOutputStr("latency %-20s %s\n", lat->msgs[ix].name, str);
+    }
+    return ioWriteOutput(true);
+}
+
+static RTCM3_STATS_t gRtcm3Stats;
+
+static bool _printRtcm3Stats(const RTCM3_STATS_t *stats)
+{
+    char name[20];
+    char str[300];
+    for (int ix = 0; ix < stats->numTypes; ix++)
+    {
+        rtcm3StatsName(&stats->types[ix], name, sizeof(name));
+        rtcm3StatsStr(&stats->types[ix], str, sizeof(str));
+        ioOutputStr("rtcm3 %-8s %4d %s\n", name, stats->types[ix].refStaId, str);
+    }
+    return ioWriteOutput(true);
+}
+
 static bool _printInfo(const bool colours, const INFO_t *info, const EPOCH_t *epoch)
 {
     ioOutputStr("%4u %4u %4u %4u %4u %4u %5u | ",
@@ -181,7 +228,8 @@ int statusRun(const char *portArg, const bool extraInfo, const bool noProbe)
     DEBUG_CFG_t debugCfg;
     debugGetCfg(&debugCfg);
 
-    (void)extraInfo;
+    latencyInit(&gLatency);
+    rtcm3StatsInit(&gRtcm3Stats);
 
     INFO_t info;
     memset(&info, 0, sizeof(info));
@@ -201,6 +249,7 @@ int statusRun(const char *portArg, const bool extraInfo, const bool noProbe)
     ioWriteOutput(false);
 
     uint32_t lastEpoch = TIME();
+    uint32_t lastLatency = lastEpoch;
 
     while (!gAbort)
     {
@@ -209,14 +258,27 @@ int statusRun(const char *portArg, const bool extraInfo, const bool noProbe)
         if (msg != NULL)
         {
             info.nMsgs++;
+            if (extraInfo)
+            {
+                latencyAddMsg(&gLatency, msg, TIME_NS());
+            }
             if (epochCollect(&coll, msg, &epoch))
             {
                 info.nEpoch++;
                 lastEpoch = now;
+                if (extraInfo)
+                {
+                    latencyAddEpoch(&gLatency, &epoch);
+                }
                 if (!_printInfo(debugCfg.colour, &info, &epoch))
                 {
                     break;
                 }
+                // Epoch has been written to the output
+                if (extraInfo)
+                {
+                    latencyAddOutput(&gLatency, &epoch, TIME_NS());
+                }
             }
             switch (msg->type)
             {
@@ -243,6 +305,10 @@ int statusRun(const char *portArg, const bool extraInfo, const bool noProbe)
                     break;
                 case PARSER_MSGTYPE_RTCM3:
                     info.nRtcm3++;
+                    if (extraInfo)
+                    {
+                        rtcm3StatsAdd(&gRtcm3Stats, msg, msg->tsNs, posixNow());
+                    }
                     break;
                 case PARSER_MSGTYPE_SPARTN:
                     info.nSpartn++;
@@ -265,6 +331,17 @@ int statusRun(const char *portArg, const bool extraInfo, const bool noProbe)
             _printInfo(debugCfg.colour, &info, NULL);
             lastEpoch = now;
         }
+        if ( extraInfo && ((now - lastLatency) > 60000) )
+        {
+            _printLatency(&gLatency);
+            _printRtcm3Stats(&gRtcm3Stats);
+            lastLatency = now;
+        }
+    }
+    if (extraInfo)
+    {
+        _printLatency(&gLatency);
+        _printRtcm3Stats(&gRtcm3Stats);
     }
     bool res = ioWriteOutput(true);
 
@@ -24,6 +24,8 @@
 #include <stdarg.h>
 #include <fcntl.h>
 #include <limits.h>
+#include <sys/stat.h>
+#include <sys/types.h>
 
 #include "ubloxcfg.h"
 
@@ -118,6 +120,16 @@ IO_LINE_t *ioGetNextInputLine(void)
     return res ? &resLine : NULL;
 }
 
+int ioPeekInput(void)
+{
+    const int c = fgetc(gInFile);
+    if (c != EOF)
+    {
+        ungetc(c, gInFile);
+    }
+    return c;
+}
+
 int ioReadInput(uint8_t *data, const int size)
 {
     int res = 0;
@@ -308,6 +320,51 @@ bool ioWriteOutput(const bool append)
 
 /* ****************************************************************************************************************** */
 
+bool cacheFilePath(char *path, const int size, const char *name)
+{
+    // Windows: %LOCALAPPDATA%\ubloxcfg\<name>, others: $XDG_CACHE_HOME/ubloxcfg/<name> or ~/.cache/ubloxcfg/<name>
+#ifdef _WIN32
+    const char *base = getenv("LOCALAPPDATA");
+    const char *sub = "";
+#else
+    const char *base = getenv("XDG_CACHE_HOME");
+    const char *sub = "";
+    if ( (base == NULL) || (base[0] == '\0') )
+    {
+        base = getenv("HOME");
+        sub = "/.cache";
+    }
+#endif
+    if ( (base == NULL) || (base[0] == '\0') )
+    {
+        return false;
+    }
+
+    // Create directories, if necessary
+    const char *dirs[] = { "", "/ubloxcfg" };
+    for (int ix = 0; ix < NUMOF(dirs); ix++)
+    {
+        if (snprintf(path, size, "%s%s%s", base, sub, dirs[ix]) >= size)
+        {
+            return false;
+        }
+#ifdef _WIN32
+        const int res = mkdir(path);
+#else
+        const int res = mkdir(path, 0755);
+#endif
+        if ( (res != 0) && (errno != EEXIST) )
+        {
+            DEBUG("Failed creating %s: %s", path, strerror(errno));
+            return false;
+        }
+    }
+
+    return snprintf(path, size, "%s%s/ubloxcfg/%s", base, sub, name) < size;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 bool layersStringToFlags(const char *layers, bool *ram, bool *bbr, bool *flash, bool *def)
 {
     char tmp[200];
@@ -46,6 +46,7 @@ typedef struct IO_LINE_s
 void ioSetOutput(const char *name, FILE *file, const bool overwrite);
 void ioSetInput(const char *name, FILE *file);
 IO_LINE_t *ioGetNextInputLine(void);
+int  ioPeekInput(void);
 int  ioReadInput(uint8_t *data, const int size);
 void ioOutputStr(const char *fmt, ...);
 void ioAddOutputBin(const uint8_t *data, const int size);
@@ -56,5 +57,8 @@ bool ioWriteOutput(const bool append);
 
 bool layersStringToFlags(const char *layers, bool *ram, bool *bbr, bool *flash, bool *def);
 
+// Get path of a file in the cache directory (and create the directory)
+bool cacheFilePath(char *path, const int size, const char *name);
+
 /* ****************************************************************************************************************** */
 #endif // __CFGTOOL_UTIL_H__
@@ -0,0 +1,340 @@
+// flipflip's multi-source time alignment
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "ff_stuff.h"
+#include "ff_debug.h"
+
+#include "ff_align.h"
+
+/* ****************************************************************************************************************** */
+
+STATIC_ASSERT(ALIGN_MAX_SOURCES < 31); // ALIGN_TUPLE_t.mask, BIT()
+
+// Pending tuple
+typedef struct ALIGN_SLOT_s
+{
+    bool           used;
+    uint64_t       firstNs;   // arrival of the first item
+    ALIGN_TUPLE_t  tuple;
+    uint8_t       *data;      // item storage (numSources x itemSize)
+} ALIGN_SLOT_t;
+
+struct ALIGN_s
+{
+    ALIGN_CFG_t    cfg;
+    ALIGN_STATS_t  stats;
+    uint32_t       allMask;                      // mask of all sources
+    int            numUsed;                      // number of used slots
+    int            outSlot;                      // slot of the tuple output last, -1 = none
+    bool           haveOutTime;
+    double         outTime;                      // time of the tuple output last
+    uint32_t       haveLastTime;                 // sources that have lastTimes[]
+    double         lastTimes[ALIGN_MAX_SOURCES]; // time of the latest item of each source
+    ALIGN_SLOT_t  *slots;                        // numSlots slots
+};
+
+ALIGN_t *alignInit(const ALIGN_CFG_t *cfg)
+{
+    if ( (cfg == NULL) || (cfg->numSources < 1) || (cfg->numSources > ALIGN_MAX_SOURCES) || (cfg->itemSize < 1) ||
+         (cfg->numSlots < 1) || !(cfg->tolerance >= 0.0) )
+    {
+        WARNING("alignInit() bad config!");
+        return NULL;
+    }
+
+    // One allocation for everything: handle, slots, item storage
+    const size_t slotsOffs = sizeof(ALIGN_t);
+    const size_t dataOffs = slotsOffs + (cfg->numSlots * sizeof(ALIGN_SLOT_t));
+    const size_t slotSize = (size_t)cfg->numSources * (size_t)cfg->itemSize;
+    uint8_t *mem = malloc(dataOffs + (cfg->numSlots * slotSize));
+    if (mem == NULL)
+    {
+        WARNING("alignInit() malloc fail!");
+        return NULL;
+    }
+
+    ALIGN_t *align = (ALIGN_t *)mem;
+    memset(align, 0, sizeof(*align));
+    align->cfg = *cfg;
+    align->allMask = BIT(cfg->numSources) - 1;
+    align->slots = (ALIGN_SLOT_t *)&mem[slotsOffs];
+    for (int ix = 0; ix < cfg->numSlots; ix++)
+    {
+        align->slots[ix].data = &mem[dataOffs + (ix * slotSize)];
+    }
+    alignReset(align);
+
+    return align;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void alignFree(ALIGN_t *align)
+{
+    free(align);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void alignReset(ALIGN_t *align)
+{
+    memset(&align->stats, 0, sizeof(align->stats));
+    align->numUsed = 0;
+    align->outSlot = -1;
+    align->haveOutTime = false;
+    align->outTime = 0.0;
+    align->haveLastTime = 0;
+    for (int ix = 0; ix < align->cfg.numSlots; ix++)
+    {
+        align->slots[ix].used = false;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// Release slot of the tuple output last
+static void _alignReleaseOut(ALIGN_t *align)
+{
+    if (align->outSlot >= 0)
+    {
+        align->slots[align->outSlot].used = false;
+        align->numUsed--;
+        align->outSlot = -1;
+    }
+}
+
+// Find slot with the oldest tuple, -1 if there are no (pending) tuples
+static int _alignOldest(const ALIGN_t *align)
+{
+    int oldest = -1;
+    for (int ix = 0; ix < align->cfg.numSlots; ix++)
+    {
+        const ALIGN_SLOT_t *slot = &align->slots[ix];
+        if (slot->used && ( (oldest < 0) || (slot->tuple.time < align->slots[oldest].tuple.time) ))
+        {
+            oldest = ix;
+        }
+    }
+    return oldest;
+}
+
+// Output tuple
+static const ALIGN_TUPLE_t *_alignOutput(ALIGN_t *align, const int ix)
+{
+    ALIGN_SLOT_t *slot = &align->slots[ix];
+    slot->tuple.complete = (slot->tuple.mask == align->allMask);
+    align->outSlot = ix;
+    align->haveOutTime = true;
+    align->outTime = slot->tuple.time;
+    align->stats.numTuples++;
+    if (slot->tuple.complete)
+    {
+        align->stats.numComplete++;
+    }
+    return &slot->tuple;
+}
+
+// Add item to a tuple, returns the storage for the item, or NULL if it was dropped
+static void *_alignAdd(ALIGN_t *align, const int source, const double time, const uint64_t nowNs)
+{
+    _alignReleaseOut(align);
+
+    if ( (source < 0) || (source >= align->cfg.numSources) || !isfinite(time) )
+    {
+        align->stats.numInvalid++;
+        return NULL;
+    }
+
+    // Keep track of the progress of each source
+    if (!CHKBITS_ANY(align->haveLastTime, BIT(source)) || (time > align->lastTimes[source]))
+    {
+        align->lastTimes[source] = time;
+        align->haveLastTime |= BIT(source);
+    }
+
+    // Find the closest pending tuple
+    int slotIx = -1;
+    double bestDt = 0.0;
+    for (int ix = 0; ix < align->cfg.numSlots; ix++)
+    {
+        const ALIGN_SLOT_t *slot = &align->slots[ix];
+        const double dt = fabs(slot->tuple.time - time);
+        if (slot->used && (dt <= align->cfg.tolerance) && ( (slotIx < 0) || (dt < bestDt) ))
+        {
+            slotIx = ix;
+            bestDt = dt;
+        }
+    }
+
+    ALIGN_SLOT_t *slot = NULL;
+    if (slotIx >= 0)
+    {
+        slot = &align->slots[slotIx];
+        if (CHKBITS_ANY(slot->tuple.mask, BIT(source)))
+        {
+            align->stats.numDuplicate++;
+            return NULL;
+        }
+    }
+    else
+    {
+        // Too late, tuple has already been output
+        if (align->haveOutTime && (time <= (align->outTime + align->cfg.tolerance)))
+        {
+            align->stats.numLate++;
+            return NULL;
+        }
+
+        // No free slot, evict oldest tuple (the application didn't call alignGet())
+        if (align->numUsed >= align->cfg.numSlots)
+        {
+            const int oldest = _alignOldest(align);
+            if (align->slots[oldest].tuple.time > time)
+            {
+                align->stats.numLate++;
+                return NULL;
+            }
+            align->haveOutTime = true;
+            align->outTime = align->slots[oldest].tuple.time;
+            align->slots[oldest].used = false;
+            align->numUsed--;
+            align->stats.numEvicted++;
+        }
+
+        // Start new tuple
+        for (int ix = 0; ix < align->cfg.numSlots; ix++)
+        {
+            if (!align->slots[ix].used)
+            {
+                slot = &align->slots[ix];
+                break;
+            }
+        }
+        slot->used = true;
+        slot->firstNs = nowNs;
+        memset(&slot->tuple, 0, sizeof(slot->tuple));
+        slot->tuple.time = time;
+        align->numUsed++;
+    }
+
+    slot->tuple.mask |= BIT(source);
+    slot->tuple.num++;
+    slot->tuple.times[source] = time;
+    void *item = &slot->data[source * align->cfg.itemSize];
+    slot->tuple.items[source] = item;
+    align->stats.numAdded++;
+    return item;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool alignAdd(ALIGN_t *align, const int source, const double time, const void *item, const uint64_t nowNs)
+{
+    void *dst = _alignAdd(align, source, time, nowNs);
+    if (dst != NULL)
+    {
+        memcpy(dst, item, align->cfg.itemSize);
+        return true;
+    }
+    return false;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool alignAddEpoch(ALIGN_t *align, const int source, const EPOCH_t *epoch)
+{
+    if ( (align->cfg.itemSize != (int)sizeof(EPOCH_t)) || !epoch->havePosixTime )
+    {
+        _alignReleaseOut(align);
+        align->stats.numInvalid++;
+        return false;
+    }
+    EPOCH_t *dst = _alignAdd(align, source, epoch->posixTime, epoch->tsNs);
+    if (dst != NULL)
+    {
+        epochCopy(dst, epoch);
+        return true;
+    }
+    return false;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const ALIGN_TUPLE_t *alignGet(ALIGN_t *align, const uint64_t nowNs)
+{
+    _alignReleaseOut(align);
+
+    const int oldest = _alignOldest(align);
+    if (oldest < 0)
+    {
+        return NULL;
+    }
+    const ALIGN_SLOT_t *slot = &align->slots[oldest];
+
+    // All sources have an item
+    if (slot->tuple.mask == align->allMask)
+    {
+        return _alignOutput(align, oldest);
+    }
+
+    // All sources have moved on to later items, so that the tuple can't get more items
+    const double limit = slot->tuple.time + align->cfg.tolerance;
+    bool passed = (align->haveLastTime == align->allMask);
+    for (int source = 0; passed && (source < align->cfg.numSources); source++)
+    {
+        if (!CHKBITS_ANY(slot->tuple.mask, BIT(source)) && (align->lastTimes[source] <= limit))
+        {
+            passed = false;
+        }
+    }
+    if (passed)
+    {
+        return _alignOutput(align, oldest);
+    }
+
+    // Late window expired, or no more space for new tuples
+    if ( ( (align->cfg.lateWindowNs > 0) && (nowNs > 0) && (nowNs >= (slot->firstNs + align->cfg.lateWindowNs)) ) ||
+         (align->numUsed >= align->cfg.numSlots) )
+    {
+        return _alignOutput(align, oldest);
+    }
+
+    return NULL;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const ALIGN_TUPLE_t *alignFlush(ALIGN_t *align)
+{
+    _alignReleaseOut(align);
+
+    const int oldest = _alignOldest(align);
+    return oldest >= 0 ? _alignOutput(align, oldest) : NULL;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void alignGetStats(const ALIGN_t *align, ALIGN_STATS_t *stats)
+{
+    *stats = align->stats;
+}
+
+/* ****************************************************************************************************************** */
+// eof
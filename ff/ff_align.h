@@ -0,0 +1,140 @@
+// flipflip's multi-source time alignment
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+//
+// Streaming alignment of items (e.g. epochs) from several sources (e.g. receivers) by their time. Items
+// that are within a tolerance of each other are grouped into a tuple. Tuples are output in time order
+// once they are complete (all sources have an item), once all sources have moved on to later items, or
+// once the late window expired. Items are copied into a fixed number of pending tuples (slots), so that
+// the memory use is bounded (numSlots x numSources x itemSize). Items arriving after their tuple has
+// been output are dropped.
+
+#ifndef __FF_ALIGN_H__
+#define __FF_ALIGN_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "ff_epoch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ****************************************************************************************************************** */
+
+#define ALIGN_MAX_SOURCES        16    //!< Maximum number of sources
+#define ALIGN_NUM_SLOTS_DEFAULT   8    //!< Suggested number of pending tuples
+
+//! Aligner configuration
+typedef struct ALIGN_CFG_s
+{
+    int       numSources;    //!< Number of sources (1..#ALIGN_MAX_SOURCES)
+    int       itemSize;      //!< Size of items [bytes]
+    int       numSlots;      //!< Maximum number of pending tuples, e.g. #ALIGN_NUM_SLOTS_DEFAULT
+    double    tolerance;     //!< Maximum time difference of items in a tuple [s] (less than half the epoch period)
+    uint64_t  lateWindowNs;  //!< Maximum wait for items of missing sources [ns], 0 = no timeout
+} ALIGN_CFG_t;
+
+//! Time-aligned tuple of items
+typedef struct ALIGN_TUPLE_s
+{
+    double       time;                        //!< Time of the tuple (time of the first item) [s]
+    uint32_t     mask;                        //!< Sources that have an item (bit 0 = source 0, etc.)
+    int          num;                         //!< Number of items
+    bool         complete;                    //!< All sources have an item
+    const void  *items[ALIGN_MAX_SOURCES];    //!< Items by source (NULL for missing items)
+    double       times[ALIGN_MAX_SOURCES];    //!< Time of the items [s]
+} ALIGN_TUPLE_t;
+
+//! Aligner statistics
+typedef struct ALIGN_STATS_s
+{
+    uint32_t  numAdded;      //!< Number of items added to a tuple
+    uint32_t  numLate;       //!< Number of items dropped because their tuple has already been output
+    uint32_t  numDuplicate;  //!< Number of items dropped because their tuple already had an item of the source
+    uint32_t  numInvalid;    //!< Number of items dropped because of a bad source or time
+    uint32_t  numEvicted;    //!< Number of tuples dropped because they were not taken out in time
+    uint32_t  numTuples;     //!< Number of tuples output
+    uint32_t  numComplete;   //!< Number of complete tuples output
+} ALIGN_STATS_t;
+
+//! Aligner handle (opaque)
+typedef struct ALIGN_s ALIGN_t;
+
+//! Create aligner
+/*!
+    \param[in]  cfg  configuration
+
+    \returns the aligner handle (free with alignFree()), or NULL on error (bad configuration, out of memory)
+*/
+ALIGN_t *alignInit(const ALIGN_CFG_t *cfg);
+
+//! Free aligner
+void alignFree(ALIGN_t *align);
+
+//! Reset aligner (discard all pending tuples, clear statistics)
+void alignReset(ALIGN_t *align);
+
+//! Add item
+/*!
+    \param[in,out]  align   aligner handle
+    \param[in]      source  source index (0..ALIGN_CFG_t.numSources-1)
+    \param[in]      time    time of the item [s], e.g. EPOCH_t.posixTime
+    \param[in]      item    item data (ALIGN_CFG_t.itemSize bytes, will be copied)
+    \param[in]      nowNs   arrival time [ns] (TIME_NS()) for the late window, 0 if there is no late window
+
+    \returns true if the item was added, false if it was dropped (see ALIGN_STATS_t)
+
+    \note Call alignGet() after each alignAdd() until it returns NULL. Otherwise pending tuples may be evicted.
+*/
+bool alignAdd(ALIGN_t *align, const int source, const double time, const void *item, const uint64_t nowNs);
+
+//! Add epoch (ALIGN_CFG_t.itemSize must be sizeof(EPOCH_t))
+/*!
+    \param[in,out]  align   aligner handle
+    \param[in]      source  source index (0..ALIGN_CFG_t.numSources-1)
+    \param[in]      epoch   epoch, uses EPOCH_t.posixTime and EPOCH_t.tsNs
+
+    \returns true if the epoch was added, false if it was dropped (e.g. no time)
+*/
+bool alignAddEpoch(ALIGN_t *align, const int source, const EPOCH_t *epoch);
+
+//! Get next tuple
+/*!
+    \param[in,out]  align   aligner handle
+    \param[in]      nowNs   current time [ns] (TIME_NS()) for the late window, 0 if there is no late window
+
+    \returns the oldest tuple if it is ready, NULL otherwise. The tuple (and its items) is valid until the next
+             call to any of the align*() functions.
+*/
+const ALIGN_TUPLE_t *alignGet(ALIGN_t *align, const uint64_t nowNs);
+
+//! Get next tuple, regardless of whether it is ready (e.g. at the end of the input)
+/*!
+    \param[in,out]  align   aligner handle
+
+    \returns the oldest tuple, NULL if there are no more tuples, see alignGet()
+*/
+const ALIGN_TUPLE_t *alignFlush(ALIGN_t *align);
+
+//! Get statistics
+void alignGetStats(const ALIGN_t *align, ALIGN_STATS_t *stats);
+
+/* ****************************************************************************************************************** */
+#ifdef __cplusplus
+}
+#endif
+#endif // __FF_ALIGN_H__
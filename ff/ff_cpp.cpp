@@ -26,7 +26,7 @@
 /* ****************************************************************************************************************** */
 
 Ff::ParserMsg::ParserMsg(const PARSER_MSG_t *_msg) :
-    type{}, data{}, size{_msg->size}, seq{_msg->seq}, ts{_msg->ts}, name{_msg->name}, info{}
+    type{}, data{}, size{_msg->size}, seq{_msg->seq}, ts{_msg->ts}, tsNs{_msg->tsNs}, name{_msg->name}, info{}
 {
     switch (_msg->type)
     {
@@ -56,8 +56,9 @@ Ff::ParserMsg::ParserMsg(const PARSER_MSG_t *_msg) :
 // ---------------------------------------------------------------------------------------------------------------------
 
 Ff::Epoch::Epoch(const EPOCH_t *_epoch) :
-    seq{_epoch->seq}, str{_epoch->str}, epoch{*_epoch}
+    seq{_epoch->seq}, str{_epoch->str}
 {
+    epochCopy(&epoch, _epoch);
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
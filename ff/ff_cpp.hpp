@@ -25,6 +25,7 @@
 #include "ff_epoch.h"
 #include "ff_rx.h"
 #include "ff_stuff.h"
+#include "ff_ubx_view.h"
 
 /* ****************************************************************************************************************** */
 
@@ -42,6 +43,7 @@ namespace Ff
         int         size;
         uint32_t    seq;
         uint32_t    ts;
+        uint64_t    tsNs;
         enum Src_e { UNKN, FROM_RX, TO_RX, VIRTUAL, USER, LOG };
         Src_e       src;
         std::string srcStr;
@@ -55,7 +57,7 @@ namespace Ff
         Epoch(const EPOCH_t *_epoch);
         uint32_t    seq;
         std::string str;
-        EPOCH_t     epoch;
+        EPOCH_t     epoch; // Only the used signals[] and satellites[] are valid, see epochCopy()
     };
 
     // RX_t
@@ -83,6 +85,29 @@ namespace Ff
         UbxMessage(const uint8_t clsId, const uint8_t msgId, const uint8_t *payload, const int payloadSize);
         std::vector<uint8_t> raw;
     };
+
+    // Repeated groups of a UBX_VIEW_t, for example:
+    //     UBX_VIEW_t view;
+    //     if (UBX_NAV_SAT_V1_view(&view, msg, size)) {
+    //         for (const uint8_t *sat: Ff::UbxGroups(view)) { ... UBX_NAV_SAT_V1_GROUP1_cno(sat) ... } }
+    struct UbxGroups
+    {
+        struct Iterator
+        {
+            Iterator(const uint8_t *_grp, const int _size) : grp{_grp}, size{_size} {}
+            const uint8_t *operator*() const { return grp; }
+            Iterator &operator++() { grp += size; return *this; }
+            bool operator!=(const Iterator &rhs) const { return grp != rhs.grp; }
+            const uint8_t *grp;
+            int            size;
+        };
+        UbxGroups(const UBX_VIEW_t &_view) : view{_view} {}
+        Iterator begin() const { return Iterator(view.groups, view.groupSize); }
+        Iterator end() const { return Iterator(view.numGroups > 0 ? UBX_VIEW_GROUP(&view, view.numGroups) : view.groups, view.groupSize); }
+        int size() const { return view.numGroups; }
+        const uint8_t *operator[](const int ix) const { return UBX_VIEW_GROUP(&view, ix); }
+        UBX_VIEW_t view;
+    };
 };
 
 /* ****************************************************************************************************************** */
@@ -19,16 +19,20 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
+#include <inttypes.h>
 #include <math.h>
 #include <float.h>
 
 #include "ff_stuff.h"
 #include "ff_ubx.h"
+#include "ff_ubx_view.h"
 #include "ff_nmea.h"
 #include "ff_trafo.h"
 #include "ff_debug.h"
 #include "ff_trafo.h"
 #include "ff_time.h"
+#include "ff_trace.h"
 
 #include "ff_epoch.h"
 
@@ -37,10 +41,6 @@
 //#define EPOCH_DEBUG(fmt, args...) DEBUG("epoch: " fmt, ## args)
 #define EPOCH_DEBUG(...) /* nothing */
 
-void epochInit(EPOCH_t *coll)
-{
-    memset(coll, 0, sizeof(*coll));
-}
 
 // "Quality" (precision) if information: UBX better than NMEA, UBX high-precision messages better than normal UBX
 typedef enum COLL_QUAL_e
@@ -67,6 +67,9 @@ typedef struct EPOCH_COLLECT_s
     COLL_QUAL_t  haveRelPos;
     bool         relPosValid;
     COLL_QUAL_t  haveDiffAge;
+    COLL_QUAL_t  haveUsedSvs;
+    bool         nmea2d;                           // NMEA-Gx-GSA says 2D fix
+    uint32_t     usedSvs[(EPOCH_NUM_SV + 31) / 32]; // NMEA-Gx-GSA used satellites, bits by epochSvToIx()
 } EPOCH_COLLECT_t;
 
 STATIC_ASSERT(SIZEOF_MEMBER(EPOCH_t, _collect) >= sizeof(EPOCH_COLLECT_t));
@@ -78,42 +81,130 @@ typedef struct EPOCH_DETECT_s
     bool         haveUbxItow;
     int          nmeaMs;
     bool         haveNmeaMs;
+    uint32_t     flags;
+    int          numMsgs;   // Number of messages (that count for detection) in the current epoch
+    int          sigCnt;    // Number of occurrences of endSig in the current epoch
+    uint64_t     lastSig;   // Signature of the last message in the current epoch
+    uint64_t     endSig;    // Signature of the (learned) last message of an epoch
+    int          endCnt;    // Number of occurrences of endSig in an epoch (0 = not known yet)
+    int          endConf;   // Number of epochs that confirmed endSig and endCnt
 } EPOCH_DETECT_t;
 
 STATIC_ASSERT(SIZEOF_MEMBER(EPOCH_t, _detect) >= sizeof(EPOCH_DETECT_t));
 
-static bool _detectUbx(EPOCH_DETECT_t *detect, const PARSER_MSG_t *msg);
-static bool _detectNmea(EPOCH_DETECT_t *detect, const NMEA_MSG_t *nmea);
+void epochInit(EPOCH_t *coll)
+{
+    epochInitEx(coll, EPOCH_FLAGS_NONE);
+}
+
+void epochInitEx(EPOCH_t *coll, const uint32_t flags)
+{
+    memset(coll, 0, sizeof(*coll));
+    EPOCH_DETECT_t *detect = (EPOCH_DETECT_t *)coll->_detect;
+    detect->flags = flags;
+}
+
+static EPOCH_END_t _detectUbx(EPOCH_DETECT_t *detect, const PARSER_MSG_t *msg);
+static EPOCH_END_t _detectNmea(EPOCH_DETECT_t *detect, const NMEA_MSG_t *nmea);
 
 static void _collectUbx(EPOCH_t *coll, EPOCH_COLLECT_t *collect, const PARSER_MSG_t *msg);
 static void _collectNmea(EPOCH_t *coll, EPOCH_COLLECT_t *collect, const NMEA_MSG_t *nmea);
 
-static void _epochComplete(const EPOCH_COLLECT_t *collect, EPOCH_t *epoch);
+static void _epochComplete(const EPOCH_COLLECT_t *collect, const EPOCH_DETECT_t *detect, EPOCH_t *epoch);
 
-bool epochCollect(EPOCH_t *coll, const PARSER_MSG_t *msg, EPOCH_t *epoch)
+void epochCopy(EPOCH_t *dst, const EPOCH_t *src)
 {
-    if ( (coll == NULL) || (msg == NULL) )
+    memcpy(dst, src, offsetof(EPOCH_t, signals));
+    memcpy(dst->signals, src->signals, src->numSignals * sizeof(*src->signals));
+    memcpy(&dst->numSignals, &src->numSignals, offsetof(EPOCH_t, satellites) - offsetof(EPOCH_t, numSignals));
+    memcpy(dst->satellites, src->satellites, src->numSatellites * sizeof(*src->satellites));
+    memcpy(&dst->numSatellites, &src->numSatellites, sizeof(*dst) - offsetof(EPOCH_t, numSatellites));
+}
+
+// Clear epoch, only the used part of the signals and satellites arrays. The unused part must already be zero, which
+// is the case when the epoch was initialised with epochInit() and has only been changed by the code in this file.
+static void _epochClear(EPOCH_t *epoch)
+{
+    memset(epoch->signals, 0, epoch->numSignals * sizeof(*epoch->signals));
+    memset(epoch->satellites, 0, epoch->numSatellites * sizeof(*epoch->satellites));
+    memset(epoch, 0, offsetof(EPOCH_t, signals));
+    memset(&epoch->numSignals, 0, offsetof(EPOCH_t, satellites) - offsetof(EPOCH_t, numSignals));
+    memset(&epoch->numSatellites, 0, sizeof(*epoch) - offsetof(EPOCH_t, numSatellites));
+}
+
+// Message signature (for learning the last message of an epoch), 0 for messages that don't count for detection
+static uint64_t _epochMsgSig(const PARSER_MSG_t *msg, const NMEA_MSG_t *nmea, const bool haveNmea)
+{
+    switch (msg->type)
     {
-        return false;
+        case PARSER_MSGTYPE_UBX:
+            if (UBX_CLSID(msg->data) == UBX_NAV_CLSID)
+            {
+                return ((uint64_t)PARSER_MSGTYPE_UBX << 56) | ((uint64_t)UBX_CLSID(msg->data) << 8) | UBX_MSGID(msg->data);
+            }
+            break;
+        case PARSER_MSGTYPE_NMEA:
+            if (haveNmea)
+            {
+                // Multiple GSV messages (for each GNSS and signal), the last of each group counts
+                const bool last = (nmea->type != NMEA_TYPE_GSV) || (nmea->gsv.msgNum == nmea->gsv.numMsg);
+                return ((uint64_t)PARSER_MSGTYPE_NMEA << 56) | ((uint64_t)last << 48) |
+                    ((uint64_t)(uint8_t)nmea->talker[0] << 40) | ((uint64_t)(uint8_t)nmea->talker[1] << 32) |
+                    ((uint64_t)(uint8_t)nmea->formatter[0] << 16) | ((uint64_t)(uint8_t)nmea->formatter[1] << 8) |
+                    (uint64_t)(uint8_t)nmea->formatter[2];
+            }
+            break;
+        default:
+            break;
     }
-    EPOCH_COLLECT_t *collect = (EPOCH_COLLECT_t *)coll->_collect;
-    EPOCH_DETECT_t  *detect  = (EPOCH_DETECT_t *)coll->_detect;
+    return 0;
+}
 
-    // Decode NMEA here, as this is quite expensive
-    NMEA_MSG_t nmea;
-    bool haveNmea = false;
-    if (msg->type == PARSER_MSGTYPE_NMEA)
+// End of epoch detected, update learning of the last message
+static EPOCH_END_t _epochEnded(EPOCH_DETECT_t *detect, const EPOCH_END_t end)
+{
+    detect->seq++;
+    if (detect->lastSig == detect->endSig)
     {
-        haveNmea = nmeaDecode(&nmea, msg->data, msg->size);
+        if (detect->sigCnt == detect->endCnt)
+        {
+            if (detect->endConf < EPOCH_LEARN_NUM)
+            {
+                detect->endConf++;
+            }
+        }
+        else
+        {
+            detect->endCnt = detect->sigCnt;
+            detect->endConf = 1;
+        }
     }
+    else
+    {
+        if (detect->endConf >= EPOCH_LEARN_NUM)
+        {
+            EPOCH_DEBUG("detect: re-learn (%016" PRIx64 " != %016" PRIx64 ")", detect->lastSig, detect->endSig);
+        }
+        detect->endSig = detect->lastSig;
+        detect->endCnt = 0;
+        detect->endConf = 0;
+    }
+    detect->numMsgs = 0;
+    detect->sigCnt = 0;
+    detect->lastSig = 0;
+    return end;
+}
 
-    // Detect end of epoch / start of next epoch
-    bool complete = false;
+// Detect start of next epoch (before collecting the message)
+static EPOCH_END_t _epochDetectStart(EPOCH_t *coll, const PARSER_MSG_t *msg, const NMEA_MSG_t *nmea, const bool haveNmea)
+{
+    EPOCH_DETECT_t *detect = (EPOCH_DETECT_t *)coll->_detect;
+    EPOCH_END_t end = EPOCH_END_UNKNOWN;
     switch (msg->type)
     {
         case PARSER_MSGTYPE_UBX:
-            complete = _detectUbx(detect, msg);
-            if (complete)
+            end = _detectUbx(detect, msg);
+            if (end != EPOCH_END_UNKNOWN)
             {
                 detect->haveNmeaMs = false;
             }
@@ -121,8 +212,8 @@ bool epochCollect(EPOCH_t *coll, const PARSER_MSG_t *msg, EPOCH_t *epoch)
         case PARSER_MSGTYPE_NMEA:
             if (haveNmea)
             {
-                complete = _detectNmea(detect, &nmea);
-                if (complete)
+                end = _detectNmea(detect, nmea);
+                if (end != EPOCH_END_UNKNOWN)
                 {
                     detect->haveUbxItow = false;
                 }
@@ -131,61 +222,240 @@ bool epochCollect(EPOCH_t *coll, const PARSER_MSG_t *msg, EPOCH_t *epoch)
         default:
             break;
     }
-    // TODO: in case of UBX-NAV-EOE, output that first and complete epoch on next call (if it can be done nicely..)
 
-    // Output epoch
-    if (complete)
+    // Nothing to output if the previous epoch has already been completed by its last message
+    if ( (end == EPOCH_END_UNKNOWN) || (detect->numMsgs == 0) )
     {
-        detect->seq++;
-        if (epoch != NULL)
-        {
-            memcpy(epoch, coll, sizeof(*epoch));
-            epoch->seq = detect->seq;
-            _epochComplete(collect, epoch);
-        }
+        return EPOCH_END_UNKNOWN;
+    }
+    //DEBUG("epoch %u ubx %u %d nmea %d %d", seq, tow, detectHaveTow, ms, detectHaveMs);
+    return _epochEnded(detect, end);
+}
 
-        // Initialise collector
-        const EPOCH_DETECT_t saveDetect = *detect;
-        memset(coll, 0, sizeof(*coll));
-        *detect = saveDetect;
+// Detect end of epoch (after collecting the message). If the message has just completed the previous epoch
+// (_epochDetectStart()) we must not end the new one as well, as only one epoch can be output per message. The epoch
+// is then completed by the next message (or a timeout).
+static EPOCH_END_t _epochDetectEnd(EPOCH_t *coll, const PARSER_MSG_t *msg, const NMEA_MSG_t *nmea, const bool haveNmea,
+    const bool canEnd)
+{
+    EPOCH_DETECT_t *detect = (EPOCH_DETECT_t *)coll->_detect;
+    const uint64_t sig = _epochMsgSig(msg, nmea, haveNmea);
+    if (sig == 0)
+    {
+        return EPOCH_END_UNKNOWN;
+    }
+    detect->numMsgs++;
+    detect->lastSig = sig;
+    if (sig == detect->endSig)
+    {
+        detect->sigCnt++;
+    }
 
-        //DEBUG("epoch %u ubx %u %d nmea %d %d", seq, tow, detectHaveTow, ms, detectHaveMs);
+    if (!canEnd)
+    {
+        return EPOCH_END_UNKNOWN;
     }
 
-    // Collect data
+    EPOCH_END_t end = EPOCH_END_UNKNOWN;
+    if ( (msg->type == PARSER_MSGTYPE_UBX) && (UBX_MSGID(msg->data) == UBX_NAV_EOE_MSGID) )
+    {
+        EPOCH_DEBUG("detect %s", msg->name);
+        end = EPOCH_END_UBX_EOE;
+    }
+    else if ( !CHKBITS(detect->flags, EPOCH_FLAGS_NOLEARN) && (detect->endConf >= EPOCH_LEARN_NUM) &&
+        (sig == detect->endSig) && (detect->sigCnt == detect->endCnt) )
+    {
+        EPOCH_DEBUG("detect %s (learned)", msg->name);
+        end = EPOCH_END_LEARNED;
+    }
+
+    if (end == EPOCH_END_UNKNOWN)
+    {
+        return EPOCH_END_UNKNOWN;
+    }
+    detect->haveUbxItow = false;
+    detect->haveNmeaMs = false;
+    return _epochEnded(detect, end);
+}
+
+// Detect end of epoch by timeout
+static EPOCH_END_t _epochDetectTimeout(EPOCH_t *coll, const uint64_t nowNs, const uint64_t timeoutNs)
+{
+    EPOCH_DETECT_t *detect = (EPOCH_DETECT_t *)coll->_detect;
+    if ( (detect->numMsgs == 0) || (coll->msgTsNs == 0) || (nowNs < (coll->msgTsNs + timeoutNs)) )
+    {
+        return EPOCH_END_UNKNOWN;
+    }
+    detect->haveUbxItow = false;
+    detect->haveNmeaMs = false;
+    return _epochEnded(detect, EPOCH_END_TIMEOUT);
+}
+
+// Collect data
+static void _epochCollectMsg(EPOCH_t *coll, const PARSER_MSG_t *msg, const NMEA_MSG_t *nmea, const bool haveNmea)
+{
+    EPOCH_COLLECT_t *collect = (EPOCH_COLLECT_t *)coll->_collect;
     switch (msg->type)
     {
         case PARSER_MSGTYPE_UBX:
             _collectUbx(coll, collect, msg);
+            coll->msgTsNs = msg->tsNs;
             break;
         case PARSER_MSGTYPE_NMEA:
             if (haveNmea)
             {
-                _collectNmea(coll, collect, &nmea);
+                _collectNmea(coll, collect, nmea);
+                coll->msgTsNs = msg->tsNs;
             }
             break;
         default:
             break;
     }
+}
+
+// Output epoch (copy) and initialise collector
+static void _epochOutput(EPOCH_t *coll, EPOCH_t *epoch, const EPOCH_END_t end)
+{
+    EPOCH_DETECT_t *detect = (EPOCH_DETECT_t *)coll->_detect;
+    const EPOCH_DETECT_t saveDetect = *detect;
+    if (epoch != NULL)
+    {
+        epochCopy(epoch, coll);
+        epoch->seq = saveDetect.seq;
+        epoch->endBy = end;
+        _epochComplete((const EPOCH_COLLECT_t *)coll->_collect, &saveDetect, epoch);
+        TRACE_EVENT(TRACE_EV_EPOCH, epoch->seq, epoch->fix, epoch->numSatUsed);
+    }
+    _epochClear(coll);
+    *detect = saveDetect;
+}
+
+bool epochCollect(EPOCH_t *coll, const PARSER_MSG_t *msg, EPOCH_t *epoch)
+{
+    if ( (coll == NULL) || (msg == NULL) )
+    {
+        return false;
+    }
+
+    // Decode NMEA here, as this is quite expensive
+    NMEA_MSG_t nmea;
+    const bool haveNmea = (msg->type == PARSER_MSGTYPE_NMEA) && nmeaDecode(&nmea, msg->data, msg->size);
+
+    // First message of the next epoch?
+    EPOCH_END_t end = _epochDetectStart(coll, msg, &nmea, haveNmea);
+    const bool complete = (end != EPOCH_END_UNKNOWN);
+    if (complete)
+    {
+        _epochOutput(coll, epoch, end);
+    }
+
+    _epochCollectMsg(coll, msg, &nmea, haveNmea);
+
+    // Last message of the epoch? (we can only output one epoch per call)
+    end = _epochDetectEnd(coll, msg, &nmea, haveNmea, !complete);
+    if (end != EPOCH_END_UNKNOWN)
+    {
+        _epochOutput(coll, epoch, end);
+        return true;
+    }
 
     return complete;
 }
 
-static bool _detectUbx(EPOCH_DETECT_t *detect, const PARSER_MSG_t *msg)
+bool epochTimeout(EPOCH_t *coll, const uint64_t nowNs, const uint64_t timeoutNs, EPOCH_t *epoch)
+{
+    if (coll == NULL)
+    {
+        return false;
+    }
+    const EPOCH_END_t end = _epochDetectTimeout(coll, nowNs, timeoutNs);
+    if (end != EPOCH_END_UNKNOWN)
+    {
+        _epochOutput(coll, epoch, end);
+        return true;
+    }
+    return false;
+}
+
+void epochCollectorInit(EPOCH_COLLECTOR_t *collector, const uint32_t flags)
+{
+    memset(collector, 0, sizeof(*collector));
+    EPOCH_DETECT_t *detect = (EPOCH_DETECT_t *)collector->_bufs[collector->_coll]._detect;
+    detect->flags = flags;
+}
+
+// Complete epoch in place and continue collecting into the other buffer, which holds the previous epoch
+static EPOCH_t *_epochCollectorSwap(EPOCH_COLLECTOR_t *collector, const EPOCH_END_t end)
+{
+    EPOCH_t *epoch = &collector->_bufs[collector->_coll];
+    collector->_coll ^= 1;
+    EPOCH_t *coll = &collector->_bufs[collector->_coll];
+    _epochClear(coll);
+    memcpy(coll->_detect, epoch->_detect, sizeof(coll->_detect));
+
+    const EPOCH_DETECT_t *detect = (const EPOCH_DETECT_t *)epoch->_detect;
+    epoch->seq = detect->seq;
+    epoch->endBy = end;
+    _epochComplete((const EPOCH_COLLECT_t *)epoch->_collect, detect, epoch);
+    TRACE_EVENT(TRACE_EV_EPOCH, epoch->seq, epoch->fix, epoch->numSatUsed);
+    return epoch;
+}
+
+const EPOCH_t *epochCollectorAdd(EPOCH_COLLECTOR_t *collector, const PARSER_MSG_t *msg)
+{
+    if ( (collector == NULL) || (msg == NULL) )
+    {
+        return NULL;
+    }
+
+    // Decode NMEA here, as this is quite expensive
+    NMEA_MSG_t nmea;
+    const bool haveNmea = (msg->type == PARSER_MSGTYPE_NMEA) && nmeaDecode(&nmea, msg->data, msg->size);
+
+    // First message of the next epoch?
+    EPOCH_t *epoch = NULL;
+    EPOCH_END_t end = _epochDetectStart(&collector->_bufs[collector->_coll], msg, &nmea, haveNmea);
+    if (end != EPOCH_END_UNKNOWN)
+    {
+        epoch = _epochCollectorSwap(collector, end);
+    }
+
+    EPOCH_t *coll = &collector->_bufs[collector->_coll];
+    _epochCollectMsg(coll, msg, &nmea, haveNmea);
+
+    // Last message of the epoch? (we can only output one epoch per call)
+    end = _epochDetectEnd(coll, msg, &nmea, haveNmea, epoch == NULL);
+    if (end != EPOCH_END_UNKNOWN)
+    {
+        epoch = _epochCollectorSwap(collector, end);
+    }
+
+    return epoch;
+}
+
+const EPOCH_t *epochCollectorTimeout(EPOCH_COLLECTOR_t *collector, const uint64_t nowNs, const uint64_t timeoutNs)
+{
+    if (collector == NULL)
+    {
+        return NULL;
+    }
+    const EPOCH_END_t end = _epochDetectTimeout(&collector->_bufs[collector->_coll], nowNs, timeoutNs);
+    return end != EPOCH_END_UNKNOWN ? _epochCollectorSwap(collector, end) : NULL;
+}
+
+static EPOCH_END_t _detectUbx(EPOCH_DETECT_t *detect, const PARSER_MSG_t *msg)
 {
     const uint8_t clsId = UBX_CLSID(msg->data);
     if (clsId != UBX_NAV_CLSID)
     {
-        return false;
+        return EPOCH_END_UNKNOWN;
     }
     const uint8_t msgId = UBX_MSGID(msg->data);
-    bool complete = false;
+    EPOCH_END_t end = EPOCH_END_UNKNOWN;
     switch (msgId)
     {
         case UBX_NAV_EOE_MSGID:
-            EPOCH_DEBUG("detect %s", msg->name);
-            detect->haveUbxItow = false;
-            complete = true;
+            // Last message of the epoch, see _epochDetectEnd()
             break;
         case UBX_NAV_PVT_MSGID:
         case UBX_NAV_SAT_MSGID:
@@ -207,12 +477,11 @@ static bool _detectUbx(EPOCH_DETECT_t *detect, const PARSER_MSG_t *msg)
         case UBX_NAV_TIMEGAL_MSGID:
             if (msg->size > (UBX_FRAME_SIZE + 4))
             {
-                uint32_t iTow;
-                memcpy(&iTow, &msg->data[UBX_HEAD_SIZE], sizeof(iTow));
+                const uint32_t iTow = ubxViewU4(&msg->data[UBX_HEAD_SIZE]);
                 if (detect->haveUbxItow && (detect->ubxItow != iTow))
                 {
                     EPOCH_DEBUG("detect %s %u != %u", msg->name, detect->ubxItow, iTow);
-                    complete = true;
+                    end = EPOCH_END_UBX_ITOW;
                 }
                 detect->ubxItow = iTow;
                 detect->haveUbxItow = true;
@@ -225,12 +494,11 @@ static bool _detectUbx(EPOCH_DETECT_t *detect, const PARSER_MSG_t *msg)
         case UBX_NAV_RELPOSNED_MSGID:
             if (msg->size > (UBX_FRAME_SIZE + 4 + 4))
             {
-                uint32_t iTow;
-                memcpy(&iTow, &msg->data[UBX_HEAD_SIZE + 4], sizeof(iTow));
+                const uint32_t iTow = ubxViewU4(&msg->data[UBX_HEAD_SIZE + 4]);
                 if (detect->haveUbxItow && (detect->ubxItow != iTow))
                 {
                     EPOCH_DEBUG("detect %s %u != %u", msg->name, detect->ubxItow, iTow);
-                    complete = true;
+                    end = EPOCH_END_UBX_ITOW;
                 }
                 detect->ubxItow = iTow;
                 detect->haveUbxItow = true;
@@ -238,22 +506,33 @@ static bool _detectUbx(EPOCH_DETECT_t *detect, const PARSER_MSG_t *msg)
             break;
     }
 
-    return complete;
+    return end;
 }
 
-static bool _detectNmea(EPOCH_DETECT_t *detect, const NMEA_MSG_t *nmea)
+static EPOCH_END_t _detectNmea(EPOCH_DETECT_t *detect, const NMEA_MSG_t *nmea)
 {
-    bool complete = false;
+    EPOCH_END_t end = EPOCH_END_UNKNOWN;
     int ms = -1;
     switch (nmea->type)
     {
         case NMEA_TYPE_NONE:
         case NMEA_TYPE_TXT:
         case NMEA_TYPE_GSV:
+        case NMEA_TYPE_GSA:
+        case NMEA_TYPE_VTG:
             break;
         case NMEA_TYPE_GGA:
             ms = (int)floor(nmea->gga.time.second * 1e3);
             break;
+        case NMEA_TYPE_GNS:
+            ms = nmea->gns.time.valid ? (int)floor(nmea->gns.time.second * 1e3) : -1;
+            break;
+        case NMEA_TYPE_GST:
+            ms = nmea->gst.time.valid ? (int)floor(nmea->gst.time.second * 1e3) : -1;
+            break;
+        case NMEA_TYPE_ZDA:
+            ms = nmea->zda.time.valid ? (int)floor(nmea->zda.time.second * 1e3) : -1;
+            break;
         case NMEA_TYPE_RMC:
             ms = (int)floor(nmea->rmc.time.second * 1e3);
             break;
@@ -266,13 +545,13 @@ static bool _detectNmea(EPOCH_DETECT_t *detect, const NMEA_MSG_t *nmea)
         if ( detect->haveNmeaMs && (ms != detect->nmeaMs) )
         {
             EPOCH_DEBUG("detect %s %s %d != %d", nmea->talker, nmea->formatter, ms, detect->nmeaMs);
-            complete = true;
+            end = EPOCH_END_NMEA_TIME;
         }
         detect->nmeaMs = ms;
         detect->haveNmeaMs = true;
     }
 
-    return complete;
+    return end;
 }
 
 #define FLAG(field, flag) ( ((field) & (flag)) == (flag) )
@@ -449,6 +728,7 @@ EPOCH_GNSS_t epochSignalGnss(const EPOCH_SIGNAL_t signal)
     return EPOCH_GNSS_UNKNOWN;
 }
 
+// Index blocks in the order of EPOCH_GNSS_t, so that sorting by index sorts by gnss and sv
 int epochSvToIx(const EPOCH_GNSS_t gnss, const int sv)
 {
     int ix = EPOCH_NO_SV;
@@ -457,39 +737,39 @@ int epochSvToIx(const EPOCH_GNSS_t gnss, const int sv)
         case EPOCH_GNSS_UNKNOWN:
             break;
         case EPOCH_GNSS_GPS:
-            if ( (sv >= EPOCH_FIRST_GPS) && (sv <= EPOCH_NUM_GPS) )
+            if ( (sv >= EPOCH_FIRST_GPS) && (sv < (EPOCH_FIRST_GPS + EPOCH_NUM_GPS)) )
             {
                 ix = sv - EPOCH_FIRST_GPS;
             }
             break;
         case EPOCH_GNSS_GLO:
-            if ( (sv >= EPOCH_FIRST_GLO) && (sv <= EPOCH_NUM_GLO) )
+            if ( (sv >= EPOCH_FIRST_GLO) && (sv < (EPOCH_FIRST_GLO + EPOCH_NUM_GLO)) )
             {
                 ix = EPOCH_NUM_GPS + sv - EPOCH_FIRST_GLO;
             }
             break;
-        case EPOCH_GNSS_GAL:
-            if ( (sv >= EPOCH_FIRST_GAL) && (sv <= EPOCH_NUM_GAL) )
+        case EPOCH_GNSS_BDS:
+            if ( (sv >= EPOCH_FIRST_BDS) && (sv < (EPOCH_FIRST_BDS + EPOCH_NUM_BDS)) )
             {
-                ix = EPOCH_NUM_GPS + EPOCH_NUM_GLO + sv - EPOCH_FIRST_GAL;
+                ix = EPOCH_NUM_GPS + EPOCH_NUM_GLO + sv - EPOCH_FIRST_BDS;
             }
             break;
-        case EPOCH_GNSS_BDS:
-            if ( (sv >= EPOCH_FIRST_BDS) && (sv <= EPOCH_NUM_BDS) )
+        case EPOCH_GNSS_GAL:
+            if ( (sv >= EPOCH_FIRST_GAL) && (sv < (EPOCH_FIRST_GAL + EPOCH_NUM_GAL)) )
             {
-                ix = EPOCH_NUM_GPS + EPOCH_NUM_GLO + EPOCH_NUM_GAL + sv - EPOCH_FIRST_BDS;
+                ix = EPOCH_NUM_GPS + EPOCH_NUM_GLO + EPOCH_NUM_BDS + sv - EPOCH_FIRST_GAL;
             }
             break;
         case EPOCH_GNSS_SBAS:
-            if ( (sv >= EPOCH_FIRST_SBAS) && (sv <= EPOCH_NUM_SBAS) )
+            if ( (sv >= EPOCH_FIRST_SBAS) && (sv < (EPOCH_FIRST_SBAS + EPOCH_NUM_SBAS)) )
             {
-                ix = EPOCH_NUM_GPS + EPOCH_NUM_GLO + EPOCH_NUM_GAL + EPOCH_NUM_BDS + sv - EPOCH_FIRST_SBAS;
+                ix = EPOCH_NUM_GPS + EPOCH_NUM_GLO + EPOCH_NUM_BDS + EPOCH_NUM_GAL + sv - EPOCH_FIRST_SBAS;
             }
             break;
         case EPOCH_GNSS_QZSS:
-            if ( (sv >= EPOCH_FIRST_QZSS) && (sv <= EPOCH_NUM_QZSS) )
+            if ( (sv >= EPOCH_FIRST_QZSS) && (sv < (EPOCH_FIRST_QZSS + EPOCH_NUM_QZSS)) )
             {
-                ix = EPOCH_NUM_GPS + EPOCH_NUM_GLO + EPOCH_NUM_GAL + EPOCH_NUM_BDS + EPOCH_NUM_SBAS + sv - EPOCH_FIRST_QZSS;
+                ix = EPOCH_NUM_GPS + EPOCH_NUM_GLO + EPOCH_NUM_BDS + EPOCH_NUM_GAL + EPOCH_NUM_SBAS + sv - EPOCH_FIRST_QZSS;
             }
             break;
     }
@@ -734,18 +1014,101 @@ static const char * const kEpochOrbStrs[] =
     [EPOCH_SATORB_OTHER] = "OTHER",
 };
 
-static int _epochSigInfoSort(const void *a, const void *b)
+// The signals and satellites are sorted by gnss, sv (and signal) without comparing them: a counting sort on the
+// epochSvToIx() index determines the final position of each entry directly. Entries with an invalid gnss or sv go last.
+STATIC_ASSERT(EPOCH_NO_SV < UINT8_MAX);
+STATIC_ASSERT(EPOCH_MAX_SATELLITES <= EPOCH_NO_SV); // satellite index (EPOCH_SIGINFO_t.satIx) != EPOCH_NO_SV
+STATIC_ASSERT((SIZEOF_MEMBER(EPOCH_t, signals) / sizeof(EPOCH_SIGINFO_t)) <= UINT8_MAX);
+STATIC_ASSERT((SIZEOF_MEMBER(EPOCH_t, satellites) / sizeof(EPOCH_SATINFO_t)) <= UINT8_MAX);
+
+// Get order of entries (sorted by key, stable), returns true if the entries are already in order
+static bool _epochSortOrder(const uint8_t *keys, const int num, uint8_t *order)
+{
+    uint8_t pos[EPOCH_NO_SV + 1];
+    memset(pos, 0, sizeof(pos));
+    bool inOrder = true;
+    for (int ix = 0; ix < num; ix++)
+    {
+        pos[keys[ix]]++;
+        order[ix] = ix;
+        if ( (ix > 0) && (keys[ix] < keys[ix - 1]) )
+        {
+            inOrder = false;
+        }
+    }
+    if (inOrder)
+    {
+        return true;
+    }
+    int start = 0;
+    for (int key = 0; key < NUMOF(pos); key++)
+    {
+        const int n = pos[key];
+        pos[key] = start;
+        start += n;
+    }
+    for (int ix = 0; ix < num; ix++)
+    {
+        order[ pos[keys[ix]]++ ] = ix;
+    }
+    return false;
+}
+
+static void _epochSortSatellites(EPOCH_t *epoch)
 {
-    const EPOCH_SIGINFO_t *sA = (const EPOCH_SIGINFO_t *)a;
-    const EPOCH_SIGINFO_t *sB = (const EPOCH_SIGINFO_t *)b;
-    return (int32_t)(sA->_order - sB->_order);
+    const int num = epoch->numSatellites;
+    uint8_t keys[NUMOF(epoch->satellites)] = { 0 };
+    uint8_t order[NUMOF(epoch->satellites)];
+    for (int ix = 0; ix < num; ix++)
+    {
+        keys[ix] = epochSvToIx(epoch->satellites[ix].gnss, epoch->satellites[ix].sv);
+    }
+    if (!_epochSortOrder(keys, num, order))
+    {
+        EPOCH_SATINFO_t sats[NUMOF(epoch->satellites)];
+        memcpy(sats, epoch->satellites, num * sizeof(*sats));
+        for (int ix = 0; ix < num; ix++)
+        {
+            epoch->satellites[ix] = sats[order[ix]];
+        }
+    }
 }
 
-static int _epochSatInfoSort(const void *a, const void *b)
+static void _epochSortSignals(EPOCH_t *epoch)
 {
-    const EPOCH_SATINFO_t *sA = (const EPOCH_SATINFO_t *)a;
-    const EPOCH_SATINFO_t *sB = (const EPOCH_SATINFO_t *)b;
-    return (int32_t)(sA->_order - sB->_order);
+    const int num = epoch->numSignals;
+    uint8_t keys[NUMOF(epoch->signals)] = { 0 };
+    uint8_t order[NUMOF(epoch->signals)];
+    for (int ix = 0; ix < num; ix++)
+    {
+        keys[ix] = epochSvToIx(epoch->signals[ix].gnss, epoch->signals[ix].sv);
+    }
+    bool inOrder = _epochSortOrder(keys, num, order);
+
+    // Order by signal within each satellite (there are only a few signals per satellite)
+    for (int ix = 1; ix < num; ix++)
+    {
+        const uint8_t sigIx = order[ix];
+        int ix2 = ix;
+        while ( (ix2 > 0) && (keys[order[ix2 - 1]] == keys[sigIx]) &&
+            (epoch->signals[order[ix2 - 1]].signal > epoch->signals[sigIx].signal) )
+        {
+            order[ix2] = order[ix2 - 1];
+            ix2--;
+            inOrder = false;
+        }
+        order[ix2] = sigIx;
+    }
+
+    if (!inOrder)
+    {
+        EPOCH_SIGINFO_t sigs[NUMOF(epoch->signals)];
+        memcpy(sigs, epoch->signals, num * sizeof(*sigs));
+        for (int ix = 0; ix < num; ix++)
+        {
+            epoch->signals[ix] = sigs[order[ix]];
+        }
+    }
 }
 
 static void _collectUbx(EPOCH_t *coll, EPOCH_COLLECT_t *collect, const PARSER_MSG_t *msg)
@@ -759,17 +1122,22 @@ static void _collectUbx(EPOCH_t *coll, EPOCH_COLLECT_t *collect, const PARSER_MS
     switch (msgId)
     {
         case UBX_NAV_PVT_MSGID:
-            if (msg->size == UBX_NAV_PVT_V1_SIZE)
+        {
+            UBX_VIEW_t view;
+            if (UBX_NAV_PVT_V1_view(&view, msg->data, msg->size))
             {
                 EPOCH_DEBUG("collect %s", msg->name);
-                UBX_NAV_PVT_V1_GROUP0_t pvt;
-                memcpy(&pvt, &msg->data[UBX_HEAD_SIZE], sizeof(pvt));
+                const uint8_t *pvt = view.head;
+                const uint8_t fixType = UBX_NAV_PVT_V1_GROUP0_fixType(pvt);
+                const uint8_t flags = UBX_NAV_PVT_V1_GROUP0_flags(pvt);
+                const uint8_t valid = UBX_NAV_PVT_V1_GROUP0_valid(pvt);
+                const uint8_t flags2 = UBX_NAV_PVT_V1_GROUP0_flags2(pvt);
 
                 // Fix info
                 if (collect->haveFix < HAVE_UBX)
                 {
                     collect->haveFix = HAVE_UBX;
-                    switch (pvt.fixType)
+                    switch (fixType)
                     {
                         case UBX_NAV_PVT_V1_FIXTYPE_NOFIX:  coll->fix = EPOCH_FIX_NOFIX;  break;
                         case UBX_NAV_PVT_V1_FIXTYPE_DRONLY: coll->fix = EPOCH_FIX_DRONLY; break;
@@ -780,9 +1148,9 @@ static void _collectUbx(EPOCH_t *coll, EPOCH_COLLECT_t *collect, const PARSER_MS
                     }
                     if (coll->fix > EPOCH_FIX_NOFIX)
                     {
-                        coll->fixOk = FLAG(pvt.flags, UBX_NAV_PVT_V1_FLAGS_GNSSFIXOK);
+                        coll->fixOk = FLAG(flags, UBX_NAV_PVT_V1_FLAGS_GNSSFIXOK);
                     }
-                    switch (UBX_NAV_PVT_V1_FLAGS_CARRSOLN_GET(pvt.flags))
+                    switch (UBX_NAV_PVT_V1_FLAGS_CARRSOLN_GET(flags))
                     {
                         case UBX_NAV_PVT_V1_FLAGS_CARRSOLN_FLOAT:
                             coll->fix = coll->fix == EPOCH_FIX_S3D_DR ? EPOCH_FIX_RTK_FLOAT_DR : EPOCH_FIX_RTK_FLOAT;
@@ -798,49 +1166,49 @@ static void _collectUbx(EPOCH_t *coll, EPOCH_COLLECT_t *collect, const PARSER_MS
                 if (collect->haveTime < HAVE_UBX)
                 {
                     collect->haveTime = HAVE_UBX;
-                    coll->hour        = pvt.hour;
-                    coll->minute      = pvt.min;
-                    coll->second      = (double)pvt.sec + ((double)pvt.nano * 1e-9);
-                    coll->haveTime    = FLAG(pvt.valid, UBX_NAV_PVT_V1_VALID_VALIDTIME);
-                    coll->confTime    = FLAG(pvt.flags2, UBX_NAV_PVT_V1_FLAGS2_CONFTIME);
-                    coll->timeAcc     = (double)pvt.tAcc * UBX_NAV_PVT_V1_TACC_SCALE;
-                    coll->leapSecKnown = FLAG(pvt.valid, UBX_NAV_PVT_V1_VALID_FULLYRESOLVED);
+                    coll->hour        = UBX_NAV_PVT_V1_GROUP0_hour(pvt);
+                    coll->minute      = UBX_NAV_PVT_V1_GROUP0_min(pvt);
+                    coll->second      = (double)UBX_NAV_PVT_V1_GROUP0_sec(pvt) + ((double)UBX_NAV_PVT_V1_GROUP0_nano(pvt) * 1e-9);
+                    coll->haveTime    = FLAG(valid, UBX_NAV_PVT_V1_VALID_VALIDTIME);
+                    coll->confTime    = FLAG(flags2, UBX_NAV_PVT_V1_FLAGS2_CONFTIME);
+                    coll->timeAcc     = (double)UBX_NAV_PVT_V1_GROUP0_tAcc(pvt) * UBX_NAV_PVT_V1_TACC_SCALE;
+                    coll->leapSecKnown = FLAG(valid, UBX_NAV_PVT_V1_VALID_FULLYRESOLVED);
                 }
 
                 // Date
                 if (collect->haveDate < HAVE_UBX)
                 {
                     collect->haveDate = HAVE_UBX;
-                    coll->year        = pvt.year;
-                    coll->month       = pvt.month;
-                    coll->day         = pvt.day;
-                    coll->haveDate    = FLAG(pvt.valid, UBX_NAV_PVT_V1_VALID_VALIDDATE);
-                    coll->confDate    = FLAG(pvt.flags2, UBX_NAV_PVT_V1_FLAGS2_CONFDATE);
+                    coll->year        = UBX_NAV_PVT_V1_GROUP0_year(pvt);
+                    coll->month       = UBX_NAV_PVT_V1_GROUP0_month(pvt);
+                    coll->day         = UBX_NAV_PVT_V1_GROUP0_day(pvt);
+                    coll->haveDate    = FLAG(valid, UBX_NAV_PVT_V1_VALID_VALIDDATE);
+                    coll->confDate    = FLAG(flags2, UBX_NAV_PVT_V1_FLAGS2_CONFDATE);
                 }
 
                 // Geodetic coordinates
                 if (collect->haveLlh < HAVE_UBX)
                 {
                     collect->haveLlh = HAVE_UBX;
-                    coll->llh[0]      = deg2rad((double)pvt.lat * UBX_NAV_PVT_V1_LAT_SCALE);
-                    coll->llh[1]      = deg2rad((double)pvt.lon * UBX_NAV_PVT_V1_LON_SCALE);
-                    coll->llh[2]      = (double)pvt.height * UBX_NAV_PVT_V1_HEIGHT_SCALE;
-                    coll->heightMsl   = (double)pvt.hMSL * UBX_NAV_PVT_V1_HEIGHT_SCALE;
-                    coll->haveMsl     = !FLAG(pvt.flags3, UBX_NAV_PVT_V1_FLAGS3_INVALIDLLH);
+                    coll->llh[0]      = deg2rad((double)UBX_NAV_PVT_V1_GROUP0_lat(pvt) * UBX_NAV_PVT_V1_LAT_SCALE);
+                    coll->llh[1]      = deg2rad((double)UBX_NAV_PVT_V1_GROUP0_lon(pvt) * UBX_NAV_PVT_V1_LON_SCALE);
+                    coll->llh[2]      = (double)UBX_NAV_PVT_V1_GROUP0_height(pvt) * UBX_NAV_PVT_V1_HEIGHT_SCALE;
+                    coll->heightMsl   = (double)UBX_NAV_PVT_V1_GROUP0_hMSL(pvt) * UBX_NAV_PVT_V1_HEIGHT_SCALE;
+                    coll->haveMsl     = !FLAG(UBX_NAV_PVT_V1_GROUP0_flags3(pvt), UBX_NAV_PVT_V1_FLAGS3_INVALIDLLH);
                 }
 
                 // Position accuracy estimate
-                if (pvt.fixType > UBX_NAV_PVT_V1_FIXTYPE_NOFIX)
+                if (fixType > UBX_NAV_PVT_V1_FIXTYPE_NOFIX)
                 {
                     if (collect->haveHacc < HAVE_UBX)
                     {
                         collect->haveHacc = HAVE_UBX;
-                        coll->horizAcc = (double)pvt.hAcc * UBX_NAV_PVT_V1_HACC_SCALE;
+                        coll->horizAcc = (double)UBX_NAV_PVT_V1_GROUP0_hAcc(pvt) * UBX_NAV_PVT_V1_HACC_SCALE;
                     }
                     if (collect->haveVacc < HAVE_UBX)
                     {
                         collect->haveVacc = HAVE_UBX;
-                        coll->vertAcc     = (double)pvt.vAcc * UBX_NAV_PVT_V1_VACC_SCALE;
+                        coll->vertAcc     = (double)UBX_NAV_PVT_V1_GROUP0_vAcc(pvt) * UBX_NAV_PVT_V1_VACC_SCALE;
                     }
                 }
 
@@ -848,182 +1216,199 @@ static void _collectUbx(EPOCH_t *coll, EPOCH_COLLECT_t *collect, const PARSER_MS
                 if (collect->haveVel < HAVE_UBX)
                 {
                     collect->haveVel = HAVE_UBX;
-                    coll->velNed[0] = pvt.velN * UBX_NAV_PVT_V1_VELNED_SCALE;
-                    coll->velNed[1] = pvt.velE * UBX_NAV_PVT_V1_VELNED_SCALE;
-                    coll->velNed[2] = pvt.velD * UBX_NAV_PVT_V1_VELNED_SCALE;
-                    coll->velAcc    = pvt.sAcc * UBX_NAV_PVT_V1_SACC_SCALE;
+                    coll->velNed[0] = UBX_NAV_PVT_V1_GROUP0_velN(pvt) * UBX_NAV_PVT_V1_VELNED_SCALE;
+                    coll->velNed[1] = UBX_NAV_PVT_V1_GROUP0_velE(pvt) * UBX_NAV_PVT_V1_VELNED_SCALE;
+                    coll->velNed[2] = UBX_NAV_PVT_V1_GROUP0_velD(pvt) * UBX_NAV_PVT_V1_VELNED_SCALE;
+                    coll->velAcc    = UBX_NAV_PVT_V1_GROUP0_sAcc(pvt) * UBX_NAV_PVT_V1_SACC_SCALE;
                 }
 
-                coll->pDOP        = (float)pvt.pDOP * UBX_NAV_PVT_V1_PDOP_SCALE;
+                coll->pDOP        = (float)UBX_NAV_PVT_V1_GROUP0_pDOP(pvt) * UBX_NAV_PVT_V1_PDOP_SCALE;
                 coll->havePdop    = true;
 
-                coll->numSv       = pvt.numSV;
+                coll->numSv       = UBX_NAV_PVT_V1_GROUP0_numSV(pvt);
                 coll->haveNumSv   = true;
 
                 if (collect->haveGpsTow < HAVE_UBX)
                 {
                     collect->haveGpsTow = HAVE_UBX;
-                    coll->gpsTow      = pvt.iTOW * UBX_NAV_PVT_V1_ITOW_SCALE;
+                    coll->gpsTow      = UBX_NAV_PVT_V1_GROUP0_iTOW(pvt) * UBX_NAV_PVT_V1_ITOW_SCALE;
                     coll->gpsTowAcc   = coll->timeAcc > 1e-3 ? coll->timeAcc : 1e-3; // 1ms at best
                     coll->haveGpsTow  = coll->haveTime;
                 }
             }
             break;
+        }
         case UBX_NAV_POSECEF_MSGID:
-            if (msg->size == UBX_NAV_POSECEF_V0_SIZE)
+        {
+            UBX_VIEW_t view;
+            if (UBX_NAV_POSECEF_V0_view(&view, msg->data, msg->size))
             {
                 EPOCH_DEBUG("collect %s", msg->name);
-                UBX_NAV_POSECEF_V0_GROUP0_t pos;
-                memcpy(&pos, &msg->data[UBX_HEAD_SIZE], sizeof(pos));
+                const uint8_t *pos = view.head;
                 if (collect->haveXyz < HAVE_UBX)
                 {
                     collect->haveXyz = HAVE_UBX;
-                    coll->xyz[0] = (double)pos.ecefX * UBX_NAV_POSECEF_V0_ECEF_XYZ_SCALE;
-                    coll->xyz[1] = (double)pos.ecefY * UBX_NAV_POSECEF_V0_ECEF_XYZ_SCALE;
-                    coll->xyz[2] = (double)pos.ecefZ * UBX_NAV_POSECEF_V0_ECEF_XYZ_SCALE;
+                    coll->xyz[0] = (double)UBX_NAV_POSECEF_V0_GROUP0_ecefX(pos) * UBX_NAV_POSECEF_V0_ECEF_XYZ_SCALE;
+                    coll->xyz[1] = (double)UBX_NAV_POSECEF_V0_GROUP0_ecefY(pos) * UBX_NAV_POSECEF_V0_ECEF_XYZ_SCALE;
+                    coll->xyz[2] = (double)UBX_NAV_POSECEF_V0_GROUP0_ecefZ(pos) * UBX_NAV_POSECEF_V0_ECEF_XYZ_SCALE;
                 }
                 if (collect->havePacc < HAVE_UBX)
                 {
                     collect->havePacc = HAVE_UBX;
-                    coll->posAcc = (double)pos.pAcc  * UBX_NAV_POSECEF_V0_PACC_SCALE;
+                    coll->posAcc = (double)UBX_NAV_POSECEF_V0_GROUP0_pAcc(pos)  * UBX_NAV_POSECEF_V0_PACC_SCALE;
                 }
             }
             break;
+        }
         case UBX_NAV_TIMEGPS_MSGID:
-            if (msg->size == UBX_NAV_TIMEGPS_V0_SIZE)
+        {
+            UBX_VIEW_t view;
+            if (UBX_NAV_TIMEGPS_V0_view(&view, msg->data, msg->size))
             {
                 EPOCH_DEBUG("collect %s", msg->name);
-                UBX_NAV_TIMEGPS_V0_GROUP0_t time;
-                memcpy(&time, &msg->data[UBX_HEAD_SIZE], sizeof(time));
-                if (FLAG(time.valid, UBX_NAV_TIMEGPS_V0_VALID_WEEKVALID))
+                const uint8_t *time = view.head;
+                const uint8_t valid = UBX_NAV_TIMEGPS_V0_GROUP0_valid(time);
+                const int16_t week = UBX_NAV_TIMEGPS_V0_GROUP0_week(time);
+                if (FLAG(valid, UBX_NAV_TIMEGPS_V0_VALID_WEEKVALID))
                 {
-                    coll->gpsWeek = time.week;
+                    coll->gpsWeek = week;
                     coll->haveGpsWeek = true;
                 }
 
                 if (collect->haveGpsTow < HAVE_UBX_HP)
                 {
                     collect->haveGpsTow = HAVE_UBX_HP;
-                    coll->gpsTow      = (time.iTow * UBX_NAV_TIMEGPS_V0_ITOW_SCALE) + (time.fTOW * UBX_NAV_TIMEGPS_V0_FTOW_SCALE);
-                    coll->gpsTowAcc   = time.tAcc * UBX_NAV_TIMEGPS_V0_TACC_SCALE;
-                    coll->haveGpsTow  = FLAG(time.valid, UBX_NAV_TIMEGPS_V0_VALID_TOWVALID);
+                    coll->gpsTow      = (UBX_NAV_TIMEGPS_V0_GROUP0_iTow(time) * UBX_NAV_TIMEGPS_V0_ITOW_SCALE) + (UBX_NAV_TIMEGPS_V0_GROUP0_fTOW(time) * UBX_NAV_TIMEGPS_V0_FTOW_SCALE);
+                    coll->gpsTowAcc   = UBX_NAV_TIMEGPS_V0_GROUP0_tAcc(time) * UBX_NAV_TIMEGPS_V0_TACC_SCALE;
+                    coll->haveGpsTow  = FLAG(valid, UBX_NAV_TIMEGPS_V0_VALID_TOWVALID);
                 }
 
                 if (collect->haveGpsWeek < HAVE_UBX)
                 {
                     collect->haveGpsWeek = HAVE_UBX;
-                    coll->gpsWeek      = time.week;
-                    coll->haveGpsWeek  = FLAG(time.valid, UBX_NAV_TIMEGPS_V0_VALID_WEEKVALID);
+                    coll->gpsWeek      = week;
+                    coll->haveGpsWeek  = FLAG(valid, UBX_NAV_TIMEGPS_V0_VALID_WEEKVALID);
                 }
 
-                if (!coll->haveLeapSeconds && FLAG(time.valid, UBX_NAV_TIMEGPS_V0_VALID_LEAPSVALID))
+                if (!coll->haveLeapSeconds && FLAG(valid, UBX_NAV_TIMEGPS_V0_VALID_LEAPSVALID))
                 {
                     coll->haveLeapSeconds = true;
-                    coll->leapSeconds = time.leapS;
+                    coll->leapSeconds = UBX_NAV_TIMEGPS_V0_GROUP0_leapS(time);
                 }
             }
             break;
+        }
         case UBX_NAV_HPPOSECEF_MSGID:
-            if ( (msg->size == UBX_NAV_HPPOSECEF_V0_SIZE) && (UBX_NAV_HPPOSECEF_VERSION_GET(msg->data) == UBX_NAV_HPPOSECEF_V0_VERSION) )
+        {
+            UBX_VIEW_t view;
+            if (UBX_NAV_HPPOSECEF_V0_view(&view, msg->data, msg->size))
             {
                 EPOCH_DEBUG("collect %s", msg->name);
-                UBX_NAV_HPPOSECEF_V0_GROUP0_t pos;
-                memcpy(&pos, &msg->data[UBX_HEAD_SIZE], sizeof(pos));
-                if (!FLAG(pos.flags, UBX_NAV_HPPOSECEF_V0_FLAGS_INVALIDECEF))
+                const uint8_t *pos = view.head;
+                if (!FLAG(UBX_NAV_HPPOSECEF_V0_GROUP0_flags(pos), UBX_NAV_HPPOSECEF_V0_FLAGS_INVALIDECEF))
                 {
                     if (collect->haveXyz < HAVE_UBX_HP)
                     {
                         collect->haveXyz = HAVE_UBX_HP;
-                        coll->xyz[0] = ((double)pos.ecefX * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_SCALE) + ((double)pos.ecefXHp * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_HP_SCALE);
-                        coll->xyz[1] = ((double)pos.ecefY * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_SCALE) + ((double)pos.ecefYHp * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_HP_SCALE);
-                        coll->xyz[2] = ((double)pos.ecefZ * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_SCALE) + ((double)pos.ecefZHp * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_HP_SCALE);
+                        coll->xyz[0] = ((double)UBX_NAV_HPPOSECEF_V0_GROUP0_ecefX(pos) * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_SCALE) + ((double)UBX_NAV_HPPOSECEF_V0_GROUP0_ecefXHp(pos) * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_HP_SCALE);
+                        coll->xyz[1] = ((double)UBX_NAV_HPPOSECEF_V0_GROUP0_ecefY(pos) * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_SCALE) + ((double)UBX_NAV_HPPOSECEF_V0_GROUP0_ecefYHp(pos) * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_HP_SCALE);
+                        coll->xyz[2] = ((double)UBX_NAV_HPPOSECEF_V0_GROUP0_ecefZ(pos) * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_SCALE) + ((double)UBX_NAV_HPPOSECEF_V0_GROUP0_ecefZHp(pos) * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_HP_SCALE);
                     }
                     if (collect->havePacc < HAVE_UBX_HP)
                     {
                         collect->havePacc = HAVE_UBX_HP;
-                        coll->posAcc = (double)pos.pAcc * UBX_NAV_HPPOSECEF_V0_PACC_SCALE;
+                        coll->posAcc = (double)UBX_NAV_HPPOSECEF_V0_GROUP0_pAcc(pos) * UBX_NAV_HPPOSECEF_V0_PACC_SCALE;
                     }
                 }
             }
             break;
+        }
         case UBX_NAV_RELPOSNED_MSGID:
-            if ( (msg->size == UBX_NAV_RELPOSNED_V1_SIZE) && (UBX_NAV_RELPOSNED_VERSION_GET(msg->data) == UBX_NAV_RELPOSNED_V1_VERSION) )
+        {
+            UBX_VIEW_t view;
+            if (UBX_NAV_RELPOSNED_V1_view(&view, msg->data, msg->size))
             {
                 EPOCH_DEBUG("collect %s", msg->name);
-                UBX_NAV_RELPOSNED_V1_GROUP0_t rel;
-                memcpy(&rel, &msg->data[UBX_HEAD_SIZE], sizeof(rel));
-                if (FLAG(rel.flags, UBX_NAV_RELPOSNED_V1_FLAGS_RELPOSVALID))
+                const uint8_t *rel = view.head;
+                const uint32_t flags = UBX_NAV_RELPOSNED_V1_GROUP0_flags(rel);
+                if (FLAG(flags, UBX_NAV_RELPOSNED_V1_FLAGS_RELPOSVALID))
                 {
-                    coll->relNed[0] = (rel.relPosN * UBX_NAV_RELPOSNED_V1_RELPOSN_E_D_SCALE) + (rel.relPosHPN * UBX_NAV_RELPOSNED_V1_RELPOSHPN_E_D_SCALE);
-                    coll->relNed[1] = (rel.relPosE * UBX_NAV_RELPOSNED_V1_RELPOSN_E_D_SCALE) + (rel.relPosHPE * UBX_NAV_RELPOSNED_V1_RELPOSHPN_E_D_SCALE);
-                    coll->relNed[2] = (rel.relPosD * UBX_NAV_RELPOSNED_V1_RELPOSN_E_D_SCALE) + (rel.relPosHPD * UBX_NAV_RELPOSNED_V1_RELPOSHPN_E_D_SCALE);
-                    coll->relAcc[0] = rel.accN * UBX_NAV_RELPOSNED_V1_ACCN_E_D_SCALE;
-                    coll->relAcc[1] = rel.accE * UBX_NAV_RELPOSNED_V1_ACCN_E_D_SCALE;
-                    coll->relAcc[2] = rel.accD * UBX_NAV_RELPOSNED_V1_ACCN_E_D_SCALE;
-                    coll->relLen    = (rel.relPosLength * UBX_NAV_RELPOSNED_V1_RELPOSLENGTH_SCALE) + (rel.relPosHPLength * UBX_NAV_RELPOSNED_V1_RELPOSHPLENGTH_SCALE);
+                    coll->relNed[0] = (UBX_NAV_RELPOSNED_V1_GROUP0_relPosN(rel) * UBX_NAV_RELPOSNED_V1_RELPOSN_E_D_SCALE) + (UBX_NAV_RELPOSNED_V1_GROUP0_relPosHPN(rel) * UBX_NAV_RELPOSNED_V1_RELPOSHPN_E_D_SCALE);
+                    coll->relNed[1] = (UBX_NAV_RELPOSNED_V1_GROUP0_relPosE(rel) * UBX_NAV_RELPOSNED_V1_RELPOSN_E_D_SCALE) + (UBX_NAV_RELPOSNED_V1_GROUP0_relPosHPE(rel) * UBX_NAV_RELPOSNED_V1_RELPOSHPN_E_D_SCALE);
+                    coll->relNed[2] = (UBX_NAV_RELPOSNED_V1_GROUP0_relPosD(rel) * UBX_NAV_RELPOSNED_V1_RELPOSN_E_D_SCALE) + (UBX_NAV_RELPOSNED_V1_GROUP0_relPosHPD(rel) * UBX_NAV_RELPOSNED_V1_RELPOSHPN_E_D_SCALE);
+                    coll->relAcc[0] = UBX_NAV_RELPOSNED_V1_GROUP0_accN(rel) * UBX_NAV_RELPOSNED_V1_ACCN_E_D_SCALE;
+                    coll->relAcc[1] = UBX_NAV_RELPOSNED_V1_GROUP0_accE(rel) * UBX_NAV_RELPOSNED_V1_ACCN_E_D_SCALE;
+                    coll->relAcc[2] = UBX_NAV_RELPOSNED_V1_GROUP0_accD(rel) * UBX_NAV_RELPOSNED_V1_ACCN_E_D_SCALE;
+                    coll->relLen    = (UBX_NAV_RELPOSNED_V1_GROUP0_relPosLength(rel) * UBX_NAV_RELPOSNED_V1_RELPOSLENGTH_SCALE) + (UBX_NAV_RELPOSNED_V1_GROUP0_relPosHPLength(rel) * UBX_NAV_RELPOSNED_V1_RELPOSHPLENGTH_SCALE);
                     collect->haveRelPos = HAVE_UBX_HP;
-                    collect->relPosValid = FLAG(rel.flags, UBX_NAV_RELPOSNED_V1_FLAGS_RELPOSVALID);
+                    collect->relPosValid = FLAG(flags, UBX_NAV_RELPOSNED_V1_FLAGS_RELPOSVALID);
                 }
             }
             break;
+        }
         case UBX_NAV_SIG_MSGID:
-            if ( (msg->size >= UBX_NAV_SIG_V0_MIN_SIZE) && (UBX_NAV_SIG_VERSION_GET(msg->data) == UBX_NAV_SIG_V0_VERSION) )
+        {
+            UBX_VIEW_t view;
+            if (UBX_NAV_SIG_V0_view(&view, msg->data, msg->size))
             {
                 EPOCH_DEBUG("collect %s", msg->name);
                 if (collect->haveSig < HAVE_UBX)
                 {
                     collect->haveSig = HAVE_UBX;
-                    UBX_NAV_SIG_V0_GROUP0_t head;
-                    memcpy(&head, &msg->data[UBX_HEAD_SIZE], sizeof(head));
-                    int ix;
-                    for (coll->numSignals = 0, ix = 0; (coll->numSignals < (int)head.numSigs) && (coll->numSignals < NUMOF(coll->signals)); coll->numSignals++, ix++)
+                    memset(coll->signals, 0, coll->numSignals * sizeof(*coll->signals)); // discard NMEA data
+                    coll->numSignals = MIN(view.numGroups, NUMOF(coll->signals));
+                    for (int ix = 0; ix < coll->numSignals; ix++)
                     {
-                        UBX_NAV_SIG_V0_GROUP1_t uInfo;
-                        memcpy(&uInfo, &msg->data[UBX_HEAD_SIZE + sizeof(UBX_NAV_SIG_V0_GROUP0_t) + (ix * sizeof(uInfo))], sizeof(uInfo));
+                        const uint8_t *uInfo = UBX_VIEW_GROUP(&view, ix);
+                        const uint8_t gnssId = UBX_NAV_SIG_V0_GROUP1_gnssId(uInfo);
+                        const uint16_t sigFlags = UBX_NAV_SIG_V0_GROUP1_sigFlags(uInfo);
                         EPOCH_SIGINFO_t *eInfo = &coll->signals[ix];
                         eInfo->valid       = true;
-                        eInfo->gnss        = _ubxGnssIdToGnss(uInfo.gnssId);
-                        eInfo->sv          = uInfo.svId;
-                        eInfo->signal      = _ubxSigIdToSignal(uInfo.gnssId, uInfo.sigId);
-                        eInfo->gloFcn      = (int)uInfo.freqId - 7;
-                        eInfo->prRes       = (float)uInfo.prRes * (float)UBX_NAV_SIG_V0_PRRES_SCALE;
-                        eInfo->cno         = uInfo.cno;
-                        eInfo->prUsed      = FLAG(uInfo.sigFlags, UBX_NAV_SIG_V0_SIGFLAGS_PR_USED);
-                        eInfo->crUsed      = FLAG(uInfo.sigFlags, UBX_NAV_SIG_V0_SIGFLAGS_CR_USED);
-                        eInfo->doUsed      = FLAG(uInfo.sigFlags, UBX_NAV_SIG_V0_SIGFLAGS_DO_USED);
-                        eInfo->prCorrUsed  = FLAG(uInfo.sigFlags, UBX_NAV_SIG_V0_SIGFLAGS_PR_CORR_USED);
-                        eInfo->crCorrUsed  = FLAG(uInfo.sigFlags, UBX_NAV_SIG_V0_SIGFLAGS_CR_CORR_USED);
-                        eInfo->doCorrUsed  = FLAG(uInfo.sigFlags, UBX_NAV_SIG_V0_SIGFLAGS_DO_CORR_USED);
-                        eInfo->use         = _ubxSigUse(uInfo.qualityInd);
-                        eInfo->corr        = _ubxSigCorrSource(uInfo.corrSource);
-                        eInfo->iono        = _ubxIonoModel(uInfo.ionoModel);
-                        eInfo->health      = _ubxSigHealth(UBX_NAV_SIG_V0_SIGFLAGS_HEALTH_GET(uInfo.sigFlags));
+                        eInfo->gnss        = _ubxGnssIdToGnss(gnssId);
+                        eInfo->sv          = UBX_NAV_SIG_V0_GROUP1_svId(uInfo);
+                        eInfo->signal      = _ubxSigIdToSignal(gnssId, UBX_NAV_SIG_V0_GROUP1_sigId(uInfo));
+                        eInfo->gloFcn      = (int)UBX_NAV_SIG_V0_GROUP1_freqId(uInfo) - 7;
+                        eInfo->prRes       = (float)UBX_NAV_SIG_V0_GROUP1_prRes(uInfo) * (float)UBX_NAV_SIG_V0_PRRES_SCALE;
+                        eInfo->cno         = UBX_NAV_SIG_V0_GROUP1_cno(uInfo);
+                        eInfo->prUsed      = FLAG(sigFlags, UBX_NAV_SIG_V0_SIGFLAGS_PR_USED);
+                        eInfo->crUsed      = FLAG(sigFlags, UBX_NAV_SIG_V0_SIGFLAGS_CR_USED);
+                        eInfo->doUsed      = FLAG(sigFlags, UBX_NAV_SIG_V0_SIGFLAGS_DO_USED);
+                        eInfo->prCorrUsed  = FLAG(sigFlags, UBX_NAV_SIG_V0_SIGFLAGS_PR_CORR_USED);
+                        eInfo->crCorrUsed  = FLAG(sigFlags, UBX_NAV_SIG_V0_SIGFLAGS_CR_CORR_USED);
+                        eInfo->doCorrUsed  = FLAG(sigFlags, UBX_NAV_SIG_V0_SIGFLAGS_DO_CORR_USED);
+                        eInfo->use         = _ubxSigUse(UBX_NAV_SIG_V0_GROUP1_qualityInd(uInfo));
+                        eInfo->corr        = _ubxSigCorrSource(UBX_NAV_SIG_V0_GROUP1_corrSource(uInfo));
+                        eInfo->iono        = _ubxIonoModel(UBX_NAV_SIG_V0_GROUP1_ionoModel(uInfo));
+                        eInfo->health      = _ubxSigHealth(UBX_NAV_SIG_V0_SIGFLAGS_HEALTH_GET(sigFlags));
                     }
+                    coll->numSignalsDropped = view.numGroups - coll->numSignals;
                 }
             }
             break;
+        }
         case UBX_NAV_SAT_MSGID:
-            if ( (msg->size >= UBX_NAV_SAT_V1_MIN_SIZE) && (UBX_NAV_SAT_VERSION_GET(msg->data) == UBX_NAV_SAT_V1_VERSION) )
+        {
+            UBX_VIEW_t view;
+            if (UBX_NAV_SAT_V1_view(&view, msg->data, msg->size))
             {
                 EPOCH_DEBUG("collect %s", msg->name);
                 if (collect->haveSat < HAVE_UBX)
                 {
                     collect->haveSat = HAVE_UBX;
-                    UBX_NAV_SAT_V1_GROUP0_t head;
-                    memcpy(&head, &msg->data[UBX_HEAD_SIZE], sizeof(head));
-                    int ix;
-                    for (coll->numSatellites = 0, ix = 0; (coll->numSatellites < (int)head.numSvs) && (coll->numSatellites < NUMOF(coll->satellites)); coll->numSatellites++, ix++)
+                    memset(coll->satellites, 0, coll->numSatellites * sizeof(*coll->satellites)); // discard NMEA data
+                    coll->numSatellites = MIN(view.numGroups, NUMOF(coll->satellites));
+                    for (int ix = 0; ix < coll->numSatellites; ix++)
                     {
-                        UBX_NAV_SAT_V1_GROUP1_t uInfo;
-                        memcpy(&uInfo, &msg->data[UBX_HEAD_SIZE + sizeof(UBX_NAV_SAT_V1_GROUP0_t) + (ix * sizeof(uInfo))], sizeof(uInfo));
+                        const uint8_t *uInfo = UBX_VIEW_GROUP(&view, ix);
+                        const uint32_t flags = UBX_NAV_SAT_V1_GROUP1_flags(uInfo);
                         EPOCH_SATINFO_t *eInfo = &coll->satellites[ix];
                         eInfo->valid       = true;
-                        eInfo->gnss        = _ubxGnssIdToGnss(uInfo.gnssId);
-                        eInfo->sv          = uInfo.svId;
-                        const int orbSrc = UBX_NAV_SAT_V1_FLAGS_ORBITSOURCE_GET(uInfo.flags);
+                        eInfo->gnss        = _ubxGnssIdToGnss(UBX_NAV_SAT_V1_GROUP1_gnssId(uInfo));
+                        eInfo->sv          = UBX_NAV_SAT_V1_GROUP1_svId(uInfo);
+                        const int orbSrc = UBX_NAV_SAT_V1_FLAGS_ORBITSOURCE_GET(flags);
                         eInfo->orbUsed = EPOCH_SATORB_NONE;
-                        eInfo->azim = uInfo.azim;
-                        eInfo->elev = uInfo.elev;
+                        eInfo->azim = UBX_NAV_SAT_V1_GROUP1_azim(uInfo);
+                        eInfo->elev = UBX_NAV_SAT_V1_GROUP1_elev(uInfo);
                         switch (orbSrc)
                         {
                             case UBX_NAV_SAT_V1_FLAGS_ORBITSOURCE_NONE: break;
@@ -1035,60 +1420,67 @@ static void _collectUbx(EPOCH_t *coll, EPOCH_COLLECT_t *collect, const PARSER_MS
                             case UBX_NAV_SAT_V1_FLAGS_ORBITSOURCE_OTHER2: /* FALLTHROUGH */
                             case UBX_NAV_SAT_V1_FLAGS_ORBITSOURCE_OTHER3: eInfo->orbUsed = EPOCH_SATORB_OTHER; break;
                         }
-                        if (FLAG(uInfo.flags, UBX_NAV_SAT_V1_FLAGS_EPHAVAIL))
+                        if (FLAG(flags, UBX_NAV_SAT_V1_FLAGS_EPHAVAIL))
                         {
                             eInfo->orbAvail |= BIT(EPOCH_SATORB_EPH);
                         }
-                        if (FLAG(uInfo.flags, UBX_NAV_SAT_V1_FLAGS_ALMAVAIL))
+                        if (FLAG(flags, UBX_NAV_SAT_V1_FLAGS_ALMAVAIL))
                         {
                             eInfo->orbAvail |= BIT(EPOCH_SATORB_ALM);
                         }
-                        if (FLAG(uInfo.flags, UBX_NAV_SAT_V1_FLAGS_ANOAVAIL) || FLAG(uInfo.flags, UBX_NAV_SAT_V1_FLAGS_AOPAVAIL))
+                        if (FLAG(flags, UBX_NAV_SAT_V1_FLAGS_ANOAVAIL) || FLAG(flags, UBX_NAV_SAT_V1_FLAGS_AOPAVAIL))
                         {
                             eInfo->orbAvail |= BIT(EPOCH_SATORB_PRED);
                         }
                     }
+                    coll->numSatellitesDropped = view.numGroups - coll->numSatellites;
                 }
             }
             break;
+        }
         case UBX_NAV_TIMELS_MSGID:
-            if (msg->size == UBX_NAV_TIMELS_V0_SIZE)
+        {
+            UBX_VIEW_t view;
+            if (UBX_NAV_TIMELS_V0_view(&view, msg->data, msg->size))
             {
                 EPOCH_DEBUG("collect %s", msg->name);
-                UBX_NAV_TIMELS_V0_GROUP0_t timels;
-                memcpy(&timels, &msg->data[UBX_HEAD_SIZE], sizeof(timels));
-
-                if (!coll->haveLeapSeconds && FLAG(timels.valid, UBX_NAV_TIMELS_V0_VALID_CURRLSVALID))
+                const uint8_t *timels = view.head;
+                if (!coll->haveLeapSeconds && FLAG(UBX_NAV_TIMELS_V0_GROUP0_valid(timels), UBX_NAV_TIMELS_V0_VALID_CURRLSVALID))
                 {
-                    coll->leapSeconds = timels.currLs;
+                    coll->leapSeconds = UBX_NAV_TIMELS_V0_GROUP0_currLs(timels);
                     coll->haveLeapSeconds = true;
                 }
             }
             break;
+        }
         case UBX_NAV_STATUS_MSGID:
-            if (msg->size == UBX_NAV_STATUS_V0_SIZE)
+        {
+            UBX_VIEW_t view;
+            if (UBX_NAV_STATUS_V0_view(&view, msg->data, msg->size))
             {
                 EPOCH_DEBUG("collect %s", msg->name);
-                UBX_NAV_STATUS_V0_GROUP0_t status;
-                memcpy(&status, &msg->data[UBX_HEAD_SIZE], sizeof(status));
+                const uint8_t *status = view.head;
                 if (!coll->haveUptime)
                 {
                     coll->haveUptime = true;
-                    coll->uptime = (double)status.msss * UBX_NAV_STATUS_V0_MSSS_SCALE;
+                    coll->uptime = (double)UBX_NAV_STATUS_V0_GROUP0_msss(status) * UBX_NAV_STATUS_V0_MSSS_SCALE;
                 }
             }
             break;
+        }
         case UBX_NAV_CLOCK_MSGID:
-            if (msg->size == UBX_NAV_CLOCK_V0_SIZE)
+        {
+            UBX_VIEW_t view;
+            if (UBX_NAV_CLOCK_V0_view(&view, msg->data, msg->size))
             {
                 EPOCH_DEBUG("collect %s", msg->name);
-                UBX_NAV_CLOCK_V0_GROUP0_t clock;
-                memcpy(&clock, &msg->data[UBX_HEAD_SIZE], sizeof(clock));
+                const uint8_t *clock = view.head;
                 coll->haveClock = true;
-                coll->clockBias = (double)clock.clkB * UBX_NAV_CLOCK_V0_CLKB_SCALE;
-                coll->clockDrift = (double)clock.clkD * UBX_NAV_CLOCK_V0_CLKD_SCALE;
+                coll->clockBias = (double)UBX_NAV_CLOCK_V0_GROUP0_clkB(clock) * UBX_NAV_CLOCK_V0_CLKB_SCALE;
+                coll->clockDrift = (double)UBX_NAV_CLOCK_V0_GROUP0_clkD(clock) * UBX_NAV_CLOCK_V0_CLKD_SCALE;
             }
             break;
+        }
     }
 }
 
@@ -1234,7 +1626,8 @@ static void _collectNmea(EPOCH_t *coll, EPOCH_COLLECT_t *collect, const NMEA_MSG
             if (collect->haveSat <= HAVE_NMEA) // multiple NMEA-Gx-GSV messages!
             {
                 collect->haveSat = HAVE_NMEA;
-                for (int ix = 0; (ix < nmea->gsv.nSvs) && (coll->numSatellites < (int)NUMOF(coll->satellites)); ix++)
+                int ix;
+                for (ix = 0; (ix < nmea->gsv.nSvs) && (coll->numSatellites < (int)NUMOF(coll->satellites)); ix++)
                 {
                     EPOCH_SATINFO_t *sat = &coll->satellites[coll->numSatellites];
                     sat->gnss      = _nmeaGnssToGnss(nmea->gsv.svs[ix].gnss);
@@ -1245,24 +1638,16 @@ static void _collectNmea(EPOCH_t *coll, EPOCH_COLLECT_t *collect, const NMEA_MSG
                     sat->azim      = nmea->gsv.svs[ix].azim;
                     coll->numSatellites++;
                 }
+                coll->numSatellitesDropped += nmea->gsv.nSvs - ix;
             }
             if (collect->haveSig <= HAVE_NMEA) // multiple NMEA-Gx-GSV messages!
             {
                 collect->haveSig = HAVE_NMEA;
-                for (int ix = 0; (ix < nmea->gsv.nSvs) && (coll->numSignals < (int)NUMOF(coll->signals)); ix++)
+                int ix;
+                for (ix = 0; (ix < nmea->gsv.nSvs) && (coll->numSignals < (int)NUMOF(coll->signals)); ix++)
                 {
                     EPOCH_SIGINFO_t *sig = &coll->signals[coll->numSignals];
-                    switch (nmea->gsv.svs[ix].gnss)
-                    {
-                        case NMEA_GNSS_UNKNOWN: sig->gnss = EPOCH_GNSS_UNKNOWN; break;
-                        case NMEA_GNSS_GPS:     sig->gnss = EPOCH_GNSS_GPS;     break;
-                        case NMEA_GNSS_GLO:     sig->gnss = EPOCH_GNSS_GLO;     break;
-                        case NMEA_GNSS_BDS:     sig->gnss = EPOCH_GNSS_BDS;     break;
-                        case NMEA_GNSS_GAL:     sig->gnss = EPOCH_GNSS_GAL;     break;
-                        case NMEA_GNSS_SBAS:    sig->gnss = EPOCH_GNSS_SBAS;    break;
-                        case NMEA_GNSS_QZSS:    sig->gnss = EPOCH_GNSS_QZSS;    break;
-                    }
-                    sig->gnss      = _nmeaGnssToGnss(nmea->gsv.svs[ix].gnss);
+                    sig->gnss     = _nmeaGnssToGnss(nmea->gsv.svs[ix].gnss);
                     sig->sv        = nmea->gsv.svs[ix].svId;
                     sig->signal    = _nmeaSignalToSignal(nmea->gsv.svs[ix].sig);
                     sig->cno       = nmea->gsv.svs[ix].cno;
@@ -1271,6 +1656,132 @@ static void _collectNmea(EPOCH_t *coll, EPOCH_COLLECT_t *collect, const NMEA_MSG
                     sig->prUsed    = true; // presumably..
                     coll->numSignals++;
                 }
+                coll->numSignalsDropped += nmea->gsv.nSvs - ix;
+            }
+            break;
+
+        case NMEA_TYPE_GNS:
+            EPOCH_DEBUG("collect %s %s", nmea->talker, nmea->formatter);
+            if (collect->haveTime < HAVE_NMEA)
+            {
+                collect->haveTime = HAVE_NMEA;
+                coll->hour      = nmea->gns.time.hour;
+                coll->minute    = nmea->gns.time.minute;
+                coll->second    = nmea->gns.time.second;
+                coll->haveTime  = nmea->gns.time.valid;
+            }
+            if (collect->haveFix < HAVE_NMEA)
+            {
+                collect->haveFix = HAVE_NMEA;
+                switch (nmea->gns.fix)
+                {
+                    case NMEA_FIX_UNKNOWN:   coll->fix = EPOCH_FIX_UNKNOWN;   break;
+                    case NMEA_FIX_NOFIX:     coll->fix = EPOCH_FIX_NOFIX;     break;
+                    case NMEA_FIX_DRONLY:    coll->fix = EPOCH_FIX_DRONLY;    break;
+                    case NMEA_FIX_S2D:       coll->fix = EPOCH_FIX_S2D;       break;
+                    case NMEA_FIX_S3D:       coll->fix = EPOCH_FIX_S3D;       break;
+                    case NMEA_FIX_S3D_DR:    coll->fix = EPOCH_FIX_S3D_DR;    break;
+                    case NMEA_FIX_RTK_FLOAT: coll->fix = EPOCH_FIX_RTK_FLOAT; break;
+                    case NMEA_FIX_RTK_FIXED: coll->fix = EPOCH_FIX_RTK_FIXED; break;
+                }
+                coll->fixOk = nmea->gns.valid;
+                coll->haveFix = true;
+            }
+            if ( (nmea->gns.fix > NMEA_FIX_NOFIX) && (collect->haveLlh < HAVE_BETTER_NMEA) )
+            {
+                collect->haveLlh = HAVE_BETTER_NMEA;
+                coll->llh[0]      = deg2rad(nmea->gns.lat);
+                coll->llh[1]      = deg2rad(nmea->gns.lon);
+                coll->llh[2]      = nmea->gns.height;
+                coll->heightMsl   = nmea->gns.heightMsl;
+                coll->haveMsl     = true;
+            }
+            if ( (nmea->gns.diffAge > -DBL_EPSILON) && (collect->haveDiffAge < HAVE_NMEA) )
+            {
+                collect->haveDiffAge = HAVE_NMEA;
+                coll->diffAge = nmea->gns.diffAge;
+                coll->haveDiffAge = true;
+            }
+            if (!coll->haveNumSv)
+            {
+                coll->numSv       = nmea->gns.numSv;
+                coll->haveNumSv   = true;
+            }
+            break;
+
+        case NMEA_TYPE_ZDA:
+            EPOCH_DEBUG("collect %s %s", nmea->talker, nmea->formatter);
+            if (collect->haveTime < HAVE_NMEA)
+            {
+                collect->haveTime = HAVE_NMEA;
+                coll->hour      = nmea->zda.time.hour;
+                coll->minute    = nmea->zda.time.minute;
+                coll->second    = nmea->zda.time.second;
+                coll->haveTime  = nmea->zda.time.valid;
+            }
+            // Four digit year, better than NMEA-Gx-RMC
+            if (collect->haveDate < HAVE_BETTER_NMEA)
+            {
+                collect->haveDate = HAVE_BETTER_NMEA;
+                coll->day       = nmea->zda.date.day;
+                coll->month     = nmea->zda.date.month;
+                coll->year      = nmea->zda.date.year;
+                coll->haveDate  = nmea->zda.date.valid;
+            }
+            break;
+
+        case NMEA_TYPE_GST:
+            EPOCH_DEBUG("collect %s %s", nmea->talker, nmea->formatter);
+            if (nmea->gst.haveStd)
+            {
+                if (collect->haveHacc < HAVE_NMEA)
+                {
+                    collect->haveHacc = HAVE_NMEA;
+                    coll->horizAcc = sqrt( (nmea->gst.stdLat * nmea->gst.stdLat) + (nmea->gst.stdLon * nmea->gst.stdLon) );
+                }
+                if (collect->haveVacc < HAVE_NMEA)
+                {
+                    collect->haveVacc = HAVE_NMEA;
+                    coll->vertAcc = nmea->gst.stdAlt;
+                }
+            }
+            break;
+
+        case NMEA_TYPE_VTG:
+            EPOCH_DEBUG("collect %s %s", nmea->talker, nmea->formatter);
+            if (nmea->vtg.haveSog && nmea->vtg.haveCogt && (collect->haveVel < HAVE_NMEA))
+            {
+                collect->haveVel = HAVE_NMEA;
+                const double speed = nmea->vtg.sogk * (1.0 / 3.6);
+                const double course = deg2rad(nmea->vtg.cogt);
+                coll->velNed[0] = speed * cos(course);
+                coll->velNed[1] = speed * sin(course);
+                coll->velNed[2] = 0.0;
+            }
+            break;
+
+        case NMEA_TYPE_GSA:
+            EPOCH_DEBUG("collect %s %s", nmea->talker, nmea->formatter);
+            if (nmea->gsa.haveDop && !coll->havePdop)
+            {
+                coll->pDOP        = (float)nmea->gsa.pDOP;
+                coll->havePdop    = true;
+            }
+            if (collect->haveUsedSvs <= HAVE_NMEA) // multiple NMEA-Gx-GSA messages!
+            {
+                collect->haveUsedSvs = HAVE_NMEA;
+                for (int ix = 0; ix < nmea->gsa.nSvs; ix++)
+                {
+                    const int svIx = epochSvToIx(_nmeaGnssToGnss(nmea->gsa.svs[ix].gnss), nmea->gsa.svs[ix].svId);
+                    if (svIx != EPOCH_NO_SV)
+                    {
+                        collect->usedSvs[svIx / 32] |= BIT(svIx % 32);
+                    }
+                }
+            }
+            if (nmea->gsa.fix == NMEA_FIX_S2D)
+            {
+                collect->nmea2d = true;
             }
             break;
 
@@ -1280,10 +1791,11 @@ static void _collectNmea(EPOCH_t *coll, EPOCH_COLLECT_t *collect, const NMEA_MSG
     }
 }
 
-static void _epochComplete(const EPOCH_COLLECT_t *collect, EPOCH_t *epoch)
+static void _epochComplete(const EPOCH_COLLECT_t *collect, const EPOCH_DETECT_t *detect, EPOCH_t *epoch)
 {
     epoch->valid = true;
     epoch->ts = TIME();
+    epoch->tsNs = TIME_NS();
     const double now = posixNow();
 
     // Convert stuff, prefer better quality, FIXME: this assumes WGS84...
@@ -1305,6 +1817,12 @@ static void _epochComplete(const EPOCH_COLLECT_t *collect, EPOCH_t *epoch)
         EPOCH_DEBUG("complete: llh (%d) = xyz (%d)", collect->haveLlh, collect->haveXyz);
     }
 
+    // NMEA-Gx-GGA et al. say 3D fix, but NMEA-Gx-GSA knows better
+    if ( collect->nmea2d && (collect->haveFix < HAVE_UBX) && (epoch->fix == EPOCH_FIX_S3D) )
+    {
+        epoch->fix = EPOCH_FIX_S2D;
+    }
+
     if ( (collect->haveHacc > HAVE_NOTHING) && (collect->haveVacc > HAVE_NOTHING) && (collect->havePacc < HAVE_UBX) )
     {
         epoch->posAcc = sqrt( (epoch->horizAcc * epoch->horizAcc) + (epoch->vertAcc * epoch->vertAcc) );
@@ -1337,22 +1855,32 @@ static void _epochComplete(const EPOCH_COLLECT_t *collect, EPOCH_t *epoch)
         sat->gnssStr    = sat->gnss    < NUMOF(kEpochGnssStrs) ? kEpochGnssStrs[sat->gnss]   : kEpochGnssStrs[EPOCH_GNSS_UNKNOWN];
         sat->orbUsedStr = sat->orbUsed < NUMOF(kEpochOrbStrs)  ? kEpochOrbStrs[sat->orbUsed] : kEpochOrbStrs[EPOCH_SATORB_NONE];
         sat->svStr      = _epochSvStr(sat->gnss, sat->sv);
-        sat->_order     = ((sat->gnss & 0xff) << 24) | ((sat->sv & 0xff) << 16);
     }
-    qsort(epoch->satellites, epoch->numSatellites, sizeof(*epoch->satellites), _epochSatInfoSort);
+    _epochSortSatellites(epoch);
 
     // Create lookup table for signal to satellite
-    uint8_t satIxs[EPOCH_NUM_SV] = { [0 ... (EPOCH_NUM_SV-1)] = EPOCH_NO_SV };
+    uint8_t satIxs[EPOCH_NO_SV + 1];
+    memset(satIxs, EPOCH_NO_SV, sizeof(satIxs));
     for (int ix = 0; ix < epoch->numSatellites; ix++)
     {
-        EPOCH_SATINFO_t *sat = &epoch->satellites[ix];
-        satIxs[ epochSvToIx(sat->gnss, sat->sv) ] = ix;
+        const EPOCH_SATINFO_t *sat = &epoch->satellites[ix];
+        const int svIx = epochSvToIx(sat->gnss, sat->sv);
+        if (svIx != EPOCH_NO_SV)
+        {
+            satIxs[svIx] = ix;
+        }
     }
 
     // Process, stringify and sort list of signals
+    const bool nmeaUsed = (collect->haveSig == HAVE_NMEA) && (collect->haveUsedSvs == HAVE_NMEA);
     for (int ix = 0; ix < epoch->numSignals; ix++)
     {
         EPOCH_SIGINFO_t *sig = &epoch->signals[ix];
+        if (nmeaUsed)
+        {
+            const int svIx = epochSvToIx(sig->gnss, sig->sv);
+            sig->prUsed = (svIx != EPOCH_NO_SV) && CHKBITS_ANY(collect->usedSvs[svIx / 32], BIT(svIx % 32));
+        }
         switch (sig->signal)
         {
             case EPOCH_SIGNAL_UNKNOWN:    sig->band = EPOCH_BAND_UNKNOWN; break;
@@ -1379,10 +1907,8 @@ static void _epochComplete(const EPOCH_COLLECT_t *collect, EPOCH_t *epoch)
         sig->ionoStr     = sig->iono   < NUMOF(kEpochSigIonoStrs)   ? kEpochSigIonoStrs[sig->iono]     : kEpochSigIonoStrs[EPOCH_SIGIONO_UNKNOWN];
         sig->healthStr   = sig->health < NUMOF(kEpochSigHealthStrs) ? kEpochSigHealthStrs[sig->health] : kEpochSigHealthStrs[EPOCH_SIGHEALTH_UNKNOWN];
         sig->satIx       = satIxs[epochSvToIx(sig->gnss, sig->sv)];
-
-        sig->_order = ((sig->gnss & 0xff) << 24) | ((sig->sv & 0xffff) << 8) | ((sig->signal & 0xff) << 0);
     }
-    qsort(&epoch->signals, epoch->numSignals, sizeof(*epoch->signals), _epochSigInfoSort);
+    _epochSortSignals(epoch);
 
     // TODO: time/date <--(leapSec)--> wno/tow
 
@@ -1403,6 +1929,18 @@ static void _epochComplete(const EPOCH_COLLECT_t *collect, EPOCH_t *epoch)
         case EPOCH_FIX_RTK_FIXED_DR: epoch->fixStr = epoch->fixOk ? "RTK_FIXED_DR" : "(RTK_FIXED_DR)"; break;
     }
 
+    // Stringify epoch detection
+    epoch->endByStr = "UNKNOWN";
+    switch (epoch->endBy)
+    {
+        case EPOCH_END_UNKNOWN:                                  break;
+        case EPOCH_END_UBX_EOE:   epoch->endByStr = "UBX_EOE";   break;
+        case EPOCH_END_UBX_ITOW:  epoch->endByStr = "UBX_ITOW";  break;
+        case EPOCH_END_NMEA_TIME: epoch->endByStr = "NMEA_TIME"; break;
+        case EPOCH_END_LEARNED:   epoch->endByStr = "LEARNED";   break;
+        case EPOCH_END_TIMEOUT:   epoch->endByStr = "TIMEOUT";   break;
+    }
+
     // Count number of signals (and satellites) used, calculate CN0 histogram
     if (epoch->numSignals > 0)
     {
@@ -1456,7 +1994,41 @@ static void _epochComplete(const EPOCH_COLLECT_t *collect, EPOCH_t *epoch)
         }
     }
 
+    // Time and date
+    if (epoch->haveGpsWeek && epoch->haveGpsTow)
+    {
+        epoch->posixTime = ts2posix(wnoTow2ts(epoch->gpsWeek, epoch->gpsTow), epoch->leapSeconds, epoch->haveLeapSeconds);
+        epoch->havePosixTime = true;
+
+    }
+    // else if (epoch->haveDate && epoch->haveTime) // FIXME TODO
+    // {
+    //     ...
+    // }
+
+    // Latency
+    if (epoch->havePosixTime)
+    {
+        epoch->latency = now - epoch->posixTime;
+        epoch->haveLatency = ((epoch->latency > 0.0f) && (epoch->latency <= 2.0f)); // Only when reading a live receiver
+    }
+
+    // Strings
+    if (!CHKBITS(detect->flags, EPOCH_FLAGS_NOSTR))
+    {
+        epochFormat(epoch);
+    }
+}
+
+void epochFormat(EPOCH_t *epoch)
+{
+    if (epoch == NULL)
+    {
+        return;
+    }
+
     // Uptime string
+    epoch->uptimeStr[0] = '\0';
     if (epoch->haveUptime)
     {
         bool anyway = false;
@@ -1492,25 +2064,6 @@ static void _epochComplete(const EPOCH_COLLECT_t *collect, EPOCH_t *epoch)
         }
     }
 
-    // Time and date
-    if (epoch->haveGpsWeek && epoch->haveGpsTow)
-    {
-        epoch->posixTime = ts2posix(wnoTow2ts(epoch->gpsWeek, epoch->gpsTow), epoch->leapSeconds, epoch->haveLeapSeconds);
-        epoch->havePosixTime = true;
-
-    }
-    // else if (epoch->haveDate && epoch->haveTime) // FIXME TODO
-    // {
-    //     ...
-    // }
-
-    // Latency
-    if (epoch->havePosixTime)
-    {
-        epoch->latency = now - epoch->posixTime;
-        epoch->haveLatency = ((epoch->latency > 0.0f) && (epoch->latency <= 2.0f)); // Only when reading a live receiver
-    }
-
     // Epoch info stringification
     snprintf(epoch->str, sizeof(epoch->str),
         "%-12s %2d %04d-%02d-%02d (%c) %02d:%02d:%06.3f (%c) %+11.7f %+12.7f (%5.1f) %+5.0f (%5.1f) %4.1f",
@@ -144,6 +144,17 @@ typedef enum EPOCH_FIX_e
     EPOCH_FIX_RTK_FIXED_DR,   //!< RTK fixed + dead-reckoning fix
 } EPOCH_FIX_t;
 
+//! How the end of an epoch was detected
+typedef enum EPOCH_END_e
+{
+    EPOCH_END_UNKNOWN = 0,    //!< Unknown
+    EPOCH_END_UBX_EOE,        //!< UBX-NAV-EOE (last message of the epoch)
+    EPOCH_END_UBX_ITOW,       //!< Change of UBX iTOW (first message of the next epoch)
+    EPOCH_END_NMEA_TIME,      //!< Change of NMEA time (first message of the next epoch)
+    EPOCH_END_LEARNED,        //!< Learned last message of the epoch
+    EPOCH_END_TIMEOUT,        //!< Timeout, see epochTimeout() and epochCollectorTimeout()
+} EPOCH_END_t;
+
 //! GNSS identifier
 typedef enum EPOCH_GNSS_e
 {
@@ -266,9 +277,6 @@ typedef struct EPOCH_SIGINFO_s
     const char       *ionoStr;
     const char       *healthStr;
     int               satIx;
-
-    // Private
-    uint32_t          _order;
 } EPOCH_SIGINFO_t;
 
 //! Satellite orbit source
@@ -295,9 +303,6 @@ typedef struct EPOCH_SATINFO_s
     const char       *gnssStr;
     const char       *svStr;
     const char       *orbUsedStr;
-
-    // Private
-    uint32_t          _order;
 } EPOCH_SATINFO_t;
 
 
@@ -309,6 +314,27 @@ typedef struct EPOCH_SATINFO_s
 #define EPOCH_SIGCNOHIST_IX2CNO_L(ix)  ((ix) * 5)
 #define EPOCH_SIGCNOHIST_IX2CNO_H(ix)  (EPOCH_SIGCNOHIST_IX2CNO_L((ix) + 1) - 1)
 
+#define EPOCH_NUM_GPS        32
+#define EPOCH_NUM_SBAS       39
+#define EPOCH_NUM_GAL        36
+#define EPOCH_NUM_BDS        37
+#define EPOCH_NUM_QZSS       10
+#define EPOCH_NUM_GLO        32
+#define EPOCH_FIRST_GPS       1
+#define EPOCH_FIRST_SBAS    120
+#define EPOCH_FIRST_GAL       1
+#define EPOCH_FIRST_BDS       1
+#define EPOCH_FIRST_QZSS      1
+#define EPOCH_FIRST_GLO       1
+#define EPOCH_NUM_SV (EPOCH_NUM_GPS + EPOCH_NUM_SBAS + EPOCH_NUM_GAL + EPOCH_NUM_BDS + EPOCH_NUM_QZSS + EPOCH_NUM_GLO)
+#define EPOCH_NO_SV (EPOCH_NUM_SV + 1)
+
+//! Capacity of EPOCH_t.signals[], the maximum number of signals the receiver reports (UBX-NAV-SIG.numSigs is a U1)
+#define EPOCH_MAX_SIGNALS 255
+
+//! Capacity of EPOCH_t.satellites[], all satellites that epochSvToIx() knows
+#define EPOCH_MAX_SATELLITES EPOCH_NUM_SV
+
 //! Navigation epoch data
 typedef struct EPOCH_s
 {
@@ -316,6 +342,10 @@ typedef struct EPOCH_s
     bool                valid;
     uint32_t            seq;
     uint32_t            ts;
+    uint64_t            tsNs;     //!< Monotonic time [ns] (TIME_NS()) when the epoch was completed
+    uint64_t            msgTsNs;  //!< Monotonic time [ns] at which the last message of the epoch arrived
+    EPOCH_END_t         endBy;    //!< How the end of the epoch was detected
+    const char         *endByStr;
     char                str[256];
 
     bool                haveFix;
@@ -384,11 +414,13 @@ typedef struct EPOCH_s
     bool                haveLatency;
     float               latency;
 
-    EPOCH_SIGINFO_t     signals[100];
+    EPOCH_SIGINFO_t     signals[EPOCH_MAX_SIGNALS];
     int                 numSignals;
+    int                 numSignalsDropped;     //!< Number of signals that did not fit into signals[]
 
-    EPOCH_SATINFO_t     satellites[100];
+    EPOCH_SATINFO_t     satellites[EPOCH_MAX_SATELLITES];
     int                 numSatellites;
+    int                 numSatellitesDropped;  //!< Number of satellites that did not fit into satellites[]
 
     bool                haveNumSig;
     int                 numSigUsed;
@@ -420,34 +452,46 @@ typedef struct EPOCH_s
     char                uptimeStr[20];
 
     // Private states for epoch detection and collection
-    uint64_t            _detect[3];
-    uint64_t            _collect[8];
+    uint64_t            _detect[8];
+    uint64_t            _collect[16];
 
 } EPOCH_t;
 
-#define EPOCH_NUM_GPS        32
-#define EPOCH_NUM_SBAS       39
-#define EPOCH_NUM_GAL        36
-#define EPOCH_NUM_BDS        37
-#define EPOCH_NUM_QZSS       10
-#define EPOCH_NUM_GLO        32
-#define EPOCH_FIRST_GPS       1
-#define EPOCH_FIRST_SBAS    120
-#define EPOCH_FIRST_GAL       1
-#define EPOCH_FIRST_BDS       1
-#define EPOCH_FIRST_QZSS      1
-#define EPOCH_FIRST_GLO       1
-#define EPOCH_NUM_SV (EPOCH_NUM_GPS + EPOCH_NUM_SBAS + EPOCH_NUM_GAL + EPOCH_NUM_BDS + EPOCH_NUM_QZSS + EPOCH_NUM_GLO)
-#define EPOCH_NO_SV (EPOCH_NUM_SV + 1)
-
 // ---------------------------------------------------------------------------------------------------------------------
 
+//! Epoch collector flags
+typedef enum EPOCH_FLAGS_e
+{
+    EPOCH_FLAGS_NONE    = 0x00,  //!< Default
+    EPOCH_FLAGS_NOSTR   = 0x01,  //!< Don't render EPOCH_t.str and EPOCH_t.uptimeStr (see epochFormat())
+    EPOCH_FLAGS_NOLEARN = 0x02,  //!< Don't learn the last message of the epoch (see below)
+} EPOCH_FLAGS_t;
+
+// The end of an epoch is detected by:
+// - UBX-NAV-EOE, which is the last message of an epoch (immediate output)
+// - A change of the UBX iTOW or NMEA time, i.e. the first message of the next epoch (output delayed by the epoch period)
+// - The last message of the epoch (immediate output). For this the collector learns which message (e.g. the last
+//   NMEA-GN-GSV or NMEA-GP-GLL) ends an epoch, and how many times it occurs in an epoch. It is used once it has been
+//   confirmed by #EPOCH_LEARN_NUM consecutive epochs, and re-learned if it doesn't show up in an epoch.
+// - A timeout, when the application calls epochTimeout() or epochCollectorTimeout() in absence of messages
+// The EPOCH_t.msgTsNs to EPOCH_t.tsNs difference is the resulting output latency (see also ff_latency.h).
+
+#define EPOCH_LEARN_NUM              3                      //!< Number of epochs to confirm the last message of an epoch
+#define EPOCH_TIMEOUT_NS_DEFAULT     (250 * 1000 * 1000)    //!< Suggested timeout for epochTimeout() [ns]
+
 //! Initialise epoch collector
 /*!
     \param[out]  coll  collector structure
 */
 void epochInit(EPOCH_t *coll);
 
+//! Initialise epoch collector with flags
+/*!
+    \param[out]  coll   collector structure
+    \param[in]   flags  flags (EPOCH_FLAGS_t)
+*/
+void epochInitEx(EPOCH_t *coll, const uint32_t flags);
+
 //! Collect message, determine if a complete epoch is available
 /*!
     \param[in,out]  coll   collector structure
@@ -458,9 +502,85 @@ void epochInit(EPOCH_t *coll);
 
     \note While \c coll has the same type as \c epoch, it must not be used by the user. Only the data returned in
           \c epoch is valid, consistent and complete.
+
+    \note Only the used part of the signals[] and satellites[] arrays (numSignals resp. numSatellites) is copied to
+          \c epoch. The remaining entries are left untouched.
 */
 bool epochCollect(EPOCH_t *coll, const PARSER_MSG_t *msg, EPOCH_t *epoch);
 
+//! Complete epoch if no message arrived for some time
+/*!
+    \param[in,out]  coll       collector structure
+    \param[in]      nowNs      current time [ns] (TIME_NS())
+    \param[in]      timeoutNs  timeout [ns], e.g. #EPOCH_TIMEOUT_NS_DEFAULT
+    \param[out]     epoch      output epoch data, can be NULL, data only valid if the functions returns true
+
+    \returns true if the time since the last message (PARSER_MSG_t.tsNs) exceeds the timeout and \c epoch contains
+             valid data, false otherwise
+*/
+bool epochTimeout(EPOCH_t *coll, const uint64_t nowNs, const uint64_t timeoutNs, EPOCH_t *epoch);
+
+//! Double-buffered epoch collector
+/*!
+    Alternative to epochInit() and epochCollect() that avoids copying the epoch data: the collector has two buffers,
+    one of which is used for collecting data while the other one holds the last completed epoch. The buffers are
+    swapped when an epoch completes.
+*/
+typedef struct EPOCH_COLLECTOR_s
+{
+    // Private
+    EPOCH_t             _bufs[2];
+    int                 _coll;
+} EPOCH_COLLECTOR_t;
+
+//! Initialise double-buffered epoch collector
+/*!
+    \param[out]  collector  collector structure
+    \param[in]   flags      flags (EPOCH_FLAGS_t)
+*/
+void epochCollectorInit(EPOCH_COLLECTOR_t *collector, const uint32_t flags);
+
+//! Collect message, determine if a complete epoch is available
+/*!
+    \param[in,out]  collector  collector structure
+    \param[in]      msg        a message
+
+    \returns the epoch if one was detected, NULL otherwise. The data remains valid until the next epoch completes. It
+             must not be modified, as the buffer is re-used for collecting and only the used parts are cleared. Use
+             epochCopy() to obtain a modifiable copy.
+*/
+const EPOCH_t *epochCollectorAdd(EPOCH_COLLECTOR_t *collector, const PARSER_MSG_t *msg);
+
+//! Complete epoch if no message arrived for some time
+/*!
+    \param[in,out]  collector  collector structure
+    \param[in]      nowNs      current time [ns] (TIME_NS())
+    \param[in]      timeoutNs  timeout [ns], e.g. #EPOCH_TIMEOUT_NS_DEFAULT
+
+    \returns the epoch if the time since the last message (PARSER_MSG_t.tsNs) exceeds the timeout, NULL otherwise,
+             see epochCollectorAdd()
+*/
+const EPOCH_t *epochCollectorTimeout(EPOCH_COLLECTOR_t *collector, const uint64_t nowNs, const uint64_t timeoutNs);
+
+//! Render epoch strings
+/*!
+    Renders EPOCH_t.str and EPOCH_t.uptimeStr. This is done automatically for each epoch, unless the collector was
+    initialised with #EPOCH_FLAGS_NOSTR.
+
+    \param[in,out]  epoch  a complete epoch (from epochCollect() or a copy of one from epochCollectorAdd())
+*/
+void epochFormat(EPOCH_t *epoch);
+
+//! Copy epoch
+/*!
+    Copies only the used parts of EPOCH_t.signals[] and EPOCH_t.satellites[], which is much faster than copying the
+    entire structure. The remaining entries in \c dst are undefined.
+
+    \param[out]  dst  destination epoch
+    \param[in]   src  source epoch
+*/
+void epochCopy(EPOCH_t *dst, const EPOCH_t *src);
+
 // ---------------------------------------------------------------------------------------------------------------------
 
 //! Epoch stringification header
@@ -496,6 +616,8 @@ EPOCH_GNSS_t epochSignalGnss(const EPOCH_SIGNAL_t signal);
     \param[in]  gnss  GNSS identifier
     \param[in]  sv    SV number
     \returns a index into an array of size #EPOCH_NUM_SV, or EPOCH_NO_SV if invalid params given
+
+    \note The index is ordered the same way as the satellites and signals in EPOCH_t, i.e. by EPOCH_GNSS_t and sv.
 */
 int epochSvToIx(const EPOCH_GNSS_t gnss, const int sv);
 
@@ -0,0 +1,216 @@
+// flipflip's latency statistics
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <string.h>
+#include <stdio.h>
+
+#include "ff_stuff.h"
+
+#include "ff_latency.h"
+
+/* ****************************************************************************************************************** */
+
+// Bucket index for value:
+// - values 0..(LATHIST_SUB_NUM - 1) go to buckets 0..(LATHIST_SUB_NUM - 1) (exact)
+// - larger values are split into LATHIST_SUB_NUM sub-buckets per power of two, so that the bucket
+//   width is 1/LATHIST_SUB_NUM...2/LATHIST_SUB_NUM of the value
+int latHistBucketIx(const uint64_t ns)
+{
+    if (ns < LATHIST_SUB_NUM)
+    {
+        return (int)ns;
+    }
+    const int msb = 63 - __builtin_clzll(ns);
+    const int shift = msb - LATHIST_SUB_BITS;
+    const int ix = ((shift + 1) * LATHIST_SUB_NUM) + (int)((ns >> shift) & (LATHIST_SUB_NUM - 1));
+    return ix < LATHIST_NUM_BUCKETS ? ix : (LATHIST_NUM_BUCKETS - 1);
+}
+
+// Largest value that goes into the bucket
+uint64_t latHistBucketMax(const int ix)
+{
+    if (ix < LATHIST_SUB_NUM)
+    {
+        return ix;
+    }
+    const int shift = (ix / LATHIST_SUB_NUM) - 1;
+    const uint64_t sub = (ix % LATHIST_SUB_NUM) + LATHIST_SUB_NUM;
+    return ((sub + 1) << shift) - 1;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void latHistInit(LATHIST_t *hist)
+{
+    memset(hist, 0, sizeof(*hist));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void latHistAdd(LATHIST_t *hist, const uint64_t ns)
+{
+    hist->counts[latHistBucketIx(ns)]++;
+    if ( (hist->count == 0) || (ns < hist->min) )
+    {
+        hist->min = ns;
+    }
+    if ( (hist->count == 0) || (ns > hist->max) )
+    {
+        hist->max = ns;
+    }
+    hist->count++;
+    hist->sum += (double)ns;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void latHistMerge(LATHIST_t *hist, const LATHIST_t *other)
+{
+    if (other->count == 0)
+    {
+        return;
+    }
+    for (int ix = 0; ix < LATHIST_NUM_BUCKETS; ix++)
+    {
+        hist->counts[ix] += other->counts[ix];
+    }
+    if ( (hist->count == 0) || (other->min < hist->min) )
+    {
+        hist->min = other->min;
+    }
+    if ( (hist->count == 0) || (other->max > hist->max) )
+    {
+        hist->max = other->max;
+    }
+    hist->count += other->count;
+    hist->sum += other->sum;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+uint64_t latHistPercentile(const LATHIST_t *hist, const double p)
+{
+    if (hist->count == 0)
+    {
+        return 0;
+    }
+    const double target = CLIP(p, 0.0, 100.0) * 1e-2 * (double)hist->count;
+    uint32_t sum = 0;
+    for (int ix = 0; ix < LATHIST_NUM_BUCKETS; ix++)
+    {
+        sum += hist->counts[ix];
+        if ( (sum > 0) && ((double)sum >= target) )
+        {
+            const uint64_t val = latHistBucketMax(ix);
+            return CLIP(val, hist->min, hist->max);
+        }
+    }
+    return hist->max;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+int latHistStr(const LATHIST_t *hist, char *str, const int size)
+{
+    return snprintf(str, size, "n=%u min=%.3f mean=%.3f p50=%.3f p90=%.3f p99=%.3f p99.9=%.3f max=%.3f",
+        hist->count, (double)hist->min * 1e-6, hist->count > 0 ? hist->sum / (double)hist->count * 1e-6 : 0.0,
+        (double)latHistPercentile(hist, 50.0) * 1e-6, (double)latHistPercentile(hist, 90.0) * 1e-6,
+        (double)latHistPercentile(hist, 99.0) * 1e-6, (double)latHistPercentile(hist, 99.9) * 1e-6,
+        (double)hist->max * 1e-6);
+}
+
+/* ****************************************************************************************************************** */
+
+void latencyInit(LATENCY_t *lat)
+{
+    memset(lat, 0, sizeof(*lat));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// Latency between two timestamps, 0 if unknown
+static uint64_t _dt(const uint64_t t0, const uint64_t t1)
+{
+    return (t0 != 0) && (t1 > t0) ? t1 - t0 : 0;
+}
+
+void latencyAddMsg(LATENCY_t *lat, const PARSER_MSG_t *msg, const uint64_t now)
+{
+    if (msg->tsNs == 0)
+    {
+        return;
+    }
+    const uint64_t dt = _dt(msg->tsNs, now);
+    latHistAdd(&lat->stages[LATENCY_STAGE_PARSER], dt);
+
+    int ix = 0;
+    while ( (ix < lat->numMsgs) && (strcmp(lat->msgs[ix].name, msg->name) != 0) )
+    {
+        ix++;
+    }
+    if (ix >= lat->numMsgs)
+    {
+        if (lat->numMsgs >= LATENCY_MAX_MSGS)
+        {
+            return;
+        }
+        lat->numMsgs++;
+        snprintf(lat->msgs[ix].name, sizeof(lat->msgs[ix].name), "%s", msg->name);
+    }
+    latHistAdd(&lat->msgs[ix].hist, dt);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void latencyAddEpoch(LATENCY_t *lat, const EPOCH_t *epoch)
+{
+    if (epoch->msgTsNs != 0)
+    {
+        latHistAdd(&lat->stages[LATENCY_STAGE_EPOCH], _dt(epoch->msgTsNs, epoch->tsNs));
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void latencyAddOutput(LATENCY_t *lat, const EPOCH_t *epoch, const uint64_t now)
+{
+    if (epoch->tsNs != 0)
+    {
+        latHistAdd(&lat->stages[LATENCY_STAGE_OUTPUT], _dt(epoch->tsNs, now));
+    }
+    if (epoch->msgTsNs != 0)
+    {
+        latHistAdd(&lat->stages[LATENCY_STAGE_TOTAL], _dt(epoch->msgTsNs, now));
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const char *latencyStageName(const LATENCY_STAGE_t stage)
+{
+    switch (stage)
+    {
+        case LATENCY_STAGE_PARSER: return "parser";
+        case LATENCY_STAGE_EPOCH:  return "epoch";
+        case LATENCY_STAGE_OUTPUT: return "output";
+        case LATENCY_STAGE_TOTAL:  return "total";
+        case LATENCY_NUM_STAGES:   break;
+    }
+    return "?";
+}
+
+/* ****************************************************************************************************************** */
+// eof
@@ -0,0 +1,118 @@
+// flipflip's latency statistics
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+//
+// Latency histograms (HDR style, i.e. log-linear buckets with constant relative precision) for the
+// stages of the data processing chain: data arrival (portRead(), PARSER_MSG_t.tsNs) -> message
+// (parserProcess()) -> epoch (epochCollect(), EPOCH_t.tsNs) -> consumer (application).
+
+#ifndef __FF_LATENCY_H__
+#define __FF_LATENCY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "ff_parser.h"
+#include "ff_epoch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ****************************************************************************************************************** */
+
+#define LATHIST_SUB_BITS          4                             // sub-buckets per power of two (2^4 = 16, ~6% precision)
+#define LATHIST_SUB_NUM           (1 << LATHIST_SUB_BITS)
+#define LATHIST_EXP_NUM          38                             // number of powers of two (up to ~2^41 ns = ~36 min)
+#define LATHIST_NUM_BUCKETS      (LATHIST_EXP_NUM * LATHIST_SUB_NUM)
+
+//! Latency histogram
+typedef struct LATHIST_s
+{
+    uint32_t  counts[LATHIST_NUM_BUCKETS];  //!< Bucket counts
+    uint32_t  count;                        //!< Number of values
+    uint64_t  min;                          //!< Smallest value [ns]
+    uint64_t  max;                          //!< Largest value [ns]
+    double    sum;                          //!< Sum of all values [ns]
+} LATHIST_t;
+
+//! Initialise (clear) histogram
+void latHistInit(LATHIST_t *hist);
+
+//! Add value [ns] to histogram
+void latHistAdd(LATHIST_t *hist, const uint64_t ns);
+
+//! Add all values of another histogram
+void latHistMerge(LATHIST_t *hist, const LATHIST_t *other);
+
+//! Get percentile, returns the (upper bound of the) value [ns] at or below which p [%] of the values are
+uint64_t latHistPercentile(const LATHIST_t *hist, const double p);
+
+//! Get bucket index for value [ns]
+int latHistBucketIx(const uint64_t ns);
+
+//! Get largest value [ns] that goes into the bucket
+uint64_t latHistBucketMax(const int ix);
+
+//! Stringify histogram summary ("n=... min=... p50=... p90=... p99=... p99.9=... max=..." [ms])
+int latHistStr(const LATHIST_t *hist, char *str, const int size);
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+//! Processing stages
+typedef enum LATENCY_STAGE_e
+{
+    LATENCY_STAGE_PARSER = 0,  //!< Data arrival (PARSER_MSG_t.tsNs) to message from the parser
+    LATENCY_STAGE_EPOCH,       //!< Arrival of last message of the epoch (EPOCH_t.msgTsNs) to epoch complete (EPOCH_t.tsNs)
+    LATENCY_STAGE_OUTPUT,      //!< Epoch complete (EPOCH_t.tsNs) to the consumer
+    LATENCY_STAGE_TOTAL,       //!< Arrival of last message of the epoch (EPOCH_t.msgTsNs) to the consumer
+    LATENCY_NUM_STAGES
+} LATENCY_STAGE_t;
+
+#define LATENCY_MAX_MSGS        50  // max. number of message types with a separate histogram
+#define LATENCY_MAX_NAME_LEN    24  // max. length of message names
+
+//! Latency statistics
+typedef struct LATENCY_s
+{
+    LATHIST_t stages[LATENCY_NUM_STAGES];     //!< Histogram per stage
+    struct
+    {
+        char      name[LATENCY_MAX_NAME_LEN]; //!< Message name
+        LATHIST_t hist;                       //!< Parser stage histogram for this message
+    } msgs[LATENCY_MAX_MSGS];
+    int       numMsgs;                        //!< Number of message types
+} LATENCY_t;
+
+//! Initialise (clear) latency statistics
+void latencyInit(LATENCY_t *lat);
+
+//! Add message from the parser (LATENCY_STAGE_PARSER, and per message type), now = TIME_NS()
+void latencyAddMsg(LATENCY_t *lat, const PARSER_MSG_t *msg, const uint64_t now);
+
+//! Add epoch from epochCollect() (LATENCY_STAGE_EPOCH)
+void latencyAddEpoch(LATENCY_t *lat, const EPOCH_t *epoch);
+
+//! Add epoch seen by the consumer (LATENCY_STAGE_OUTPUT and LATENCY_STAGE_TOTAL), now = TIME_NS()
+void latencyAddOutput(LATENCY_t *lat, const EPOCH_t *epoch, const uint64_t now);
+
+//! Stringify stage
+const char *latencyStageName(const LATENCY_STAGE_t stage);
+
+/* ****************************************************************************************************************** */
+#ifdef __cplusplus
+}
+#endif
+#endif // __FF_LATENCY_H__
@@ -15,6 +15,7 @@
 // If not, see <https://www.gnu.org/licenses/>.
 
 #include <string.h>
+#include <stddef.h>
 #include <stdio.h>
 
 #include "ff_stuff.h"
@@ -213,11 +214,26 @@ bool nmeaMessageInfo(char *info, const int size, const uint8_t *msg, const int m
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-static bool sNmeaDecodeTxt(NMEA_TXT_t *txt, char *payload, const char *talker);
-static bool sNmeaDecodeGga(NMEA_GGA_t *gga, char *payload, const char *talker);
-static bool sNmeaDecodeRmc(NMEA_RMC_t *gga, char *payload, const char *talker);
-static bool sNmeaDecodeGll(NMEA_GLL_t *gll, char *payload, const char *talker);
-static bool sNmeaDecodeGsv(NMEA_GSV_t *gsv, char *payload, const char *talker);
+// Payload field (in place in the message, not nul-terminated)
+typedef struct NMEA_FIELD_s
+{
+    const char *str;
+    int         len;
+} NMEA_FIELD_t;
+
+// Packed three character formatter code, for switch()
+#define NMEA_FMT(c0, c1, c2) ( ((uint32_t)(uint8_t)(c0) << 16) | ((uint32_t)(uint8_t)(c1) << 8) | (uint32_t)(uint8_t)(c2) )
+
+static bool sNmeaDecodeTxt(NMEA_TXT_t *txt, const char *payload, const int len, const char *talker);
+static bool sNmeaDecodeGga(NMEA_GGA_t *gga, const char *payload, const int len, const char *talker);
+static bool sNmeaDecodeRmc(NMEA_RMC_t *rmc, const char *payload, const int len, const char *talker);
+static bool sNmeaDecodeGll(NMEA_GLL_t *gll, const char *payload, const int len, const char *talker);
+static bool sNmeaDecodeGsv(NMEA_GSV_t *gsv, const char *payload, const int len, const char *talker);
+static bool sNmeaDecodeGsa(NMEA_GSA_t *gsa, const char *payload, const int len, const char *talker);
+static bool sNmeaDecodeGst(NMEA_GST_t *gst, const char *payload, const int len, const char *talker);
+static bool sNmeaDecodeVtg(NMEA_VTG_t *vtg, const char *payload, const int len, const char *talker);
+static bool sNmeaDecodeZda(NMEA_ZDA_t *zda, const char *payload, const int len, const char *talker);
+static bool sNmeaDecodeGns(NMEA_GNS_t *gns, const char *payload, const int len, const char *talker);
 static const char *sNmeaFixStr(const NMEA_FIX_t fix);
 
 bool nmeaDecode(NMEA_MSG_t *nmea, const uint8_t *msg, const int msgSize)
@@ -226,11 +242,16 @@ bool nmeaDecode(NMEA_MSG_t *nmea, const uint8_t *msg, const int msgSize)
     {
         return false;
     }
-    memset(nmea, 0, sizeof(*nmea));
+    nmea->type = NMEA_TYPE_NONE;
+    nmea->info[0] = '\0';
 
     MSG_INFO_t info;
     if (!sNmeaMessageInfo(&info, msg, msgSize))
     {
+        memset(nmea->talker, 0, sizeof(nmea->talker));
+        memset(nmea->formatter, 0, sizeof(nmea->formatter));
+        nmea->payloadIx0 = 0;
+        nmea->payloadIx1 = 0;
         return false;
     }
     memcpy(nmea->talker,    info.talker,    sizeof(nmea->talker));
@@ -241,61 +262,141 @@ bool nmeaDecode(NMEA_MSG_t *nmea, const uint8_t *msg, const int msgSize)
     // 012345678901234567890
     // $GNGGA,.......*xx\r\n
     //        ^=7   ^=13  --> 13 - 7 + 1 = 7
-    char payload[1000];
+    const char *payload = (const char *)&msg[info.payloadIx0];
     const int payloadLen = info.payloadIx1 - info.payloadIx0 + 1;
-    if (payloadLen > ((int)sizeof(payload) - 1))
+    if (payloadLen < 0)
     {
         return false;
     }
-    memcpy(payload, &msg[info.payloadIx0], payloadLen);
-    payload[payloadLen] = '\0';
+
+    // Only formatters with three characters are decoded
+    const uint32_t fmt = (info.formatter[0] != '\0') && (info.formatter[1] != '\0') && (info.formatter[2] != '\0') &&
+        (info.formatter[3] == '\0') ? NMEA_FMT(info.formatter[0], info.formatter[1], info.formatter[2]) : 0;
 
     bool res = false;
-    if (strcmp(info.formatter, "GGA") == 0)
-    {
-        nmea->type = NMEA_TYPE_GGA;
-        res = sNmeaDecodeGga(&nmea->gga, payload, info.talker);
-        snprintf(nmea->info, sizeof(nmea->info), "%02d:%02d:%06.3f (%d) %s %+11.7f %+12.7f %+5.0f",
-            nmea->gga.time.hour, nmea->gga.time.minute, nmea->gga.time.second, nmea->gga.time.valid,
-            sNmeaFixStr(nmea->gga.fix), nmea->gga.lat, nmea->gga.lon, nmea->gga.height);
-    }
-    else if (strcmp(info.formatter, "RMC") == 0)
-    {
-        nmea->type = NMEA_TYPE_RMC;
-        res = sNmeaDecodeRmc(&nmea->rmc, payload, info.talker);
-        snprintf(nmea->info, sizeof(nmea->info), "%04d-%02d-%02d (%d) %02d:%02d:%06.3f (%d) %s (%d) %+11.7f %+12.7f",
-            nmea->rmc.date.year, nmea->rmc.date.month, nmea->rmc.date.day, nmea->rmc.date.valid,
-            nmea->rmc.time.hour, nmea->rmc.time.minute, nmea->rmc.time.second, nmea->rmc.time.valid,
-            sNmeaFixStr(nmea->rmc.fix), nmea->rmc.valid, nmea->rmc.lat, nmea->rmc.lon);
-    }
-    else if (strcmp(info.formatter, "GLL") == 0)
-    {
-        nmea->type = NMEA_TYPE_GLL;
-        res = sNmeaDecodeGll(&nmea->gll, payload, info.talker);
-        snprintf(nmea->info, sizeof(nmea->info), "%02d:%02d:%06.3f (%d) %s (%d) %+11.7f %+12.7f",
-            nmea->gll.time.hour, nmea->gll.time.minute, nmea->gll.time.second, nmea->gll.time.valid,
-            sNmeaFixStr(nmea->gll.fix), nmea->gll.valid, nmea->gll.lat, nmea->gll.lon);
-    }
-    else if (strcmp(info.formatter, "GSV") == 0)
-    {
-        nmea->type = NMEA_TYPE_GSV;
-        res = sNmeaDecodeGsv(&nmea->gsv, payload, info.talker);
-        snprintf(nmea->info, sizeof(nmea->info), "%d/%d %d",
-            nmea->gsv.msgNum, nmea->gsv.numMsg, nmea->gsv.numSat);
-    }
-    else if (strcmp(info.formatter, "TXT") == 0)
+    switch (fmt)
     {
-        nmea->type = NMEA_TYPE_TXT;
-        res = sNmeaDecodeTxt(&nmea->txt, payload, info.talker);
-        snprintf(nmea->info, sizeof(nmea->info), "%s", nmea->txt.text);
+        case NMEA_FMT('G', 'G', 'A'):
+            nmea->type = NMEA_TYPE_GGA;
+            memset(&nmea->gga, 0, sizeof(nmea->gga));
+            res = sNmeaDecodeGga(&nmea->gga, payload, payloadLen, info.talker);
+            break;
+        case NMEA_FMT('R', 'M', 'C'):
+            nmea->type = NMEA_TYPE_RMC;
+            memset(&nmea->rmc, 0, sizeof(nmea->rmc));
+            res = sNmeaDecodeRmc(&nmea->rmc, payload, payloadLen, info.talker);
+            break;
+        case NMEA_FMT('G', 'L', 'L'):
+            nmea->type = NMEA_TYPE_GLL;
+            memset(&nmea->gll, 0, sizeof(nmea->gll));
+            res = sNmeaDecodeGll(&nmea->gll, payload, payloadLen, info.talker);
+            break;
+        case NMEA_FMT('G', 'S', 'V'):
+            nmea->type = NMEA_TYPE_GSV;
+            memset(&nmea->gsv, 0, sizeof(nmea->gsv));
+            res = sNmeaDecodeGsv(&nmea->gsv, payload, payloadLen, info.talker);
+            break;
+        case NMEA_FMT('G', 'S', 'A'):
+            nmea->type = NMEA_TYPE_GSA;
+            memset(&nmea->gsa, 0, sizeof(nmea->gsa));
+            res = sNmeaDecodeGsa(&nmea->gsa, payload, payloadLen, info.talker);
+            break;
+        case NMEA_FMT('G', 'S', 'T'):
+            nmea->type = NMEA_TYPE_GST;
+            memset(&nmea->gst, 0, sizeof(nmea->gst));
+            res = sNmeaDecodeGst(&nmea->gst, payload, payloadLen, info.talker);
+            break;
+        case NMEA_FMT('V', 'T', 'G'):
+            nmea->type = NMEA_TYPE_VTG;
+            memset(&nmea->vtg, 0, sizeof(nmea->vtg));
+            res = sNmeaDecodeVtg(&nmea->vtg, payload, payloadLen, info.talker);
+            break;
+        case NMEA_FMT('Z', 'D', 'A'):
+            nmea->type = NMEA_TYPE_ZDA;
+            memset(&nmea->zda, 0, sizeof(nmea->zda));
+            res = sNmeaDecodeZda(&nmea->zda, payload, payloadLen, info.talker);
+            break;
+        case NMEA_FMT('G', 'N', 'S'):
+            nmea->type = NMEA_TYPE_GNS;
+            memset(&nmea->gns, 0, sizeof(nmea->gns));
+            res = sNmeaDecodeGns(&nmea->gns, payload, payloadLen, info.talker);
+            break;
+        case NMEA_FMT('T', 'X', 'T'):
+            nmea->type = NMEA_TYPE_TXT;
+            memset(&nmea->txt, 0, offsetof(NMEA_TXT_t, text) + 1);
+            res = sNmeaDecodeTxt(&nmea->txt, payload, payloadLen, info.talker);
+            break;
+        default:
+            break;
     }
 
-    NMEA_DEBUG("decodeNmea: %d [%s] [%s] [%s]", res, nmea->talker, nmea->formatter, nmea->info);
+    NMEA_DEBUG("decodeNmea: %d [%s] [%s]", res, nmea->talker, nmea->formatter);
     return res;
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+void nmeaFormatInfo(NMEA_MSG_t *nmea)
+{
+    switch (nmea->type)
+    {
+        case NMEA_TYPE_GGA:
+            snprintf(nmea->info, sizeof(nmea->info), "%02d:%02d:%06.3f (%d) %s %+11.7f %+12.7f %+5.0f",
+                nmea->gga.time.hour, nmea->gga.time.minute, nmea->gga.time.second, nmea->gga.time.valid,
+                sNmeaFixStr(nmea->gga.fix), nmea->gga.lat, nmea->gga.lon, nmea->gga.height);
+            break;
+        case NMEA_TYPE_RMC:
+            snprintf(nmea->info, sizeof(nmea->info), "%04d-%02d-%02d (%d) %02d:%02d:%06.3f (%d) %s (%d) %+11.7f %+12.7f",
+                nmea->rmc.date.year, nmea->rmc.date.month, nmea->rmc.date.day, nmea->rmc.date.valid,
+                nmea->rmc.time.hour, nmea->rmc.time.minute, nmea->rmc.time.second, nmea->rmc.time.valid,
+                sNmeaFixStr(nmea->rmc.fix), nmea->rmc.valid, nmea->rmc.lat, nmea->rmc.lon);
+            break;
+        case NMEA_TYPE_GLL:
+            snprintf(nmea->info, sizeof(nmea->info), "%02d:%02d:%06.3f (%d) %s (%d) %+11.7f %+12.7f",
+                nmea->gll.time.hour, nmea->gll.time.minute, nmea->gll.time.second, nmea->gll.time.valid,
+                sNmeaFixStr(nmea->gll.fix), nmea->gll.valid, nmea->gll.lat, nmea->gll.lon);
+            break;
+        case NMEA_TYPE_GSV:
+            snprintf(nmea->info, sizeof(nmea->info), "%d/%d %d",
+                nmea->gsv.msgNum, nmea->gsv.numMsg, nmea->gsv.numSat);
+            break;
+        case NMEA_TYPE_GSA:
+            snprintf(nmea->info, sizeof(nmea->info), "%c %s %d %d %.2f %.2f %.2f",
+                nmea->gsa.opMode, sNmeaFixStr(nmea->gsa.fix), nmea->gsa.systemId, nmea->gsa.nSvs,
+                nmea->gsa.pDOP, nmea->gsa.hDOP, nmea->gsa.vDOP);
+            break;
+        case NMEA_TYPE_GST:
+            snprintf(nmea->info, sizeof(nmea->info), "%02d:%02d:%06.3f (%d) %.3f %.3f %.3f",
+                nmea->gst.time.hour, nmea->gst.time.minute, nmea->gst.time.second, nmea->gst.time.valid,
+                nmea->gst.stdLat, nmea->gst.stdLon, nmea->gst.stdAlt);
+            break;
+        case NMEA_TYPE_VTG:
+            snprintf(nmea->info, sizeof(nmea->info), "%s %.1f %.1f %.3f",
+                sNmeaFixStr(nmea->vtg.fix), nmea->vtg.cogt, nmea->vtg.cogm, nmea->vtg.sogk);
+            break;
+        case NMEA_TYPE_ZDA:
+            snprintf(nmea->info, sizeof(nmea->info), "%04d-%02d-%02d (%d) %02d:%02d:%06.3f (%d) %+03d:%02d",
+                nmea->zda.date.year, nmea->zda.date.month, nmea->zda.date.day, nmea->zda.date.valid,
+                nmea->zda.time.hour, nmea->zda.time.minute, nmea->zda.time.second, nmea->zda.time.valid,
+                nmea->zda.ltzh, nmea->zda.ltzn);
+            break;
+        case NMEA_TYPE_GNS:
+            snprintf(nmea->info, sizeof(nmea->info), "%02d:%02d:%06.3f (%d) %s %s (%d) %+11.7f %+12.7f %+5.0f",
+                nmea->gns.time.hour, nmea->gns.time.minute, nmea->gns.time.second, nmea->gns.time.valid,
+                sNmeaFixStr(nmea->gns.fix), nmea->gns.posMode, nmea->gns.valid, nmea->gns.lat, nmea->gns.lon,
+                nmea->gns.height);
+            break;
+        case NMEA_TYPE_TXT:
+            snprintf(nmea->info, sizeof(nmea->info), "%s", nmea->txt.text);
+            break;
+        case NMEA_TYPE_NONE:
+            nmea->info[0] = '\0';
+            break;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 static const char * const kNmeaFixStrs[] =
 {
     [NMEA_FIX_UNKNOWN]   = "UNKNOWN",
@@ -313,82 +414,172 @@ static const char *sNmeaFixStr(const NMEA_FIX_t fix)
     return (fix >= 0) && (fix < NUMOF(kNmeaFixStrs)) ? kNmeaFixStrs[fix] : kNmeaFixStrs[NMEA_FIX_UNKNOWN];
 }
 
-static int sGetFields(const char **fields, const int maxFields, char *payload)
+// Split payload into fields, returns the number of fields (at most maxFields)
+static int sGetFields(NMEA_FIELD_t *fields, const int maxFields, const char *payload, const int len)
 {
-    int nTok = 0;
     int nFields = 0;
-    for (char *sep = strchr(payload, ','); sep != NULL; )
+    int ix0 = 0;
+    for (int ix = 0; (ix <= len) && (nFields < maxFields); ix++)
     {
-        nTok++;
-        *sep = '\0';
-        NMEA_DEBUG("tok %d [%s]", nTok, payload);
-        if (nFields < maxFields)
+        if ( (ix == len) || (payload[ix] == ',') )
         {
-            fields[nFields] = payload;
+            fields[nFields].str = &payload[ix0];
+            fields[nFields].len = ix - ix0;
+            NMEA_DEBUG("tok %d [%.*s]", nFields, fields[nFields].len, fields[nFields].str);
             nFields++;
+            ix0 = ix + 1;
         }
-
-        payload = &sep[1];
-        sep = strchr(payload, ',');
-    }
-    nTok++;
-    NMEA_DEBUG("tok %d [%s]", nTok, payload);
-    if (nFields < maxFields)
-    {
-        fields[nFields] = payload;
-        nFields++;
     }
+    return nFields;
+}
 
-    return nFields <= maxFields ? nFields : 0;
+// First character of field, '\0' for empty fields
+static char sFieldChr(const NMEA_FIELD_t *field)
+{
+    return field->len > 0 ? field->str[0] : '\0';
 }
 
-static bool sStrToTime(NMEA_TIME_t *time, const char *str)
+// Parse fixed number of digits
+static bool sParseDigits(int *val, const char *str, const int num)
 {
-    int len = 0;
-    time->valid =
-        (sscanf(str, "%2d%2d%lf%n", &time->hour, &time->minute, &time->second, &len) == 3) && (len == (int)strlen(str));
-    // FIXME: validate data?
-    NMEA_DEBUG("sStrToTime [%s] -> %d %d %.3f (%d)", str, time->hour, time->minute, time->second, time->valid);
-    return time->valid;
+    int v = 0;
+    for (int ix = 0; ix < num; ix++)
+    {
+        const char c = str[ix];
+        if ( (c < '0') || (c > '9') )
+        {
+            return false;
+        }
+        v = (v * 10) + (c - '0');
+    }
+    *val = v;
+    return true;
 }
 
-static bool sStrToDate(NMEA_DATE_t *date, const char *str)
+// Parse decimal number ("[+-]digits[.digits]", "[+-].digits", "[+-]digits."). The result is the same as from strtod()
+// for up to 15 significant digits, which is plenty for NMEA.
+static bool sParseDbl(double *val, const char *str, const int len)
 {
-    int len = 0;
-    date->valid =
-        (sscanf(str, "%2d%2d%2d%n", &date->day, &date->month, &date->year, &len) == 3) && (len == (int)strlen(str));
-    date->year += 2000; // probably... :-/
-    // FIXME: validate data?
-    NMEA_DEBUG("sStrToDate [%s] -> %d %d %d (%d)", str, date->day, date->month, date->year, date->valid);
-    return date->valid;
+    static const double kPow10[] =
+    {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18
+    };
+    int ix = 0;
+    bool neg = false;
+    if ( (len > 0) && ((str[0] == '-') || (str[0] == '+')) )
+    {
+        neg = (str[0] == '-');
+        ix++;
+    }
+    uint64_t mant = 0;  // mantissa, up to 18 significant digits (further fraction digits are ignored)
+    int nSig = 0;       // number of significant digits in mant
+    int nFrac = 0;      // number of fraction digits in mant
+    int nDigits = 0;    // number of digits
+    bool frac = false;
+    for (; ix < len; ix++)
+    {
+        const char c = str[ix];
+        if ( (c >= '0') && (c <= '9') )
+        {
+            nDigits++;
+            if ( (nSig < 18) && (!frac || (nFrac < 18)) )
+            {
+                mant = (mant * 10) + (c - '0');
+                if (mant > 0)
+                {
+                    nSig++;
+                }
+                if (frac)
+                {
+                    nFrac++;
+                }
+            }
+            else if (!frac)
+            {
+                return false; // too large
+            }
+        }
+        else if ( (c == '.') && !frac )
+        {
+            frac = true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    if (nDigits < 1)
+    {
+        return false;
+    }
+    const double v = (double)mant / kPow10[nFrac];
+    *val = neg ? -v : v;
+    return true;
 }
 
-static bool sStrToLat(double *lat, const char *str)
+// Parse integer ("[+-]digits")
+static bool sParseInt(int *val, const char *str, const int len)
 {
-    int len = 0;
-    int deg = 0;
-    double min = 0.0;
-    if ( (sscanf(str, "%2d%lf%n", &deg, &min, &len) == 2) && (len == (int)strlen(str)) )
+    int ix = 0;
+    bool neg = false;
+    if ( (len > 0) && ((str[0] == '-') || (str[0] == '+')) )
     {
-        *lat = (double)deg + (min * (1.0/60.0));
-        NMEA_DEBUG("sStrToLat [%s] -> %d %g -> %g", str, deg, min, *lat);
-        return true;
+        neg = (str[0] == '-');
+        ix++;
     }
-    else
+    if (ix >= len)
     {
         return false;
     }
+    int64_t v = 0;
+    for (; ix < len; ix++)
+    {
+        const char c = str[ix];
+        if ( (c < '0') || (c > '9') )
+        {
+            return false;
+        }
+        v = (v * 10) + (c - '0');
+        if (v > INT32_MAX)
+        {
+            return false;
+        }
+    }
+    *val = (int)(neg ? -v : v);
+    return true;
+}
+
+static bool sStrToTime(NMEA_TIME_t *time, const NMEA_FIELD_t *field)
+{
+    // hhmmss[.sss]
+    time->valid = (field->len >= 6) && sParseDigits(&time->hour, field->str, 2) &&
+        sParseDigits(&time->minute, &field->str[2], 2) && sParseDbl(&time->second, &field->str[4], field->len - 4);
+    // FIXME: validate data?
+    NMEA_DEBUG("sStrToTime [%.*s] -> %d %d %.3f (%d)", field->len, field->str, time->hour, time->minute, time->second, time->valid);
+    return time->valid;
+}
+
+static bool sStrToDate(NMEA_DATE_t *date, const NMEA_FIELD_t *field)
+{
+    // ddmmyy
+    date->valid = (field->len == 6) && sParseDigits(&date->day, field->str, 2) &&
+        sParseDigits(&date->month, &field->str[2], 2) && sParseDigits(&date->year, &field->str[4], 2);
+    date->year += 2000; // probably... :-/
+    // FIXME: validate data?
+    NMEA_DEBUG("sStrToDate [%.*s] -> %d %d %d (%d)", field->len, field->str, date->day, date->month, date->year, date->valid);
+    return date->valid;
 }
 
-static bool sStrToLon(double *lon, const char *str)
+// Latitude (nDeg = 2, "ddmm.mmmm") or longitude (nDeg = 3, "dddmm.mmmm")
+static bool sStrToDegMin(double *deg, const NMEA_FIELD_t *field, const int nDeg)
 {
-    int len = 0;
-    int deg = 0;
+    int d = 0;
     double min = 0.0;
-    if ( (sscanf(str, "%3d%lf%n", &deg, &min, &len) == 2) && (len == (int)strlen(str)) )
+    if ( (field->len > nDeg) && sParseDigits(&d, field->str, nDeg) &&
+         sParseDbl(&min, &field->str[nDeg], field->len - nDeg) )
     {
-        *lon = (double)deg + (min * (1.0/60.0));
-        NMEA_DEBUG("sStrToLon [%s] -> %d %g -> %g", str, deg, min, *lon);
+        *deg = (double)d + (min * (1.0/60.0));
+        NMEA_DEBUG("sStrToDegMin [%.*s] -> %d %g -> %g", field->len, field->str, d, min, *deg);
         return true;
     }
     else
@@ -397,14 +588,14 @@ static bool sStrToLon(double *lon, const char *str)
     }
 }
 
-static bool sStrToFix(NMEA_FIX_t *fix, const char *str, const NMEA_TYPE_t type)
+static bool sStrToFix(NMEA_FIX_t *fix, const NMEA_FIELD_t *field, const NMEA_TYPE_t type)
 {
     // FIXME: very confusing and the interface description isn't terribly helpful... to check actual receiver behaviour
     bool res = true;
     switch (type)
     {
         case NMEA_TYPE_GGA:
-            switch (str[0])
+            switch (sFieldChr(field))
             {
                 case '0': *fix = NMEA_FIX_NOFIX; break;
                 case '1':
@@ -417,7 +608,9 @@ static bool sStrToFix(NMEA_FIX_t *fix, const char *str, const NMEA_TYPE_t type)
             break;
         case NMEA_TYPE_RMC:
         case NMEA_TYPE_GLL:
-            switch (str[0])
+        case NMEA_TYPE_VTG:
+        case NMEA_TYPE_GNS:
+            switch (sFieldChr(field))
             {
                 case 'N': *fix = NMEA_FIX_NOFIX; break;
                 case 'A':
@@ -430,29 +623,28 @@ static bool sStrToFix(NMEA_FIX_t *fix, const char *str, const NMEA_TYPE_t type)
             break;
         case NMEA_TYPE_TXT:
         case NMEA_TYPE_GSV:
+        case NMEA_TYPE_GSA:
+        case NMEA_TYPE_GST:
+        case NMEA_TYPE_ZDA:
         case NMEA_TYPE_NONE:
             res = false;
             break;
     }
-    NMEA_DEBUG("sStrToFix [%s] -> %d", str, *fix);
+    NMEA_DEBUG("sStrToFix [%.*s] -> %d", field->len, field->str, *fix);
     return res;
 }
 
-static bool sStrToInt(int *val, const char *str, const bool checkLo, const int lo, const bool checkHi, const int hi)
+static bool sStrToInt(int *val, const NMEA_FIELD_t *field, const bool checkLo, const int lo, const bool checkHi, const int hi)
 {
-    int len = 0;
-    bool res = (sscanf(str, "%d%n", val, &len) == 1) && (len == (int)strlen(str)) &&
-         (!checkLo || (*val >= lo)) && (!checkHi || (*val <= hi));
-    NMEA_DEBUG("sStrToInt [%s] -> %d (%d, %d:%d - %d:%d)", str, *val, res, checkLo, lo, checkHi, hi);
+    bool res = sParseInt(val, field->str, field->len) && (!checkLo || (*val >= lo)) && (!checkHi || (*val <= hi));
+    NMEA_DEBUG("sStrToInt [%.*s] -> %d (%d, %d:%d - %d:%d)", field->len, field->str, *val, res, checkLo, lo, checkHi, hi);
     return res;
 }
 
-static bool sStrToDbl(double *val, const char *str, const bool checkLo, const double lo, const bool checkHi, const double hi)
+static bool sStrToDbl(double *val, const NMEA_FIELD_t *field, const bool checkLo, const double lo, const bool checkHi, const double hi)
 {
-    int len = 0;
-    bool res = (sscanf(str, "%lf%n", val, &len) == 1) && (len == (int)strlen(str)) &&
-         (!checkLo || (*val >= lo)) && (!checkHi || (*val <= hi));
-    NMEA_DEBUG("sStrToDbl [%s] -> %g (%d, %d:%g - %d:%g)", str, *val, res, checkLo, lo, checkHi, hi);
+    bool res = sParseDbl(val, field->str, field->len) && (!checkLo || (*val >= lo)) && (!checkHi || (*val <= hi));
+    NMEA_DEBUG("sStrToDbl [%.*s] -> %g (%d, %d:%g - %d:%g)", field->len, field->str, *val, res, checkLo, lo, checkHi, hi);
     return res;
 }
 
@@ -473,13 +665,13 @@ static bool sStrToDbl(double *val, const char *str, const bool checkLo, const do
 #define F_GGA_DIFFAGE (13 - 1)
 #define F_GGA_DIFFSTA (14 - 1)
 
-static bool sNmeaDecodeGga(NMEA_GGA_t *gga, char *payload, const char *talker)
+static bool sNmeaDecodeGga(NMEA_GGA_t *gga, const char *payload, const int len, const char *talker)
 {
-    NMEA_DEBUG("sNmeaDecodeGga [%s] [%s]", talker, payload);
+    NMEA_DEBUG("sNmeaDecodeGga [%s] [%.*s]", talker, len, payload);
     UNUSED(talker);
 
-    const char *fields[30];
-    const int nFields = sGetFields(fields, NUMOF(fields), payload);
+    NMEA_FIELD_t fields[30];
+    const int nFields = sGetFields(fields, NUMOF(fields), payload, len);
     if (nFields != 14)
     {
         return false;
@@ -487,24 +679,24 @@ static bool sNmeaDecodeGga(NMEA_GGA_t *gga, char *payload, const char *talker)
 
     bool res = true;
 
-    if (fields[F_GGA_TIME][0] != '\0')
+    if (fields[F_GGA_TIME].len > 0)
     {
-        res = sStrToTime(&gga->time, fields[F_GGA_TIME]);
+        res = sStrToTime(&gga->time, &fields[F_GGA_TIME]);
     }
 
-    if ( (fields[F_GGA_LAT][0] != '\0') && (fields[F_GGA_LON][0] != '\0') && (fields[F_GGA_QUALITY][0] != '\0') )
+    if ( (fields[F_GGA_LAT].len > 0) && (fields[F_GGA_LON].len > 0) && (fields[F_GGA_QUALITY].len > 0) )
     {
-        if (!sStrToLat( &gga->lat, fields[F_GGA_LAT]) ||
-            !sStrToLon( &gga->lon, fields[F_GGA_LON]) ||
-            !sStrToFix( &gga->fix, fields[F_GGA_QUALITY], NMEA_TYPE_GGA))
+        if (!sStrToDegMin(&gga->lat, &fields[F_GGA_LAT], 2) ||
+            !sStrToDegMin(&gga->lon, &fields[F_GGA_LON], 3) ||
+            !sStrToFix( &gga->fix, &fields[F_GGA_QUALITY], NMEA_TYPE_GGA))
         {
             res = false;
         }
-        if (fields[F_GGA_NS][0] == 'S')
+        if (sFieldChr(&fields[F_GGA_NS]) == 'S')
         {
             gga->lat *= -1.0;
         }
-        if (fields[F_GGA_EW][0] == 'W')
+        if (sFieldChr(&fields[F_GGA_EW]) == 'W')
         {
             gga->lon *= -1.0;
         }
@@ -514,34 +706,30 @@ static bool sNmeaDecodeGga(NMEA_GGA_t *gga, char *payload, const char *talker)
         gga->fix = NMEA_FIX_NOFIX;
     }
 
-    if ( (fields[F_GGA_NUMSV][0] != '\0') && !sStrToInt(&gga->numSv, fields[F_GGA_NUMSV], true, 0, false, 0) )
+    if ( (fields[F_GGA_NUMSV].len > 0) && !sStrToInt(&gga->numSv, &fields[F_GGA_NUMSV], true, 0, false, 0) )
     {
         res = false;
     }
 
-    if ( (fields[F_GGA_HDOP][0] != '\0') && !sStrToDbl(&gga->hDOP, fields[F_GGA_HDOP], true, 0.0, false, 0.0) )
+    if ( (fields[F_GGA_HDOP].len > 0) && !sStrToDbl(&gga->hDOP, &fields[F_GGA_HDOP], true, 0.0, false, 0.0) )
     {
         res = false;
     }
 
-    if ( (fields[F_GGA_ALT][0] != '\0') && !sStrToDbl(&gga->height, fields[F_GGA_ALT], false, 0.0, false, 0.0) )
+    if ( (fields[F_GGA_ALT].len > 0) && !sStrToDbl(&gga->heightMsl, &fields[F_GGA_ALT], false, 0.0, false, 0.0) )
     {
         res = false;
     }
-
-    if (fields[F_GGA_SEP][0] != '\0')
+    double sep = 0.0;
+    if ( (fields[F_GGA_SEP].len > 0) && !sStrToDbl(&sep, &fields[F_GGA_SEP], false, 0.0, false, 0.0) )
     {
-        double sep = 0.0;
-        if (!sStrToDbl(&sep, fields[F_GGA_SEP], false, 0.0, false, 0.0))
-        {
-            res = false;
-        }
-        gga->heightMsl = gga->height - sep;
+        res = false;
     }
+    gga->height = gga->heightMsl + sep;
 
-    if (fields[F_GGA_DIFFAGE][0] != '\0')
+    if (fields[F_GGA_DIFFAGE].len > 0)
     {
-        if (!sStrToDbl(&gga->diffAge, fields[F_GGA_DIFFAGE], true, 0, false, 0))
+        if (!sStrToDbl(&gga->diffAge, &fields[F_GGA_DIFFAGE], true, 0, false, 0))
         {
             res = false;
         }
@@ -551,9 +739,9 @@ static bool sNmeaDecodeGga(NMEA_GGA_t *gga, char *payload, const char *talker)
         gga->diffAge = -1.0;
     }
 
-    if (fields[13][0] != '\0')
+    if (fields[F_GGA_DIFFSTA].len > 0)
     {
-        if (!sStrToInt(&gga->diffStation, fields[13], true, 0, false, 0))
+        if (!sStrToInt(&gga->diffStation, &fields[13], true, 0, false, 0))
         {
             res = false;
         }
@@ -582,13 +770,13 @@ static bool sNmeaDecodeGga(NMEA_GGA_t *gga, char *payload, const char *talker)
 #define F_RMC_POSMODE   (12 - 1)
 #define F_RMC_NAVSTATUS (13 - 1)
 
-static bool sNmeaDecodeRmc(NMEA_RMC_t *rmc, char *payload, const char *talker)
+static bool sNmeaDecodeRmc(NMEA_RMC_t *rmc, const char *payload, const int len, const char *talker)
 {
-    NMEA_DEBUG("sNmeaDecodeRmc [%s] [%s]", talker, payload);
+    NMEA_DEBUG("sNmeaDecodeRmc [%s] [%.*s]", talker, len, payload);
     UNUSED(talker);
 
-    const char *fields[30];
-    const int nFields = sGetFields(fields, NUMOF(fields), payload);
+    NMEA_FIELD_t fields[30];
+    const int nFields = sGetFields(fields, NUMOF(fields), payload, len);
     if (nFields < 13)
     {
         return false;
@@ -596,32 +784,32 @@ static bool sNmeaDecodeRmc(NMEA_RMC_t *rmc, char *payload, const char *talker)
 
     bool res = true;
 
-    if (fields[F_RMC_TIME][0] != '\0')
+    if (fields[F_RMC_TIME].len > 0)
     {
-        res = sStrToTime(&rmc->time, fields[F_RMC_TIME]);
+        res = sStrToTime(&rmc->time, &fields[F_RMC_TIME]);
     }
-    if (fields[F_RMC_DATE][0] != '\0')
+    if (fields[F_RMC_DATE].len > 0)
     {
-        res = sStrToDate(&rmc->date, fields[F_RMC_DATE]);
+        res = sStrToDate(&rmc->date, &fields[F_RMC_DATE]);
     }
 
-    if ( (fields[F_RMC_LAT][0] != '\0') && (fields[F_RMC_LON][0] != '\0') && (fields[F_RMC_POSMODE][0] != '\0') )
+    if ( (fields[F_RMC_LAT].len > 0) && (fields[F_RMC_LON].len > 0) && (fields[F_RMC_POSMODE].len > 0) )
     {
-        if (!sStrToLat( &rmc->lat, fields[F_RMC_LAT]) ||
-            !sStrToLon( &rmc->lon, fields[F_RMC_LON]) ||
-            !sStrToFix( &rmc->fix, fields[F_RMC_POSMODE], NMEA_TYPE_RMC))
+        if (!sStrToDegMin(&rmc->lat, &fields[F_RMC_LAT], 2) ||
+            !sStrToDegMin(&rmc->lon, &fields[F_RMC_LON], 3) ||
+            !sStrToFix( &rmc->fix, &fields[F_RMC_POSMODE], NMEA_TYPE_RMC))
         {
             res = false;
         }
-        if (fields[F_RMC_NS][0] != 'N')
+        if (sFieldChr(&fields[F_RMC_NS]) != 'N')
         {
             rmc->lat *= -1.0;
         }
-        if (fields[F_RMC_EW][0] != 'E')
+        if (sFieldChr(&fields[F_RMC_EW]) != 'E')
         {
             rmc->lon *= -1.0;
         }
-        if ( (nFields > F_RMC_NAVSTATUS) && (fields[F_RMC_NAVSTATUS][0] != 'V') )
+        if ( (nFields > F_RMC_NAVSTATUS) && (sFieldChr(&fields[F_RMC_NAVSTATUS]) != 'V') )
         {
             rmc->fix = NMEA_FIX_NOFIX; // FIXME: or what does != 'V' mean?
         }
@@ -631,32 +819,32 @@ static bool sNmeaDecodeRmc(NMEA_RMC_t *rmc, char *payload, const char *talker)
         rmc->fix = NMEA_FIX_NOFIX;
     }
 
-    rmc->valid = (fields[F_RMC_STATUS][0] == 'A');
+    rmc->valid = (sFieldChr(&fields[F_RMC_STATUS]) == 'A');
 
-    if (fields[F_RMC_SPEED][0] != '\0')
+    if (fields[F_RMC_SPEED].len > 0)
     {
-        if (!sStrToDbl(&rmc->spd, fields[F_RMC_SPEED], false, 0.0, false, 0.0))
+        if (!sStrToDbl(&rmc->spd, &fields[F_RMC_SPEED], false, 0.0, false, 0.0))
         {
             res = false;
         }
     }
 
-    if (fields[F_RMC_COG][0] != '\0')
+    if (fields[F_RMC_COG].len > 0)
     {
-        if (!sStrToDbl(&rmc->cog, fields[F_RMC_COG], true, 0.0, true, 360.0))
+        if (!sStrToDbl(&rmc->cog, &fields[F_RMC_COG], true, 0.0, true, 360.0))
         {
             res = false;
         }
     }
 
-    if (fields[F_RMC_MV][0] != '\0')
+    if (fields[F_RMC_MV].len > 0)
     {
-        if (!sStrToDbl(&rmc->mv, fields[F_RMC_MV], true, -180.0, true, 180.0))
+        if (!sStrToDbl(&rmc->mv, &fields[F_RMC_MV], true, -180.0, true, 180.0))
         {
             res = false;
         }
     }
-    if (fields[F_RMC_MVEW][0] == 'W')
+    if (sFieldChr(&fields[F_RMC_MVEW]) == 'W')
     {
         rmc->mv *= -1.0;
     }
@@ -666,21 +854,23 @@ static bool sNmeaDecodeRmc(NMEA_RMC_t *rmc, char *payload, const char *talker)
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-static bool sNmeaDecodeTxt(NMEA_TXT_t *txt, char *payload, const char *talker)
+static bool sNmeaDecodeTxt(NMEA_TXT_t *txt, const char *payload, const int len, const char *talker)
 {
     UNUSED(talker);
-    NMEA_DEBUG("sNmeaDecodeTxt [%s] [%s]", talker, payload);
+    NMEA_DEBUG("sNmeaDecodeTxt [%s] [%.*s]", talker, len, payload);
 
-    const char *fields[5];
-    const int nFields = sGetFields(fields, NUMOF(fields), payload);
+    NMEA_FIELD_t fields[5];
+    const int nFields = sGetFields(fields, NUMOF(fields), payload, len);
     if ((nFields != 4) ||
-        !sStrToInt(&txt->numMsg,  fields[0], true, 0, false, 0) ||
-        !sStrToInt(&txt->msgNum,  fields[1], true, 0, false, 0) ||
-        !sStrToInt(&txt->msgType, fields[2], true, 0, false, 0))
+        !sStrToInt(&txt->numMsg,  &fields[0], true, 0, false, 0) ||
+        !sStrToInt(&txt->msgNum,  &fields[1], true, 0, false, 0) ||
+        !sStrToInt(&txt->msgType, &fields[2], true, 0, false, 0))
     {
         return false;
     }
-    snprintf(txt->text, sizeof(txt->text), "%s", fields[3]);
+    const int textLen = MIN(fields[3].len, (int)sizeof(txt->text) - 1);
+    memcpy(txt->text, fields[3].str, textLen);
+    txt->text[textLen] = '\0';
     return true;
 }
 
@@ -694,13 +884,13 @@ static bool sNmeaDecodeTxt(NMEA_TXT_t *txt, char *payload, const char *talker)
 #define F_GLL_STATUS   (6 - 1)
 #define F_GLL_POSMODE  (7 - 1)
 
-static bool sNmeaDecodeGll(NMEA_GLL_t *gll, char *payload, const char *talker)
+static bool sNmeaDecodeGll(NMEA_GLL_t *gll, const char *payload, const int len, const char *talker)
 {
     UNUSED(talker);
-    NMEA_DEBUG("sNmeaDecodeGll [%s] [%s]", talker, payload);
+    NMEA_DEBUG("sNmeaDecodeGll [%s] [%.*s]", talker, len, payload);
 
-    const char *fields[15];
-    const int nFields = sGetFields(fields, NUMOF(fields), payload);
+    NMEA_FIELD_t fields[15];
+    const int nFields = sGetFields(fields, NUMOF(fields), payload, len);
     if (nFields != 7)
     {
         return false;
@@ -708,24 +898,24 @@ static bool sNmeaDecodeGll(NMEA_GLL_t *gll, char *payload, const char *talker)
 
     bool res = true;
 
-    if (fields[F_GLL_TIME][0] != '\0')
+    if (fields[F_GLL_TIME].len > 0)
     {
-        res = sStrToTime(&gll->time, fields[F_GLL_TIME]);
+        res = sStrToTime(&gll->time, &fields[F_GLL_TIME]);
     }
 
-    if ( (fields[F_GLL_LAT][0] != '\0') && (fields[F_GLL_LON][0] != '\0') && (fields[F_GLL_POSMODE][0] != '\0') )
+    if ( (fields[F_GLL_LAT].len > 0) && (fields[F_GLL_LON].len > 0) && (fields[F_GLL_POSMODE].len > 0) )
     {
-        if (!sStrToLat( &gll->lat, fields[F_GLL_LAT]) ||
-            !sStrToLon( &gll->lon, fields[F_GLL_LON]) ||
-            !sStrToFix( &gll->fix, fields[F_GLL_POSMODE], NMEA_TYPE_RMC))
+        if (!sStrToDegMin(&gll->lat, &fields[F_GLL_LAT], 2) ||
+            !sStrToDegMin(&gll->lon, &fields[F_GLL_LON], 3) ||
+            !sStrToFix( &gll->fix, &fields[F_GLL_POSMODE], NMEA_TYPE_RMC))
         {
             res = false;
         }
-        if (fields[F_GLL_NS][0] != 'N')
+        if (sFieldChr(&fields[F_GLL_NS]) != 'N')
         {
             gll->lat *= -1.0;
         }
-        if (fields[F_GLL_EW][0] != 'E')
+        if (sFieldChr(&fields[F_GLL_EW]) != 'E')
         {
             gll->lon *= -1.0;
         }
@@ -735,26 +925,105 @@ static bool sNmeaDecodeGll(NMEA_GLL_t *gll, char *payload, const char *talker)
         gll->fix = NMEA_FIX_NOFIX;
     }
 
-    gll->valid = (fields[F_GLL_STATUS][0] == 'A');
+    gll->valid = (sFieldChr(&fields[F_GLL_STATUS]) == 'A');
 
     return res;
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-static bool sNmeaDecodeGsv(NMEA_GSV_t *gsv, char *payload, const char *talker)
+// NMEA satellite numbers to "native" numbers (SBAS 120-158, GLONASS slots 1-32, QZSS 1-10). If the GNSS is unknown
+// (e.g. "GN" talker and no system ID), it is inferred from the (NMEA 4.0 "extended") satellite number.
+static void sNmeaToSv(NMEA_GNSS_t *gnss, int *svId)
+{
+    switch (*gnss)
+    {
+        case NMEA_GNSS_UNKNOWN:
+            if ( (*svId >= 1) && (*svId <= 32) )
+            {
+                *gnss = NMEA_GNSS_GPS;
+            }
+            else if ( (*svId >= 33) && (*svId <= 64) )
+            {
+                *gnss = NMEA_GNSS_SBAS;
+                *svId += 87;
+            }
+            else if ( (*svId >= 65) && (*svId <= 96) )
+            {
+                *gnss = NMEA_GNSS_GLO;
+                *svId -= 64;
+            }
+            break;
+        case NMEA_GNSS_GPS:
+            if (*svId > 32)
+            {
+                *gnss = NMEA_GNSS_SBAS;
+                // S120-S158 (39) = 33-64 (32, S120-S151) and 152-158 (7, S152-158)
+                if ( (*svId >= 33) && (*svId <= 64) )
+                {
+                    *svId += 87;
+                }
+            }
+            break;
+        case NMEA_GNSS_GLO:
+            if ( (*svId >= 65) && (*svId <= 96) )
+            {
+                *svId -= 64;
+            }
+            break;
+        case NMEA_GNSS_QZSS:
+            if ( (*svId >= 193) && (*svId <= 202) )
+            {
+                *svId -= 192;
+            }
+            break;
+        case NMEA_GNSS_BDS:
+        case NMEA_GNSS_GAL:
+        case NMEA_GNSS_SBAS:
+            break;
+    }
+}
+
+// GNSS from talker ID or NMEA 4.10+ system ID
+static NMEA_GNSS_t sNmeaGnss(const char *talker, const int systemId)
+{
+    switch (systemId)
+    {
+        case 1: return NMEA_GNSS_GPS;
+        case 2: return NMEA_GNSS_GLO;
+        case 3: return NMEA_GNSS_GAL;
+        case 4: return NMEA_GNSS_BDS;
+        case 5: return NMEA_GNSS_QZSS;
+    }
+    if (talker[0] == 'G')
+    {
+        switch (talker[1])
+        {
+            case 'P': return NMEA_GNSS_GPS;
+            case 'L': return NMEA_GNSS_GLO;
+            case 'A': return NMEA_GNSS_GAL;
+            case 'B': return NMEA_GNSS_BDS;
+            case 'Q': return NMEA_GNSS_QZSS;
+        }
+    }
+    return NMEA_GNSS_UNKNOWN;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static bool sNmeaDecodeGsv(NMEA_GSV_t *gsv, const char *payload, const int len, const char *talker)
 {
-    NMEA_DEBUG("sNmeaDecodeGsv [%s] [%s]", talker, payload);
+    NMEA_DEBUG("sNmeaDecodeGsv [%s] [%.*s]", talker, len, payload);
 
-    const char *fields[30];
-    const int nFields = sGetFields(fields, NUMOF(fields), payload);
+    NMEA_FIELD_t fields[30];
+    const int nFields = sGetFields(fields, NUMOF(fields), payload, len);
     if (nFields < 3)
     {
         return false;
     }
-    if (!sStrToInt(&gsv->numMsg, fields[0], true, 1, false, 0) ||
-        !sStrToInt(&gsv->msgNum, fields[1], true, 1, true, gsv->numMsg) ||
-        !sStrToInt(&gsv->numSat, fields[2], true, 0, false, 0) )
+    if (!sStrToInt(&gsv->numMsg, &fields[0], true, 1, false, 0) ||
+        !sStrToInt(&gsv->msgNum, &fields[1], true, 1, true, gsv->numMsg) ||
+        !sStrToInt(&gsv->numSat, &fields[2], true, 0, false, 0) )
     {
         return false;
     }
@@ -763,7 +1032,7 @@ static bool sNmeaDecodeGsv(NMEA_GSV_t *gsv, char *payload, const char *talker)
     int nmeaSig = 0;
     if (remFields > 0)
     {
-        if (!sStrToInt(&nmeaSig, fields[3 + (nSat * 4)], false, 0, false, 0))
+        if (!sStrToInt(&nmeaSig, &fields[3 + (nSat * 4)], false, 0, false, 0))
         {
             return false;
         }
@@ -825,24 +1094,19 @@ static bool sNmeaDecodeGsv(NMEA_GSV_t *gsv, char *payload, const char *talker)
     for (int satIx = 0; (satIx < nSat) && (satIx < (int)NUMOF(gsv->svs)); satIx++)
     {
         const int offs = 3 + (satIx * 4);
-        if (!sStrToInt(&gsv->svs[satIx].svId, fields[offs    ], true, 1, false, 0) ||
-            !sStrToInt(&gsv->svs[satIx].elev, fields[offs + 1], true, -90, true, 90) ||
-            !sStrToInt(&gsv->svs[satIx].azim, fields[offs + 2], true, 0, false, 360) ||
-            !sStrToInt(&gsv->svs[satIx].cno,  fields[offs + 3], true, 0, false, 0) )
+        if (!sStrToInt(&gsv->svs[satIx].svId, &fields[offs    ], true, 1, false, 0) ||
+            !sStrToInt(&gsv->svs[satIx].elev, &fields[offs + 1], true, -90, true, 90) ||
+            !sStrToInt(&gsv->svs[satIx].azim, &fields[offs + 2], true, 0, false, 360) ||
+            !sStrToInt(&gsv->svs[satIx].cno,  &fields[offs + 3], true, 0, false, 0) )
         {
             return false;
         }
         gsv->svs[satIx].gnss = gnss;
         gsv->svs[satIx].sig = sig;
-        if ( (gnss == NMEA_GNSS_GPS) && (gsv->svs[satIx].svId > 32) )
+        sNmeaToSv(&gsv->svs[satIx].gnss, &gsv->svs[satIx].svId);
+        if ( (gnss == NMEA_GNSS_GPS) && (gsv->svs[satIx].gnss == NMEA_GNSS_SBAS) )
         {
-            gsv->svs[satIx].gnss = NMEA_GNSS_SBAS;
             gsv->svs[satIx].sig = (sig == NMEA_SIGNAL_GPS_L1CA ? NMEA_SIGNAL_SBAS_L1CA : NMEA_SIGNAL_UNKNOWN);
-            // S120-S158 (39) = 33-64 (32, S120-S151) and 152-158 (7, S152-158)
-            if  ((gsv->svs[satIx].svId >= 33) && (gsv->svs[satIx].svId <= 64) )
-            {
-                gsv->svs[satIx].svId += 87;
-            }
         }
         NMEA_DEBUG("satIx=%d svId=%d elev=%d azim=%d cno=%d gnss=%d sig=%d",
             satIx, gsv->svs[satIx].svId, gsv->svs[satIx].elev, gsv->svs[satIx].azim, gsv->svs[satIx].cno, gsv->svs[satIx].gnss, gsv->svs[satIx].sig);
@@ -854,6 +1118,339 @@ static bool sNmeaDecodeGsv(NMEA_GSV_t *gsv, char *payload, const char *talker)
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+#define F_GSA_OPMODE    ( 1 - 1)
+#define F_GSA_NAVMODE   ( 2 - 1)
+#define F_GSA_SV1       ( 3 - 1)
+#define F_GSA_PDOP      (15 - 1)
+#define F_GSA_HDOP      (16 - 1)
+#define F_GSA_VDOP      (17 - 1)
+#define F_GSA_SYSTEMID  (18 - 1)
+
+static bool sNmeaDecodeGsa(NMEA_GSA_t *gsa, const char *payload, const int len, const char *talker)
+{
+    NMEA_DEBUG("sNmeaDecodeGsa [%s] [%.*s]", talker, len, payload);
+
+    NMEA_FIELD_t fields[20];
+    const int nFields = sGetFields(fields, NUMOF(fields), payload, len);
+    if ( (nFields != 17) && (nFields != 18) )
+    {
+        return false;
+    }
+
+    gsa->opMode = sFieldChr(&fields[F_GSA_OPMODE]);
+    switch (sFieldChr(&fields[F_GSA_NAVMODE]))
+    {
+        case '1': gsa->fix = NMEA_FIX_NOFIX; break;
+        case '2': gsa->fix = NMEA_FIX_S2D;   break;
+        case '3': gsa->fix = NMEA_FIX_S3D;   break;
+        default:  gsa->fix = NMEA_FIX_UNKNOWN; break;
+    }
+
+    if ( (nFields > F_GSA_SYSTEMID) && (fields[F_GSA_SYSTEMID].len > 0) &&
+        !sStrToInt(&gsa->systemId, &fields[F_GSA_SYSTEMID], true, 0, false, 0) )
+    {
+        return false;
+    }
+    const NMEA_GNSS_t gnss = sNmeaGnss(talker, gsa->systemId);
+
+    for (int ix = 0; ix < (int)NUMOF(gsa->svs); ix++)
+    {
+        const NMEA_FIELD_t *field = &fields[F_GSA_SV1 + ix];
+        if (field->len > 0)
+        {
+            if (!sStrToInt(&gsa->svs[gsa->nSvs].svId, field, true, 1, false, 0))
+            {
+                return false;
+            }
+            gsa->svs[gsa->nSvs].gnss = gnss;
+            sNmeaToSv(&gsa->svs[gsa->nSvs].gnss, &gsa->svs[gsa->nSvs].svId);
+            gsa->nSvs++;
+        }
+    }
+
+    if ( (fields[F_GSA_PDOP].len > 0) && (fields[F_GSA_HDOP].len > 0) && (fields[F_GSA_VDOP].len > 0) )
+    {
+        if (!sStrToDbl(&gsa->pDOP, &fields[F_GSA_PDOP], true, 0.0, false, 0.0) ||
+            !sStrToDbl(&gsa->hDOP, &fields[F_GSA_HDOP], true, 0.0, false, 0.0) ||
+            !sStrToDbl(&gsa->vDOP, &fields[F_GSA_VDOP], true, 0.0, false, 0.0) )
+        {
+            return false;
+        }
+        gsa->haveDop = true;
+    }
+
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+#define F_GST_TIME      (1 - 1)
+#define F_GST_RANGERMS  (2 - 1)
+#define F_GST_STDMAJOR  (3 - 1)
+#define F_GST_STDMINOR  (4 - 1)
+#define F_GST_ORIENT    (5 - 1)
+#define F_GST_STDLAT    (6 - 1)
+#define F_GST_STDLON    (7 - 1)
+#define F_GST_STDALT    (8 - 1)
+
+static bool sNmeaDecodeGst(NMEA_GST_t *gst, const char *payload, const int len, const char *talker)
+{
+    UNUSED(talker);
+    NMEA_DEBUG("sNmeaDecodeGst [%s] [%.*s]", talker, len, payload);
+
+    NMEA_FIELD_t fields[10];
+    const int nFields = sGetFields(fields, NUMOF(fields), payload, len);
+    if (nFields != 8)
+    {
+        return false;
+    }
+
+    bool res = true;
+
+    if (fields[F_GST_TIME].len > 0)
+    {
+        res = sStrToTime(&gst->time, &fields[F_GST_TIME]);
+    }
+
+    if (fields[F_GST_RANGERMS].len > 0)
+    {
+        gst->haveRangeRms = sStrToDbl(&gst->rangeRms, &fields[F_GST_RANGERMS], true, 0.0, false, 0.0);
+        res = res && gst->haveRangeRms;
+    }
+
+    if ( (fields[F_GST_STDMAJOR].len > 0) && (fields[F_GST_STDMINOR].len > 0) && (fields[F_GST_ORIENT].len > 0) )
+    {
+        gst->haveEllipse =
+            sStrToDbl(&gst->stdMajor, &fields[F_GST_STDMAJOR], true, 0.0, false, 0.0) &&
+            sStrToDbl(&gst->stdMinor, &fields[F_GST_STDMINOR], true, 0.0, false, 0.0) &&
+            sStrToDbl(&gst->orient,   &fields[F_GST_ORIENT],   true, 0.0, true, 360.0);
+        res = res && gst->haveEllipse;
+    }
+
+    if ( (fields[F_GST_STDLAT].len > 0) && (fields[F_GST_STDLON].len > 0) && (fields[F_GST_STDALT].len > 0) )
+    {
+        gst->haveStd =
+            sStrToDbl(&gst->stdLat, &fields[F_GST_STDLAT], true, 0.0, false, 0.0) &&
+            sStrToDbl(&gst->stdLon, &fields[F_GST_STDLON], true, 0.0, false, 0.0) &&
+            sStrToDbl(&gst->stdAlt, &fields[F_GST_STDALT], true, 0.0, false, 0.0);
+        res = res && gst->haveStd;
+    }
+
+    return res;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+#define F_VTG_COGT      (1 - 1)
+#define F_VTG_COGTUNIT  (2 - 1)
+#define F_VTG_COGM      (3 - 1)
+#define F_VTG_COGMUNIT  (4 - 1)
+#define F_VTG_SOGN      (5 - 1)
+#define F_VTG_SOGNUNIT  (6 - 1)
+#define F_VTG_SOGK      (7 - 1)
+#define F_VTG_SOGKUNIT  (8 - 1)
+#define F_VTG_POSMODE   (9 - 1)
+
+static bool sNmeaDecodeVtg(NMEA_VTG_t *vtg, const char *payload, const int len, const char *talker)
+{
+    UNUSED(talker);
+    NMEA_DEBUG("sNmeaDecodeVtg [%s] [%.*s]", talker, len, payload);
+
+    NMEA_FIELD_t fields[10];
+    const int nFields = sGetFields(fields, NUMOF(fields), payload, len);
+    if ( (nFields != 8) && (nFields != 9) )
+    {
+        return false;
+    }
+
+    bool res = true;
+
+    if (fields[F_VTG_COGT].len > 0)
+    {
+        vtg->haveCogt = sStrToDbl(&vtg->cogt, &fields[F_VTG_COGT], true, 0.0, true, 360.0);
+        res = res && vtg->haveCogt;
+    }
+
+    if (fields[F_VTG_COGM].len > 0)
+    {
+        vtg->haveCogm = sStrToDbl(&vtg->cogm, &fields[F_VTG_COGM], true, 0.0, true, 360.0);
+        res = res && vtg->haveCogm;
+    }
+
+    if ( (fields[F_VTG_SOGN].len > 0) && (fields[F_VTG_SOGK].len > 0) )
+    {
+        vtg->haveSog =
+            sStrToDbl(&vtg->sogn, &fields[F_VTG_SOGN], true, 0.0, false, 0.0) &&
+            sStrToDbl(&vtg->sogk, &fields[F_VTG_SOGK], true, 0.0, false, 0.0);
+        res = res && vtg->haveSog;
+    }
+
+    if ( (nFields > F_VTG_POSMODE) && (fields[F_VTG_POSMODE].len > 0) )
+    {
+        sStrToFix(&vtg->fix, &fields[F_VTG_POSMODE], NMEA_TYPE_VTG);
+    }
+
+    return res;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+#define F_ZDA_TIME      (1 - 1)
+#define F_ZDA_DAY       (2 - 1)
+#define F_ZDA_MONTH     (3 - 1)
+#define F_ZDA_YEAR      (4 - 1)
+#define F_ZDA_LTZH      (5 - 1)
+#define F_ZDA_LTZN      (6 - 1)
+
+static bool sNmeaDecodeZda(NMEA_ZDA_t *zda, const char *payload, const int len, const char *talker)
+{
+    UNUSED(talker);
+    NMEA_DEBUG("sNmeaDecodeZda [%s] [%.*s]", talker, len, payload);
+
+    NMEA_FIELD_t fields[10];
+    const int nFields = sGetFields(fields, NUMOF(fields), payload, len);
+    if (nFields != 6)
+    {
+        return false;
+    }
+
+    bool res = true;
+
+    if (fields[F_ZDA_TIME].len > 0)
+    {
+        res = sStrToTime(&zda->time, &fields[F_ZDA_TIME]);
+    }
+
+    if ( (fields[F_ZDA_DAY].len > 0) && (fields[F_ZDA_MONTH].len > 0) && (fields[F_ZDA_YEAR].len > 0) )
+    {
+        zda->date.valid =
+            sStrToInt(&zda->date.day,   &fields[F_ZDA_DAY],   true, 1, true, 31) &&
+            sStrToInt(&zda->date.month, &fields[F_ZDA_MONTH], true, 1, true, 12) &&
+            sStrToInt(&zda->date.year,  &fields[F_ZDA_YEAR],  true, 1980, true, 2099);
+        res = res && zda->date.valid;
+    }
+
+    if ( (fields[F_ZDA_LTZH].len > 0) && !sStrToInt(&zda->ltzh, &fields[F_ZDA_LTZH], true, -13, true, 13) )
+    {
+        res = false;
+    }
+    if ( (fields[F_ZDA_LTZN].len > 0) && !sStrToInt(&zda->ltzn, &fields[F_ZDA_LTZN], true, 0, true, 59) )
+    {
+        res = false;
+    }
+
+    return res;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+#define F_GNS_TIME      ( 1 - 1)
+#define F_GNS_LAT       ( 2 - 1)
+#define F_GNS_NS        ( 3 - 1)
+#define F_GNS_LON       ( 4 - 1)
+#define F_GNS_EW        ( 5 - 1)
+#define F_GNS_POSMODE   ( 6 - 1)
+#define F_GNS_NUMSV     ( 7 - 1)
+#define F_GNS_HDOP      ( 8 - 1)
+#define F_GNS_ALT       ( 9 - 1)
+#define F_GNS_SEP       (10 - 1)
+#define F_GNS_DIFFAGE   (11 - 1)
+#define F_GNS_DIFFSTA   (12 - 1)
+#define F_GNS_NAVSTATUS (13 - 1)
+
+static bool sNmeaDecodeGns(NMEA_GNS_t *gns, const char *payload, const int len, const char *talker)
+{
+    NMEA_DEBUG("sNmeaDecodeGns [%s] [%.*s]", talker, len, payload);
+    UNUSED(talker);
+
+    NMEA_FIELD_t fields[15];
+    const int nFields = sGetFields(fields, NUMOF(fields), payload, len);
+    if ( (nFields != 12) && (nFields != 13) )
+    {
+        return false;
+    }
+
+    bool res = true;
+
+    if (fields[F_GNS_TIME].len > 0)
+    {
+        res = sStrToTime(&gns->time, &fields[F_GNS_TIME]);
+    }
+
+    // One mode indicator per constellation (GPS, GLONASS, Galileo, BeiDou, ...), use the best one
+    const NMEA_FIELD_t *posMode = &fields[F_GNS_POSMODE];
+    const int nModes = MIN(posMode->len, (int)sizeof(gns->posMode) - 1);
+    memcpy(gns->posMode, posMode->str, nModes);
+    gns->posMode[nModes] = '\0';
+    gns->fix = NMEA_FIX_UNKNOWN;
+    for (int ix = 0; ix < nModes; ix++)
+    {
+        const NMEA_FIELD_t mode = { .str = &posMode->str[ix], .len = 1 };
+        NMEA_FIX_t fix = NMEA_FIX_UNKNOWN;
+        sStrToFix(&fix, &mode, NMEA_TYPE_GNS);
+        if (fix > gns->fix)
+        {
+            gns->fix = fix;
+        }
+    }
+
+    if ( (fields[F_GNS_LAT].len > 0) && (fields[F_GNS_LON].len > 0) )
+    {
+        if (!sStrToDegMin(&gns->lat, &fields[F_GNS_LAT], 2) ||
+            !sStrToDegMin(&gns->lon, &fields[F_GNS_LON], 3))
+        {
+            res = false;
+        }
+        if (sFieldChr(&fields[F_GNS_NS]) == 'S')
+        {
+            gns->lat *= -1.0;
+        }
+        if (sFieldChr(&fields[F_GNS_EW]) == 'W')
+        {
+            gns->lon *= -1.0;
+        }
+    }
+
+    if ( (fields[F_GNS_NUMSV].len > 0) && !sStrToInt(&gns->numSv, &fields[F_GNS_NUMSV], true, 0, false, 0) )
+    {
+        res = false;
+    }
+
+    if ( (fields[F_GNS_HDOP].len > 0) && !sStrToDbl(&gns->hDOP, &fields[F_GNS_HDOP], true, 0.0, false, 0.0) )
+    {
+        res = false;
+    }
+
+    if ( (fields[F_GNS_ALT].len > 0) && !sStrToDbl(&gns->heightMsl, &fields[F_GNS_ALT], false, 0.0, false, 0.0) )
+    {
+        res = false;
+    }
+    double sep = 0.0;
+    if ( (fields[F_GNS_SEP].len > 0) && !sStrToDbl(&sep, &fields[F_GNS_SEP], false, 0.0, false, 0.0) )
+    {
+        res = false;
+    }
+    gns->height = gns->heightMsl + sep;
+
+    gns->diffAge = -1.0;
+    if ( (fields[F_GNS_DIFFAGE].len > 0) && !sStrToDbl(&gns->diffAge, &fields[F_GNS_DIFFAGE], true, 0, false, 0) )
+    {
+        res = false;
+    }
+    gns->diffStation = -1;
+    if ( (fields[F_GNS_DIFFSTA].len > 0) && !sStrToInt(&gns->diffStation, &fields[F_GNS_DIFFSTA], true, 0, false, 0) )
+    {
+        res = false;
+    }
+
+    gns->valid = (nFields <= F_GNS_NAVSTATUS) || (sFieldChr(&fields[F_GNS_NAVSTATUS]) == 'S') ||
+        (sFieldChr(&fields[F_GNS_NAVSTATUS]) == 'C');
+
+    return res;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 bool nmeaMessageClsId(const char *name, uint8_t *clsId, uint8_t *msgId)
 {
     if ( (name == NULL) || (name[0] == '\0') )
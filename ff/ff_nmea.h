@@ -94,8 +94,8 @@ typedef struct NMEA_GGA_s
     NMEA_FIX_t  fix;
     int         numSv;
     double      hDOP;
-    double      height;
-    double      heightMsl;
+    double      height;      // Ellipsoidal height [m] (altitude + geoid separation)
+    double      heightMsl;   // Height above mean sea level [m] (altitude)
     double      diffAge;     // < 0 = no DGPS
     int         diffStation; // < 0 = no DGPS
 } NMEA_GGA_t;
@@ -139,6 +139,74 @@ typedef struct NMEA_GSV_s
     int nSvs;
 } NMEA_GSV_t;
 
+typedef struct NMEA_GSA_s
+{
+    char        opMode;      // 'M' = manual, 'A' = automatic
+    NMEA_FIX_t  fix;         // NMEA_FIX_NOFIX, NMEA_FIX_S2D or NMEA_FIX_S3D
+    int         systemId;    // 0 = not available (NMEA < 4.10)
+    struct
+    {
+        int         svId;
+        NMEA_GNSS_t gnss;
+    } svs[12];               // Satellites used
+    int         nSvs;
+    bool        haveDop;
+    double      pDOP;
+    double      hDOP;
+    double      vDOP;
+} NMEA_GSA_t;
+
+typedef struct NMEA_GST_s
+{
+    NMEA_TIME_t time;
+    bool        haveRangeRms;
+    double      rangeRms;    // [m]
+    bool        haveEllipse;
+    double      stdMajor;    // [m]
+    double      stdMinor;    // [m]
+    double      orient;      // [deg]
+    bool        haveStd;
+    double      stdLat;      // [m]
+    double      stdLon;      // [m]
+    double      stdAlt;      // [m]
+} NMEA_GST_t;
+
+typedef struct NMEA_VTG_s
+{
+    NMEA_FIX_t  fix;
+    bool        haveCogt;
+    double      cogt;        // [deg]
+    bool        haveCogm;
+    double      cogm;        // [deg]
+    bool        haveSog;
+    double      sogn;        // [kn]
+    double      sogk;        // [km/h]
+} NMEA_VTG_t;
+
+typedef struct NMEA_ZDA_s
+{
+    NMEA_TIME_t time;
+    NMEA_DATE_t date;
+    int         ltzh;        // Local time zone hours
+    int         ltzn;        // Local time zone minutes
+} NMEA_ZDA_t;
+
+typedef struct NMEA_GNS_s
+{
+    NMEA_TIME_t time;
+    double      lat;
+    double      lon;
+    NMEA_FIX_t  fix;         // Best of all constellations
+    char        posMode[8];  // Mode indicator for each constellation (GPS, GLONASS, Galileo, BeiDou, ...)
+    int         numSv;
+    double      hDOP;
+    double      height;      // Ellipsoidal height [m] (altitude + geoid separation)
+    double      heightMsl;   // Height above mean sea level [m] (altitude)
+    double      diffAge;     // < 0 = no DGPS
+    int         diffStation; // < 0 = no DGPS
+    bool        valid;       // Navigational status (NMEA >= 4.10) is 'S' (safe) or 'C' (caution), or not available
+} NMEA_GNS_t;
+
 typedef struct NMEA_TXT_s
 {
     int         numMsg;
@@ -155,13 +223,18 @@ typedef enum NMEA_TYPE_e
     NMEA_TYPE_RMC,
     NMEA_TYPE_GLL,
     NMEA_TYPE_GSV,
+    NMEA_TYPE_GSA,
+    NMEA_TYPE_GST,
+    NMEA_TYPE_VTG,
+    NMEA_TYPE_ZDA,
+    NMEA_TYPE_GNS,
 } NMEA_TYPE_t;
 
 typedef struct NMEA_MSG_s
 {
     char talker[3];      //!< Talker ID ("GP", "GN", "P", ...)
     char formatter[8];   //!< Formatter ("GGA", "RMC", "UBX", ...)
-    char info[200];
+    char info[200];      //!< Stringified message data, see nmeaFormatInfo()
     int  payloadIx0;
     int  payloadIx1;
     NMEA_TYPE_t type;
@@ -172,6 +245,11 @@ typedef struct NMEA_MSG_s
         NMEA_RMC_t rmc;
         NMEA_GLL_t gll;
         NMEA_GSV_t gsv;
+        NMEA_GSA_t gsa;
+        NMEA_GST_t gst;
+        NMEA_VTG_t vtg;
+        NMEA_ZDA_t zda;
+        NMEA_GNS_t gns;
     };
 
 } NMEA_MSG_t;
@@ -182,8 +260,27 @@ bool nmeaMessageName(char *name, const int size, const uint8_t *msg, const int m
 
 bool nmeaMessageInfo(char *info, const int size, const uint8_t *msg, const int msgSize);
 
+//! Decode NMEA message
+/*!
+    \param[out]  nmea     Decoded message
+    \param[in]   msg      The message (sentence)
+    \param[in]   msgSize  Size of the message
+
+    \note This does not render NMEA_MSG_t.info, see nmeaFormatInfo().
+
+    \note For GGA and GNS the altitude field is the height above mean sea level (heightMsl), and the
+           height is the ellipsoidal height (altitude plus geoid separation).
+
+    \returns true if the message was successfully decoded, false otherwise
+*/
 bool nmeaDecode(NMEA_MSG_t *nmea, const uint8_t *msg, const int msgSize);
 
+//! Render NMEA_MSG_t.info
+/*!
+    \param[in,out]  nmea  Message decoded by nmeaDecode()
+*/
+void nmeaFormatInfo(NMEA_MSG_t *nmea);
+
 //! Get NMEA message IDs ("fake" UBX class and message IDs)
 /*!
     \param[in]   name   Message name (e.g. "NMEA-STANDARD-GGA", "NMEA-PUBX-POSITION")
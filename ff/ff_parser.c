@@ -25,6 +25,7 @@
 #include "ff_nmea.h"
 #include "ff_novatel.h"
 #include "ff_crc.h"
+#include "ff_trace.h"
 
 #include "ff_parser.h"
 
@@ -53,6 +54,11 @@ void parserInit(PARSER_t *parser)
 // ---------------------------------------------------------------------------------------------------------------------
 
 bool parserAdd(PARSER_t *parser, const uint8_t *data, const int size)
+{
+    return parserAddTs(parser, data, size, TIME_NS());
+}
+
+bool parserAddTs(PARSER_t *parser, const uint8_t *data, const int size, const uint64_t tsNs)
 {
     // Overflow, discard all
     if ((parser->offs + parser->size + size) > (int)sizeof(parser->buf))
@@ -62,6 +68,19 @@ bool parserAdd(PARSER_t *parser, const uint8_t *data, const int size)
     // Add to buffer
     memcpy(&parser->buf[parser->offs + parser->size], data, size);
     parser->size += size;
+
+    // Remember arrival time of the chunk, merge with previous chunk if we're out of space
+    if (parser->nChunks < PARSER_MAX_CHUNKS)
+    {
+        parser->chunkTs[parser->nChunks]   = tsNs;
+        parser->chunkSize[parser->nChunks] = size;
+        parser->nChunks++;
+    }
+    else
+    {
+        parser->chunkTs[PARSER_MAX_CHUNKS - 1]    = tsNs;
+        parser->chunkSize[PARSER_MAX_CHUNKS - 1] += size;
+    }
     PARSER_XTRA_TRACE("add: size=%d ", size);
     return true;
 }
@@ -90,6 +109,7 @@ static int _isRtcm3Message(const uint8_t *buf, const int size);
 static int _isSpartnMessage(const uint8_t *buf, const int size);
 static int _isNovatelMessage(const uint8_t *buf, const int size);
 static void _emitGarbage(PARSER_t *parser, PARSER_MSG_t *msg);
+static uint64_t _consumeChunks(PARSER_t *parser, const int size);
 static void _emitMessage(PARSER_t *parser, PARSER_MSG_t *msg, const int msgSize, const PARSER_MSGTYPE_t msgType, const bool info);
 
 typedef struct PARSER_FUNC_s
@@ -203,6 +223,35 @@ bool parserFlush(PARSER_t *parser, PARSER_MSG_t *msg)
 
 /* ****************************************************************************************************************** */
 
+// Remove size bytes from the front of the chunks, returns the arrival time of the last of these bytes
+static uint64_t _consumeChunks(PARSER_t *parser, const int size)
+{
+    uint64_t ts = 0;
+    int rem = size;
+    int n = 0;
+    while ( (rem > 0) && (n < parser->nChunks) )
+    {
+        ts = parser->chunkTs[n];
+        if (rem >= parser->chunkSize[n])
+        {
+            rem -= parser->chunkSize[n];
+            n++;
+        }
+        else
+        {
+            parser->chunkSize[n] -= rem;
+            rem = 0;
+        }
+    }
+    if (n > 0)
+    {
+        parser->nChunks -= n;
+        memmove(&parser->chunkTs[0], &parser->chunkTs[n], parser->nChunks * sizeof(parser->chunkTs[0]));
+        memmove(&parser->chunkSize[0], &parser->chunkSize[n], parser->nChunks * sizeof(parser->chunkSize[0]));
+    }
+    return ts;
+}
+
 static void _emitGarbage(PARSER_t *parser, PARSER_MSG_t *msg)
 {
     uint32_t now = TIME();
@@ -228,10 +277,13 @@ static void _emitGarbage(PARSER_t *parser, PARSER_MSG_t *msg)
     msg->data = parser->tmp;
     msg->seq  = parser->nMsgs;
     msg->ts   = now;
+    msg->tsNs = _consumeChunks(parser, size);
     msg->src  = PARSER_MSGSRC_UNKN;
     msg->name = "GARBAGE";
     msg->info = NULL;
 
+    TRACE_EVENT(TRACE_EV_PARSER_GARBAGE, size, 0, 0);
+
     PARSER_XTRA_TRACE("process: emit %s, size %d ", msg->name, size);
 }
 
@@ -262,6 +314,7 @@ static void _emitMessage(PARSER_t *parser, PARSER_MSG_t *msg, const int msgSize,
     msg->data = parser->tmp;
     msg->seq  = parser->nMsgs;
     msg->ts   = now;
+    msg->tsNs = _consumeChunks(parser, msgSize);
     msg->src  = PARSER_MSGSRC_UNKN;
     parser->name[0] = '\0';
     parser->info[0] = '\0';
@@ -327,6 +380,9 @@ static void _emitMessage(PARSER_t *parser, PARSER_MSG_t *msg, const int msgSize,
             msg->info = NULL;
             break;
     }
+    TRACE_EVENT(TRACE_EV_PARSER_MSG, msgType, msgSize,
+        msgType == PARSER_MSGTYPE_UBX   ? ((uint32_t)UBX_CLSID(parser->tmp) << 8) | UBX_MSGID(parser->tmp) :
+        msgType == PARSER_MSGTYPE_RTCM3 ? (uint32_t)RTCM3_TYPE(parser->tmp) : 0);
     PARSER_XTRA_TRACE("process: emit %s, size %d, type %d ", msg->name, msgSize, msgType);
 }
 
@@ -41,6 +41,7 @@ extern "C" {
 #define PARSER_MAX_ANY_SIZE    16384 // the largest of the above
 #define PARSER_MAX_NAME_SIZE     100
 #define PARSER_MAX_INFO_SIZE    1000
+#define PARSER_MAX_CHUNKS         32 // number of chunks of data (parserAdd() calls) tracked for the arrival time
 
 typedef struct PARSER_s
 {
@@ -51,6 +52,9 @@ typedef struct PARSER_s
     uint8_t   tmp[PARSER_MAX_ANY_SIZE];
     char      name[PARSER_MAX_NAME_SIZE];
     char      info[PARSER_MAX_INFO_SIZE];
+    uint64_t  chunkTs[PARSER_MAX_CHUNKS];
+    int       chunkSize[PARSER_MAX_CHUNKS];
+    int       nChunks;
     // Statistics (number and size of all messages reps. of protocol)
     uint32_t  nMsgs;
     uint32_t  sMsgs;
@@ -96,6 +100,7 @@ typedef struct PARSER_MSG_s
     int              size;
     uint32_t         seq;
     uint32_t         ts;
+    uint64_t         tsNs; // monotonic time [ns] (TIME_NS()) at which the last byte of the message arrived
     PARSER_MSGSRC_t  src;
     const char      *name;
     const char      *info; // may be NULL
@@ -103,6 +108,7 @@ typedef struct PARSER_MSG_s
 
 void parserInit(PARSER_t *parser);
 bool parserAdd(PARSER_t *parser, const uint8_t *data, const int size);
+bool parserAddTs(PARSER_t *parser, const uint8_t *data, const int size, const uint64_t tsNs); // tsNs = arrival time of data
 bool parserProcess(PARSER_t *parser, PARSER_MSG_t *msg, const bool info);
 bool parserFlush(PARSER_t *parser, PARSER_MSG_t *msg);
 
@@ -21,6 +21,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <inttypes.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <fcntl.h>
@@ -40,9 +41,14 @@
 #  include <netinet/in.h>
 #  include <netinet/tcp.h>
 #endif
+#ifdef __linux__
+#  include <sys/ioctl.h>
+#  include <linux/serial.h>
+#endif
 
 #include "ff_debug.h"
 #include "ff_stuff.h"
+#include "ff_trace.h"
 #include "ff_port.h"
 
 /* ****************************************************************************************************************** */
@@ -57,7 +63,7 @@
 
 #define PORT_WARNING(fmt, ...) WARNING("port(%s) " fmt, portSpecStr(port), ##__VA_ARGS__)
 #define PORT_DEBUG(fmt, ...)   DEBUG(  "port(%s) " fmt, portSpecStr(port), ##__VA_ARGS__)
-#define PORT_TRACE(fmt, ...)   TRACE(  "port(%s) " fmt, portSpecStr(port), ##__VA_ARGS__)
+#define PORT_TRACE(fmt, ...)   do { if (isTRACE()) { TRACE("port(%s) " fmt, portSpecStr(port), ##__VA_ARGS__); } } while (0)
 
 #define PORT_WARNING_THROTTLE(fmt, ...) do { \
     const uint32_t now = TIME(); if ((now - port->lastWarn) > 1000) { \
@@ -110,6 +116,8 @@ const char *_portErrStr(PORT_t *port, int err)
 // ---------------------------------------------------------------------------------------------------------------------
 
 static uint32_t _portBaudrateValue(const int baudrate);
+static bool _portBaudrateOk(const PORT_TYPE_t type, const int baudrate);
+static bool _portOptions(PORT_t *port, const char *spec, char *opts);
 
 bool portInit(PORT_t *port, const char *spec)
 {
@@ -158,6 +166,14 @@ bool portInit(PORT_t *port, const char *spec)
         }
     }
 
+    // Split off options
+    char *opts = strchr(addr, ',');
+    if (opts != NULL)
+    {
+        *opts = '\0';
+        opts++;
+    }
+
     // Parameters
     if (res)
     {
@@ -165,8 +181,9 @@ bool portInit(PORT_t *port, const char *spec)
         {
             case PORT_TYPE_SER:
             {
-                addr = strtok(addr, "@");
-                char *arg = strtok(NULL, "@");
+                char *save = NULL;
+                addr = strtok_r(addr, "@", &save);
+                char *arg = strtok_r(NULL, "@", &save);
 #ifdef _WIN32
                 const bool isAcm = false; // FIXME: How to detect?
 #else
@@ -175,7 +192,7 @@ bool portInit(PORT_t *port, const char *spec)
                 free(real);
 #endif
                 const int baudrate = arg != NULL ? atoi(arg) : (isAcm ? 921600 : 9600);
-                if (_portBaudrateValue(baudrate) == 0)
+                if (!_portBaudrateOk(port->type, baudrate))
                 {
                     WARNING("%s: Bad baudrate %s!", spec, arg);
                     res = false;
@@ -184,13 +201,15 @@ bool portInit(PORT_t *port, const char *spec)
                 {
                     strcat(port->file, addr);
                     port->baudrate = baudrate;
+                    port->specBaudrate = arg != NULL ? baudrate : 0;
                 }
                 break;
             }
             case PORT_TYPE_TCP:
             {
-                addr = strtok(addr, ":");
-                char *arg = strtok(NULL, ":");
+                char *save = NULL;
+                addr = strtok_r(addr, ":", &save);
+                char *arg = strtok_r(NULL, ":", &save);
                 const int portnr = arg == NULL ? -1 : atoi(arg);
                 if ( (portnr < 1) || (portnr > UINT16_MAX))
                 {
@@ -207,8 +226,9 @@ bool portInit(PORT_t *port, const char *spec)
             }
             case PORT_TYPE_TELNET:
             {
-                addr = strtok(addr, ":");
-                char *arg = strtok(NULL, ":@");
+                char *save = NULL;
+                addr = strtok_r(addr, ":", &save);
+                char *arg = strtok_r(NULL, ":@", &save);
                 const int portnr = arg == NULL ? -1 : atoi(arg);
                 if ( (portnr < 1) || (portnr > UINT16_MAX))
                 {
@@ -220,9 +240,9 @@ bool portInit(PORT_t *port, const char *spec)
                     port->port = (uint16_t)portnr;
                     strcat(port->file, addr);
                 }
-                arg = strtok(NULL, "@");
+                arg = strtok_r(NULL, "@", &save);
                 const int baudrate = arg != NULL ? atoi(arg) : 9600;
-                if (_portBaudrateValue(baudrate) == 0)
+                if (!_portBaudrateOk(port->type, baudrate))
                 {
                     WARNING("%s: Bad baudrate %s!", spec, arg);
                     res = false;
@@ -230,12 +250,19 @@ bool portInit(PORT_t *port, const char *spec)
                 else
                 {
                     port->baudrate = baudrate;
+                    port->specBaudrate = arg != NULL ? baudrate : 0;
                 }
                 break;
             }
         }
     }
 
+    // Options
+    if ( res && (opts != NULL) && !_portOptions(port, spec, opts) )
+    {
+        res = false;
+    }
+
     if (res)
     {
         PORT_DEBUG("port init (%s)", spec);
@@ -244,25 +271,101 @@ bool portInit(PORT_t *port, const char *spec)
     return res;
 }
 
+// Options for serial ports: lowlat, vmin=<n>, vtime=<n>. For TCP/IP and telnet ports: reconnect
+static bool _portOptions(PORT_t *port, const char *spec, char *opts)
+{
+    const bool isSer = (port->type == PORT_TYPE_SER);
+    char *save = NULL;
+    for (char *opt = strtok_r(opts, ",", &save); opt != NULL; opt = strtok_r(NULL, ",", &save))
+    {
+        int value = 0;
+        if ( isSer && (strcmp(opt, "lowlat") == 0) )
+        {
+            port->lowLatency = true;
+        }
+        else if ( isSer && (sscanf(opt, "vmin=%d", &value) == 1) && (value >= 0) && (value <= 255) )
+        {
+            port->vMin = value;
+        }
+        else if ( isSer && (sscanf(opt, "vtime=%d", &value) == 1) && (value >= 0) && (value <= 255) )
+        {
+            port->vTime = value;
+        }
+        else if ( !isSer && (strcmp(opt, "reconnect") == 0) )
+        {
+            port->reconnect = true;
+        }
+        else
+        {
+            WARNING("%s: Bad option %s!", spec, opt);
+            return false;
+        }
+    }
+    // Without an inter-byte timeout a read would block until vmin bytes have arrived
+    if ( (port->vMin > 0) && (port->vTime == 0) )
+    {
+        WARNING("%s: Option vmin requires vtime!", spec);
+        return false;
+    }
+    return true;
+}
+
 static bool _portOpenSer(PORT_t *port);
 static bool _portOpenTcp(PORT_t *port);
 static bool _portOpenTelnet(PORT_t *port);
 
+// The write queue is only needed for TCP/IP and telnet ports
+static bool _portAllocTxQueue(PORT_t *port)
+{
+    if (port->txQueue == NULL)
+    {
+        port->txQueue = malloc(PORT_TX_QUEUE_SIZE);
+        if (port->txQueue == NULL)
+        {
+            PORT_WARNING("malloc fail");
+            return false;
+        }
+    }
+    return true;
+}
+
+static void _portFreeTxQueue(PORT_t *port)
+{
+    free(port->txQueue);
+    port->txQueue = NULL;
+}
+
 bool portOpen(PORT_t *port)
 {
     bool res = false;
     if (port != NULL)
     {
+        port->numRx        = 0;
+        port->numTx        = 0;
+        port->numReadCalls = 0;
+        port->numReads     = 0;
+        port->numWrites    = 0;
+        port->readSizeMax  = 0;
+        port->readNs       = 0;
+        port->readNsMax    = 0;
+        port->writeNs      = 0;
+        port->writeNsMax   = 0;
+        port->txHead       = 0;
+        port->txSize       = 0;
+        port->txDropped    = 0;
+        port->numReconnects = 0;
+        port->numAttempts  = 0;
+        port->openTs       = TIME_NS();
         switch (port->type)
         {
             case PORT_TYPE_SER:
                 res = _portOpenSer(port);
                 break;
             case PORT_TYPE_TCP:
-                res = _portOpenTcp(port);
+                res = _portAllocTxQueue(port) && _portOpenTcp(port);
                 break;
             case PORT_TYPE_TELNET:
-                res = _portOpenTelnet(port);
+                res = _portAllocTxQueue(port) && _portOpenTelnet(port);
                 break;
         }
     }
@@ -273,6 +376,10 @@ bool portOpen(PORT_t *port)
         port->portOk = true;
         PORT_DEBUG("connected");
     }
+    else if (port != NULL)
+    {
+        _portFreeTxQueue(port);
+    }
     return res;
 }
 
@@ -298,7 +405,12 @@ void portClose(PORT_t *port)
                 _portCloseTelnet(port);
                 break;
         }
-        PORT_DEBUG("closed (rx=%u, tx=%u)", port->numRx, port->numTx);
+        PORT_STATS_t stats;
+        char str[200];
+        if (portGetStats(port, &stats) && (portStatsStr(&stats, str, sizeof(str)) > 0))
+        {
+            PORT_DEBUG("closed (%s)", str);
+        }
         port->portOk = false;
     }
 }
@@ -314,6 +426,7 @@ bool portWrite(PORT_t *port, const uint8_t *data, const int size)
     bool res = false;
     if ( (port != NULL) && port->portOk && (size > 0) )
     {
+        const uint64_t t0 = TIME_NS();
         switch (port->type)
         {
             case PORT_TYPE_SER:
@@ -326,11 +439,15 @@ bool portWrite(PORT_t *port, const uint8_t *data, const int size)
                 res = _portWriteTelnet(port, data, size);
                 break;
         }
+        const uint64_t dt = TIME_NS() - t0;
+        port->writeNs += dt;
+        port->writeNsMax = MAX(port->writeNsMax, dt);
     }
     PORT_TRACE("write %d %s", size, res ? "ok" : "fail");
     if (res)
     {
         port->numTx += size;
+        port->numWrites++;
     }
     return res;
 }
@@ -347,6 +464,7 @@ bool portRead(PORT_t *port, uint8_t *data, const int size, int *nRead)
     *nRead = 0;
     if ( (port != NULL) && (nRead != NULL) && port->portOk && (size > 0) )
     {
+        const uint64_t t0 = TIME_NS();
         switch (port->type)
         {
             case PORT_TYPE_SER:
@@ -359,9 +477,20 @@ bool portRead(PORT_t *port, uint8_t *data, const int size, int *nRead)
                 res = _portReadTelnet(port, data, size, nRead);
                 break;
         }
+        const uint64_t t1 = TIME_NS();
+        port->numReadCalls++;
+        port->readNs += t1 - t0;
+        port->readNsMax = MAX(port->readNsMax, t1 - t0);
+        if (*nRead > 0)
+        {
+            port->rxTs = t1;
+            port->numReads++;
+            port->readSizeMax = MAX(port->readSizeMax, *nRead);
+        }
     }
     if ((*nRead > 0) || !res)
     {
+        TRACE_EVENT(TRACE_EV_PORT_READ, size, *nRead, res ? 1 : 0);
         PORT_TRACE("read %d -> %d %s", size, *nRead, res ? "ok" : "fail");
     }
     if (res)
@@ -407,7 +536,7 @@ static bool _portSetBaudrateTelnet(PORT_t *port, const int baudrate);
 bool portSetBaudrate(PORT_t *port, const int baudrate)
 {
     bool res = false;
-    if ( (port != NULL) && port->portOk && (_portBaudrateValue(baudrate) != 0) )
+    if ( (port != NULL) && port->portOk && _portBaudrateOk(port->type, baudrate) )
     {
         switch (port->type)
         {
@@ -453,8 +582,207 @@ int portGetBaudrate(PORT_t *port)
     return res;
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool portGetStats(PORT_t *port, PORT_STATS_t *stats)
+{
+    if ( (port == NULL) || (stats == NULL) )
+    {
+        return false;
+    }
+    memset(stats, 0, sizeof(*stats));
+    stats->duration     = port->openTs != 0 ? (double)(TIME_NS() - port->openTs) * 1e-9 : 0.0;
+    stats->rxBytes      = port->numRx;
+    stats->txBytes      = port->numTx;
+    stats->numReads     = port->numReads;
+    stats->numWrites    = port->numWrites;
+    stats->readSizeMax  = port->readSizeMax;
+    stats->readTimeMax  = (double)port->readNsMax * 1e-6;
+    stats->writeTimeMax = (double)port->writeNsMax * 1e-6;
+    stats->txQueued     = port->txSize;
+    stats->txDropped    = port->txDropped;
+    stats->numReconnects = port->numReconnects;
+    if (stats->duration > 0.0)
+    {
+        stats->rxRate = (double)port->numRx / stats->duration;
+        stats->txRate = (double)port->numTx / stats->duration;
+        const int baudrate = portGetBaudrate(port);
+        if (baudrate > 0)
+        {
+            stats->rxLoad = stats->rxRate * 10.0 * 1e2 / (double)baudrate;
+        }
+    }
+    if (port->numReads > 0)
+    {
+        stats->readSize = (double)port->numRx / (double)port->numReads;
+    }
+    if (port->numReadCalls > 0)
+    {
+        stats->readTime = (double)port->readNs * 1e-6 / (double)port->numReadCalls;
+    }
+    if (port->numWrites > 0)
+    {
+        stats->writeTime = (double)port->writeNs * 1e-6 / (double)port->numWrites;
+    }
+    return true;
+}
+
+int portStatsStr(const PORT_STATS_t *stats, char *str, const int size)
+{
+    if ( (stats == NULL) || (str == NULL) || (size < 1) )
+    {
+        return 0;
+    }
+    const int len = snprintf(str, size,
+        "rx=%"PRIu64" (%.0fB/s, %.1f%%, %u reads, size %.0f/%d, %.3f/%.3fms) tx=%"PRIu64" (%.0fB/s, %u writes, %.3f/%.3fms,"
+        " queued %d, dropped %"PRIu64") %u reconnects %.1fs",
+        stats->rxBytes, stats->rxRate, stats->rxLoad, stats->numReads, stats->readSize, stats->readSizeMax,
+        stats->readTime, stats->readTimeMax,
+        stats->txBytes, stats->txRate, stats->numWrites, stats->writeTime, stats->writeTimeMax,
+        stats->txQueued, stats->txDropped, stats->numReconnects, stats->duration);
+    return len < size ? len : size - 1;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+PORT_STATE_t portGetState(PORT_t *port)
+{
+    if (port == NULL)
+    {
+        return PORT_STATE_CLOSED;
+    }
+    switch (port->type)
+    {
+        case PORT_TYPE_TCP:
+        case PORT_TYPE_TELNET:
+            return port->portOk ? port->state : PORT_STATE_CLOSED;
+        case PORT_TYPE_SER:
+            break;
+    }
+    return port->portOk ? PORT_STATE_CONNECTED : PORT_STATE_CLOSED;
+}
+
+const char *portStateStr(const PORT_STATE_t state)
+{
+    switch (state)
+    {
+        case PORT_STATE_CLOSED:      return "closed";
+        case PORT_STATE_CONNECTING:  return "connecting";
+        case PORT_STATE_NEGOTIATING: return "negotiating";
+        case PORT_STATE_CONNECTED:   return "connected";
+        case PORT_STATE_RECONNECT:   return "reconnect";
+    }
+    return "?";
+}
+
+int portTxQueued(PORT_t *port)
+{
+    return port != NULL ? port->txSize : 0;
+}
+
 /* ***** serial ports *************************************************************************** */
 
+#if defined(__linux__) && defined(TCGETS2) && \
+    (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__) || defined(__arm__) || defined(__riscv))
+#  define PORT_HAVE_TERMIOS2 1
+// From <asm/termbits.h>, which cannot be included together with <termios.h>
+struct termios2
+{
+    tcflag_t c_iflag;
+    tcflag_t c_oflag;
+    tcflag_t c_cflag;
+    tcflag_t c_lflag;
+    cc_t     c_line;
+    cc_t     c_cc[19];
+    speed_t  c_ispeed;
+    speed_t  c_ospeed;
+};
+#  define PORT_BOTHER  0x00001000
+#  define PORT_IBSHIFT 16
+#else
+#  define PORT_HAVE_TERMIOS2 0
+#endif
+
+#if PORT_HAVE_TERMIOS2
+// Non-standard baudrates, e.g. 1500000 or 3000000
+static bool _portSetCustomBaudrate(PORT_t *port, const int fd, const int baudrate)
+{
+    struct termios2 settings;
+    if (ioctl(fd, TCGETS2, &settings) != 0)
+    {
+        PORT_WARNING("TCGETS2 fail: %s", _portErrStr(port, 0));
+        return false;
+    }
+    settings.c_cflag &= ~(CBAUD | (CBAUD << PORT_IBSHIFT));
+    settings.c_cflag |= PORT_BOTHER | (PORT_BOTHER << PORT_IBSHIFT);
+    settings.c_ispeed = baudrate;
+    settings.c_ospeed = baudrate;
+    if (ioctl(fd, TCSETS2, &settings) != 0)
+    {
+        PORT_WARNING("TCSETS2 fail: %s", _portErrStr(port, 0));
+        return false;
+    }
+    // The driver may use the nearest possible baudrate
+    if ( (ioctl(fd, TCGETS2, &settings) == 0) && (settings.c_ospeed != (speed_t)baudrate) )
+    {
+        PORT_DEBUG("baudrate %d is %u", baudrate, settings.c_ospeed);
+    }
+    return true;
+}
+#endif
+
+#ifndef _WIN32
+static void _portLowLatencySer(PORT_t *port, const int fd)
+{
+#  ifdef __linux__
+    // Low-latency mode of the tty driver (not all drivers have it, e.g. USB CDC ACM doesn't)
+    struct serial_struct serial;
+    if (ioctl(fd, TIOCGSERIAL, &serial) == 0)
+    {
+        serial.flags |= ASYNC_LOW_LATENCY;
+        if (ioctl(fd, TIOCSSERIAL, &serial) != 0)
+        {
+            PORT_DEBUG("Failed setting low-latency mode: %s", _portErrStr(port, 0));
+        }
+    }
+    else
+    {
+        PORT_DEBUG("No low-latency mode: %s", _portErrStr(port, 0));
+    }
+
+    // USB serial adapters (FTDI and others) hold back data for up to 16ms by default
+    char *real = realpath(port->file, NULL); // port->file might be a symlink..
+    const char *name = real != NULL ? strrchr(real, '/') : NULL;
+    if (name != NULL)
+    {
+        char path[PORT_SPEC_MAX_LEN + 100];
+        snprintf(path, sizeof(path), "/sys/class/tty/%s/device/latency_timer", &name[1]);
+        FILE *f = fopen(path, "w");
+        if (f != NULL)
+        {
+            const bool ok = (fputs("1", f) >= 0);
+            if ( (fclose(f) != 0) || !ok )
+            {
+                PORT_WARNING("Failed setting latency timer: %s", _portErrStr(port, 0));
+            }
+            else
+            {
+                PORT_DEBUG("latency timer 1ms");
+            }
+        }
+        else if (errno != ENOENT)
+        {
+            PORT_WARNING("Failed setting latency timer (%s): %s", path, _portErrStr(port, 0));
+        }
+    }
+    free(real);
+#  else
+    (void)fd;
+    PORT_DEBUG("No low-latency mode on this platform");
+#  endif
+}
+#endif
+
 static bool _portOpenSer(PORT_t *port)
 {
 #ifdef _WIN32
@@ -470,8 +798,7 @@ static bool _portOpenSer(PORT_t *port)
     }
 
     char settingsStr[256];
-    snprintf(settingsStr, sizeof(settingsStr), "baud=%u data=8 parity=n stop=1",
-        _portBaudrateValue(port->baudrate));
+    snprintf(settingsStr, sizeof(settingsStr), "baud=%d data=8 parity=n stop=1", port->baudrate);
     DCB settings;
     memset(&settings, 0, sizeof(settings));
     settings.DCBlength = sizeof(settings);
@@ -488,9 +815,15 @@ static bool _portOpenSer(PORT_t *port)
         return false;
     }
 
+    // Return immediately, or (vtime) as soon as there is data but wait at most this long
     COMMTIMEOUTS timeouts;
     memset(&timeouts, 0, sizeof(timeouts));
     timeouts.ReadIntervalTimeout = MAXDWORD;
+    if (port->vTime > 0)
+    {
+        timeouts.ReadTotalTimeoutMultiplier = MAXDWORD;
+        timeouts.ReadTotalTimeoutConstant = port->vTime * 100;
+    }
     if (SetCommTimeouts(handle, &timeouts) == 0)
     {
         PORT_WARNING("Failed applying timeouts: %s", _portErrStr(port, 0));
@@ -516,14 +849,23 @@ static bool _portOpenSer(PORT_t *port)
         return false;
     }
 
+    // Non-standard baudrates are set below
+    const uint32_t baudValue = _portBaudrateValue(port->baudrate);
     struct termios settings;
     memset(&settings, 0, sizeof(settings));
     settings.c_iflag = IGNBRK | IGNPAR;
     settings.c_cflag = CS8 | CLOCAL | CREAD;
-    cfsetispeed(&settings, _portBaudrateValue(port->baudrate));
-    cfsetospeed(&settings, _portBaudrateValue(port->baudrate));
-
-    if (tcsetattr(fileno, TCSANOW, &settings) != 0)
+    settings.c_cc[VMIN]  = port->vMin;
+    settings.c_cc[VTIME] = port->vTime;
+    cfsetispeed(&settings, baudValue != 0 ? baudValue : B9600);
+    cfsetospeed(&settings, baudValue != 0 ? baudValue : B9600);
+
+    if ( (tcsetattr(fileno, TCSANOW, &settings) != 0) ||
+#  if PORT_HAVE_TERMIOS2
+        ( (baudValue == 0) && !_portSetCustomBaudrate(port, fileno, port->baudrate) ) )
+#  else
+        (baudValue == 0) )
+#  endif
     {
         PORT_WARNING("Failed configuring device: %s", _portErrStr(port, 0));
         flock(fileno, LOCK_UN);
@@ -531,6 +873,24 @@ static bool _portOpenSer(PORT_t *port)
         return false;
     }
 
+    // VMIN and VTIME only apply to blocking reads
+    if (port->vTime > 0)
+    {
+        const int flags = fcntl(fileno, F_GETFL, 0);
+        if ( (flags < 0) || (fcntl(fileno, F_SETFL, flags & ~O_NONBLOCK) < 0) )
+        {
+            PORT_WARNING("Failed setting blocking operation: %s", _portErrStr(port, 0));
+            flock(fileno, LOCK_UN);
+            close(fileno);
+            return false;
+        }
+    }
+
+    if (port->lowLatency)
+    {
+        _portLowLatencySer(port, fileno);
+    }
+
     port->fd = fileno;
 
 #endif
@@ -552,6 +912,28 @@ static uint32_t _portBaudrateValue(const int baudrate)
     return 0;
 }
 
+static bool _portBaudrateOk(const PORT_TYPE_t type, const int baudrate)
+{
+    if (_portBaudrateValue(baudrate) != 0)
+    {
+        return true;
+    }
+    const bool inRange = (baudrate >= PORT_BAUDRATE_MIN) && (baudrate <= PORT_BAUDRATE_MAX);
+    switch (type)
+    {
+        case PORT_TYPE_SER:
+#if defined(_WIN32) || PORT_HAVE_TERMIOS2
+            return inRange;
+#else
+            return false;
+#endif
+        case PORT_TYPE_TCP:
+        case PORT_TYPE_TELNET:
+            return inRange;
+    }
+    return false;
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 
 static void _portCloseSer(PORT_t *port)
@@ -656,7 +1038,7 @@ static bool _portSetBaudrateSer(PORT_t *port, const int baudrate)
         PORT_WARNING("Failed getting port (baudrate) settings: %s", _portErrStr(port, 0));
         return false;
     }
-    settings.BaudRate = _portBaudrateValue(baudrate);
+    settings.BaudRate = baudrate;
     if (SetCommState((HANDLE)port->handle, &settings) == 0)
     {
         PORT_WARNING("Failed applying (baudrate) settings: %s", _portErrStr(port, 0));
@@ -665,20 +1047,38 @@ static bool _portSetBaudrateSer(PORT_t *port, const int baudrate)
 
 #else
 
-    struct termios settings;
-    if (tcgetattr(port->fd, &settings) != 0)
+    const uint32_t baudValue = _portBaudrateValue(baudrate);
+    if (baudValue == 0)
     {
-        PORT_WARNING("tcgetattr fail: %s", _portErrStr(port, 0));
+#  if PORT_HAVE_TERMIOS2
+        if (!_portSetCustomBaudrate(port, port->fd, baudrate))
+        {
+            return false;
+        }
+#  else
         return false;
+#  endif
     }
+    else
+    {
+        struct termios settings;
+        if (tcgetattr(port->fd, &settings) != 0)
+        {
+            PORT_WARNING("tcgetattr fail: %s", _portErrStr(port, 0));
+            return false;
+        }
 
-    cfsetispeed(&settings, _portBaudrateValue(baudrate));
-    cfsetospeed(&settings, _portBaudrateValue(baudrate));
+#  ifdef CIBAUD
+        settings.c_cflag &= ~CIBAUD; // in case it was a non-standard baudrate
+#  endif
+        cfsetispeed(&settings, baudValue);
+        cfsetospeed(&settings, baudValue);
 
-    if (tcsetattr(port->fd, TCSANOW, &settings) != 0)
-    {
-        PORT_WARNING("tcsetattr fail: %s", _portErrStr(port, 0));
-        return false;
+        if (tcsetattr(port->fd, TCSANOW, &settings) != 0)
+        {
+            PORT_WARNING("tcsetattr fail: %s", _portErrStr(port, 0));
+            return false;
+        }
     }
     port->baudrate = baudrate;
 
@@ -753,216 +1153,452 @@ void _winsockDeinit(PORT_t *port)
 
 #endif
 
-static bool _portOpenTcp(PORT_t *port)
-{
-#ifdef _WIN32
-    if (!_winsockInit(port))
-    {
-        return false;
-    }
+#define TCPIP_CONNECT_TIMEOUT   5000  // [ms]
+#define TCPIP_CLOSE_TIMEOUT     2000  // [ms] max. time to send remaining queued data when closing the port
+#define TCPIP_RECONNECT_MIN      500  // [ms] initial reconnect delay, doubled for every failed attempt..
+#define TCPIP_RECONNECT_MAX    16000  // [ms] ..up to this
+
+#ifdef MSG_NOSIGNAL
+#  define TCPIP_SEND_FLAGS MSG_NOSIGNAL // Don't raise SIGPIPE if the connection is gone
+#else
+#  define TCPIP_SEND_FLAGS 0
 #endif
 
-    // Find address, as per getaddrinfo(3)
-    struct addrinfo *result;
-    {
-        struct addrinfo hints;
-        memset(&hints, 0, sizeof(hints));
-        hints.ai_family   = AF_UNSPEC;  // IPv4 or IPv6
-        hints.ai_socktype = SOCK_STREAM;
-        char portNrStr[20];
-        snprintf(portNrStr, sizeof(portNrStr), "%d", port->port);
-        const int res = getaddrinfo(port->file, portNrStr, &hints, &result);
-        if (res != 0)
-        {
+static bool _telnetNegotiateStart(PORT_t *port);
+static int _telnetNegotiateCheck(PORT_t *port);
+static bool _telnetConfigure(PORT_t *port);
+
+static SOCKET _portSock(PORT_t *port)
+{
 #ifdef _WIN32
-            PORT_WARNING("Failed connecting: %s", _portErrStr(port, 0));
-            _winsockDeinit(port);
+    return (SOCKET)port->handle;
 #else
-            PORT_WARNING("Failed getting address: %s", gai_strerror(res));
+    return port->fd;
 #endif
-            return false;
-        }
-    }
-
-    // Connect
-    SOCKET fd = INVALID_SOCKET;
-    for (struct addrinfo *rp = result; rp != NULL; rp = rp->ai_next)
-    {
-        fd = socket(rp->ai_family, rp->ai_socktype, rp->ai_protocol);
-        if (fd == INVALID_SOCKET)
-        {
-            continue;
-        }
+}
 
-#ifndef _WIN32
-#  if 1
-        struct timeval timeout;
-        timeout.tv_sec  = 5;
-        timeout.tv_usec = 0;
-        if (setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout)) != 0)
-        {
-            PORT_WARNING("Failed setting SO_SNDTIMEO option: %s", _portErrStr(port, 0));
-        }
-#  else
-        const int count = 3;
-        if (setsockopt(fd, IPPROTO_TCP, TCP_SYNCNT, &count, sizeof(count)) != 0)
-        {
-            PORT_WARNING("Failed setting TCP_SYNCNT option: %s", _portErrStr(port, 0));
-        }
-#  endif
+static bool _portSockWouldBlock(void)
+{
+#ifdef _WIN32
+    return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+    return (errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINPROGRESS);
 #endif
+}
 
-        int res = connect(fd, rp->ai_addr, rp->ai_addrlen);
-        if (res == SOCKET_ERROR)
-        {
-            PORT_WARNING("Failed connecting: %s", _portErrStr(port, 0));
+static void _portSockClose(PORT_t *port)
+{
 #ifdef _WIN32
-            closesocket(fd);
-            _winsockDeinit(port);
+    closesocket((SOCKET)port->handle);
+    port->handle = (void *)INVALID_SOCKET;
 #else
-            close(fd);
+    close(port->fd);
+    port->fd = INVALID_SOCKET;
 #endif
-            return false;
-        }
-        else
-        {
-            break;
-        }
+}
+
+static void _portTcpSetState(PORT_t *port, const PORT_STATE_t state)
+{
+    if (state != port->state)
+    {
+        PORT_DEBUG("%s -> %s", portStateStr(port->state), portStateStr(state));
+        port->state = state;
+        port->stateTime = TIME();
     }
+}
 
-    // Cleanup
-    freeaddrinfo(result);
+// Connection failed or lost: schedule reconnect (only if it was open before) or give up
+static bool _portTcpLost(PORT_t *port)
+{
+    const PORT_STATE_t state = port->state;
+    if ( (state == PORT_STATE_CONNECTING) || (state == PORT_STATE_NEGOTIATING) || (state == PORT_STATE_CONNECTED) )
+    {
+        _portSockClose(port);
+    }
+    port->txDropped += port->txSize;
+    port->txHead = 0;
+    port->txSize = 0;
 
-    // Happy?
-    if (fd == INVALID_SOCKET)
+    if (!port->reconnect || !port->portOk)
     {
-        PORT_WARNING("No connection possible!"); // FIXME: but why?
-#ifdef _WIN32
-        _winsockDeinit(port);
-#endif
+        _portTcpSetState(port, PORT_STATE_CLOSED);
         return false;
     }
 
-    // Make non-blocking
-#ifdef _WIN32
-    unsigned long mode = 1;
-    if (ioctlsocket(fd, FIONBIO, &mode) != 0)
+    // Start over with a short delay if the connection was good for a while
+    if ( (state == PORT_STATE_CONNECTED) && ((TIME() - port->stateTime) > TCPIP_RECONNECT_MAX) )
+    {
+        port->backoff = 0;
+    }
+    port->backoff = CLIP(2 * port->backoff, TCPIP_RECONNECT_MIN, TCPIP_RECONNECT_MAX);
+    port->nextConnect = TIME() + port->backoff;
+    if (state == PORT_STATE_CONNECTED)
+    {
+        PORT_WARNING("Connection lost, reconnecting in %ums", port->backoff);
+    }
+    else
+    {
+        PORT_DEBUG("Reconnecting in %ums", port->backoff);
+    }
+    _portTcpSetState(port, PORT_STATE_RECONNECT);
+    return true;
+}
+
+// Start connecting (non-blocking) to port->addr
+static bool _portTcpConnectStart(PORT_t *port)
+{
+    const struct sockaddr *addr = (const struct sockaddr *)port->addr;
+    SOCKET fd = socket(addr->sa_family, SOCK_STREAM, IPPROTO_TCP);
+    if (fd == INVALID_SOCKET)
+    {
+        PORT_WARNING("Failed creating socket: %s", _portErrStr(port, 0));
+        return false;
+    }
+
+    // Make non-blocking
+#ifdef _WIN32
+    unsigned long mode = 1;
+    if (ioctlsocket(fd, FIONBIO, &mode) != 0)
     {
         PORT_WARNING("Failed setting non-blocking operation: %s", _portErrStr(port, 0));
         closesocket(fd);
-        _winsockDeinit(port);
         return false;
     }
 #else
     const int flags = fcntl(fd, F_GETFL, 0);
-    if (flags < 0)
+    if ( (flags < 0) || (fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) )
     {
-        PORT_WARNING("Failed getting flags: %s", _portErrStr(port, 0));
-        close(fd);
-        return false;
-    }
-    int res = fcntl(fd, F_SETFL, flags | O_NONBLOCK);
-    if (res < 0)
-    {
-        PORT_WARNING("Failed setting flags: %s", _portErrStr(port, 0));
+        PORT_WARNING("Failed setting non-blocking operation: %s", _portErrStr(port, 0));
         close(fd);
         return false;
     }
 #endif
 
-    // Send immediately
+    // Send immediately, and detect dead connections (e.g. a serial port server losing power) within seconds
 #ifdef _WIN32
     const DWORD enable = 1;
+#else
+    const int enable = 1;
+#endif
     if (setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, (const char *)&enable, sizeof(enable)) != 0)
     {
         PORT_WARNING("Failed setting TCP_NODELAY option: %s", _portErrStr(port, 0));
-        closesocket(fd);
-        _winsockDeinit(port);
-        return false;
     }
-#else
-    const int enable = 1;
-    if (setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable)) != 0)
+    if (setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, (const char *)&enable, sizeof(enable)) != 0)
     {
-        PORT_WARNING("Failed setting TCP_NODELAY option: %s", _portErrStr(port, 0));
+        PORT_WARNING("Failed setting SO_KEEPALIVE option: %s", _portErrStr(port, 0));
+    }
+#if defined(TCP_KEEPIDLE) && defined(TCP_KEEPINTVL) && defined(TCP_KEEPCNT)
+    const int idle = 5;
+    const int intvl = 2;
+    const int cnt = 3;
+    if ( (setsockopt(fd, IPPROTO_TCP, TCP_KEEPIDLE,  (const char *)&idle,  sizeof(idle))  != 0) ||
+         (setsockopt(fd, IPPROTO_TCP, TCP_KEEPINTVL, (const char *)&intvl, sizeof(intvl)) != 0) ||
+         (setsockopt(fd, IPPROTO_TCP, TCP_KEEPCNT,   (const char *)&cnt,   sizeof(cnt))   != 0) )
+    {
+        PORT_DEBUG("Failed setting keep-alive parameters: %s", _portErrStr(port, 0));
+    }
+#endif
+
+    if ( (connect(fd, addr, port->addrLen) == SOCKET_ERROR) && !_portSockWouldBlock() )
+    {
+        PORT_WARNING("Failed connecting: %s", _portErrStr(port, 0));
+#ifdef _WIN32
+        closesocket(fd);
+#else
         close(fd);
+#endif
         return false;
     }
-#endif
 
-    // Remember socket
 #ifdef _WIN32
     port->handle = (void *)fd;
 #else
     port->fd = fd;
 #endif
-
+    _portTcpSetState(port, PORT_STATE_CONNECTING);
     return true;
 }
 
-// ---------------------------------------------------------------------------------------------------------------------
-
-static void _portCloseTcp(PORT_t *port)
+// Check connection progress: 1 = connected, 0 = not yet, -1 = failed
+static int _portTcpConnectCheck(PORT_t *port)
 {
-#ifdef _WIN32
-    closesocket((SOCKET)port->handle);
-    _winsockDeinit(port);
-#else
-    close(port->fd);
-#endif
+    const SOCKET fd = _portSock(port);
+    fd_set wfds;
+    fd_set efds;
+    FD_ZERO(&wfds);
+    FD_ZERO(&efds);
+    FD_SET(fd, &wfds);
+    FD_SET(fd, &efds);
+    struct timeval tv = { .tv_sec = 0, .tv_usec = 0 };
+    const int res = select((int)fd + 1, NULL, &wfds, &efds, &tv);
+    if (res == 0)
+    {
+        if ((TIME() - port->stateTime) > TCPIP_CONNECT_TIMEOUT)
+        {
+            PORT_WARNING("Timeout connecting!");
+            return -1;
+        }
+        return 0;
+    }
+    int err = 0;
+    socklen_t len = sizeof(err);
+    if ( (res < 0) || (getsockopt(fd, SOL_SOCKET, SO_ERROR, (char *)&err, &len) != 0) || (err != 0) )
+    {
+        PORT_WARNING("Failed connecting: %s", _portErrStr(port, err));
+        return -1;
+    }
+    return 1;
 }
 
-// ---------------------------------------------------------------------------------------------------------------------
-
-static bool _portWriteTcp(PORT_t *port, const uint8_t *data, const int size)
+// Send data right away, bypassing the queue (for small amounts of data on a fresh connection only)
+static bool _portTcpSendNow(PORT_t *port, const uint8_t *data, const int size)
 {
-    int rem = size;
-    int offs = 0;
-    while (rem > 0)
+    const int res = send(_portSock(port), (const char *)data, size, TCPIP_SEND_FLAGS);
+    PORT_XTRA_TRACE("tcp send now %d -> %d", size, res);
+    if (res != size)
     {
-        const int sendSize = rem > TCPIP_MAX_PACKET_SIZE ? TCPIP_MAX_PACKET_SIZE : rem;
+        PORT_WARNING("tcp send fail (%d, %d): %s", size, res, _portErrStr(port, 0));
+        return false;
+    }
+    return true;
+}
 
+// Send queued data, as much as the socket takes and the throttling allows
+static bool _portTcpSendQueue(PORT_t *port)
+{
+    while (port->txSize > 0)
+    {
         // Throttle. The remote device will not have infinite buffers. So don't send faster than the remote
         // serial port at this baudrate can transmit. Assume 11 bits per character to be on the safe side.
-        const int dt = TIME() - port->lastTime;
-        const int reqDt = port->baudrate != 0 ? (port->lastCount * 1000 / (port->baudrate / 11)) : 0;
-        const int wait = reqDt - dt;
-        if (wait > 0)
+        const uint32_t sendTime = TIME();
+        if ((int32_t)(sendTime - port->txNext) < 0)
+        {
+            break;
+        }
+        const int sendSize = MIN(MIN(port->txSize, PORT_TX_QUEUE_SIZE - port->txHead), TCPIP_MAX_PACKET_SIZE);
+        const int res = send(_portSock(port), (const char *)&port->txQueue[port->txHead], sendSize, TCPIP_SEND_FLAGS);
+        PORT_XTRA_TRACE("tcp send %d -> %d (queued %d)", sendSize, res, port->txSize);
+        if (res < 0)
         {
-            SLEEP(wait);
+            // Socket buffer full, try again later
+            if (_portSockWouldBlock())
+            {
+                break;
+            }
+            PORT_WARNING_THROTTLE("tcp send fail (%d, %d): %s", sendSize, res, _portErrStr(port, 0));
+            return _portTcpLost(port);
+        }
+        port->txHead = (port->txHead + res) % PORT_TX_QUEUE_SIZE;
+        port->txSize -= res;
+        port->txNext = sendTime + (port->baudrate > 0 ? (uint32_t)(res * 11 * 1000 / port->baudrate) : 0);
+    }
+    return true;
+}
+
+// Drive the connection (connecting, telnet negotiation, reconnecting) and send queued data. Never blocks.
+// Returns false if the connection is gone (and not reconnecting).
+static bool _portTcpPump(PORT_t *port)
+{
+    switch (port->state)
+    {
+        case PORT_STATE_CLOSED:
+            return false;
+        case PORT_STATE_RECONNECT:
+            if ((int32_t)(TIME() - port->nextConnect) < 0)
+            {
+                return true;
+            }
+            port->numAttempts++;
+            PORT_DEBUG("Reconnecting (attempt %u)", port->numAttempts);
+            if (!_portTcpConnectStart(port))
+            {
+                return _portTcpLost(port);
+            }
+            return true;
+        case PORT_STATE_CONNECTING:
+        {
+            const int res = _portTcpConnectCheck(port);
+            if (res < 0)
+            {
+                return _portTcpLost(port);
+            }
+            else if (res == 0)
+            {
+                return true;
+            }
+            if (port->type == PORT_TYPE_TELNET)
+            {
+                if (!_telnetNegotiateStart(port))
+                {
+                    return _portTcpLost(port);
+                }
+                _portTcpSetState(port, PORT_STATE_NEGOTIATING);
+                return true;
+            }
+            break;
+        }
+        case PORT_STATE_NEGOTIATING:
+        {
+            const int res = _telnetNegotiateCheck(port);
+            if ( (res < 0) || ( (res > 0) && !_telnetConfigure(port) ) )
+            {
+                return _portTcpLost(port);
+            }
+            else if (res == 0)
+            {
+                return true;
+            }
+            break;
         }
+        case PORT_STATE_CONNECTED:
+            return _portTcpSendQueue(port);
+    }
 
+    // Connection (re-)established
+    if (port->numAttempts > 0)
+    {
+        port->numReconnects++;
+        port->numAttempts = 0;
+        PORT_WARNING("Connection re-established");
+    }
+    _portTcpSetState(port, PORT_STATE_CONNECTED);
+    return _portTcpSendQueue(port);
+}
+
+static bool _portOpenTcp(PORT_t *port)
+{
 #ifdef _WIN32
-        const int res = send((SOCKET)port->handle, (const char *)&data[offs], sendSize, 0);
-#else
-        const int res = send(port->fd, &data[offs], sendSize, 0);
+    if (!_winsockInit(port))
+    {
+        return false;
+    }
 #endif
 
-        port->lastTime = TIME();
-        port->lastCount = sendSize;
-
-        PORT_XTRA_TRACE("tcp send (delay %d) %d -> %d", wait > 0 ? wait : 0, sendSize, res);
-        // FIXME: handle EAGAIN?
-        if ( (res < 0) || (res != sendSize) )
+    // Find address, as per getaddrinfo(3)
+    struct addrinfo *result;
+    {
+        struct addrinfo hints;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family   = AF_UNSPEC;  // IPv4 or IPv6
+        hints.ai_socktype = SOCK_STREAM;
+        char portNrStr[20];
+        snprintf(portNrStr, sizeof(portNrStr), "%d", port->port);
+        const int res = getaddrinfo(port->file, portNrStr, &hints, &result);
+        if (res != 0)
         {
-            PORT_WARNING_THROTTLE("tcp send fail (%d, %d): %s", sendSize, res, _portErrStr(port, 0));
+#ifdef _WIN32
+            PORT_WARNING("Failed connecting: %s", _portErrStr(port, 0));
+            _winsockDeinit(port);
+#else
+            PORT_WARNING("Failed getting address: %s", gai_strerror(res));
+#endif
             return false;
         }
-        offs += sendSize;
-        rem  -= sendSize;
     }
+
+    // Connect, try all addresses
+    port->state = PORT_STATE_CLOSED;
+    port->backoff = 0;
+    port->txNext = 0;
+    bool connected = false;
+    for (struct addrinfo *rp = result; (rp != NULL) && !connected; rp = rp->ai_next)
+    {
+        if (rp->ai_addrlen > sizeof(port->addr))
+        {
+            continue;
+        }
+        memcpy(port->addr, rp->ai_addr, rp->ai_addrlen);
+        port->addrLen = rp->ai_addrlen;
+        if (!_portTcpConnectStart(port))
+        {
+            continue;
+        }
+        while (_portTcpPump(port) && (port->state != PORT_STATE_CONNECTED))
+        {
+            SLEEP(5);
+        }
+        connected = (port->state == PORT_STATE_CONNECTED);
+    }
+
+    // Cleanup
+    freeaddrinfo(result);
+
+    // Happy?
+    if (!connected)
+    {
+        PORT_WARNING("No connection possible!");
+#ifdef _WIN32
+        _winsockDeinit(port);
+#endif
+        return false;
+    }
+
     return true;
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-static bool _portReadTcp(PORT_t *port, uint8_t *data, const int size, int *nRead)
+static void _portCloseTcp(PORT_t *port)
 {
+    // Send remaining data
+    const uint32_t t0 = TIME();
+    while ( (port->state == PORT_STATE_CONNECTED) && (port->txSize > 0) && ((TIME() - t0) < TCPIP_CLOSE_TIMEOUT) &&
+        _portTcpSendQueue(port) )
+    {
+        SLEEP(5);
+    }
+    if (port->txSize > 0)
+    {
+        PORT_WARNING("Dropping %d bytes of unsent data", port->txSize);
+    }
+    port->txDropped += port->txSize;
+    port->txSize = 0;
+
+    if ( (port->state == PORT_STATE_CONNECTING) || (port->state == PORT_STATE_NEGOTIATING) ||
+         (port->state == PORT_STATE_CONNECTED) )
+    {
+        _portSockClose(port);
+    }
+    _portTcpSetState(port, PORT_STATE_CLOSED);
+    _portFreeTxQueue(port);
 #ifdef _WIN32
-    const int res = recv((SOCKET)port->handle, (char *)data, size, 0);
-#else
-    const int res = recv(port->fd, data, size, 0);
+    _winsockDeinit(port);
 #endif
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static bool _portWriteTcp(PORT_t *port, const uint8_t *data, const int size)
+{
+    if (port->state == PORT_STATE_CLOSED)
+    {
+        return false;
+    }
+
+    // Queue data...
+    if (size > (PORT_TX_QUEUE_SIZE - port->txSize))
+    {
+        PORT_WARNING_THROTTLE("tcp write queue full (%d, %d)", size, port->txSize);
+        port->txDropped += size;
+        return false;
+    }
+    const int tail = (port->txHead + port->txSize) % PORT_TX_QUEUE_SIZE;
+    const int size1 = MIN(size, PORT_TX_QUEUE_SIZE - tail);
+    memcpy(&port->txQueue[tail], data, size1);
+    memcpy(port->txQueue, &data[size1], size - size1);
+    port->txSize += size;
+
+    // ...and send what we can
+    return _portTcpPump(port);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// Receive data, false on error or if the connection was closed
+static bool _portTcpRecv(PORT_t *port, uint8_t *data, const int size, int *nRead)
+{
+    const int res = recv(_portSock(port), (char *)data, size, 0);
     PORT_XTRA_TRACE("tpc recv %d -> %d", size, res);
     // Got data
     if (res > 0)
@@ -971,11 +1607,7 @@ static bool _portReadTcp(PORT_t *port, uint8_t *data, const int size, int *nRead
         return true;
     }
     // No more data at the moment
-#ifdef _WIN32
-    else if ( (res == -1) && (GetLastError() == WSAEWOULDBLOCK) )
-#else
-    else if ( (res == -1) && (errno == EAGAIN) )
-#endif
+    else if ( (res < 0) && _portSockWouldBlock() )
     {
         *nRead = 0;
         return true;
@@ -983,12 +1615,37 @@ static bool _portReadTcp(PORT_t *port, uint8_t *data, const int size, int *nRead
     // Error
     else
     {
-        PORT_WARNING_THROTTLE("tcp recv fail (%d, %d): %s", size, res, _portErrStr(port, 0));
+        if (res == 0)
+        {
+            PORT_WARNING_THROTTLE("tcp recv fail (%d, %d): %s", size, res, "connection closed");
+        }
+        else
+        {
+            PORT_WARNING_THROTTLE("tcp recv fail (%d, %d): %s", size, res, _portErrStr(port, 0));
+        }
         *nRead = 0;
         return false;
     }
 }
 
+static bool _portReadTcp(PORT_t *port, uint8_t *data, const int size, int *nRead)
+{
+    *nRead = 0;
+    if (!_portTcpPump(port))
+    {
+        return false;
+    }
+    if (port->state != PORT_STATE_CONNECTED)
+    {
+        return true;
+    }
+    if (!_portTcpRecv(port, data, size, nRead))
+    {
+        return _portTcpLost(port);
+    }
+    return true;
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 
 static bool _portCanBaudrateTcp(PORT_t *port)
@@ -1304,94 +1961,88 @@ void _telnetProcessInband(PORT_t *port, uint8_t *buf, int nIn, int *nOut, TELNET
     *nOut = nO;
 }
 
-static bool _portOpenTelnet(PORT_t *port)
+// Our offer
+static const TELNET_OPTION_t kTelnetOptions[] =
+{
+  //{ .agree = false, .command = TELNET_COMMAND_WILL, .option = TELNET_OPTION_SUPPRESS_GO_AHEAD },
+    { .agree = false, .command = TELNET_COMMAND_WILL, .option = TELNET_OPTION_TRANSMIT_BINARY },
+  //{ .agree = false, .command = TELNET_COMMAND_WONT, .option = TELNET_OPTION_ECHO },
+    { .agree = false, .command = TELNET_COMMAND_WILL, .option = TELNET_OPTION_COM_PORT_OPTION },
+  //{ .agree = false, .command = TELNET_COMMAND_DO,   .option = TELNET_OPTION_SUPPRESS_GO_AHEAD },
+    { .agree = false, .command = TELNET_COMMAND_DO,   .option = TELNET_OPTION_TRANSMIT_BINARY },
+  //{ .agree = false, .command = TELNET_COMMAND_DONT, .option = TELNET_OPTION_ECHO },
+    { .agree = false, .command = TELNET_COMMAND_DO,   .option = TELNET_OPTION_COM_PORT_OPTION }
+};
+
+#define TELNET_NEGOTIATE_TIMEOUT 1500 // [ms]
+
+// Announce our offer
+static bool _telnetNegotiateStart(PORT_t *port)
 {
-    if (!_portOpenTcp(port))
-    {
-        return false;
-    }
     port->tnState = TELNET_STATE_NORMAL;
     port->nTnInband = 0;
+    port->tnAgree = 0;
 
-    uint8_t buf[TCPIP_MAX_PACKET_SIZE];
-
-    // Our offer
-    TELNET_OPTION_t telnetOptions[] =
-    {
-      //{ .agree = false, .command = TELNET_COMMAND_WILL, .option = TELNET_OPTION_SUPPRESS_GO_AHEAD },
-        { .agree = false, .command = TELNET_COMMAND_WILL, .option = TELNET_OPTION_TRANSMIT_BINARY },
-      //{ .agree = false, .command = TELNET_COMMAND_WONT, .option = TELNET_OPTION_ECHO },
-        { .agree = false, .command = TELNET_COMMAND_WILL, .option = TELNET_OPTION_COM_PORT_OPTION },
-      //{ .agree = false, .command = TELNET_COMMAND_DO,   .option = TELNET_OPTION_SUPPRESS_GO_AHEAD },
-        { .agree = false, .command = TELNET_COMMAND_DO,   .option = TELNET_OPTION_TRANSMIT_BINARY },
-      //{ .agree = false, .command = TELNET_COMMAND_DONT, .option = TELNET_OPTION_ECHO },
-        { .agree = false, .command = TELNET_COMMAND_DO,   .option = TELNET_OPTION_COM_PORT_OPTION }
-    };
-
-    // Announce our offer
-    for (int ix = 0; ix < NUMOF(telnetOptions); ix++)
+    uint8_t buf[3 * NUMOF(kTelnetOptions)];
+    for (int ix = 0; ix < NUMOF(kTelnetOptions); ix++)
     {
         buf[(ix * 3) + 0] = TELNET_IAC;
-        buf[(ix * 3) + 1] = telnetOptions[ix].command;
-        buf[(ix * 3) + 2] = telnetOptions[ix].option;
-        PORT_XTRA_TRACE("we offer: %-4s %s", _telnetCommandStr(port, telnetOptions[ix].command), _telnetOptionStr(port, telnetOptions[ix].option));
+        buf[(ix * 3) + 1] = kTelnetOptions[ix].command;
+        buf[(ix * 3) + 2] = kTelnetOptions[ix].option;
+        PORT_XTRA_TRACE("we offer: %-4s %s", _telnetCommandStr(port, kTelnetOptions[ix].command), _telnetOptionStr(port, kTelnetOptions[ix].option));
     }
-    if (!_portWriteTcp(port, buf, 3 * NUMOF(telnetOptions)))
+    return _portTcpSendNow(port, buf, sizeof(buf));
+}
+
+// Negotiate, process their answer: 1 = done, 0 = not yet, -1 = failed
+static int _telnetNegotiateCheck(PORT_t *port)
+{
+    uint8_t buf[TCPIP_MAX_PACKET_SIZE];
+    int nRead = 0;
+    if (!_portTcpRecv(port, buf, sizeof(buf), &nRead))
     {
-        _portCloseTcp(port);
-        return false;
+        PORT_WARNING("Failed negotiating telnet options!");
+        return -1;
     }
 
-    // Negotiate, process their answer
-    bool happy = false;
-    bool timeout = false;
-    const uint32_t t0 = TIME();
-    const uint32_t t1 = t0 + 1500;
-    while (!happy && !timeout)
+    TELNET_OPTION_t telnetOptions[NUMOF(kTelnetOptions)];
+    memcpy(telnetOptions, kTelnetOptions, sizeof(telnetOptions));
+    for (int ix = 0; ix < NUMOF(telnetOptions); ix++)
     {
-        if (TIME() > t1)
-        {
-            timeout = true;
-            break;
-        }
-
-        int nRead = 0;
-        if (!_portReadTcp(port, buf, sizeof(buf), &nRead))
-        {
-            break;
-        }
-        if (nRead == 0)
-        {
-            SLEEP(10);
-            continue;
-        }
+        telnetOptions[ix].agree = ((port->tnAgree & (1 << ix)) != 0);
+    }
 
+    if (nRead > 0)
+    {
         int nOut = 0;
         _telnetProcessInband(port, buf, nRead, &nOut, telnetOptions, NUMOF(telnetOptions));
 
         PORT_XTRA_TRACE("State of negotiations:");
-        happy = true;
+        bool happy = true;
+        port->tnAgree = 0;
         for (int ix = 0; ix < NUMOF(telnetOptions); ix++)
         {
             PORT_XTRA_TRACE("%d %-4s %-20s %s", ix, _telnetCommandStr(port, telnetOptions[ix].command),
                 _telnetOptionStr(port, telnetOptions[ix].option), telnetOptions[ix].agree ? ":-)" : ":-(");
-            if (!telnetOptions[ix].agree)
+            if (telnetOptions[ix].agree)
+            {
+                port->tnAgree |= (1 << ix);
+            }
+            else
             {
                 happy = false;
             }
         }
         PORT_XTRA_TRACE("We %s happy", happy ? "are" : "are not (yet)");
-    }
-    if (!happy || timeout)
-    {
-        if (timeout)
+        if (happy)
         {
-            PORT_WARNING("Timeout negotiating telnet options!");
-        }
-        else
-        {
-            PORT_WARNING("Failed negotiating telnet options!");
+            return 1;
         }
+    }
+
+    if ((TIME() - port->stateTime) > TELNET_NEGOTIATE_TIMEOUT)
+    {
+        PORT_WARNING("Timeout negotiating telnet options!");
         for (int ix = 0; ix < NUMOF(telnetOptions); ix++)
         {
             if (!telnetOptions[ix].agree)
@@ -1400,11 +2051,31 @@ static bool _portOpenTelnet(PORT_t *port)
                 _telnetOptionStr(port, telnetOptions[ix].option));
             }
         }
-        _portCloseTcp(port);
-        return false;
+        return -1;
     }
 
-    // Configure port
+    return 0;
+}
+
+static int _telnetBaudrateCmd(uint8_t *buf, const int baudrate)
+{
+    const uint32_t b = (uint32_t)baudrate;
+    buf[0] = TELNET_IAC;
+    buf[1] = TELNET_COMMAND_SB;
+    buf[2] = TELNET_OPTION_COM_PORT_OPTION;
+    buf[3] = TELNET_CPCO_SET_BAUDRATE;
+    buf[4] = (b >> 24) & 0xff;
+    buf[5] = (b >> 16) & 0xff;
+    buf[6] = (b >>  8) & 0xff;
+    buf[7] =  b        & 0xff;
+    buf[8] = TELNET_IAC;
+    buf[9] = TELNET_COMMAND_SE;
+    return 10;
+}
+
+// Configure port
+static bool _telnetConfigure(PORT_t *port)
+{
     static const TELNET_CPCO_t kTelnetCpco[] =
     {
         { .cpco = TELNET_CPCO_SET_DATASIZE,        .arg = 8 }, // 8
@@ -1414,6 +2085,7 @@ static bool _portOpenTelnet(PORT_t *port)
         { .cpco = TELNET_CPCO_SET_MODEMSTATE_MASK, .arg = 0 },
         { .cpco = TELNET_CPCO_SET_LINESTATE_MASK,  .arg = 0 }  // FIXME: maybe we should watch some of these?
     };
+    uint8_t buf[(6 * NUMOF(kTelnetCpco)) + 10];
     for (int ix = 0; ix < NUMOF(kTelnetCpco); ix++)
     {
         buf[(ix * 6) + 0] = TELNET_IAC;
@@ -1423,17 +2095,21 @@ static bool _portOpenTelnet(PORT_t *port)
         buf[(ix * 6) + 4] = kTelnetCpco[ix].arg;
         buf[(ix * 6) + 5] = TELNET_COMMAND_SE;
     }
-    if (!_portWriteTcp(port, buf, 6 * NUMOF(kTelnetCpco)) ||
-        !_portSetBaudrateTelnet(port, port->baudrate))
+    const int size = (6 * NUMOF(kTelnetCpco)) + _telnetBaudrateCmd(&buf[6 * NUMOF(kTelnetCpco)], port->baudrate);
+    if (!_portTcpSendNow(port, buf, size))
     {
         PORT_WARNING("Failed configuring port!");
-        _portCloseTcp(port);
         return false;
     }
-
     return true;
 }
 
+static bool _portOpenTelnet(PORT_t *port)
+{
+    // Connecting includes negotiating and configuring the port, see _portTcpPump()
+    return _portOpenTcp(port);
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 
 static void _portCloseTelnet(PORT_t *port)
@@ -1445,6 +2121,22 @@ static void _portCloseTelnet(PORT_t *port)
 
 static bool _portWriteTelnet(PORT_t *port, const uint8_t *data, const int size)
 {
+    // Queue all or nothing
+    int escSize = size;
+    for (int ix = 0; ix < size; ix++)
+    {
+        if (data[ix] == TELNET_IAC)
+        {
+            escSize++;
+        }
+    }
+    if (escSize > (PORT_TX_QUEUE_SIZE - port->txSize))
+    {
+        PORT_WARNING_THROTTLE("tcp write queue full (%d, %d)", escSize, port->txSize);
+        port->txDropped += escSize;
+        return false;
+    }
+
     uint8_t buf[TCPIP_MAX_PACKET_SIZE];
     int nData = size;
     const uint8_t *pData = data;
@@ -1527,18 +2219,8 @@ static bool _portCanBaudrateTelnet(PORT_t *port)
 
 static bool _portSetBaudrateTelnet(PORT_t *port, const int baudrate)
 {
-    const uint32_t b = (uint32_t)baudrate;
-    uint8_t buf[] =
-    {
-        TELNET_IAC, TELNET_COMMAND_SB,
-        TELNET_OPTION_COM_PORT_OPTION, TELNET_CPCO_SET_BAUDRATE,
-        ((b >> 24) & 0xff),
-        ((b >> 16) & 0xff),
-        ((b >>  8) & 0xff),
-        ( b        & 0xff),
-        TELNET_IAC, TELNET_COMMAND_SE
-    };
-    const bool res = _portWriteTcp(port, buf, sizeof(buf));
+    uint8_t buf[10];
+    const bool res = _portWriteTcp(port, buf, _telnetBaudrateCmd(buf, baudrate));
     if (res)
     {
         port->baudrate = baudrate;
@@ -33,37 +33,80 @@ extern "C" {
 #  define PORT_BAUDVALUES  B9600, B19200, B38400, B57600, B115200, B230400, B460800, B921600
 #endif
 
+#define PORT_BAUDRATE_MIN   300       // Smallest non-standard baudrate (where supported, see portInit())
+#define PORT_BAUDRATE_MAX   16000000  // Largest non-standard baudrate
+
 #define PORT_SPEC_MAX_LEN 256
+#define PORT_TX_QUEUE_SIZE  (32 * 1024)  // Size of the write queue of TCP/IP and telnet ports
+
 
 typedef enum PORT_TYPE_e
 {
-    PORT_TYPE_SER,    // Serial ports: ser://<device>[@baudrate]
-    PORT_TYPE_TCP,    // TCP/IP sockets: tcp://<host>:<port>
-    PORT_TYPE_TELNET  // TCP/IP sockets with telnet (RFC854 etc.) and com port control (RFC2217): telnet://<host>:<port>[@<baudrate>]
+    PORT_TYPE_SER,    // Serial ports: ser://<device>[@baudrate][,<option>...]
+    PORT_TYPE_TCP,    // TCP/IP sockets: tcp://<host>:<port>[,reconnect]
+    PORT_TYPE_TELNET  // TCP/IP sockets with telnet (RFC854 etc.) and com port control (RFC2217): telnet://<host>:<port>[@<baudrate>][,reconnect]
   //PORT_TYPE_HANDLE  // Use existing file handle (or pair of file handles, such as stdin/stdout)
 } PORT_TYPE_t;
 
+typedef enum PORT_STATE_e
+{
+    PORT_STATE_CLOSED = 0,    // Not open, or connection lost (and no reconnect)
+    PORT_STATE_CONNECTING,    // TCP/IP connection in progress
+    PORT_STATE_NEGOTIATING,   // Telnet options negotiation in progress
+    PORT_STATE_CONNECTED,     // Ready
+    PORT_STATE_RECONNECT      // Connection lost, waiting to reconnect
+} PORT_STATE_t;
+
 typedef struct PORT_s
 {
     PORT_TYPE_t type;
-    uint32_t    numRx;
-    uint32_t    numTx;
+    uint64_t    numRx;
+    uint64_t    numTx;
+    uint64_t    rxTs;   // monotonic time [ns] (TIME_NS()) of the last read that returned data
     bool        portOk;
     int         baudrate;
+    int         specBaudrate; // baudrate given in the port spec (@<baudrate>), 0 if none
     char        file[PORT_SPEC_MAX_LEN];
 #ifdef _WIN32
     void       *handle;
 #else
     int         fd;
 #endif
+    // serial options
+    bool        lowLatency; // ,lowlat:    low-latency mode, incl. 1ms FTDI latency timer (Linux)
+    int         vMin;       // ,vmin=<n>:  read returns after n bytes (or vtime after the first byte)
+    int         vTime;      // ,vtime=<n>: read waits up to n * 100ms for data
+    // statistics
+    uint64_t    openTs;     // monotonic time [ns] (TIME_NS()) of portOpen()
+    uint32_t    numReadCalls;
+    uint32_t    numReads;   // reads that returned data
+    uint32_t    numWrites;
+    int         readSizeMax;
+    uint64_t    readNs;
+    uint64_t    readNsMax;
+    uint64_t    writeNs;
+    uint64_t    writeNsMax;
     // tcp
     uint16_t    port;
-    uint32_t    lastTime;
-    int         lastCount;
+    PORT_STATE_t state;
+    uint32_t    stateTime;  // TIME() of the last state change
+    bool        reconnect;  // ,reconnect: reconnect automatically if the connection is lost
+    uint32_t    backoff;    // current reconnect delay [ms]
+    uint32_t    nextConnect;
+    uint32_t    numReconnects; // connections re-established after a loss
+    uint32_t    numAttempts;   // reconnect attempts since the connection was lost
+    uint8_t     addr[128];  // resolved address (struct sockaddr_storage), for reconnecting without name lookup
+    int         addrLen;
+    uint8_t    *txQueue;    // write queue (PORT_TX_QUEUE_SIZE bytes), allocated by portOpen() for TCP/IP and telnet ports
+    int         txHead;
+    int         txSize;
+    uint32_t    txNext;     // TIME() when the next chunk may be sent (throttling)
+    uint64_t    txDropped;
     // telnet
     int         tnState;
     uint8_t     tnInband[12];
     int         nTnInband;
+    uint8_t     tnAgree;    // agreed options (bits)
     char        tmp[PORT_SPEC_MAX_LEN + 32];
     uint32_t    lastWarn;
 } PORT_t;
@@ -76,6 +119,33 @@ bool portRead(PORT_t *port, uint8_t *data, const int size, int *read);
 bool portCanBaudrate(PORT_t *port);
 bool portSetBaudrate(PORT_t *port, const int baudrate);
 int portGetBaudrate(PORT_t *port);
+PORT_STATE_t portGetState(PORT_t *port);
+const char *portStateStr(const PORT_STATE_t state);
+int portTxQueued(PORT_t *port); // bytes waiting in the write queue (TCP/IP and telnet ports)
+
+typedef struct PORT_STATS_s
+{
+    double      duration;     // time since portOpen() [s]
+    uint64_t    rxBytes;
+    uint64_t    txBytes;
+    double      rxRate;       // average rx throughput [bytes/s]
+    double      txRate;       // average tx throughput [bytes/s]
+    double      rxLoad;       // rx throughput relative to the baudrate (10 bits per byte) [%], 0.0 if n/a
+    uint32_t    numReads;     // reads that returned data
+    uint32_t    numWrites;
+    double      readSize;     // average amount of data per read [bytes]
+    int         readSizeMax;  // largest amount of data per read [bytes]
+    double      readTime;     // average time spent in a read call [ms]
+    double      readTimeMax;  // longest time spent in a read call [ms]
+    double      writeTime;    // average time spent in a write call [ms]
+    double      writeTimeMax; // longest time spent in a write call [ms]
+    int         txQueued;     // bytes waiting in the write queue
+    uint64_t    txDropped;    // bytes dropped (write queue full, or connection lost)
+    uint32_t    numReconnects; // connections re-established after a loss
+} PORT_STATS_t;
+
+bool portGetStats(PORT_t *port, PORT_STATS_t *stats);
+int portStatsStr(const PORT_STATS_t *stats, char *str, const int size);
 
 /* ****************************************************************************************************************** */
 #ifdef __cplusplus
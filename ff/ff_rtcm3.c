@@ -193,85 +193,306 @@ bool rtcm3typeToMsm(int msgType, RTCM3_MSM_GNSS_t *gnss, RTCM3_MSM_TYPE_t *msm)
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-static uint64_t bits(const uint8_t *data, const int offs, const int size)
+// Get (up to 64) bits from big-endian data, bits beyond the end of the data read as 0
+static uint64_t bits(const uint8_t *data, const int dataSize, const int offs, const int size)
 {
-    uint64_t val = 0;
-    for (int bo = 0; bo < size; bo++)
+    if ( (size < 1) || (size > 64) || (offs < 0) )
     {
-        val <<= 1;
-        const int bit = offs + bo;
-        val |= ( data[bit / 8] >> (7 - (bit % 8)) ) & 0x01;
+        return 0;
     }
-    return val;
-}
-
-static int64_t sbits(const uint8_t *data, const int offs, const int size)
-{
-    uint64_t val = 0;
-    for (int bo = 0; bo < size; bo++)
+    // Load the 64-bit (big-endian) word at the first byte, and one more byte if the bits straddle the word
+    const int byteIx = offs / 8;
+    const int bitIx  = offs % 8;
+    uint64_t word = 0;
+    if ((byteIx + 8) <= dataSize)
     {
-        val <<= 1;
-        const int bit = offs + bo;
-        val |= ( data[bit / 8] >> (7 - (bit % 8)) ) & 0x01;
+        const uint8_t *p = &data[byteIx];
+        word = ((uint64_t)p[0] << 56) | ((uint64_t)p[1] << 48) | ((uint64_t)p[2] << 40) | ((uint64_t)p[3] << 32) |
+               ((uint64_t)p[4] << 24) | ((uint64_t)p[5] << 16) | ((uint64_t)p[6] <<  8) |  (uint64_t)p[7];
     }
-    // Sign-extend to full 64 bits
-    if ((val & ((uint64_t)1 << (size - 1))) != 0)
+    else
     {
-        for (int bo = size; bo < 64; bo++)
+        for (int ix = byteIx; ix < (byteIx + 8); ix++)
         {
-            val |= (uint64_t)1 << bo;
+            word = (word << 8) | (ix < dataSize ? data[ix] : 0);
         }
     }
-    return (int64_t)val;
+    word <<= bitIx;
+    if ((bitIx + size) > 64)
+    {
+        const int ix = byteIx + 8;
+        word |= (ix < dataSize ? data[ix] : 0) >> (8 - bitIx);
+    }
+    return word >> (64 - size);
 }
 
-static int countbits(uint64_t mask)
+// Get (up to 64) bits and sign-extend them
+static int64_t sbits(const uint8_t *data, const int dataSize, const int offs, const int size)
 {
-    int cnt = 0;
-    for (; mask != 0; mask >>= 1)
+    if ( (size < 1) || (size > 64) )
     {
-        cnt += mask & 0x1;
+        return 0;
     }
-    return cnt;
+    const int shift = 64 - size;
+    return (int64_t)(bits(data, dataSize, offs, size) << shift) >> shift;
 }
 
-bool rtcm3GetMsmHeader(const uint8_t *msg, RTCM3_MSM_HEADER_t *header)
+static int countbits(uint64_t mask)
+{
+    return __builtin_popcountll(mask);
+}
+
+// Payload data and size (incl. CRC, which is always there)
+#define RTCM3_DATA(msg)      (&(msg)[RTCM3_HEAD_SIZE])
+#define RTCM3_DATA_SIZE(msg) (RTCM3_PAYLOAD_SIZE(msg) + (RTCM3_FRAME_SIZE - RTCM3_HEAD_SIZE))
+
+// Get MSM header, returns the bit offset of the satellite data, or 0 on error
+static int _rtcm3MsmHeader(const uint8_t *data, const int dataSize, RTCM3_MSM_HEADER_t *header)
 {
     memset(header, 0, sizeof(*header));
-    const uint8_t *data = &msg[RTCM3_HEAD_SIZE];
 
-    header->msgType = bits(data, 0, 12); // DF002
+    header->msgType = bits(data, dataSize, 0, 12); // DF002
     if (!rtcm3typeToMsm(header->msgType, &header->gnss, &header->msm))
     {
-        return false; // Not an MSM message
+        return 0; // Not an MSM message
     }
 
-    header->refStaId = bits(data, 12, 12); // DF003
+    header->refStaId = bits(data, dataSize, 12, 12); // DF003
     if (header->gnss == RTCM3_MSM_GNSS_GLO)
     {
-        const int dow = bits(data, 24,  3); // DF416
-        const int tod = bits(data, 27, 27); // DF034
+        const int dow = bits(data, dataSize, 24,  3); // DF416
+        const int tod = bits(data, dataSize, 27, 27); // DF034
         header->gloTow = ((double)dow * 86400.0) + ((double)tod * 1e-3);
     }
     else
     {
-        header->anyTow   = (double)bits(data, 24, 30) * 1e-3; // DF004, DF416, DF248, DF427
+        header->anyTow   = (double)bits(data, dataSize, 24, 30) * 1e-3; // DF004, DF416, DF248, DF427
     }
 
-    header->multiMsgBit = bits(data,  54,  1); // DF393
-    header->iods        = bits(data,  55,  3); // DF409
+    header->multiMsgBit = bits(data, dataSize,  54,  1); // DF393
+    header->iods        = bits(data, dataSize,  55,  3); // DF409
     // bit(7) reserved // DF001
-    header->clkSteering = bits(data,  65,  2); // DF411
-    header->extClock    = bits(data,  67,  2); // DF412
-    header->smooth      = bits(data,  69,  1); // DF417
-    header->smoothInt   = bits(data,  70,  3); // DF418
-    header->satMask     = bits(data,  73, 64); // DF394
-    header->sigMask     = bits(data, 137, 32); // DF395
+    header->clkSteering = bits(data, dataSize,  65,  2); // DF411
+    header->extClock    = bits(data, dataSize,  67,  2); // DF412
+    header->smooth      = bits(data, dataSize,  69,  1); // DF417
+    header->smoothInt   = bits(data, dataSize,  70,  3); // DF418
+    header->satMask     = bits(data, dataSize,  73, 64); // DF394
+    header->sigMask     = bits(data, dataSize, 137, 32); // DF395
 
     header->numSat   = countbits(header->satMask);
     header->numSig   = countbits(header->sigMask);
     header->numCell  = header->numSat * header->numSig;
-    header->cellMask = bits(data, 169, header->numCell); // DF396
+    if (header->numCell > RTCM3_MSM_MAX_CELLS)
+    {
+        return 0; // Invalid
+    }
+    header->cellMask = bits(data, dataSize, 169, header->numCell); // DF396
+
+    return 169 + header->numCell;
+}
+
+bool rtcm3GetMsmHeader(const uint8_t *msg, RTCM3_MSM_HEADER_t *header)
+{
+    return _rtcm3MsmHeader(RTCM3_DATA(msg), RTCM3_DATA_SIZE(msg), header) > 0;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+#define RTCM3_MSM_RANGE_MS 299792.458  // Range of 1 ms [m]
+
+// Minimum lock time [ms] from lock time indicator DF402 (MSM4/5)
+static uint32_t _rtcm3LockTime4(const uint32_t ind)
+{
+    return ind == 0 ? 0 : ( ind < 16 ? (UINT32_C(1) << (ind + 4)) : 0 );
+}
+
+// Minimum lock time [ms] from extended lock time indicator DF407 (MSM6/7)
+static uint32_t _rtcm3LockTime7(const uint32_t ind)
+{
+    if (ind < 64)
+    {
+        return ind;
+    }
+    else if (ind <= 704)
+    {
+        // 32 values per range, resolution doubles with each range
+        const uint32_t range = ((ind - 64) / 32) + 1;
+        return (UINT32_C(1) << (range + 5)) + ( (ind - (32 * (range + 1))) << range );
+    }
+    else
+    {
+        return 0; // reserved
+    }
+}
+
+bool rtcm3GetMsm(const uint8_t *msg, RTCM3_MSM_t *msm)
+{
+    const uint8_t *data = RTCM3_DATA(msg);
+    const int dataSize = RTCM3_DATA_SIZE(msg);
+
+    RTCM3_MSM_HEADER_t *header = &msm->header;
+    int offs = _rtcm3MsmHeader(data, dataSize, header);
+    msm->numCells = 0;
+    if ( (offs <= 0) || (header->msm < RTCM3_MSM_TYPE_4) )
+    {
+        return false; // Not an MSM message, or not one that we can decode (MSM1-3)
+    }
+    const int numSat  = header->numSat;
+    const int numCell = countbits(header->cellMask);
+    const bool ext    = (header->msm == RTCM3_MSM_TYPE_6) || (header->msm == RTCM3_MSM_TYPE_7);
+    const bool rate   = (header->msm == RTCM3_MSM_TYPE_5) || (header->msm == RTCM3_MSM_TYPE_7);
+
+    // Check that the message is long enough
+    const int satBits  = rate ? (8 + 4 + 10 + 14) : (8 + 10);
+    const int cellBits = (ext ? (20 + 24 + 10 + 1 + 10) : (15 + 22 + 4 + 1 + 6)) + (rate ? 15 : 0);
+    if ( (offs + (numSat * satBits) + (numCell * cellBits)) > (RTCM3_PAYLOAD_SIZE(msg) * 8) )
+    {
+        return false;
+    }
+
+    // Satellite data
+    uint8_t  satIds[64];
+    uint8_t  satRoughMs[64];
+    uint8_t  satExtInfo[64];
+    double   satRough[64];     // [ms]
+    double   satRoughRate[64]; // [m/s]
+    bool     satRateValid[64];
+    for (int satIx = 0, bit = 0; bit < 64; bit++)
+    {
+        if (CHKBITS_ANY(header->satMask, (uint64_t)1 << (63 - bit)))
+        {
+            satIds[satIx++] = bit + 1;
+        }
+    }
+    for (int satIx = 0; satIx < numSat; satIx++, offs += 8)
+    {
+        satRoughMs[satIx] = bits(data, dataSize, offs, 8); // DF397
+    }
+    for (int satIx = 0; satIx < numSat; satIx++)
+    {
+        satExtInfo[satIx] = 0;
+        if (rate)
+        {
+            satExtInfo[satIx] = bits(data, dataSize, offs, 4); // extended satellite info
+            offs += 4;
+        }
+    }
+    for (int satIx = 0; satIx < numSat; satIx++, offs += 10)
+    {
+        satRough[satIx] = (double)satRoughMs[satIx] + ((double)bits(data, dataSize, offs, 10) * (1.0 / 1024.0)); // DF398
+    }
+    for (int satIx = 0; satIx < numSat; satIx++)
+    {
+        satRoughRate[satIx] = 0.0;
+        satRateValid[satIx] = false;
+        if (rate)
+        {
+            const int64_t val = sbits(data, dataSize, offs, 14); // DF399
+            offs += 14;
+            satRateValid[satIx] = (val != -8192);
+            satRoughRate[satIx] = (double)val;
+        }
+    }
+
+    // Signal IDs
+    uint8_t sigIds[32];
+    for (int sigIx = 0, bit = 0; bit < 32; bit++)
+    {
+        if (CHKBITS_ANY(header->sigMask, (uint64_t)1 << (31 - bit)))
+        {
+            sigIds[sigIx++] = bit + 1;
+        }
+    }
+
+    // Cells (the cell mask is numSat x numSig bits, first all signals of the first satellite, etc.)
+    for (int cellBit = 0; cellBit < header->numCell; cellBit++)
+    {
+        if (CHKBITS_ANY(header->cellMask, (uint64_t)1 << (header->numCell - 1 - cellBit)))
+        {
+            RTCM3_MSM_CELL_t *cell = &msm->cells[msm->numCells];
+            const int satIx = cellBit / header->numSig;
+            cell->satIx   = satIx;
+            cell->svId    = satIds[satIx];
+            cell->sigId   = sigIds[cellBit % header->numSig];
+            cell->extInfo = satExtInfo[satIx];
+            msm->numCells++;
+        }
+    }
+
+    // Signal data, each field for all cells
+    RTCM3_MSM_CELL_t *cells = msm->cells;
+    if (ext)
+    {
+        for (int ix = 0; ix < numCell; ix++, offs += 20)
+        {
+            const int64_t val = sbits(data, dataSize, offs, 20); // DF405
+            const double rough = satRough[cells[ix].satIx];
+            cells[ix].prValid = (val != -524288) && (satRoughMs[cells[ix].satIx] != 255);
+            cells[ix].pseudoRange = cells[ix].prValid ? (rough + ((double)val * 0x1p-29)) * RTCM3_MSM_RANGE_MS : 0.0;
+        }
+        for (int ix = 0; ix < numCell; ix++, offs += 24)
+        {
+            const int64_t val = sbits(data, dataSize, offs, 24); // DF406
+            const double rough = satRough[cells[ix].satIx];
+            cells[ix].cpValid = (val != -8388608) && (satRoughMs[cells[ix].satIx] != 255);
+            cells[ix].phaseRange = cells[ix].cpValid ? (rough + ((double)val * 0x1p-31)) * RTCM3_MSM_RANGE_MS : 0.0;
+        }
+        for (int ix = 0; ix < numCell; ix++, offs += 10)
+        {
+            cells[ix].lockTime = _rtcm3LockTime7(bits(data, dataSize, offs, 10)); // DF407
+        }
+    }
+    else
+    {
+        for (int ix = 0; ix < numCell; ix++, offs += 15)
+        {
+            const int64_t val = sbits(data, dataSize, offs, 15); // DF400
+            const double rough = satRough[cells[ix].satIx];
+            cells[ix].prValid = (val != -16384) && (satRoughMs[cells[ix].satIx] != 255);
+            cells[ix].pseudoRange = cells[ix].prValid ? (rough + ((double)val * 0x1p-24)) * RTCM3_MSM_RANGE_MS : 0.0;
+        }
+        for (int ix = 0; ix < numCell; ix++, offs += 22)
+        {
+            const int64_t val = sbits(data, dataSize, offs, 22); // DF401
+            const double rough = satRough[cells[ix].satIx];
+            cells[ix].cpValid = (val != -2097152) && (satRoughMs[cells[ix].satIx] != 255);
+            cells[ix].phaseRange = cells[ix].cpValid ? (rough + ((double)val * 0x1p-29)) * RTCM3_MSM_RANGE_MS : 0.0;
+        }
+        for (int ix = 0; ix < numCell; ix++, offs += 4)
+        {
+            cells[ix].lockTime = _rtcm3LockTime4(bits(data, dataSize, offs, 4)); // DF402
+        }
+    }
+    for (int ix = 0; ix < numCell; ix++, offs += 1)
+    {
+        cells[ix].halfCycle = (bits(data, dataSize, offs, 1) != 0); // DF420
+    }
+    if (ext)
+    {
+        for (int ix = 0; ix < numCell; ix++, offs += 10)
+        {
+            cells[ix].cno = (float)bits(data, dataSize, offs, 10) * 0x1p-4f; // DF408
+        }
+    }
+    else
+    {
+        for (int ix = 0; ix < numCell; ix++, offs += 6)
+        {
+            cells[ix].cno = (float)bits(data, dataSize, offs, 6); // DF403
+        }
+    }
+    for (int ix = 0; ix < numCell; ix++)
+    {
+        cells[ix].rrValid = false;
+        cells[ix].phaseRangeRate = 0.0;
+        if (rate)
+        {
+            const int64_t val = sbits(data, dataSize, offs, 15); // DF404
+            offs += 15;
+            cells[ix].rrValid = (val != -16384) && satRateValid[cells[ix].satIx];
+            cells[ix].phaseRangeRate = cells[ix].rrValid ? satRoughRate[cells[ix].satIx] + ((double)val * 0.0001) : 0.0;
+        }
+    }
 
     return true;
 }
@@ -281,24 +502,25 @@ bool rtcm3GetMsmHeader(const uint8_t *msg, RTCM3_MSM_HEADER_t *header)
 bool rtcm3GetArp(const uint8_t *msg, RTCM3_ARP_t *arp)
 {
     memset(arp, 0, sizeof(*arp));
-    const uint8_t *data = &msg[RTCM3_HEAD_SIZE];
+    const uint8_t *data = RTCM3_DATA(msg);
+    const int dataSize = RTCM3_DATA_SIZE(msg);
 
-    const int msgType = bits(data, 0, 12); // DF002
+    const int msgType = bits(data, dataSize, 0, 12); // DF002
     bool res = true;
     switch (msgType)
     {
         case 1005:
         case 1006:
-            arp->refStaId =          bits(data,  12, 12);          // DF003
-            arp->X        = (double)sbits(data,  34, 38) * 0.0001; // DF025
-            arp->Y        = (double)sbits(data,  74, 38) * 0.0001; // DF026
-            arp->Z        = (double)sbits(data, 114, 38) * 0.0001; // DF027
+            arp->refStaId =          bits(data, dataSize,  12, 12);          // DF003
+            arp->X        = (double)sbits(data, dataSize,  34, 38) * 0.0001; // DF025
+            arp->Y        = (double)sbits(data, dataSize,  74, 38) * 0.0001; // DF026
+            arp->Z        = (double)sbits(data, dataSize, 114, 38) * 0.0001; // DF027
             break;
         case 1032:
-            arp->refStaId =          bits(data,  12, 12);          // DF003
-            arp->X        = (double)sbits(data,  42, 38) * 0.0001; // DF025
-            arp->Y        = (double)sbits(data,  80, 38) * 0.0001; // DF026
-            arp->Z        = (double)sbits(data, 118, 38) * 0.0001; // DF027
+            arp->refStaId =          bits(data, dataSize,  12, 12);          // DF003
+            arp->X        = (double)sbits(data, dataSize,  42, 38) * 0.0001; // DF025
+            arp->Y        = (double)sbits(data, dataSize,  80, 38) * 0.0001; // DF026
+            arp->Z        = (double)sbits(data, dataSize, 118, 38) * 0.0001; // DF027
             break;
         default:
             res = false;
@@ -312,57 +534,58 @@ bool rtcm3GetArp(const uint8_t *msg, RTCM3_ARP_t *arp)
 bool rtcm3GetAnt(const uint8_t *msg, RTCM3_ANT_t *ant)
 {
     memset(ant, 0, sizeof(*ant));
-    const uint8_t *data = &msg[RTCM3_HEAD_SIZE];
+    const uint8_t *data = RTCM3_DATA(msg);
+    const int dataSize = RTCM3_DATA_SIZE(msg);
 
-    const int msgType = bits(data, 0, 12); // DF002
+    const int msgType = bits(data, dataSize, 0, 12); // DF002
     bool res = true;
     if ( (msgType == 1007) || (msgType == 1008) || (msgType == 1033) )
     {
         int offs = 12;
-        ant->refStaId = bits(data, offs, 12);        // DF003
+        ant->refStaId = bits(data, dataSize, offs, 12);        // DF003
         offs += 12;
-        const int n   = bits(data, offs, 8);         // DF029
+        const int n   = bits(data, dataSize, offs, 8);         // DF029
         offs += 8;
         for (int ix = 0; (ix < n) && (ix < ((int)sizeof(ant->antDesc)-1)); ix++)
         {
-            ant->antDesc[ix] = bits(data, offs, 8);  // DF030
+            ant->antDesc[ix] = bits(data, dataSize, offs, 8);  // DF030
             offs += 8;
         }
-        ant->antSetupId = bits(data, offs, 8);       // DF031
+        ant->antSetupId = bits(data, dataSize, offs, 8);       // DF031
         offs += 8;
 
         if ( (msgType == 1008) || (msgType == 1033) )
         {
-            const int m = bits(data, offs, 8);           // DF032
+            const int m = bits(data, dataSize, offs, 8);           // DF032
             offs += 8;
             for (int ix = 0; (ix < m) && (ix < ((int)sizeof(ant->antSerial)-1)); ix++)
             {
-                ant->antSerial[ix] = bits(data, offs, 8);  // DF033
+                ant->antSerial[ix] = bits(data, dataSize, offs, 8);  // DF033
                 offs += 8;
             }
         }
 
         if ( msgType == 1033 )
         {
-            const int i = bits(data, offs, 8);           // DF227
+            const int i = bits(data, dataSize, offs, 8);           // DF227
             offs += 8;
             for (int ix = 0; (ix < i) && (ix < ((int)sizeof(ant->rxType)-1)); ix++)
             {
-                ant->rxType[ix] = bits(data, offs, 8);   // DF228
+                ant->rxType[ix] = bits(data, dataSize, offs, 8);   // DF228
                 offs += 8;
             }
-            const int j = bits(data, offs, 8);           // DF229
+            const int j = bits(data, dataSize, offs, 8);           // DF229
             offs += 8;
             for (int ix = 0; (ix < j) && (ix < ((int)sizeof(ant->rxFw)-1)); ix++)
             {
-                ant->rxFw[ix] = bits(data, offs, 8);     // DF230
+                ant->rxFw[ix] = bits(data, dataSize, offs, 8);     // DF230
                 offs += 8;
             }
-            const int k = bits(data, offs, 8);           // DF231
+            const int k = bits(data, dataSize, offs, 8);           // DF231
             offs += 8;
             for (int ix = 0; (ix < k) && (ix < ((int)sizeof(ant->rxSerial)-1)); ix++)
             {
-                ant->rxSerial[ix] = bits(data, offs, 8); // DF232
+                ant->rxSerial[ix] = bits(data, dataSize, offs, 8); // DF232
                 offs += 8;
             }
         }
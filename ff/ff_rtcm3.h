@@ -33,6 +33,9 @@ extern "C" {
 //! Get message type from message
 #define RTCM3_TYPE(msg) ( (((uint8_t *)(msg))[RTCM3_HEAD_SIZE + 0] << 4) | ((((uint8_t *)(msg))[RTCM3_HEAD_SIZE + 1] >> 4) & 0x0f) )
 
+//! Get payload size from message
+#define RTCM3_PAYLOAD_SIZE(msg) ( ((((uint8_t *)(msg))[1] & 0x03) << 8) | ((uint8_t *)(msg))[2] )
+
 //! Get sub-type for RTCM-4072 message
 #define RTCM3_4072_SUBTYPE(msg) ( (((uint8_t *)(msg))[RTCM3_HEAD_SIZE + 1] & 0x0f) | (((uint8_t *)(msg))[RTCM3_HEAD_SIZE + 2]) )
 
@@ -108,8 +111,46 @@ typedef struct RTCM3_MSM_HEADER_s
 
 } RTCM3_MSM_HEADER_t;
 
+//! Get MSM header from message types 1071-1127
 bool rtcm3GetMsmHeader(const uint8_t *msg, RTCM3_MSM_HEADER_t *header);
 
+#define RTCM3_MSM_MAX_CELLS 64 //!< Maximum number of cells (satellites x signals) in a MSM message
+
+//! RTCM3 MSM observation of one signal (cell)
+typedef struct RTCM3_MSM_CELL_s
+{
+    uint8_t  svId;           //!< Satellite ID (1-64, the position in DF394, e.g. 1 = G01, R01, E01, S120, J193, C01)
+    uint8_t  sigId;          //!< Signal ID (1-32, the position in DF395)
+    uint8_t  satIx;          //!< Index of the satellite in the message (0..numSat-1)
+    uint8_t  extInfo;        //!< Extended satellite info (MSM5 and MSM7 only, for GLONASS the frequency channel + 7)
+    bool     prValid;        //!< pseudoRange is valid
+    bool     cpValid;        //!< phaseRange is valid
+    bool     rrValid;        //!< phaseRangeRate is valid (MSM5 and MSM7 only)
+    bool     halfCycle;      //!< Half-cycle ambiguity indicator (DF420)
+    float    cno;            //!< Signal CNR [dBHz] (DF403 or DF408)
+    uint32_t lockTime;       //!< Minimum lock time [ms] (DF402 or DF407)
+    double   pseudoRange;    //!< Pseudorange [m] (DF397, DF398 and DF400 or DF405)
+    double   phaseRange;     //!< Phase range [m] (DF397, DF398 and DF401 or DF406)
+    double   phaseRangeRate; //!< Phase range rate [m/s] (DF399, DF404)
+} RTCM3_MSM_CELL_t;
+
+//! RTCM3 MSM message
+typedef struct RTCM3_MSM_s
+{
+    RTCM3_MSM_HEADER_t header;                         //!< Header
+    int                numCells;                       //!< Number of cells (signals)
+    RTCM3_MSM_CELL_t   cells[RTCM3_MSM_MAX_CELLS];     //!< Cells, in the order of the cell mask (by satellite and signal)
+} RTCM3_MSM_t;
+
+//! Get MSM observations from message types 1074-1077, ..., 1124-1127
+/*!
+    \param[in]   msg  The message (complete frame)
+    \param[out]  msm  The decoded message
+
+    \returns true if the message was a MSM4, MSM5, MSM6 or MSM7 message and was decoded successfully, false otherwise
+*/
+bool rtcm3GetMsm(const uint8_t *msg, RTCM3_MSM_t *msm);
+
 //! Antenna reference point
 typedef struct RTCM3_ARP_s
 {
@@ -0,0 +1,400 @@
+// flipflip's RTCM3 correction stream statistics
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "ff_stuff.h"
+#include "ff_rtcm3.h"
+#include "ff_time.h"
+
+#include "ff_rtcm3stats.h"
+
+/* ****************************************************************************************************************** */
+
+#define RTCM3_STATS_WEEK    (7.0 * 86400.0)  // GPS, Galileo, QZSS, SBAS and BeiDou time of week wraps
+#define RTCM3_STATS_DAY     86400.0          // GLONASS time of day wraps
+#define RTCM3_STATS_BDS     14.0             // BeiDou time = GPS time - 14 s
+#define RTCM3_STATS_GLO     10800.0          // GLONASS time = UTC + 3 h
+#define RTCM3_STATS_GAP     1.5              // Gap if there's no message for longer than this many periods
+#define RTCM3_STATS_SMOOTH  16.0             // Smoothing of running values (like RFC 3550 jitter)
+
+void rtcm3StatsInit(RTCM3_STATS_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+typedef enum RTCM3_STATS_TIME_e
+{
+    RTCM3_STATS_TIME_NONE = 0, // Message has no epoch time
+    RTCM3_STATS_TIME_GPS,      // GPS time of week (also Galileo, QZSS, SBAS)
+    RTCM3_STATS_TIME_BDS,      // BeiDou time of week
+    RTCM3_STATS_TIME_GLO,      // GLONASS time of day
+} RTCM3_STATS_TIME_t;
+
+// Relevant header fields of a message
+typedef struct RTCM3_STATS_INFO_s
+{
+    int                 msgType;
+    int                 subType;
+    int                 refStaId;
+    RTCM3_STATS_TIME_t  timeType;
+    double              time;
+    int                 numSat;
+    int                 numSig;
+    int                 numCell;
+} RTCM3_STATS_INFO_t;
+
+static bool _rtcm3StatsInfo(const PARSER_MSG_t *msg, RTCM3_STATS_INFO_t *info)
+{
+    memset(info, 0, sizeof(*info));
+    info->refStaId = -1;
+    const int payloadSize = msg->size - RTCM3_FRAME_SIZE;
+    if (payloadSize < 2)
+    {
+        return false;
+    }
+    const uint8_t *data = &msg->data[RTCM3_HEAD_SIZE];
+    info->msgType = RTCM3_TYPE(msg->data);
+
+    RTCM3_MSM_HEADER_t header;
+    if (rtcm3GetMsmHeader(msg->data, &header))
+    {
+        info->refStaId = header.refStaId;
+        switch (header.gnss)
+        {
+            case RTCM3_MSM_GNSS_GLO:
+                info->timeType = RTCM3_STATS_TIME_GLO;
+                info->time = fmod(header.gloTow, RTCM3_STATS_DAY); // DF416 day of week may be unknown (7)
+                break;
+            case RTCM3_MSM_GNSS_BDS:
+                info->timeType = RTCM3_STATS_TIME_BDS;
+                info->time = header.bdsTow;
+                break;
+            case RTCM3_MSM_GNSS_GPS:
+            case RTCM3_MSM_GNSS_SBAS:
+            case RTCM3_MSM_GNSS_GAL:
+            case RTCM3_MSM_GNSS_QZSS:
+                info->timeType = RTCM3_STATS_TIME_GPS;
+                info->time = header.anyTow;
+                break;
+        }
+        info->numSat  = header.numSat;
+        info->numSig  = header.numSig;
+        info->numCell = header.numCell;
+        return true;
+    }
+
+    switch (info->msgType)
+    {
+        // Legacy GPS observations: DF003 (uint12) station, DF004 (uint30) time of week [ms]
+        case 1001: case 1002: case 1003: case 1004:
+            if (payloadSize >= 7)
+            {
+                info->refStaId = ((data[1] & 0x0f) << 8) | data[2];
+                info->timeType = RTCM3_STATS_TIME_GPS;
+                info->time = (double)( ((uint32_t)data[3] << 22) | ((uint32_t)data[4] << 14) |
+                                       ((uint32_t)data[5] <<  6) | ((uint32_t)data[6] >>  2) ) * 1e-3;
+            }
+            break;
+        // Legacy GLONASS observations: DF003 (uint12) station, DF034 (uint27) time of day [ms]
+        case 1009: case 1010: case 1011: case 1012:
+            if (payloadSize >= 7)
+            {
+                info->refStaId = ((data[1] & 0x0f) << 8) | data[2];
+                info->timeType = RTCM3_STATS_TIME_GLO;
+                info->time = (double)( ((uint32_t)data[3] << 19) | ((uint32_t)data[4] << 11) |
+                                       ((uint32_t)data[5] <<  3) | ((uint32_t)data[6] >>  5) ) * 1e-3;
+            }
+            break;
+        // Station and antenna information, GLONASS biases: DF003 (uint12) station
+        case 1005: case 1006: case 1007: case 1008: case 1033: case 1230:
+            if (payloadSize >= 3)
+            {
+                info->refStaId = ((data[1] & 0x0f) << 8) | data[2];
+            }
+            break;
+        // u-blox proprietary
+        case 4072:
+            if (payloadSize >= 3)
+            {
+                info->subType = RTCM3_4072_SUBTYPE(msg->data);
+            }
+            break;
+    }
+    return true;
+}
+
+// Wrap time difference to +/- half the period
+static double _rtcm3StatsWrap(double dt, const double period)
+{
+    if (dt >= (0.5 * period))
+    {
+        dt -= period;
+    }
+    else if (dt < (-0.5 * period))
+    {
+        dt += period;
+    }
+    return dt;
+}
+
+// Compare entry to message
+static int _rtcm3StatsCmp(const RTCM3_STATS_TYPE_t *type, const RTCM3_STATS_INFO_t *info)
+{
+    if (type->msgType != info->msgType)
+    {
+        return (int)type->msgType - info->msgType;
+    }
+    if (type->subType != info->subType)
+    {
+        return (int)type->subType - info->subType;
+    }
+    return type->refStaId - info->refStaId;
+}
+
+// Find entry for message, or add a new one, NULL if the table is full
+static RTCM3_STATS_TYPE_t *_rtcm3StatsGetType(RTCM3_STATS_t *stats, const RTCM3_STATS_INFO_t *info)
+{
+    int ix = 0;
+    while (ix < stats->numTypes)
+    {
+        const int cmp = _rtcm3StatsCmp(&stats->types[ix], info);
+        if (cmp == 0)
+        {
+            return &stats->types[ix];
+        }
+        else if (cmp > 0)
+        {
+            break;
+        }
+        ix++;
+    }
+    if (stats->numTypes >= RTCM3_STATS_MAX_TYPES)
+    {
+        return NULL;
+    }
+    memmove(&stats->types[ix + 1], &stats->types[ix], (stats->numTypes - ix) * sizeof(stats->types[0]));
+    stats->numTypes++;
+    RTCM3_STATS_TYPE_t *type = &stats->types[ix];
+    memset(type, 0, sizeof(*type));
+    type->msgType  = info->msgType;
+    type->subType  = info->subType;
+    type->refStaId = info->refStaId;
+    return type;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool rtcm3StatsAdd(RTCM3_STATS_t *stats, const PARSER_MSG_t *msg, const uint64_t tsNs, const double posixTime)
+{
+    RTCM3_STATS_INFO_t info;
+    if ( (msg->type != PARSER_MSGTYPE_RTCM3) || !_rtcm3StatsInfo(msg, &info) )
+    {
+        return false;
+    }
+    RTCM3_STATS_TYPE_t *type = _rtcm3StatsGetType(stats, &info);
+    if (type == NULL)
+    {
+        stats->numDropped++;
+        return false;
+    }
+
+    // Totals
+    stats->count++;
+    stats->bytes += msg->size;
+    if (tsNs > 0)
+    {
+        if (stats->firstNs == 0)
+        {
+            stats->firstNs = tsNs;
+        }
+        stats->lastNs = tsNs;
+    }
+
+    // Count and size
+    type->count++;
+    type->bytes += msg->size;
+    type->size = type->count > 1 ? type->size + (((double)msg->size - type->size) / RTCM3_STATS_SMOOTH) : (double)msg->size;
+
+    // Epoch time, period and gaps. Messages with the same epoch time (multiple message bit) belong to the same epoch.
+    bool haveDtTime = false;
+    double dtTime = 0.0;
+    if (info.timeType != RTCM3_STATS_TIME_NONE)
+    {
+        if (type->haveTime)
+        {
+            const double period = info.timeType == RTCM3_STATS_TIME_GLO ? RTCM3_STATS_DAY : RTCM3_STATS_WEEK;
+            dtTime = _rtcm3StatsWrap(info.time - type->lastTime, period);
+            haveDtTime = (dtTime >= 0.0);
+            if (dtTime > 0.0)
+            {
+                if ( (type->period > 0.0) && (dtTime > (RTCM3_STATS_GAP * type->period)) )
+                {
+                    type->numGaps++;
+                    type->numMissing += (uint32_t)lround(dtTime / type->period) - 1;
+                }
+                if ( (type->period <= 0.0) || (dtTime < type->period) )
+                {
+                    type->period = dtTime;
+                }
+            }
+        }
+        if (!haveDtTime || (dtTime > 0.0))
+        {
+            type->numEpochs++;
+        }
+        type->haveTime = true;
+        type->lastTime = info.time;
+    }
+
+    // Interval and jitter, from arrival time if available, from the epoch time otherwise
+    double dt = -1.0;
+    if ( (tsNs > 0) && (type->lastNs > 0) && (tsNs >= type->lastNs) )
+    {
+        dt = (double)(tsNs - type->lastNs) * 1e-9;
+    }
+    else if ( (tsNs == 0) && haveDtTime )
+    {
+        dt = dtTime;
+    }
+    if (dt >= 0.0)
+    {
+        if (type->numIntervals > 0)
+        {
+            // Transit time difference if there is an epoch time (RFC 3550), interval difference otherwise
+            const double d = (haveDtTime && (tsNs > 0)) ? dt - dtTime : dt - type->interval;
+            type->jitter += (fabs(d) - type->jitter) / RTCM3_STATS_SMOOTH;
+
+            // Gaps for messages without epoch time
+            if ( (info.timeType == RTCM3_STATS_TIME_NONE) && (type->interval > 0.0) &&
+                 (dt > (RTCM3_STATS_GAP * type->interval)) )
+            {
+                type->numGaps++;
+                type->numMissing += (uint32_t)lround(dt / type->interval) - 1;
+            }
+
+            type->interval += (dt - type->interval) / RTCM3_STATS_SMOOTH;
+            type->intervalMin = MIN(type->intervalMin, dt);
+            type->intervalMax = MAX(type->intervalMax, dt);
+        }
+        else
+        {
+            type->interval    = dt;
+            type->intervalMin = dt;
+            type->intervalMax = dt;
+        }
+        type->numIntervals++;
+    }
+    if (tsNs > 0)
+    {
+        type->lastNs = tsNs;
+    }
+
+    // Age: arrival time minus epoch time
+    if ( (posixTime > 0.0) && (info.timeType != RTCM3_STATS_TIME_NONE) )
+    {
+        const double gpsTow = fmod(posix2ts(posixTime, 0, false), RTCM3_STATS_WEEK);
+        double age = 0.0;
+        switch (info.timeType)
+        {
+            case RTCM3_STATS_TIME_GPS:
+                age = _rtcm3StatsWrap(gpsTow - info.time, RTCM3_STATS_WEEK);
+                break;
+            case RTCM3_STATS_TIME_BDS:
+                age = _rtcm3StatsWrap(gpsTow - RTCM3_STATS_BDS - info.time, RTCM3_STATS_WEEK);
+                break;
+            case RTCM3_STATS_TIME_GLO:
+                age = _rtcm3StatsWrap(fmod(posixTime + RTCM3_STATS_GLO, RTCM3_STATS_DAY) - info.time, RTCM3_STATS_DAY);
+                break;
+            case RTCM3_STATS_TIME_NONE:
+                break;
+        }
+        type->ageMin = type->numAge > 0 ? MIN(type->ageMin, age) : age;
+        type->ageMax = type->numAge > 0 ? MAX(type->ageMax, age) : age;
+        type->ageLast = age;
+        type->ageSum += age;
+        type->numAge++;
+    }
+
+    // MSM size
+    type->numSat  = info.numSat;
+    type->numSig  = info.numSig;
+    type->numCell = info.numCell;
+
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+double rtcm3StatsRate(const RTCM3_STATS_TYPE_t *type)
+{
+    return type->interval > 0.0 ? 1.0 / type->interval : 0.0;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+double rtcm3StatsByteRate(const RTCM3_STATS_TYPE_t *type)
+{
+    return type->size * rtcm3StatsRate(type);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+int rtcm3StatsName(const RTCM3_STATS_TYPE_t *type, char *str, const int size)
+{
+    if (type->msgType == 4072)
+    {
+        return snprintf(str, size, "%u.%u", type->msgType, type->subType);
+    }
+    else
+    {
+        return snprintf(str, size, "%u", type->msgType);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+int rtcm3StatsStr(const RTCM3_STATS_TYPE_t *type, char *str, const int size)
+{
+    int len = snprintf(str, size, "count=%u rate=%.2fHz bytes=%.0fB/s interval=%.3f/%.3f/%.3fs jitter=%.3fs",
+        type->count, rtcm3StatsRate(type), rtcm3StatsByteRate(type),
+        type->intervalMin, type->interval, type->intervalMax, type->jitter);
+    if ( (len < size) && type->haveTime )
+    {
+        len += snprintf(&str[len], size - len, " period=%.3fs epochs=%u", type->period, type->numEpochs);
+    }
+    if (len < size)
+    {
+        len += snprintf(&str[len], size - len, " gaps=%u missing=%u", type->numGaps, type->numMissing);
+    }
+    if ( (len < size) && (type->numAge > 0) )
+    {
+        len += snprintf(&str[len], size - len, " age=%.3f/%.3f/%.3f/%.3fs",
+            type->ageLast, type->ageMin, type->ageSum / (double)type->numAge, type->ageMax);
+    }
+    if ( (len < size) && (type->numCell > 0) )
+    {
+        len += snprintf(&str[len], size - len, " sat=%d sig=%d cell=%d", type->numSat, type->numSig, type->numCell);
+    }
+    return len;
+}
+
+/* ****************************************************************************************************************** */
+// eof
@@ -0,0 +1,118 @@
+// flipflip's RTCM3 correction stream statistics
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+//
+// Streaming statistics of RTCM3 messages (e.g. from a base station or a NTRIP caster) per message type
+// and reference station: message and byte rate, arrival jitter, age (arrival time minus epoch time of
+// the message), and gaps (missing epochs). The statistics are running values (no history is kept), so
+// memory and CPU use are constant.
+
+#ifndef __FF_RTCM3STATS_H__
+#define __FF_RTCM3STATS_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "ff_parser.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ****************************************************************************************************************** */
+
+#define RTCM3_STATS_MAX_TYPES  64  //!< Maximum number of message types (incl. reference station and sub-type)
+
+//! Statistics of one message type
+typedef struct RTCM3_STATS_TYPE_s
+{
+    uint16_t  msgType;      //!< Message type (DF002)
+    uint16_t  subType;      //!< Sub-type (4072 only, 0 otherwise)
+    int       refStaId;     //!< Reference station ID (DF003), -1 if the message has none
+
+    uint32_t  count;        //!< Number of messages
+    uint64_t  bytes;        //!< Number of bytes (incl. frame)
+    double    size;         //!< Smoothed message size [bytes]
+
+    uint64_t  lastNs;       //!< Arrival time of the last message [ns], 0 if unknown
+    uint32_t  numIntervals; //!< Number of intervals
+    double    interval;     //!< Smoothed interval between messages [s], 0 if unknown (yet)
+    double    intervalMin;  //!< Smallest interval [s]
+    double    intervalMax;  //!< Largest interval [s]
+    double    jitter;       //!< Interarrival jitter (RFC 3550 style) [s]
+
+    bool      haveTime;     //!< Message has an epoch time (MSM and legacy observations), lastTime is valid
+    double    lastTime;     //!< Epoch time of the last message (time of week, for GLONASS time of day) [s]
+    double    period;       //!< Epoch period (smallest difference of consecutive epoch times) [s], 0 if unknown
+    uint32_t  numEpochs;    //!< Number of epochs (messages with a new epoch time)
+    uint32_t  numGaps;      //!< Number of gaps (no message for more than 1.5 periods or intervals)
+    uint32_t  numMissing;   //!< Estimated number of missing epochs (or messages) in the gaps
+
+    uint32_t  numAge;       //!< Number of age values
+    double    ageLast;      //!< Age of the last message [s]
+    double    ageMin;       //!< Smallest age [s]
+    double    ageMax;       //!< Largest age [s]
+    double    ageSum;       //!< Sum of all ages [s]
+
+    int       numSat;       //!< Number of satellites in the last message (MSM only)
+    int       numSig;       //!< Number of signals in the last message (MSM only)
+    int       numCell;      //!< Number of cells in the last message (MSM only)
+} RTCM3_STATS_TYPE_t;
+
+//! RTCM3 stream statistics
+typedef struct RTCM3_STATS_s
+{
+    RTCM3_STATS_TYPE_t types[RTCM3_STATS_MAX_TYPES]; //!< Statistics per type, sorted by type, sub-type and station
+    int       numTypes;     //!< Number of types
+    uint32_t  count;        //!< Total number of messages
+    uint64_t  bytes;        //!< Total number of bytes
+    uint64_t  firstNs;      //!< Arrival time of the first message [ns], 0 if unknown
+    uint64_t  lastNs;       //!< Arrival time of the last message [ns], 0 if unknown
+    uint32_t  numDropped;   //!< Number of messages not in types[] because it was full
+} RTCM3_STATS_t;
+
+//! Initialise (clear) statistics
+void rtcm3StatsInit(RTCM3_STATS_t *stats);
+
+//! Add message
+/*!
+    \param[in,out]  stats      statistics
+    \param[in]      msg        message from the parser (other than RTCM3 messages are ignored)
+    \param[in]      tsNs       arrival time of the message [ns] (e.g. PARSER_MSG_t.tsNs), 0 if unknown
+    \param[in]      posixTime  arrival time of the message [s] (e.g. posixNow()), 0.0 if unknown (no age)
+
+    \returns true if the message was added, false otherwise (not RTCM3, or too many types)
+
+    \note Without arrival time the rate and jitter are derived from the epoch times of the messages, if any.
+*/
+bool rtcm3StatsAdd(RTCM3_STATS_t *stats, const PARSER_MSG_t *msg, const uint64_t tsNs, const double posixTime);
+
+//! Get message rate [Hz], 0.0 if unknown
+double rtcm3StatsRate(const RTCM3_STATS_TYPE_t *type);
+
+//! Get byte rate [bytes/s], 0.0 if unknown
+double rtcm3StatsByteRate(const RTCM3_STATS_TYPE_t *type);
+
+//! Get message name, e.g. "1077", "4072.0"
+int rtcm3StatsName(const RTCM3_STATS_TYPE_t *type, char *str, const int size);
+
+//! Stringify statistics of one message type ("count=... rate=... bytes=... interval=min/mean/max ... age=last/min/mean/max ...")
+int rtcm3StatsStr(const RTCM3_STATS_TYPE_t *type, char *str, const int size);
+
+/* ****************************************************************************************************************** */
+#ifdef __cplusplus
+}
+#endif
+#endif // __FF_RTCM3STATS_H__
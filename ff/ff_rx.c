@@ -20,12 +20,15 @@
 #include <stdlib.h>
 #include <ctype.h>
 #include <unistd.h>
+#include <errno.h>
+#include <pthread.h>
 
 #include "ff_debug.h"
 #include "ff_stuff.h"
 #include "ff_ubx.h"
 #include "ff_parser.h"
 #include "ff_port.h"
+#include "ff_trace.h"
 #include "ff_rx.h"
 
 /* ****************************************************************************************************************** */
@@ -40,9 +43,9 @@
 
 #define RX_PRINT(fmt, ...)   if (rx->verbose) { PRINT("%s: " fmt, rx->name, ## __VA_ARGS__); }
 #define RX_WARNING(fmt, ...) WARNING("%s: " fmt, rx->name, ## __VA_ARGS__)
-#define RX_DEBUG(fmt, ...)   DEBUG(  "%s: " fmt, rx->name, ## __VA_ARGS__)
-#define RX_TRACE(fmt, ...)   TRACE(  "%s: " fmt, rx->name, ## __VA_ARGS__)
-#define RX_TRACE_HD(data, size, fmt, ...) TRACE_HEXDUMP(data, size, "%s: " fmt, rx->name, ## __VA_ARGS__)
+#define RX_DEBUG(fmt, ...)   do { if (isDEBUG()) { DEBUG("%s: " fmt, rx->name, ## __VA_ARGS__); } } while (0)
+#define RX_TRACE(fmt, ...)   do { if (isTRACE()) { TRACE("%s: " fmt, rx->name, ## __VA_ARGS__); } } while (0)
+#define RX_TRACE_HD(data, size, fmt, ...) do { if (isTRACE()) { TRACE_HEXDUMP(data, size, "%s: " fmt, rx->name, ## __VA_ARGS__); } } while (0)
 
 // ---------------------------------------------------------------------------------------------------------------------
 
@@ -54,6 +57,9 @@ typedef struct RX_s
     uint8_t      pollBuf[PARSER_MAX_ANY_SIZE];
     PARSER_MSG_t msg;
     char         name[100];
+    char         verStr[100];
+    const char  *autobaudHow; // Strategy that found the baudrate
+    uint32_t     autobaudDur; // Duration of autobaud [ms]
     bool         verbose;
     bool         autobaud;
     bool         detect;
@@ -85,17 +91,17 @@ RX_t *rxInit(const char *port, const RX_ARGS_t *args)
         rx->detect   = rxArgs->detect;
         rx->autobaud = rxArgs->autobaud; // but see below
         static int instCnt;
+        const int inst = __atomic_fetch_add(&instCnt, 1, __ATOMIC_RELAXED); // rxFleetRun() may call us from several threads
         if ( (rxArgs->name != NULL) && (rxArgs->name[0] != '\0') )
         {
             snprintf(rx->name, sizeof(rx->name), "%s", rxArgs->name);
         }
         else
         {
-            snprintf(rx->name, sizeof(rx->name), "rx%d", instCnt);
+            snprintf(rx->name, sizeof(rx->name), "rx%d", inst);
         }
         rx->msgcb = rxArgs->msgcb;
         rx->cbarg = rxArgs->cbarg;
-        instCnt++;
     }
     RX_PRINT("Connecting to receiver at port %s", port);
 
@@ -144,15 +150,9 @@ bool rxOpen(RX_t *rx)
 
 static bool _rxOpenDetect(RX_t *rx)
 {
-    // Quick first try, which may just work..
-    char verStr[100];
-    if (rxGetVerStr(rx, verStr, sizeof(verStr)))
-    {
-        RX_PRINT("Receiver detected: %s", verStr);
-        return true;
-    }
+    rx->verStr[0] = '\0';
 
-    // Try different baudrates
+    // Autobaud tries the current baudrate first and gets the version, too
     if (rx->autobaud)
     {
         if (!rxAutobaud(rx))
@@ -160,30 +160,17 @@ static bool _rxOpenDetect(RX_t *rx)
             RX_WARNING("Failed autobauding!");
             return false;
         }
-        if (!rx->detect) // unless we print below
-        {
-            RX_PRINT("Receiver detected at baudrate %d", rxGetBaudrate(rx));
-        }
+        RX_PRINT("Receiver detected at baudrate %d (%s, %ums): %s",
+            rxGetBaudrate(rx), rx->autobaudHow, rx->autobaudDur, rx->verStr);
+        return true;
     }
 
-    // And check again
-    if (rx->detect)
+    if (!rxGetVerStr(rx, rx->verStr, sizeof(rx->verStr)))
     {
-        if (!rxGetVerStr(rx, verStr, sizeof(verStr)))
-        {
-            RX_WARNING("Could not detect receiver!");
-            return false;
-        }
-        RX_DEBUG("Receiver detected: %s", verStr);
-        if (rx->autobaud)
-        {
-            RX_PRINT("Receiver detected at baudrate %d: %s", rxGetBaudrate(rx), verStr);
-        }
-        else
-        {
-            RX_PRINT("Receiver detected: %s", verStr);
-        }
+        RX_WARNING("Could not detect receiver!");
+        return false;
     }
+    RX_PRINT("Receiver detected: %s", rx->verStr);
     return true;
 }
 
@@ -263,13 +250,14 @@ int rxGetBaudrate(RX_t *rx)
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-bool rxSetBaudrate(RX_t *rx, const int baudrate)
+PORT_STATE_t rxGetPortState(RX_t *rx)
 {
-    if (rx != NULL)
-    {
-        return portSetBaudrate(&rx->port, baudrate);
-    }
-    return false;
+    return rx != NULL ? portGetState(&rx->port) : PORT_STATE_CLOSED;
+}
+
+bool rxGetPortStats(RX_t *rx, PORT_STATS_t *stats)
+{
+    return rx != NULL ? portGetStats(&rx->port, stats) : false;
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -282,7 +270,7 @@ PARSER_MSG_t *rxGetNextMessage(RX_t *rx)
         int readSize;
         while ( !rx->abort && portRead(&rx->port, rx->readBuf, sizeof(rx->readBuf), &readSize) && (readSize > 0) )
         {
-            parserAdd(&rx->parser, rx->readBuf, readSize);
+            parserAddTs(&rx->parser, rx->readBuf, readSize, rx->port.rxTs);
         }
 
         if (parserProcess(&rx->parser, &rx->msg, true))
@@ -346,6 +334,7 @@ PARSER_MSG_t *rxPollUbx(RX_t *rx, const RX_POLL_UBX_t *param, bool *pollNak)
     {
         RX_DEBUG("poll %s, size %d, timeout=%d, isUbxCfg=%d, attempt %d/%d.",
             pollName, pollSize, timeout, attempt, isUbxCfg, retries);
+        TRACE_EVENT(TRACE_EV_RX_POLL_BEGIN, ((uint32_t)param->clsId << 8) | param->msgId, attempt, retries);
 
         // Send request
         if (!rxSend(rx, rx->pollBuf, pollSize))
@@ -395,6 +384,8 @@ PARSER_MSG_t *rxPollUbx(RX_t *rx, const RX_POLL_UBX_t *param, bool *pollNak)
             }
         }
 
+        TRACE_EVENT(TRACE_EV_RX_POLL_END, ((uint32_t)param->clsId << 8) | param->msgId,
+            res != NULL ? 1 : (_pollNak ? 2 : 0), 0);
         if (res != NULL)
         {
             break;
@@ -531,87 +522,350 @@ static bool _rxFlushTx(RX_t *rx)
     return rxSend(rx, flushSeq, sizeof(flushSeq));
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+
+#define RX_BAUDCACHE_SIZE 50
+
+typedef struct RX_BAUDCACHE_s
+{
+    char key[PORT_SPEC_MAX_LEN + 20];
+    int  baudrate;
+} RX_BAUDCACHE_t;
+
+static RX_BAUDCACHE_t   gBaudCache[RX_BAUDCACHE_SIZE];
+static int              gBaudCacheNum;
+static pthread_mutex_t  gBaudCacheMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void _rxBaudCacheKey(const PORT_t *port, char *key, const int size)
+{
+    switch (port->type)
+    {
+        case PORT_TYPE_SER:    snprintf(key, size, "ser://%s", port->file);                break;
+        case PORT_TYPE_TCP:    snprintf(key, size, "tcp://%s:%u", port->file, port->port);    break;
+        case PORT_TYPE_TELNET: snprintf(key, size, "telnet://%s:%u", port->file, port->port); break;
+    }
+}
+
+// Add or update entry, most recently used first
+static void _rxBaudCacheSet(const char *key, const int baudrate)
+{
+    pthread_mutex_lock(&gBaudCacheMutex);
+    int ix = 0;
+    while ( (ix < gBaudCacheNum) && (strcmp(gBaudCache[ix].key, key) != 0) )
+    {
+        ix++;
+    }
+    if (ix >= gBaudCacheNum) // not found: add, or drop the oldest
+    {
+        ix = MIN(gBaudCacheNum, RX_BAUDCACHE_SIZE - 1);
+        gBaudCacheNum = MIN(gBaudCacheNum + 1, RX_BAUDCACHE_SIZE);
+    }
+    memmove(&gBaudCache[1], &gBaudCache[0], ix * sizeof(*gBaudCache));
+    snprintf(gBaudCache[0].key, sizeof(gBaudCache[0].key), "%s", key);
+    gBaudCache[0].baudrate = baudrate;
+    pthread_mutex_unlock(&gBaudCacheMutex);
+}
+
+static int _rxBaudCacheGet(const char *key)
+{
+    int baudrate = 0;
+    pthread_mutex_lock(&gBaudCacheMutex);
+    for (int ix = 0; ix < gBaudCacheNum; ix++)
+    {
+        if (strcmp(gBaudCache[ix].key, key) == 0)
+        {
+            baudrate = gBaudCache[ix].baudrate;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&gBaudCacheMutex);
+    return baudrate;
+}
+
+bool rxSetBaudrate(RX_t *rx, const int baudrate)
+{
+    if ( (rx != NULL) && portSetBaudrate(&rx->port, baudrate) )
+    {
+        if (portCanBaudrate(&rx->port))
+        {
+            char key[sizeof(gBaudCache[0].key)];
+            _rxBaudCacheKey(&rx->port, key, sizeof(key));
+            _rxBaudCacheSet(key, baudrate);
+        }
+        return true;
+    }
+    return false;
+}
+
+bool rxBaudrateCacheLoad(const char *file)
+{
+    FILE *f = file != NULL ? fopen(file, "r") : NULL;
+    if (f == NULL)
+    {
+        return false;
+    }
+    // Oldest last in file
+    char line[sizeof(gBaudCache[0].key) + 20];
+    RX_BAUDCACHE_t entries[RX_BAUDCACHE_SIZE];
+    int nEntries = 0;
+    while ( (nEntries < NUMOF(entries)) && (fgets(line, sizeof(line), f) != NULL) )
+    {
+        char *sep = strrchr(line, ' ');
+        if (sep == NULL)
+        {
+            continue;
+        }
+        *sep = '\0';
+        const int baudrate = atoi(&sep[1]);
+        if ( (line[0] != '\0') && (baudrate > 0) && (strlen(line) < sizeof(entries[nEntries].key)) )
+        {
+            memcpy(entries[nEntries].key, line, strlen(line) + 1);
+            entries[nEntries].baudrate = baudrate;
+            nEntries++;
+        }
+    }
+    fclose(f);
+    for (int ix = nEntries - 1; ix >= 0; ix--)
+    {
+        _rxBaudCacheSet(entries[ix].key, entries[ix].baudrate);
+    }
+    DEBUG("rxBaudrateCacheLoad() %s: %d entries", file, nEntries);
+    return true;
+}
+
+bool rxBaudrateCacheSave(const char *file)
+{
+    FILE *f = file != NULL ? fopen(file, "w") : NULL;
+    if (f == NULL)
+    {
+        return false;
+    }
+    pthread_mutex_lock(&gBaudCacheMutex);
+    for (int ix = 0; ix < gBaudCacheNum; ix++)
+    {
+        fprintf(f, "%s %d\n", gBaudCache[ix].key, gBaudCache[ix].baudrate);
+    }
+    DEBUG("rxBaudrateCacheSave() %s: %d entries", file, gBaudCacheNum);
+    pthread_mutex_unlock(&gBaudCacheMutex);
+    return fclose(f) == 0;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+#define RX_AUTOBAUD_MAX_CAND 10
+
+typedef struct RX_AUTOBAUD_CAND_s
+{
+    int       baudrate;
+    uint32_t  sValid;    // Bytes in valid frames received while listening
+    uint32_t  sGarbage;  // Bytes not in valid frames (framing errors, wrong baudrate) received while listening
+    bool      polled;    // Poll attempted (in the quick phase)
+} RX_AUTOBAUD_CAND_t;
+
+// Rank: valid frames first, then silent baudrates, finally the ones with garbage only
+static int _rxAutobaudScore(const RX_AUTOBAUD_CAND_t *cand)
+{
+    if (cand->sValid > 0)
+    {
+        return 2;
+    }
+    else if (cand->sGarbage == 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+// Poll receiver version at the current baudrate (and keep it)
+static bool _rxAutobaudPoll(RX_t *rx, const uint32_t timeout, const int retries)
+{
+    RX_POLL_UBX_t pollParam = { .clsId = UBX_MON_CLSID, .msgId = UBX_MON_VER_MSGID, .retries = retries, .timeout = timeout };
+    PARSER_MSG_t *ubxMonVer = rxPollUbx(rx, &pollParam, NULL);
+    if (ubxMonVer == NULL)
+    {
+        return false;
+    }
+    _rxCallbackMsg(rx, ubxMonVer);
+    if (!ubxMonVerToVerStr(rx->verStr, sizeof(rx->verStr), ubxMonVer->data, ubxMonVer->size))
+    {
+        rx->verStr[0] = '?';
+        rx->verStr[1] = '\0';
+    }
+    return true;
+}
+
+// Listen at the current baudrate and collect statistics on the received data
+static void _rxAutobaudListen(RX_t *rx, RX_AUTOBAUD_CAND_t *cand, const uint32_t duration)
+{
+    const uint32_t t1 = TIME() + duration;
+    while ( !rx->abort && (TIME() < t1) )
+    {
+        PARSER_MSG_t *msg = rxGetNextMessage(rx);
+        if (msg == NULL)
+        {
+            SLEEP(10);
+            continue;
+        }
+        if (msg->type == PARSER_MSGTYPE_GARBAGE)
+        {
+            cand->sGarbage += msg->size;
+        }
+        else
+        {
+            cand->sValid += msg->size;
+            _rxCallbackMsg(rx, msg);
+            // One valid message is good enough
+            break;
+        }
+    }
+}
+
 bool rxAutobaud(RX_t *rx)
 {
     if (rx == NULL)
     {
         return false;
     }
+    if (!portCanBaudrate(&rx->port))
+    {
+        rx->autobaudHow = "n/a";
+        rx->autobaudDur = 0;
+        return _rxAutobaudPoll(rx, 0, 0);
+    }
 
-    int baudrate = 0;
+    const uint32_t t0 = TIME();
+    char key[sizeof(gBaudCache[0].key)];
+    _rxBaudCacheKey(&rx->port, key, sizeof(key));
+    const int specBaudrate = rx->port.specBaudrate;
+    const int cachedBaudrate = specBaudrate > 0 ? 0 : _rxBaudCacheGet(key);
     const int currentBaudrate = rxGetBaudrate(rx);
-    int baudrates[] = { currentBaudrate, 9600, 38400, 115200, 230400, 460800, 921600 };
-    PARSER_MSG_t *ubxMonVer = NULL;
+    const char *firstHow = specBaudrate > 0 ? "spec" : (cachedBaudrate > 0 ? "cached" : "current");
 
-    // First, try quickly..
+    // Candidates: baudrate given in the port spec or last known baudrate, current baudrate, common baudrates
+    RX_AUTOBAUD_CAND_t cands[RX_AUTOBAUD_MAX_CAND];
+    int nCands = 0;
     {
-        RX_POLL_UBX_t pollParam = { .clsId = UBX_MON_CLSID, .msgId = UBX_MON_VER_MSGID, .retries = 1, .timeout = 1000 };
-        for (int ix = 0; !rx->abort && (ix < NUMOF(baudrates)); ix++)
+        const int baudrates[] = { specBaudrate > 0 ? specBaudrate : cachedBaudrate, currentBaudrate,
+            9600, 38400, 115200, 230400, 460800, 921600 };
+        for (int ix = 0; ix < NUMOF(baudrates); ix++)
         {
-            if ( (ix > 0) && (baudrates[ix] == currentBaudrate) )
+            bool dupe = (baudrates[ix] <= 0);
+            for (int ix2 = 0; !dupe && (ix2 < nCands); ix2++)
             {
-                continue;
-            }
-            if (!rxSetBaudrate(rx, baudrates[ix]))
-            {
-                continue;
+                dupe = (cands[ix2].baudrate == baudrates[ix]);
             }
-            RX_DEBUG("autobaud %d (quick)", baudrates[ix]);
-            ubxMonVer = rxPollUbx(rx, &pollParam, NULL);
-            if (ubxMonVer != NULL)
+            if (!dupe)
             {
-                _rxCallbackMsg(rx, ubxMonVer);
-                baudrate = baudrates[ix];
-                break;
+                memset(&cands[nCands], 0, sizeof(cands[nCands]));
+                cands[nCands].baudrate = baudrates[ix];
+                nCands++;
             }
         }
     }
-    // Try harder
-    if (baudrate == 0)
+
+    int baudrate = 0;
+    const char *how = NULL;
+
+    // 1. Quickly try the given, last known (or current) baudrate, which usually works
+    if (portSetBaudrate(&rx->port, cands[0].baudrate))
     {
-        RX_POLL_UBX_t pollParam = { .clsId = UBX_MON_CLSID, .msgId = UBX_MON_VER_MSGID, .retries = 2, .timeout = 2500 };
-        for (int ix = 0; !rx->abort && (ix < NUMOF(baudrates)); ix++)
+        RX_DEBUG("autobaud %d (%s)", cands[0].baudrate, firstHow);
+        cands[0].polled = true;
+        if (_rxAutobaudPoll(rx, 500 + (3000 * 1000 / cands[0].baudrate), 1))
         {
-            if ( (ix > 0) && (baudrates[ix] == currentBaudrate) )
-            {
-                continue;
-            }
-            if (!rxSetBaudrate(rx, baudrates[ix]))
-            {
-                continue;
-            }
-            RX_DEBUG("autobaud %d (flush rx/tx)", baudrates[ix]);
-            _rxFlushRx(rx);
-            _rxFlushTx(rx);
-            ubxMonVer = rxPollUbx(rx, &pollParam, NULL);
-            if (ubxMonVer != NULL)
+            baudrate = cands[0].baudrate;
+            how = firstHow;
+        }
+    }
+
+    // 2. Listen at the other baudrates, stop at the first one with valid messages and poll there
+    for (int ix = 1; (baudrate == 0) && !rx->abort && (ix < nCands); ix++)
+    {
+        if (!portSetBaudrate(&rx->port, cands[ix].baudrate))
+        {
+            continue;
+        }
+        // Long enough to see a complete NMEA message (or a bunch of bytes, if it's the wrong baudrate)
+        const uint32_t duration = 50 + (1000 * 1000 / cands[ix].baudrate);
+        _rxAutobaudListen(rx, &cands[ix], duration);
+        RX_DEBUG("autobaud %d (listen %ums): valid %u, garbage %u", cands[ix].baudrate, duration,
+            cands[ix].sValid, cands[ix].sGarbage);
+        if (cands[ix].sValid > 0)
+        {
+            cands[ix].polled = true;
+            if (_rxAutobaudPoll(rx, 500 + (3000 * 1000 / cands[ix].baudrate), 2))
             {
-                _rxCallbackMsg(rx, ubxMonVer);
-                baudrate = baudrates[ix];
-                break;
+                baudrate = cands[ix].baudrate;
+                how = "listen";
             }
         }
     }
 
-    if ( !rx->abort && (baudrate != 0) )
+    // Rank the candidates (stable, keeps the initial order for equal scores)
+    for (int ix = 1; ix < nCands; ix++)
+    {
+        const RX_AUTOBAUD_CAND_t cand = cands[ix];
+        int ix2 = ix - 1;
+        while ( (ix2 >= 0) && (_rxAutobaudScore(&cands[ix2]) < _rxAutobaudScore(&cand)) )
+        {
+            cands[ix2 + 1] = cands[ix2];
+            ix2--;
+        }
+        cands[ix2 + 1] = cand;
+    }
+
+    // 3. Poll at the remaining (silent, or garbage) baudrates, the receiver may have no output enabled
+    for (int ix = 0; (baudrate == 0) && !rx->abort && (ix < nCands); ix++)
+    {
+        if (cands[ix].polled || !portSetBaudrate(&rx->port, cands[ix].baudrate))
+        {
+            continue;
+        }
+        RX_DEBUG("autobaud %d (quick)", cands[ix].baudrate);
+        // Enough for a UBX-MON-VER response at this baudrate
+        if (_rxAutobaudPoll(rx, 200 + (3000 * 1000 / cands[ix].baudrate), 1))
+        {
+            baudrate = cands[ix].baudrate;
+            how = "quick";
+        }
+    }
+
+    // 4. Try harder
+    for (int ix = 0; (baudrate == 0) && !rx->abort && (ix < nCands); ix++)
     {
-        char verStr[100];
-        if (!ubxMonVerToVerStr(verStr, sizeof(verStr), ubxMonVer->data, ubxMonVer->size))
+        if (!portSetBaudrate(&rx->port, cands[ix].baudrate))
+        {
+            continue;
+        }
+        RX_DEBUG("autobaud %d (flush rx/tx)", cands[ix].baudrate);
+        _rxFlushRx(rx);
+        _rxFlushTx(rx);
+        if (_rxAutobaudPoll(rx, 2500, 2))
         {
-            verStr[0] = '?';
-            verStr[1] = '\0';
+            baudrate = cands[ix].baudrate;
+            how = "thorough";
         }
-        RX_DEBUG("autobaud %d success: %s", baudrate, verStr);
+    }
+
+    const uint32_t dt = TIME() - t0;
+    if ( !rx->abort && (baudrate != 0) )
+    {
+        RX_DEBUG("autobaud %d success (%s, %ums): %s", baudrate, how, dt, rx->verStr);
+        _rxBaudCacheSet(key, baudrate);
+        rx->autobaudHow = how;
+        rx->autobaudDur = dt;
         return true;
     }
     else
     {
-        RX_DEBUG("autobaud fail");
+        RX_DEBUG("autobaud fail (%ums)", dt);
         return false;
     }
 }
 
-
 /* ****************************************************************************************************************** */
 
 bool rxReset(RX_t *rx, const RX_RESET_t reset)
@@ -831,175 +1085,400 @@ const char *rxResetStr(const RX_RESET_t reset)
 
 /* ****************************************************************************************************************** */
 
-int rxGetConfig(RX_t *rx, const UBLOXCFG_LAYER_t layer, const uint32_t *keys, const int numKeys, UBLOXCFG_KEYVAL_t *kv, const int maxKv)
+// Pipelined UBX-CFG-VALGET polling: up to RX_GETCONFIG_WINDOW requests (pages of UBX_CFG_VALGET_V1_MAX_KV items
+// of some layer) are outstanding at any time. The receiver answers the requests in order. Responses are matched
+// by layer and position. UBX-ACK-NAK carries neither, so it is attributed to the oldest outstanding request.
+// Requests older than the one that was answered are considered lost and are sent again. As we don't know how many
+// items a layer has, pages are requested speculatively until the last (not full) page of the layer is known. Before
+// returning, responses to all outstanding requests are awaited, so that none of them leak into the next poll.
+#define RX_GETCONFIG_WINDOW    4     // Maximum number of outstanding requests
+#define RX_GETCONFIG_TIMEOUT   2000  // Timeout waiting for a response [ms]
+#define RX_GETCONFIG_ATTEMPTS  2     // Number of attempts for each page
+
+typedef struct RX_GETCONFIG_PAGE_s
+{
+    int8_t   numKv;     // Number of items in the page, -1 = not received (yet)
+    int8_t   attempts;  // Number of requests sent
+    bool     pending;   // Request is outstanding
+} RX_GETCONFIG_PAGE_t;
+
+typedef struct RX_GETCONFIG_STATE_s
+{
+    RX_GETCONFIG_t      *cfg;       // Caller's layer config and results
+    const char          *name;      // Layer name
+    uint8_t              pollLayer; // UBX-CFG-VALGET.layer
+    int                  maxPages;  // Number of pages that fit into cfg->kv
+    int                  endPage;   // Number of pages in this layer, maxPages until known
+    bool                 done;      // Layer complete, or failed
+    RX_GETCONFIG_PAGE_t *pages;     // maxPages pages
+} RX_GETCONFIG_STATE_t;
+
+typedef struct RX_GETCONFIG_REQ_s
+{
+    int      layerIx;   // Index into state
+    int      page;      // Page (position / UBX_CFG_VALGET_V1_MAX_KV)
+    uint32_t sent;      // Time sent [ms]
+} RX_GETCONFIG_REQ_t;
+
+static void _rxGetConfigFail(RX_t *rx, RX_GETCONFIG_STATE_t *state, const char *reason, const int page)
 {
-    if ( (rx == NULL) || (keys == NULL) || (numKeys < 1) || (kv == NULL) || (maxKv < 1) )
+    RX_WARNING("%s polling UBX-CFG-VALGET (position=%d, layer=%s)!", reason, page * UBX_CFG_VALGET_V1_MAX_KV, state->name);
+    state->done = true;
+    state->cfg->numKv = -1;
+}
+
+// Check if layer is complete
+static void _rxGetConfigCheck(RX_t *rx, RX_GETCONFIG_STATE_t *state)
+{
+    int numKv = 0;
+    for (int page = 0; page < state->endPage; page++)
     {
-        return -1;
+        if (state->pages[page].numKv < 0)
+        {
+            return;
+        }
+        numKv += state->pages[page].numKv;
+    }
+    state->done = true;
+    state->cfg->numKv = numKv;
+    RX_DEBUG("Total %d items for layer %s", numKv, state->name);
+}
+
+// Handle request without (proper) response
+static void _rxGetConfigLost(RX_t *rx, RX_GETCONFIG_STATE_t *state, const int page)
+{
+    RX_GETCONFIG_PAGE_t *p = &state->pages[page];
+    p->pending = false;
+    if (state->done || (page >= state->endPage) || (p->numKv >= 0))
+    {
+        return;
+    }
+    if (p->attempts >= RX_GETCONFIG_ATTEMPTS)
+    {
+        _rxGetConfigFail(rx, state, "No response", page);
+    }
+    else
+    {
+        RX_DEBUG("No response polling UBX-CFG-VALGET (position=%d, layer=%s), retrying",
+            page * UBX_CFG_VALGET_V1_MAX_KV, state->name);
     }
+}
 
-    const char *layerName = ubloxcfg_layerName(layer);
-    RX_DEBUG("Polling receiver configuration for layer %s", layerName);
+// Handle response (msg = UBX-CFG-VALGET), or UBX-ACK-NAK (msg = NULL)
+static void _rxGetConfigPage(RX_t *rx, RX_GETCONFIG_STATE_t *state, const int page, const PARSER_MSG_t *msg)
+{
+    RX_GETCONFIG_PAGE_t *p = &state->pages[page];
+    p->pending = false;
+    if (state->done || (page >= state->endPage) || (p->numKv >= 0))
+    {
+        return;
+    }
+    const UBLOXCFG_LAYER_t layer = state->cfg->layer;
 
-    uint8_t pollLayer = UBLOXCFG_LAYER_DEFAULT;
-    switch (layer)
+    // No key-val pairs in data (or no data at all)
+    const int cfgDataSize = msg == NULL ? 0 : (msg->size - UBX_FRAME_SIZE - (int)sizeof(UBX_CFG_VALGET_V1_GROUP0_t));
+    if (cfgDataSize < (4 + 1))
     {
-        case UBLOXCFG_LAYER_RAM:
-            pollLayer = UBX_CFG_VALGET_V0_LAYER_RAM;
-            break;
-        case UBLOXCFG_LAYER_BBR:
-            pollLayer = UBX_CFG_VALGET_V0_LAYER_BBR;
-            break;
-        case UBLOXCFG_LAYER_FLASH:
-            pollLayer = UBX_CFG_VALGET_V0_LAYER_FLASH;
-            break;
-        case UBLOXCFG_LAYER_DEFAULT:
-            pollLayer = UBX_CFG_VALGET_V0_LAYER_DEFAULT;
-            break;
+        // Past the end of the data in this layer
+        if (page > 0)
+        {
+            state->endPage = page;
+        }
+        // No data in this layer
+        else if ( (msg == NULL) || (layer == UBLOXCFG_LAYER_BBR) || (layer == UBLOXCFG_LAYER_FLASH) )
+        {
+            RX_DEBUG("No data in layer %s!", state->name);
+            state->endPage = 0;
+        }
+        // Unexpectedly no data for layer that must have data
+        else
+        {
+            _rxGetConfigFail(rx, state, "Bad response", page);
+            return;
+        }
+        _rxGetConfigCheck(rx, state);
+        return;
     }
 
-    uint32_t t0 = TIME();
-    bool done = false;
-    bool res = true;
-    int totNumKv = 0;
-    uint16_t position = 0;
-    while (!done)
+    // Add received data to list
+    const int offs = page * UBX_CFG_VALGET_V1_MAX_KV;
+    const int maxKv = MIN(state->cfg->maxKv - offs, UBX_CFG_VALGET_V1_MAX_KV);
+    int numKv = 0;
+    if (!ubloxcfg_parseData(&msg->data[UBX_HEAD_SIZE + sizeof(UBX_CFG_VALGET_V1_GROUP0_t)],
+        cfgDataSize, &state->cfg->kv[offs], maxKv, &numKv))
     {
-        if (rx->abort)
+        DEBUG_HEXDUMP(msg->data, msg->size, NULL);
+        _rxGetConfigFail(rx, state, maxKv < UBX_CFG_VALGET_V1_MAX_KV ? "Too many config items" : "Bad config data", page);
+        return;
+    }
+    p->numKv = numKv;
+
+    // Last page?
+    if (numKv < UBX_CFG_VALGET_V1_MAX_KV)
+    {
+        state->endPage = page + 1;
+    }
+    else if ((page + 1) >= state->maxPages)
+    {
+        _rxGetConfigFail(rx, state, "Too many config items", page);
+        return;
+    }
+
+    // Debug
+    RX_DEBUG("Received %d items from (position=%d, layer=%s)", numKv, offs, state->name);
+    if (isTRACE())
+    {
+        for (int ix = offs; ix < (offs + numKv); ix++)
         {
-            break;
+            char str[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
+            if (ubloxcfg_stringifyKeyVal(str, sizeof(str), &state->cfg->kv[ix]))
+            {
+                RX_TRACE("kv[%d]: %s", ix, str);
+            }
         }
+    }
+
+    _rxGetConfigCheck(rx, state);
+}
 
-        // UBX-CFG-VALGET poll request payload
-        UBX_CFG_VALGET_V0_GROUP0_t pollHead =
+bool rxGetConfigLayers(RX_t *rx, const uint32_t *keys, const int numKeys, RX_GETCONFIG_t *layers, const int numLayers)
+{
+    if ( (rx == NULL) || (keys == NULL) || (numKeys < 1) || (numKeys > UBX_CFG_VALGET_V0_MAX_K) ||
+         (layers == NULL) || (numLayers < 1) )
+    {
+        return false;
+    }
+    for (int ix = 0; ix < numLayers; ix++)
+    {
+        layers[ix].numKv = -1;
+        if ( (layers[ix].kv == NULL) || (layers[ix].maxKv < 1) )
         {
-            .version  = UBX_CFG_VALGET_V0_VERSION,
-            .layer    = pollLayer,
-            .position = position
-        };
-        uint8_t pollPayload[UBX_CFG_VALGET_V0_MAX_SIZE];
-        memcpy(&pollPayload[0], &pollHead, sizeof(pollHead));
-        const int keysSize = numKeys * sizeof(uint32_t);
-        memcpy(&pollPayload[sizeof(pollHead)], keys, keysSize);
+            return false;
+        }
+    }
 
-        // Poll UBX-CFG-VALGET
-        RX_POLL_UBX_t pollParam =
+    // Layer state and page bookkeeping
+    int totPages = 0;
+    for (int ix = 0; ix < numLayers; ix++)
+    {
+        totPages += (layers[ix].maxKv + UBX_CFG_VALGET_V1_MAX_KV - 1) / UBX_CFG_VALGET_V1_MAX_KV;
+    }
+    RX_GETCONFIG_STATE_t *state = malloc((numLayers * sizeof(RX_GETCONFIG_STATE_t)) + (totPages * sizeof(RX_GETCONFIG_PAGE_t)));
+    if (state == NULL)
+    {
+        RX_WARNING("rxGetConfigLayers() malloc fail!");
+        return false;
+    }
+    RX_GETCONFIG_PAGE_t *pages = (RX_GETCONFIG_PAGE_t *)&state[numLayers];
+    for (int ix = 0; ix < numLayers; ix++)
+    {
+        RX_GETCONFIG_STATE_t *s = &state[ix];
+        s->cfg = &layers[ix];
+        s->name = ubloxcfg_layerName(layers[ix].layer);
+        switch (layers[ix].layer)
         {
-            .clsId = UBX_CFG_CLSID, .msgId = UBX_CFG_VALGET_MSGID,
-            .payload = pollPayload, .payloadSize = (sizeof(UBX_CFG_VALGET_V0_GROUP0_t) + keysSize),
-            .retries = 2, .timeout = 2000,
-        };
-        bool pollNak = false;
-        PARSER_MSG_t *msg = rxPollUbx(rx, &pollParam, &pollNak);
-        if (msg == NULL)
+            case UBLOXCFG_LAYER_RAM:     s->pollLayer = UBX_CFG_VALGET_V0_LAYER_RAM;     break;
+            case UBLOXCFG_LAYER_BBR:     s->pollLayer = UBX_CFG_VALGET_V0_LAYER_BBR;     break;
+            case UBLOXCFG_LAYER_FLASH:   s->pollLayer = UBX_CFG_VALGET_V0_LAYER_FLASH;   break;
+            case UBLOXCFG_LAYER_DEFAULT: s->pollLayer = UBX_CFG_VALGET_V0_LAYER_DEFAULT; break;
+        }
+        s->maxPages = (layers[ix].maxKv + UBX_CFG_VALGET_V1_MAX_KV - 1) / UBX_CFG_VALGET_V1_MAX_KV;
+        s->endPage = s->maxPages;
+        s->done = false;
+        s->pages = pages;
+        pages += s->maxPages;
+        for (int page = 0; page < s->maxPages; page++)
         {
-            if (pollNak)
-            {
-                RX_DEBUG("No data in layer %s!", layerName);
-            }
-            else
+            s->pages[page].numKv = -1;
+            s->pages[page].attempts = 0;
+            s->pages[page].pending = false;
+        }
+        RX_DEBUG("Polling receiver configuration for layer %s", s->name);
+    }
+
+    // UBX-CFG-VALGET poll request payload
+    uint8_t pollPayload[UBX_CFG_VALGET_V0_MAX_SIZE];
+    const int keysSize = numKeys * sizeof(uint32_t);
+    memcpy(&pollPayload[sizeof(UBX_CFG_VALGET_V0_GROUP0_t)], keys, keysSize);
+    const int pollPayloadSize = sizeof(UBX_CFG_VALGET_V0_GROUP0_t) + keysSize;
+
+    const uint32_t t0 = TIME();
+    uint32_t lastResp = t0;
+    RX_GETCONFIG_REQ_t reqs[RX_GETCONFIG_WINDOW]; // Outstanding requests, oldest first
+    int numReqs = 0;
+    bool res = true;
+    while (true)
+    {
+        if (rx->abort)
+        {
+            res = false;
+            break;
+        }
+
+        // All layers done? Any layer failed?
+        int numDone = 0;
+        for (int ix = 0; ix < numLayers; ix++)
+        {
+            if (state[ix].done)
             {
-                RX_WARNING("No response polling UBX-CFG-VALGET (position=%u, layer=%s)!", position, layerName);
-                res = false;
+                numDone++;
+                if (layers[ix].numKv < 0)
+                {
+                    res = false;
+                }
             }
+        }
+        // Once done (or failed), drain the responses to requests still outstanding (speculative requests for pages
+        // past the end of a layer, requests for a failed layer) so that they don't end up in the next poll
+        const bool draining = (numDone == numLayers) || !res;
+        if (draining && (numReqs == 0))
+        {
             break;
         }
 
-        _rxCallbackMsg(rx, msg);
-
-        // No key-val pairs in data
-        if (msg->size < (int)(UBX_FRAME_SIZE + sizeof(UBX_CFG_VALGET_V0_GROUP0_t) + 4 + 1))
+        // Fill pipeline with the lowest missing page of any layer, which makes missing pages retried first
+        bool sendFail = false;
+        while (!draining && (numReqs < RX_GETCONFIG_WINDOW))
         {
-            // No data in this layer
-            if ( (position == 0) && ((layer == UBLOXCFG_LAYER_BBR) || (layer == UBLOXCFG_LAYER_FLASH)) )
+            int layerIx = -1;
+            int page = 0;
+            for (int ix = 0; ix < numLayers; ix++)
             {
-                break;
+                const RX_GETCONFIG_STATE_t *s = &state[ix];
+                for (int p = 0; !s->done && (p < s->endPage) && ( (layerIx < 0) || (p < page) ); p++)
+                {
+                    if ( (s->pages[p].numKv < 0) && !s->pages[p].pending )
+                    {
+                        layerIx = ix;
+                        page = p;
+                        break;
+                    }
+                }
             }
-            // No more data for this poll
-            else if (position > 0)
+            if (layerIx < 0)
             {
                 break;
             }
-            // Unexpectedly no data for layer that must have data
-            else
+
+            RX_GETCONFIG_STATE_t *s = &state[layerIx];
+            const UBX_CFG_VALGET_V0_GROUP0_t pollHead =
             {
-                RX_WARNING("Bad response polling UBX-CFG-VALGET (position=%u, layer=%s)!", position, layerName);
-                res = false;
+                .version  = UBX_CFG_VALGET_V0_VERSION,
+                .layer    = s->pollLayer,
+                .position = page * UBX_CFG_VALGET_V1_MAX_KV
+            };
+            memcpy(&pollPayload[0], &pollHead, sizeof(pollHead));
+            const int pollSize = ubxMakeMessage(UBX_CFG_CLSID, UBX_CFG_VALGET_MSGID, pollPayload, pollPayloadSize, rx->pollBuf);
+            if (!rxSend(rx, rx->pollBuf, pollSize))
+            {
+                sendFail = true;
                 break;
             }
-
-            res = false;
-            break;
+            s->pages[page].pending = true;
+            s->pages[page].attempts++;
+            reqs[numReqs].layerIx = layerIx;
+            reqs[numReqs].page = page;
+            reqs[numReqs].sent = TIME();
+            numReqs++;
+            RX_DEBUG("poll UBX-CFG-VALGET (position=%u, layer=%s), attempt %d/%d, outstanding %d",
+                pollHead.position, s->name, s->pages[page].attempts, RX_GETCONFIG_ATTEMPTS, numReqs);
         }
-
-        // Check result
-        UBX_CFG_VALGET_V1_GROUP0_t respHead;
-        memcpy(&respHead, &msg->data[UBX_HEAD_SIZE], sizeof(respHead));
-        if ( (respHead.version != UBX_CFG_VALGET_V1_VERSION) || (respHead.position != position) ||
-            (respHead.layer != pollLayer) )
+        if (sendFail)
         {
-            RX_WARNING("Unexpected response polling UBX-CFG-VALGET (position=%u, layer=%s)!", position, layerName);
-            DEBUG_HEXDUMP(msg->data, msg->size, "version: %u %u, position: %u %u, layer: %u %u",
-                respHead.version, UBX_CFG_VALGET_V1_VERSION,
-                respHead.position, position, respHead.layer, layer);
             res = false;
             break;
         }
 
-        // Add received data to list
-        int numKv = 0;
-        const int cfgDataSize = msg->size - UBX_FRAME_SIZE - sizeof(UBX_CFG_VALGET_V1_GROUP0_t);
-        if (cfgDataSize > 0)
+        // The oldest request is overdue. As responses queue up behind each other, the timeout starts with the
+        // last response received.
+        if ( (numReqs > 0) && ((TIME() - MAX(reqs[0].sent, lastResp)) > RX_GETCONFIG_TIMEOUT) )
         {
-            if (!ubloxcfg_parseData(&msg->data[UBX_HEAD_SIZE + sizeof(UBX_CFG_VALGET_V1_GROUP0_t)],
-                cfgDataSize, &kv[totNumKv], UBX_CFG_VALGET_V1_MAX_KV, &numKv))
-            {
-                RX_WARNING("Bad config data in UBX-CFG-VALGET response (position=%u, layer=%s)!", position, layerName);
-                DEBUG_HEXDUMP(msg->data, msg->size, NULL);
-                res = false;
-                break;
-            }
-            totNumKv += numKv;
+            _rxGetConfigLost(rx, &state[reqs[0].layerIx], reqs[0].page);
+            numReqs--;
+            memmove(&reqs[0], &reqs[1], numReqs * sizeof(*reqs));
+            lastResp = TIME();
+            continue;
         }
 
-        // Are we done?
-        if (numKv < UBX_CFG_VALGET_V1_MAX_KV)
+        // Get response
+        PARSER_MSG_t *msg = rxGetNextMessage(rx);
+        if (msg == NULL)
         {
-            done = true;
+            SLEEP(5);
+            continue;
         }
-        else
+        _rxCallbackMsg(rx, msg);
+
+        if ( (msg->type != PARSER_MSGTYPE_UBX) || (numReqs < 1) )
         {
-            position += UBX_CFG_VALGET_V1_MAX_KV;
+            continue;
         }
 
-        // Debug
-        RX_DEBUG("Received %d items from (position=%u, layer=%s, done=%s)",
-            numKv, position, layerName, done ? "yes" : "no");
-        if (isTRACE())
+        // UBX-CFG-VALGET response
+        int reqIx = -1;
+        if ( (UBX_CLSID(msg->data) == UBX_CFG_CLSID) && (UBX_MSGID(msg->data) == UBX_CFG_VALGET_MSGID) &&
+             (msg->size >= (int)(UBX_FRAME_SIZE + sizeof(UBX_CFG_VALGET_V1_GROUP0_t))) )
         {
-            for (int ix = totNumKv - numKv; ix < totNumKv; ix++)
+            UBX_CFG_VALGET_V1_GROUP0_t respHead;
+            memcpy(&respHead, &msg->data[UBX_HEAD_SIZE], sizeof(respHead));
+            for (int ix = 0; ix < numReqs; ix++)
             {
-                char str[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
-                if (ubloxcfg_stringifyKeyVal(str, sizeof(str), &kv[ix]))
+                if ( (respHead.version == UBX_CFG_VALGET_V1_VERSION) &&
+                     (respHead.layer == state[reqs[ix].layerIx].pollLayer) &&
+                     (respHead.position == (reqs[ix].page * UBX_CFG_VALGET_V1_MAX_KV)) )
                 {
-                    RX_TRACE("kv[%d]: %s", ix, str);
+                    reqIx = ix;
+                    break;
                 }
             }
+            if (reqIx < 0)
+            {
+                RX_DEBUG("Unexpected UBX-CFG-VALGET response (version=%u, position=%u, layer=%u)",
+                    respHead.version, respHead.position, respHead.layer);
+                continue;
+            }
         }
-
-        // Enough space left in list?
-        if ( (totNumKv + UBX_CFG_VALGET_V1_MAX_KV) > maxKv )
+        // UBX-ACK-NAK for the oldest request
+        else if ( (UBX_CLSID(msg->data) == UBX_ACK_CLSID) && (UBX_MSGID(msg->data) == UBX_ACK_NAK_MSGID) &&
+                  (msg->size >= (int)(UBX_FRAME_SIZE + sizeof(UBX_ACK_ACK_V0_GROUP0_t))) )
         {
-            RX_WARNING("Too many config items (position=%u, layer=%s)!", position, layerName);
-            res = false;
-            break;
+            const UBX_ACK_ACK_V0_GROUP0_t *ack = (const UBX_ACK_ACK_V0_GROUP0_t *)&msg->data[UBX_HEAD_SIZE];
+            if ( (ack->clsId != UBX_CFG_CLSID) || (ack->msgId != UBX_CFG_VALGET_MSGID) )
+            {
+                continue;
+            }
+            RX_DEBUG("UBX-ACK-NAK: UBX-CFG-VALGET (position=%d, layer=%s)",
+                reqs[0].page * UBX_CFG_VALGET_V1_MAX_KV, state[reqs[0].layerIx].name);
+            reqIx = 0;
+            msg = NULL;
+        }
+        else
+        {
+            continue;
         }
 
+        // Requests sent before the one answered now have been lost
+        lastResp = TIME();
+        for (int ix = 0; ix < reqIx; ix++)
+        {
+            _rxGetConfigLost(rx, &state[reqs[ix].layerIx], reqs[ix].page);
+        }
+        _rxGetConfigPage(rx, &state[reqs[reqIx].layerIx], reqs[reqIx].page, msg);
+        numReqs -= reqIx + 1;
+        memmove(&reqs[0], &reqs[reqIx + 1], numReqs * sizeof(*reqs));
     }
-    // while 64 left, not complete, ...
-    RX_DEBUG("Total %d items for layer %s (poll duration %ums), res=%d", totNumKv, layerName, TIME() - t0, res);
 
-    return res ? totNumKv : -1;
+    RX_DEBUG("Polling receiver configuration %s (poll duration %ums, %d requests outstanding)",
+        res ? "done" : "failed", TIME() - t0, numReqs);
+    free(state);
+
+    return res;
+}
+
+int rxGetConfig(RX_t *rx, const UBLOXCFG_LAYER_t layer, const uint32_t *keys, const int numKeys, UBLOXCFG_KEYVAL_t *kv, const int maxKv)
+{
+    RX_GETCONFIG_t cfg = { .layer = layer, .kv = kv, .maxKv = maxKv, .numKv = -1 };
+    return rxGetConfigLayers(rx, keys, numKeys, &cfg, 1) ? cfg.numKv : -1;
 }
 
 bool rxSetConfig(RX_t *rx, const UBLOXCFG_KEYVAL_t *kv, const int nKv, const bool ram, const bool bbr, const bool flash)
@@ -1034,5 +1513,388 @@ bool rxSetConfig(RX_t *rx, const UBLOXCFG_KEYVAL_t *kv, const int nKv, const boo
 }
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+
+#define RX_UPDATE_MAX_KV 3000 // Maximum number of items in a layer
+
+static void _rxConfigUpdateDebug(RX_t *rx, const char *what, const UBLOXCFG_KEYVAL_t *kv, const int nKv)
+{
+    if (!isDEBUG())
+    {
+        return;
+    }
+    for (int ix = 0; ix < nKv; ix++)
+    {
+        char str[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
+        if (ubloxcfg_stringifyKeyVal(str, sizeof(str), &kv[ix]))
+        {
+            RX_DEBUG("Config %s differs from %s", str, what);
+        }
+    }
+}
+
+int rxGetConfigUpdate(RX_t *rx, const UBLOXCFG_KEYVAL_t *cfg, const int nCfg, const bool resetToDefault,
+    const bool ram, const bool bbr, const bool flash, UBLOXCFG_KEYVAL_t *set, const int maxSet, bool *upToDate)
+{
+    if ( (rx == NULL) || (cfg == NULL) || (nCfg < 0) || (nCfg > RX_UPDATE_MAX_KV) || (set == NULL) )
+    {
+        return -1;
+    }
+
+    // Poll the default layer and the layers to compare to all at once
+    const UBLOXCFG_LAYER_t cmpLayers[] = { UBLOXCFG_LAYER_RAM, UBLOXCFG_LAYER_BBR, UBLOXCFG_LAYER_FLASH };
+    const bool doLayer[] = { ram, bbr, flash };
+    RX_GETCONFIG_t layers[1 + NUMOF(cmpLayers)];
+    int numLayers = 0;
+    layers[numLayers++].layer = UBLOXCFG_LAYER_DEFAULT;
+    for (int ix = 0; ix < NUMOF(cmpLayers); ix++)
+    {
+        if (doLayer[ix])
+        {
+            layers[numLayers++].layer = cmpLayers[ix];
+        }
+    }
+
+    UBLOXCFG_KEYVAL_t *mem = malloc((3 + numLayers) * RX_UPDATE_MAX_KV * sizeof(*mem));
+    if (mem == NULL)
+    {
+        RX_WARNING("malloc fail");
+        return -1;
+    }
+    UBLOXCFG_KEYVAL_t *kvCfg   = &mem[0 * RX_UPDATE_MAX_KV];
+    UBLOXCFG_KEYVAL_t *kvTmp   = &mem[1 * RX_UPDATE_MAX_KV];
+    UBLOXCFG_KEYVAL_t *kvWant  = &mem[2 * RX_UPDATE_MAX_KV];
+    for (int ix = 0; ix < numLayers; ix++)
+    {
+        layers[ix].kv = &mem[(3 + ix) * RX_UPDATE_MAX_KV];
+        layers[ix].maxKv = RX_UPDATE_MAX_KV;
+    }
+    const uint32_t keys[] = { UBX_CFG_VALGET_V0_ALL_WILDCARD };
+    if (!rxGetConfigLayers(rx, keys, NUMOF(keys), layers, numLayers))
+    {
+        free(mem);
+        return -1;
+    }
+
+    // The default layer has all items the receiver knows
+    UBLOXCFG_KEYVAL_t *kvDef = layers[0].kv;
+    int nDef = layers[0].numKv;
+    if (nDef <= 0)
+    {
+        free(mem);
+        return -1;
+    }
+    nDef = ubloxcfg_sortKeyVal(kvDef, nDef);
+
+    // Ignore items the receiver doesn't know
+    memcpy(kvTmp, cfg, nCfg * sizeof(*kvTmp));
+    const int nSorted = ubloxcfg_sortKeyVal(kvTmp, nCfg);
+    const int nKvCfg = ubloxcfg_intersectKeyVal(kvTmp, nSorted, kvDef, nDef, kvCfg, RX_UPDATE_MAX_KV);
+    if ( (nKvCfg >= 0) && (nKvCfg != nSorted) )
+    {
+        RX_WARNING("Ignoring %d unknown items", nSorted - nKvCfg);
+    }
+
+    int nSet = 0;
+    bool res = (nKvCfg >= 0);
+
+    // The configuration the layers should have. After a reset all layers are at the default configuration, so all
+    // items must match the default, except for those given in cfg.
+    int nWant = nKvCfg;
+    if (res && resetToDefault)
+    {
+        nWant = ubloxcfg_mergeKeyVal(kvDef, nDef, kvCfg, nKvCfg, kvWant, RX_UPDATE_MAX_KV);
+        res = (nWant >= 0);
+    }
+    else if (res)
+    {
+        memcpy(kvWant, kvCfg, nKvCfg * sizeof(*kvWant));
+    }
+
+    // Compare to each layer. The stored layers (BBR, Flash) have only the items that differ from the default.
+    bool same = true;
+    for (int ix = 1; res && (ix < numLayers); ix++)
+    {
+        UBLOXCFG_KEYVAL_t *kvLayer = layers[ix].kv;
+        int nLayer = ubloxcfg_sortKeyVal(kvLayer, layers[ix].numKv);
+        if (layers[ix].layer != UBLOXCFG_LAYER_RAM)
+        {
+            nLayer = ubloxcfg_mergeKeyVal(kvDef, nDef, kvLayer, nLayer, kvTmp, RX_UPDATE_MAX_KV);
+            memcpy(kvLayer, kvTmp, MAX(nLayer, 0) * sizeof(*kvLayer));
+        }
+        const int nDiff = ubloxcfg_diffKeyVal(kvLayer, nLayer, kvWant, nWant, kvTmp, RX_UPDATE_MAX_KV);
+        _rxConfigUpdateDebug(rx, ubloxcfg_layerName(layers[ix].layer), kvTmp, nDiff);
+        if ( (nLayer < 0) || (nDiff < 0) )
+        {
+            res = false;
+            break;
+        }
+        if (nDiff > 0)
+        {
+            same = false;
+        }
+        // Without reset the update set is the union of the differences of all layers
+        if (!resetToDefault)
+        {
+            const int nUnion = ubloxcfg_mergeKeyVal(set, nSet, kvTmp, nDiff, kvLayer, RX_UPDATE_MAX_KV);
+            if ( (nUnion < 0) || (nUnion > maxSet) )
+            {
+                res = false;
+                break;
+            }
+            memcpy(set, kvLayer, nUnion * sizeof(*set));
+            nSet = nUnion;
+        }
+    }
+
+    // After the reset the items that differ from the default must be set
+    if (res && resetToDefault)
+    {
+        nSet = ubloxcfg_diffKeyVal(kvDef, nDef, kvCfg, nKvCfg, set, maxSet);
+        _rxConfigUpdateDebug(rx, "default", set, nSet);
+        res = (nSet >= 0);
+    }
+
+    if (res && (upToDate != NULL))
+    {
+        *upToDate = same;
+    }
+
+    free(mem);
+    return res ? nSet : -1;
+}
+
+/* ****************************************************************************************************************** */
+
+typedef struct RX_FLEET_s
+{
+    RX_FLEET_JOB_t  *jobs;
+    int              numJobs;
+    int              nextJob;
+    const RX_ARGS_t *args;
+    RX_FLEET_FUNC_t  func;
+    void            *arg;
+} RX_FLEET_t;
+
+typedef struct RX_FLEET_WORKER_s
+{
+    RX_FLEET_t      *fleet;
+    int              ix;
+    pthread_t        thread;
+    bool             running;
+} RX_FLEET_WORKER_t;
+
+static void _rxFleetRunJob(RX_FLEET_t *fleet, RX_FLEET_JOB_t *job)
+{
+    RX_ARGS_t args = RX_ARGS_DEFAULT();
+    if (fleet->args != NULL)
+    {
+        args = *fleet->args;
+    }
+    char name[sizeof(((RX_t *)NULL)->name)];
+    if ( (args.name == NULL) || (args.name[0] == '\0') )
+    {
+        snprintf(name, sizeof(name), "%s", job->port);
+        args.name = name;
+    }
+
+    const uint32_t t0 = TIME();
+    RX_t *rx = rxInit(job->port, &args);
+    if ( (rx == NULL) || !rxOpen(rx) )
+    {
+        snprintf(job->error, sizeof(job->error), "%s", rx == NULL ? "Bad port" : "Failed connecting receiver");
+        job->durOpen = TIME() - t0;
+        free(rx);
+        return;
+    }
+    snprintf(job->verStr, sizeof(job->verStr), "%s", rx->verStr);
+    const uint32_t t1 = TIME();
+    job->durOpen = t1 - t0;
+
+    job->ok = (fleet->func != NULL) && fleet->func(rx, job, fleet->arg);
+    job->durRun = TIME() - t1;
+    if (!job->ok && (job->error[0] == '\0'))
+    {
+        snprintf(job->error, sizeof(job->error), "Failed");
+    }
+
+    rxClose(rx);
+    free(rx);
+}
+
+// Run jobs until there are no more left
+static void _rxFleetWork(RX_FLEET_t *fleet, const int workerIx)
+{
+    while (true)
+    {
+        const int jobIx = __atomic_fetch_add(&fleet->nextJob, 1, __ATOMIC_RELAXED);
+        if (jobIx >= fleet->numJobs)
+        {
+            break;
+        }
+        RX_FLEET_JOB_t *job = &fleet->jobs[jobIx];
+        job->worker = workerIx;
+        _rxFleetRunJob(fleet, job);
+    }
+}
+
+static void *_rxFleetThread(void *arg)
+{
+    RX_FLEET_WORKER_t *worker = (RX_FLEET_WORKER_t *)arg;
+    char name[50];
+    snprintf(name, sizeof(name), "rx fleet %d", worker->ix);
+    traceThreadName(name);
+    _rxFleetWork(worker->fleet, worker->ix);
+    traceThreadDone();
+    return NULL;
+}
+
+bool rxFleetRun(RX_FLEET_JOB_t *jobs, const int numJobs, const int numWorkers, const RX_ARGS_t *args,
+    RX_FLEET_FUNC_t func, void *arg)
+{
+    if ( (jobs == NULL) || (numJobs < 1) || (func == NULL) )
+    {
+        return false;
+    }
+    for (int ix = 0; ix < numJobs; ix++)
+    {
+        jobs[ix].ok        = false;
+        jobs[ix].worker    = -1;
+        jobs[ix].verStr[0] = '\0';
+        jobs[ix].error[0]  = '\0';
+        jobs[ix].durOpen   = 0;
+        jobs[ix].durRun    = 0;
+        jobs[ix].result    = 0;
+    }
+
+    RX_FLEET_t fleet = { .jobs = jobs, .numJobs = numJobs, .nextJob = 0, .args = args, .func = func, .arg = arg };
+    const int nWorkers = CLIP(numWorkers < 1 ? numJobs : numWorkers, 1, MIN(numJobs, RX_FLEET_MAX_WORKERS));
+    RX_FLEET_WORKER_t workers[RX_FLEET_MAX_WORKERS];
+    memset(workers, 0, sizeof(workers));
+    DEBUG("rxFleetRun() %d jobs, %d workers", numJobs, nWorkers);
+
+    (void)TIME(); // Initialise time base before any thread uses it
+
+    // The first worker is us, the others are threads
+    for (int ix = 1; ix < nWorkers; ix++)
+    {
+        workers[ix].fleet = &fleet;
+        workers[ix].ix = ix;
+        const int err = pthread_create(&workers[ix].thread, NULL, _rxFleetThread, &workers[ix]);
+        if (err != 0)
+        {
+            WARNING("rxFleetRun() failed starting worker %d: %s", ix, strerror(err));
+            break;
+        }
+        workers[ix].running = true;
+    }
+    _rxFleetWork(&fleet, 0);
+    for (int ix = 1; ix < nWorkers; ix++)
+    {
+        if (workers[ix].running)
+        {
+            pthread_join(workers[ix].thread, NULL);
+        }
+    }
+
+    bool res = true;
+    for (int ix = 0; ix < numJobs; ix++)
+    {
+        if (!jobs[ix].ok)
+        {
+            res = false;
+        }
+    }
+    return res;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool rxFleetSetConfig(RX_t *rx, RX_FLEET_JOB_t *job, void *arg)
+{
+    const RX_FLEET_CFG_t *cfg = (const RX_FLEET_CFG_t *)arg;
+    if ( (rx == NULL) || (job == NULL) || (cfg == NULL) || (cfg->kv == NULL) )
+    {
+        return false;
+    }
+    const bool doReset = (cfg->reset != RX_RESET_NONE);
+    const bool resetToDefault = (cfg->reset == RX_RESET_FACTORY) || (cfg->reset == RX_RESET_DEFAULT);
+
+    const int maxSet = RX_UPDATE_MAX_KV;
+    UBLOXCFG_KEYVAL_t *set = malloc(maxSet * sizeof(*set));
+    if (set == NULL)
+    {
+        snprintf(job->error, sizeof(job->error), "malloc fail");
+        return false;
+    }
+
+    // Reduce config to the items that need to be changed
+    const UBLOXCFG_KEYVAL_t *kv = cfg->kv;
+    int nKv = cfg->nKv;
+    bool upToDate = false;
+    if (cfg->updateOnly)
+    {
+        nKv = rxGetConfigUpdate(rx, cfg->kv, cfg->nKv, resetToDefault, cfg->ram, cfg->bbr, cfg->flash, set, maxSet,
+            &upToDate);
+        if (nKv < 0)
+        {
+            snprintf(job->error, sizeof(job->error), "Failed determining configuration update");
+            free(set);
+            return false;
+        }
+        kv = set;
+        if (upToDate)
+        {
+            RX_PRINT("Current configuration is up to date");
+        }
+        else
+        {
+            RX_PRINT("Current configuration differs from requested config (%d of %d items to set)", nKv, cfg->nKv);
+        }
+    }
+    job->result = upToDate ? 0 : nKv;
+
+    bool res = true;
+    if (res && !upToDate && doReset && !rxReset(rx, cfg->reset))
+    {
+        snprintf(job->error, sizeof(job->error), "Failed resetting receiver");
+        res = false;
+    }
+    if (res && !upToDate && (nKv > 0) && !rxSetConfig(rx, kv, nKv, cfg->ram, cfg->bbr, cfg->flash))
+    {
+        snprintf(job->error, sizeof(job->error), "Failed storing configuration");
+        res = false;
+    }
+
+    // Check that all layers have the configuration now
+    if (res && cfg->verify)
+    {
+        const int nDiff = rxGetConfigUpdate(rx, cfg->kv, cfg->nKv, false, cfg->ram, cfg->bbr, cfg->flash, set, maxSet,
+            NULL);
+        if (nDiff != 0)
+        {
+            if (nDiff < 0)
+            {
+                snprintf(job->error, sizeof(job->error), "Failed verifying configuration");
+            }
+            else
+            {
+                snprintf(job->error, sizeof(job->error), "Verify failed, %d items differ", nDiff);
+            }
+            res = false;
+        }
+    }
+
+    if (res && !upToDate && cfg->apply && !rxReset(rx, RX_RESET_SOFT))
+    {
+        snprintf(job->error, sizeof(job->error), "Failed applying configuration");
+        res = false;
+    }
+
+    free(set);
+    return res;
+}
+
+
 /* ****************************************************************************************************************** */
 // eof
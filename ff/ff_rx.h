@@ -22,6 +22,7 @@
 
 #include "ubloxcfg.h"
 #include "ff_parser.h"
+#include "ff_port.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -53,9 +54,20 @@ PARSER_MSG_t *rxGetNextMessageTimeout(RX_t *rx, const uint32_t timeout);
 
 bool rxSend(RX_t *rx, const uint8_t *data, const int size);
 
+// Detect baudrate: tries the baudrate given in the port spec (or else the last known baudrate for the port) first,
+// then listens for valid messages at the common baudrates, then polls at the baudrates ranked by what was received
+// (valid messages, nothing, garbage)
 bool rxAutobaud(RX_t *rx);
+
+// Last known baudrates (see rxAutobaud() and rxSetBaudrate()) are kept in memory, these load and save them to a file
+bool rxBaudrateCacheLoad(const char *file);
+bool rxBaudrateCacheSave(const char *file);
 int rxGetBaudrate(RX_t *rx);
-bool rxSetBaudrate(RX_t *rx, const int baudrate);
+bool rxSetBaudrate(RX_t *rx, const int baudrate); // Also updates the last known baudrate for the port
+
+// Port connection state (e.g. reconnecting) and statistics (incl. write queue depth)
+PORT_STATE_t rxGetPortState(RX_t *rx);
+bool rxGetPortStats(RX_t *rx, PORT_STATS_t *stats);
 
 void rxAbort(RX_t *rx);
 
@@ -102,8 +114,69 @@ const char *rxResetStr(const RX_RESET_t reset);
 
 int rxGetConfig(RX_t *rx, const UBLOXCFG_LAYER_t layer, const uint32_t *keys, const int numKeys, UBLOXCFG_KEYVAL_t *kv, const int maxKv);
 
+typedef struct RX_GETCONFIG_s
+{
+    UBLOXCFG_LAYER_t   layer;  // Layer to poll
+    UBLOXCFG_KEYVAL_t *kv;     // List for the polled items
+    int                maxKv;  // Size of kv
+    int                numKv;  // Number of items polled, -1 on failure
+} RX_GETCONFIG_t;
+
+// Poll several layers at once, with multiple UBX-CFG-VALGET requests in flight, returns true if all layers were polled
+bool rxGetConfigLayers(RX_t *rx, const uint32_t *keys, const int numKeys, RX_GETCONFIG_t *layers, const int numLayers);
+
 bool rxSetConfig(RX_t *rx, const UBLOXCFG_KEYVAL_t *kv, const int nKv, const bool ram, const bool bbr, const bool flash);
 
+// Determine the items to set in order to get the receiver from its current configuration to the desired configuration
+// (cfg), returns the number of items in set, or -1 on failure. Items unknown to the receiver are ignored. upToDate
+// (can be NULL) is set to true if the layers (ram, bbr, flash) already have the desired configuration. Without
+// resetToDefault set is the items of cfg that differ in any of the layers (and upToDate is true if there are none).
+// With resetToDefault the layers are compared to the default configuration updated with cfg, and set is the items
+// that differ from the default configuration, that is, what must be set after the reset.
+int rxGetConfigUpdate(RX_t *rx, const UBLOXCFG_KEYVAL_t *cfg, const int nCfg, const bool resetToDefault,
+    const bool ram, const bool bbr, const bool flash, UBLOXCFG_KEYVAL_t *set, const int maxSet, bool *upToDate);
+
+/* ****************************************************************************************************************** */
+
+#define RX_FLEET_MAX_WORKERS 64
+
+typedef struct RX_FLEET_JOB_s
+{
+    const char *port;         // Port (see rxInit())
+    bool        ok;           // Receiver detected and job function succeeded
+    int         worker;       // Worker that did the job, -1 if the job didn't run
+    char        verStr[100];  // Receiver version, empty if not detected
+    char        error[100];   // Reason for failure, empty on success
+    uint32_t    durOpen;      // Duration of connecting to and detecting the receiver [ms]
+    uint32_t    durRun;       // Duration of the job function [ms]
+    int         result;       // Free for use by the job function
+} RX_FLEET_JOB_t;
+
+typedef bool (*RX_FLEET_FUNC_t)(RX_t *rx, RX_FLEET_JOB_t *job, void *arg);
+
+// Connect to many receivers and do a job on each of them, with up to numWorkers (0 = all) receivers in parallel.
+// Each receiver is opened (detect, autobaud, see args), func() is called and the receiver is closed. Only the port
+// field of the jobs must be set. Returns true if all jobs were successful.
+bool rxFleetRun(RX_FLEET_JOB_t *jobs, const int numJobs, const int numWorkers, const RX_ARGS_t *args,
+    RX_FLEET_FUNC_t func, void *arg);
+
+typedef struct RX_FLEET_CFG_s
+{
+    const UBLOXCFG_KEYVAL_t *kv;  // Configuration
+    int          nKv;             // Number of items in kv
+    bool         ram;             // Store to RAM layer
+    bool         bbr;             // Store to BBR layer
+    bool         flash;           // Store to Flash layer
+    RX_RESET_t   reset;           // Reset before storing configuration, RX_RESET_NONE for no reset
+    bool         updateOnly;      // Only store items that differ from the current configuration (see rxGetConfigUpdate())
+    bool         verify;          // Check configuration after storing it
+    bool         apply;           // Apply configuration (soft reset) after storing it
+} RX_FLEET_CFG_t;
+
+// Job function for rxFleetRun() that configures a receiver, arg is a RX_FLEET_CFG_t, job->result is the number
+// of items stored
+bool rxFleetSetConfig(RX_t *rx, RX_FLEET_JOB_t *job, void *arg);
+
 /* ****************************************************************************************************************** */
 #ifdef __cplusplus
 }
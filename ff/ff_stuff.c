@@ -41,6 +41,13 @@ uint32_t TIME(void)
     return dt;
 }
 
+uint64_t TIME_NS(void)
+{
+    struct timespec tp;
+    clock_gettime(CLOCK_MONOTONIC, &tp);
+    return ((uint64_t)tp.tv_sec * 1000000000) + (uint64_t)tp.tv_nsec;
+}
+
 void SLEEP(uint32_t dur)
 {
 #ifdef _WIN32
@@ -27,6 +27,7 @@ extern "C" {
 /* ****************************************************************************************************************** */
 
 uint32_t TIME(void);
+uint64_t TIME_NS(void); // monotonic time [ns], does not wrap
 void SLEEP(uint32_t dur);
 
 uint32_t timeOfDay(void);
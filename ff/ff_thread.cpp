@@ -25,6 +25,7 @@
 #include <sys/prctl.h>
 
 #include "ff_debug.h"
+#include "ff_trace.h"
 
 #include "ff_thread.hpp"
 
@@ -134,6 +135,7 @@ void Ff::Thread::_Thread()
     }
 
     DEBUG("%s thread start", _name.c_str());
+    traceThreadName(_name.c_str());
 
     if (_prep)
     {
@@ -156,6 +158,7 @@ void Ff::Thread::_Thread()
 
     _abort = true;
 
+    traceThreadDone();
     DEBUG("%s thread stop", _name.c_str());
 }
 
@@ -86,6 +86,22 @@ double ts2posix(const double ts, const int leapSec, const bool leapSecValid)
     }
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+
+double posix2ts(const double posix, const int leapSec, const bool leapSecValid)
+{
+    if (leapSecValid)
+    {
+        return posix - (double)(GPS_POSIX_OFFS - leapSec);
+    }
+    else
+    {
+        // Leap seconds at GPS time without leap seconds, wrong only for a few seconds after a leap second
+        const double ts = posix - (double)GPS_POSIX_OFFS;
+        return ts + (double)sLeapSecAtTs(ts);
+    }
+}
+
 
 // ---------------------------------------------------------------------------------------------------------------------
 
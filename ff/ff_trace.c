@@ -0,0 +1,306 @@
+// flipflip's low-overhead event tracing
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <string.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "ff_stuff.h"
+#include "ff_parser.h"
+
+#include "ff_trace.h"
+
+/* ****************************************************************************************************************** */
+
+STATIC_ASSERT((TRACE_RING_SIZE & (TRACE_RING_SIZE - 1)) == 0);
+STATIC_ASSERT(sizeof(TRACE_EVENT_t) == 24);
+
+// Ring buffer of a thread. Rings are never freed, but they can be handed over to another thread
+// (see traceThreadDone()). Only the owning thread writes to a ring, and the list of rings only ever
+// grows at the head, so that no locking is necessary.
+typedef struct TRACE_RING_s
+{
+    struct TRACE_RING_s *next;
+    int                  id;
+    bool                 inUse;
+    char                 name[TRACE_MAX_NAME_LEN];
+    uint32_t             head;                    // number of events written
+    TRACE_EVENT_t        events[TRACE_RING_SIZE];
+} TRACE_RING_t;
+
+volatile bool gTraceEnabled = false;
+
+static TRACE_RING_t *gTraceRings = NULL;
+static int gTraceNumRings = 0;
+
+static __thread TRACE_RING_t *sThreadRing = NULL;
+static __thread char sThreadName[TRACE_MAX_NAME_LEN];
+
+// Copy thread name, replacing all characters that would need escaping in JSON
+static void _setName(char *dst, const char *src)
+{
+    int ix = 0;
+    while ( (src[ix] != '\0') && (ix < (TRACE_MAX_NAME_LEN - 1)) )
+    {
+        const char c = src[ix];
+        dst[ix] = (c >= ' ') && (c <= '~') && (c != '"') && (c != '\\') ? c : '_';
+        ix++;
+    }
+    dst[ix] = '\0';
+}
+
+static TRACE_RING_t *_getRing(void)
+{
+    if (sThreadRing != NULL)
+    {
+        return sThreadRing;
+    }
+
+    // Re-use a ring released by another thread
+    TRACE_RING_t *ring = __atomic_load_n(&gTraceRings, __ATOMIC_ACQUIRE);
+    while (ring != NULL)
+    {
+        bool expected = false;
+        if (__atomic_compare_exchange_n(&ring->inUse, &expected, true, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        {
+            __atomic_store_n(&ring->head, 0, __ATOMIC_RELEASE);
+            break;
+        }
+        ring = ring->next;
+    }
+
+    // Make a new one
+    if (ring == NULL)
+    {
+        ring = malloc(sizeof(TRACE_RING_t));
+        if (ring == NULL)
+        {
+            return NULL;
+        }
+        ring->id    = __atomic_add_fetch(&gTraceNumRings, 1, __ATOMIC_RELAXED);
+        ring->inUse = true;
+        ring->head  = 0;
+        ring->next  = __atomic_load_n(&gTraceRings, __ATOMIC_RELAXED);
+        while (!__atomic_compare_exchange_n(&gTraceRings, &ring->next, ring, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        {
+        }
+    }
+
+    if (sThreadName[0] != '\0')
+    {
+        _setName(ring->name, sThreadName);
+    }
+    else
+    {
+        snprintf(ring->name, sizeof(ring->name), "thread %d", ring->id);
+    }
+    sThreadRing = ring;
+    return ring;
+}
+
+/* ****************************************************************************************************************** */
+
+void traceEnable(const bool enable)
+{
+    gTraceEnabled = enable;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool traceIsEnabled(void)
+{
+    return gTraceEnabled;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void traceEvent(const TRACE_EV_t type, const uint32_t a, const uint32_t b, const uint32_t c)
+{
+    TRACE_RING_t *ring = _getRing();
+    if (ring == NULL)
+    {
+        return;
+    }
+    const uint32_t head = ring->head;
+    TRACE_EVENT_t *ev = &ring->events[head & (TRACE_RING_SIZE - 1)];
+    ev->ts   = TIME_NS();
+    ev->type = type;
+    ev->a    = a;
+    ev->b    = b;
+    ev->c    = c;
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void traceThreadName(const char *name)
+{
+    _setName(sThreadName, name != NULL ? name : "");
+    if (sThreadRing != NULL)
+    {
+        _setName(sThreadRing->name, sThreadName);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void traceThreadDone(void)
+{
+    if (sThreadRing != NULL)
+    {
+        __atomic_store_n(&sThreadRing->inUse, false, __ATOMIC_RELEASE);
+        sThreadRing = NULL;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void traceClear(void)
+{
+    for (TRACE_RING_t *ring = __atomic_load_n(&gTraceRings, __ATOMIC_ACQUIRE); ring != NULL; ring = ring->next)
+    {
+        __atomic_store_n(&ring->head, 0, __ATOMIC_RELEASE);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void traceStats(uint32_t *nEvents, uint32_t *nDropped)
+{
+    uint32_t n = 0;
+    uint32_t d = 0;
+    for (TRACE_RING_t *ring = __atomic_load_n(&gTraceRings, __ATOMIC_ACQUIRE); ring != NULL; ring = ring->next)
+    {
+        const uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+        n += head;
+        d += head > TRACE_RING_SIZE ? head - TRACE_RING_SIZE : 0;
+    }
+    if (nEvents != NULL)
+    {
+        *nEvents = n;
+    }
+    if (nDropped != NULL)
+    {
+        *nDropped = d;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const char *traceEventName(const TRACE_EV_t type)
+{
+    switch (type)
+    {
+        case TRACE_EV_NONE:           return "none";
+        case TRACE_EV_PARSER_MSG:     return "parser msg";
+        case TRACE_EV_PARSER_GARBAGE: return "parser garbage";
+        case TRACE_EV_PORT_READ:      return "port read";
+        case TRACE_EV_RX_POLL_BEGIN:  return "rx poll";
+        case TRACE_EV_RX_POLL_END:    return "rx poll";
+        case TRACE_EV_EPOCH:          return "epoch";
+        case TRACE_EV_USER:           return "user";
+        case TRACE_NUM_EV:            break;
+    }
+    return "?";
+}
+
+/* ****************************************************************************************************************** */
+
+static void _exportEvent(FILE *file, const int tid, const TRACE_EVENT_t *ev)
+{
+    // Timestamp in [us] with [ns] resolution
+    char common[100];
+    snprintf(common, sizeof(common), "\"pid\":1,\"tid\":%d,\"ts\":%" PRIu64 ".%03u",
+        tid, ev->ts / 1000, (unsigned int)(ev->ts % 1000));
+    const char *name = traceEventName((TRACE_EV_t)ev->type);
+    switch ((TRACE_EV_t)ev->type)
+    {
+        case TRACE_EV_PARSER_MSG:
+            fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"parser\",\"ph\":\"i\",\"s\":\"t\",%s,"
+                "\"args\":{\"size\":%u,\"id\":\"0x%04x\"}}",
+                parserMsgtypeName((PARSER_MSGTYPE_t)ev->a), common, ev->b, ev->c);
+            break;
+        case TRACE_EV_PARSER_GARBAGE:
+            fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"parser\",\"ph\":\"i\",\"s\":\"t\",%s,\"args\":{\"size\":%u}}",
+                parserMsgtypeName(PARSER_MSGTYPE_GARBAGE), common, ev->a);
+            break;
+        case TRACE_EV_PORT_READ:
+            fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"port\",\"ph\":\"C\",%s,\"args\":{\"bytes\":%u}}",
+                name, common, ev->b);
+            if (ev->c == 0)
+            {
+                fprintf(file, ",\n{\"name\":\"port read fail\",\"cat\":\"port\",\"ph\":\"i\",\"s\":\"t\",%s,"
+                    "\"args\":{\"size\":%u}}", common, ev->a);
+            }
+            break;
+        case TRACE_EV_RX_POLL_BEGIN:
+            fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"rx\",\"ph\":\"B\",%s,"
+                "\"args\":{\"id\":\"0x%04x\",\"attempt\":%u,\"retries\":%u}}",
+                name, common, ev->a, ev->b, ev->c);
+            break;
+        case TRACE_EV_RX_POLL_END:
+            fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"rx\",\"ph\":\"E\",%s,\"args\":{\"result\":\"%s\"}}",
+                name, common, ev->b == 1 ? "response" : (ev->b == 2 ? "nak" : "timeout"));
+            break;
+        case TRACE_EV_EPOCH:
+            fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"epoch\",\"ph\":\"i\",\"s\":\"t\",%s,"
+                "\"args\":{\"seq\":%u,\"fix\":%u,\"numSv\":%u}}",
+                name, common, ev->a, ev->b, ev->c);
+            break;
+        case TRACE_EV_USER:
+            fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"user\",\"ph\":\"i\",\"s\":\"t\",%s,"
+                "\"args\":{\"a\":%u,\"b\":%u,\"c\":%u}}",
+                name, common, ev->a, ev->b, ev->c);
+            break;
+        case TRACE_EV_NONE:
+        case TRACE_NUM_EV:
+            break;
+    }
+}
+
+int traceExportJson(FILE *file)
+{
+    if (file == NULL)
+    {
+        return -1;
+    }
+
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", file);
+    fputs("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"ff\"}}", file);
+
+    int nEvents = 0;
+    for (TRACE_RING_t *ring = __atomic_load_n(&gTraceRings, __ATOMIC_ACQUIRE); ring != NULL; ring = ring->next)
+    {
+        fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+            ring->id, ring->name);
+
+        // Oldest to newest event
+        const uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+        const uint32_t num = MIN(head, TRACE_RING_SIZE);
+        for (uint32_t ix = head - num; ix != head; ix++)
+        {
+            _exportEvent(file, ring->id, &ring->events[ix & (TRACE_RING_SIZE - 1)]);
+            nEvents++;
+        }
+    }
+
+    fputs("\n]}\n", file);
+
+    return ferror(file) ? -1 : nEvents;
+}
+
+/* ****************************************************************************************************************** */
+// eof
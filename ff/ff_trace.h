@@ -0,0 +1,110 @@
+// flipflip's low-overhead event tracing
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+//
+// Fixed-size binary events (timestamp, type and three arguments) are recorded into per-thread ring
+// buffers by the hooks in the ff hot paths (parser, port, rx, epoch). When tracing is disabled (the
+// default) a hook costs a single (predicted) branch on a global flag. The ring buffer of a thread is
+// allocated on its first event after traceEnable(). The recorded events can be exported in the
+// Chrome trace event format (JSON), which can be loaded into chrome://tracing or
+// https://ui.perfetto.dev.
+
+#ifndef __FF_TRACE_H__
+#define __FF_TRACE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ****************************************************************************************************************** */
+
+#define TRACE_RING_SIZE    16384  // number of events per thread (must be a power of two)
+#define TRACE_MAX_NAME_LEN    32  // max. length of thread names
+
+//! Event types
+typedef enum TRACE_EV_e
+{
+    TRACE_EV_NONE = 0,
+    TRACE_EV_PARSER_MSG,     //!< Parser emits message: a = PARSER_MSGTYPE_t, b = size, c = message ID (UBX: class << 8 | ID, RTCM3: type)
+    TRACE_EV_PARSER_GARBAGE, //!< Parser flushes garbage: a = size
+    TRACE_EV_PORT_READ,      //!< Data read from port: a = requested size, b = number of bytes read, c = 1 ok / 0 fail
+    TRACE_EV_RX_POLL_BEGIN,  //!< Receiver poll attempt: a = class << 8 | ID, b = attempt, c = max attempts
+    TRACE_EV_RX_POLL_END,    //!< Receiver poll attempt done: a = class << 8 | ID, b = 1 response / 2 nak / 0 timeout
+    TRACE_EV_EPOCH,          //!< Epoch complete: a = sequence, b = EPOCH_FIX_t, c = number of SVs used
+    TRACE_EV_USER,           //!< Application specific: a, b, c = anything
+    TRACE_NUM_EV
+} TRACE_EV_t;
+
+//! Recorded event
+typedef struct TRACE_EVENT_s
+{
+    uint64_t  ts;    //!< Time (TIME_NS()) [ns]
+    uint32_t  type;  //!< Event type (TRACE_EV_t)
+    uint32_t  a;     //!< Argument
+    uint32_t  b;     //!< Argument
+    uint32_t  c;     //!< Argument
+} TRACE_EVENT_t;
+
+//! Tracing enabled flag, don't mess with this, use traceEnable() and TRACE_EVENT()
+extern volatile bool gTraceEnabled;
+
+//! Record an event (if tracing is enabled)
+#define TRACE_EVENT(_type_, _a_, _b_, _c_) \
+    do { if (__builtin_expect(gTraceEnabled, 0)) { traceEvent(_type_, _a_, _b_, _c_); } } while (0)
+
+//! Enable or disable tracing
+void traceEnable(const bool enable);
+
+//! Check if tracing is enabled
+bool traceIsEnabled(void);
+
+//! Record an event (unconditionally, prefer the TRACE_EVENT() macro)
+void traceEvent(const TRACE_EV_t type, const uint32_t a, const uint32_t b, const uint32_t c);
+
+//! Set name of the calling thread (shown in the exported trace)
+void traceThreadName(const char *name);
+
+//! Release ring buffer of the calling thread (to be re-used by another thread, events are kept until then)
+void traceThreadDone(void);
+
+//! Discard all recorded events (should be called while tracing is disabled)
+void traceClear(void);
+
+//! Get total number of recorded (and dropped, i.e. overwritten) events
+void traceStats(uint32_t *nEvents, uint32_t *nDropped);
+
+//! Stringify event type
+const char *traceEventName(const TRACE_EV_t type);
+
+//! Export recorded events in Chrome trace event format (JSON)
+/*!
+    Tracing should be disabled while exporting, otherwise the output may include partially written
+    events.
+
+    \param[in]  file  File to write to
+
+    \returns the number of events written, or -1 on error
+*/
+int traceExportJson(FILE *file);
+
+/* ****************************************************************************************************************** */
+#ifdef __cplusplus
+}
+#endif
+#endif // __FF_TRACE_H__
@@ -0,0 +1,276 @@
+// flipflip's timestamped log container
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <string.h>
+#include <time.h>
+
+#include "ff_debug.h"
+#include "ff_stuff.h"
+#include "ff_crc.h"
+
+#include "ff_tslog.h"
+
+/* ****************************************************************************************************************** */
+
+#define TSLOG_SYNC_CHAR         0xa5
+#define TSLOG_TYPE_SYNC          'S'
+#define TSLOG_TYPE_DATA          'D'
+#define TSLOG_MAX_OFFS_DIFF  1000000 // [ns] max change of wall-clock offset before a new SYNC record is written
+
+STATIC_ASSERT(TSLOG_DEC_BUF_SIZE >= (2 * (TSLOG_HEAD_SIZE + TSLOG_MAX_DATA_SIZE)));
+STATIC_ASSERT(TSLOG_MAX_ENC_SIZE >= (TSLOG_MAGIC_SIZE + TSLOG_HEAD_SIZE + TSLOG_SYNC_SIZE + TSLOG_HEAD_SIZE));
+STATIC_ASSERT(TSLOG_SYNC_INTERVAL < UINT32_MAX);
+
+static void _wrU16(uint8_t *p, const uint16_t v)
+{
+    p[0] = v & 0xff;
+    p[1] = (v >> 8) & 0xff;
+}
+
+static void _wrU32(uint8_t *p, const uint32_t v)
+{
+    _wrU16(&p[0], v & 0xffff);
+    _wrU16(&p[2], (v >> 16) & 0xffff);
+}
+
+static void _wrU64(uint8_t *p, const uint64_t v)
+{
+    _wrU32(&p[0], v & 0xffffffff);
+    _wrU32(&p[4], (v >> 32) & 0xffffffff);
+}
+
+static uint16_t _rdU16(const uint8_t *p)
+{
+    return (uint16_t)p[0] | ((uint16_t)p[1] << 8);
+}
+
+static uint32_t _rdU32(const uint8_t *p)
+{
+    return (uint32_t)_rdU16(&p[0]) | ((uint32_t)_rdU16(&p[2]) << 16);
+}
+
+static uint64_t _rdU64(const uint8_t *p)
+{
+    return (uint64_t)_rdU32(&p[0]) | ((uint64_t)_rdU32(&p[4]) << 32);
+}
+
+static void _wrHead(uint8_t *p, const uint8_t type, const uint16_t size, const uint32_t arg)
+{
+    p[0] = TSLOG_SYNC_CHAR;
+    p[1] = type;
+    _wrU16(&p[2], size);
+    _wrU32(&p[4], arg);
+}
+
+/* ****************************************************************************************************************** */
+
+void tslogTime(uint64_t *mono, uint64_t *wall)
+{
+    if (mono != NULL)
+    {
+        *mono = TIME_NS();
+    }
+    if (wall != NULL)
+    {
+        struct timespec tp;
+        clock_gettime(CLOCK_REALTIME, &tp);
+        *wall = ((uint64_t)tp.tv_sec * 1000000000) + (uint64_t)tp.tv_nsec;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool tslogDetect(const uint8_t *data, const int size)
+{
+    return (data != NULL) && (size >= TSLOG_MAGIC_SIZE) && (memcmp(data, TSLOG_MAGIC, TSLOG_MAGIC_SIZE) == 0);
+}
+
+/* ****************************************************************************************************************** */
+
+void tslogEncInit(TSLOG_ENC_t *enc)
+{
+    memset(enc, 0, sizeof(*enc));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+int tslogEncode(TSLOG_ENC_t *enc, uint8_t *buf, const int size, const uint64_t mono, const uint64_t wall)
+{
+    if ( (enc == NULL) || (buf == NULL) || (size < 1) || (size > TSLOG_MAX_DATA_SIZE) )
+    {
+        return 0;
+    }
+
+    int len = 0;
+
+    // File header
+    if (!enc->init)
+    {
+        memcpy(&buf[len], TSLOG_MAGIC, TSLOG_MAGIC_SIZE);
+        len += TSLOG_MAGIC_SIZE;
+    }
+
+    // SYNC record
+    const int64_t offs = (int64_t)wall - (int64_t)mono;
+    const int64_t dOffs = offs - enc->syncOffs;
+    if ( !enc->init || (mono < enc->lastMono) || ((mono - enc->syncMono) >= TSLOG_SYNC_INTERVAL) ||
+        (ABS(dOffs) > TSLOG_MAX_OFFS_DIFF) )
+    {
+        uint8_t *sync = &buf[len + TSLOG_HEAD_SIZE];
+        _wrU64(&sync[0], mono);
+        _wrU64(&sync[8], wall);
+        _wrHead(&buf[len], TSLOG_TYPE_SYNC, TSLOG_SYNC_SIZE, crcNovatel32(sync, TSLOG_SYNC_SIZE));
+        len += TSLOG_HEAD_SIZE + TSLOG_SYNC_SIZE;
+        enc->init     = true;
+        enc->lastMono = mono;
+        enc->syncMono = mono;
+        enc->syncOffs = offs;
+        enc->nSync++;
+    }
+
+    // DATA record head, the delta to the last record always fits (see TSLOG_SYNC_INTERVAL)
+    _wrHead(&buf[len], TSLOG_TYPE_DATA, size, (uint32_t)(mono - enc->lastMono));
+    len += TSLOG_HEAD_SIZE;
+    enc->lastMono = mono;
+    enc->nData++;
+
+    return len;
+}
+
+/* ****************************************************************************************************************** */
+
+void tslogDecInit(TSLOG_DEC_t *dec)
+{
+    memset(dec, 0, sizeof(*dec));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void tslogDecResync(TSLOG_DEC_t *dec)
+{
+    dec->size   = 0;
+    dec->offs   = 0;
+    dec->synced = false;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool tslogDecAdd(TSLOG_DEC_t *dec, const uint8_t *data, const int size)
+{
+    // Move remaining data to the front of the buffer
+    if ( (dec->offs > 0) && (dec->size > 0) )
+    {
+        memmove(&dec->buf[0], &dec->buf[dec->offs], dec->size);
+    }
+    dec->offs = 0;
+
+    // Overflow, discard
+    if ((dec->size + size) > (int)sizeof(dec->buf))
+    {
+        return false;
+    }
+    memcpy(&dec->buf[dec->size], data, size);
+    dec->size += size;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool tslogDecProcess(TSLOG_DEC_t *dec, TSLOG_REC_t *rec)
+{
+    while (dec->size >= TSLOG_HEAD_SIZE)
+    {
+        const uint8_t *p = &dec->buf[dec->offs];
+
+        // Skip file header (start of file or concatenated files)
+        if (tslogDetect(p, dec->size))
+        {
+            dec->offs += TSLOG_MAGIC_SIZE;
+            dec->size -= TSLOG_MAGIC_SIZE;
+            continue;
+        }
+
+        bool ok = false;
+        if (p[0] == TSLOG_SYNC_CHAR)
+        {
+            const int size = _rdU16(&p[2]);
+            const uint32_t arg = _rdU32(&p[4]);
+            switch (p[1])
+            {
+                case TSLOG_TYPE_SYNC:
+                    if (size != TSLOG_SYNC_SIZE)
+                    {
+                        break;
+                    }
+                    if (dec->size < (TSLOG_HEAD_SIZE + TSLOG_SYNC_SIZE))
+                    {
+                        return false; // need more data
+                    }
+                    if (crcNovatel32(&p[TSLOG_HEAD_SIZE], TSLOG_SYNC_SIZE) == arg)
+                    {
+                        const uint64_t mono = _rdU64(&p[TSLOG_HEAD_SIZE]);
+                        const uint64_t wall = _rdU64(&p[TSLOG_HEAD_SIZE + 8]);
+                        dec->lastMono = mono;
+                        dec->syncOffs = (int64_t)wall - (int64_t)mono;
+                        dec->synced = true;
+                        dec->nSync++;
+                        dec->offs += TSLOG_HEAD_SIZE + TSLOG_SYNC_SIZE;
+                        dec->size -= TSLOG_HEAD_SIZE + TSLOG_SYNC_SIZE;
+                        ok = true;
+                    }
+                    break;
+                case TSLOG_TYPE_DATA:
+                    if ( !dec->synced || (size < 1) || (size > TSLOG_MAX_DATA_SIZE) )
+                    {
+                        break;
+                    }
+                    if (dec->size < (TSLOG_HEAD_SIZE + size))
+                    {
+                        return false; // need more data
+                    }
+                    dec->lastMono += arg;
+                    rec->data = &p[TSLOG_HEAD_SIZE];
+                    rec->size = size;
+                    rec->mono = dec->lastMono;
+                    rec->wall = (uint64_t)((int64_t)dec->lastMono + dec->syncOffs);
+                    dec->nData++;
+                    dec->offs += TSLOG_HEAD_SIZE + size;
+                    dec->size -= TSLOG_HEAD_SIZE + size;
+                    return true;
+            }
+        }
+
+        // Bad record (or not synchronised yet), skip to next possible record start
+        if (!ok)
+        {
+            if (dec->synced)
+            {
+                WARNING("tslog: lost sync");
+                dec->synced = false;
+            }
+            const uint8_t *next = memchr(&p[1], TSLOG_SYNC_CHAR, dec->size - 1);
+            const int skip = next != NULL ? (int)(next - p) : dec->size;
+            dec->offs += skip;
+            dec->size -= skip;
+            dec->nSkip += skip;
+        }
+    }
+
+    return false;
+}
+
+/* ****************************************************************************************************************** */
+// eof
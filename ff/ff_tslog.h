@@ -0,0 +1,133 @@
+// flipflip's timestamped log container
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+//
+// This is a minimal container that stores chunks of raw receiver data along with the monotonic and
+// the wall-clock time (nanoseconds) at which they arrived. The raw data is stored unmodified.
+//
+// Layout (all values little-endian):
+//
+//   file header:  "FFTSLOG" version (8 bytes, TSLOG_MAGIC)
+//   record head:  sync (0xa5), type, size (u16), arg (u32)
+//   SYNC record:  type 'S', size 16, arg = crcNovatel32(payload), payload = mono (u64) + wall (u64)
+//   DATA record:  type 'D', size = number of data bytes, arg = mono delta [ns] to the previous record,
+//                 followed by the data
+//
+// The wall-clock time of a DATA record is its monotonic time plus the offset (wall - mono) of the
+// last SYNC record. SYNC records are written at the start, at least once per TSLOG_SYNC_INTERVAL,
+// and whenever the wall-clock offset changes (e.g. clock adjustments). This keeps the per-chunk
+// overhead at TSLOG_HEAD_SIZE bytes and allows the decoder to resynchronise after seeking into a
+// file.
+
+#ifndef __FF_TSLOG_H__
+#define __FF_TSLOG_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ****************************************************************************************************************** */
+
+#define TSLOG_MAGIC          "FFTSLOG\x01"   // file header
+#define TSLOG_MAGIC_SIZE               8
+#define TSLOG_HEAD_SIZE                8     // size of record head
+#define TSLOG_SYNC_SIZE               16     // size of SYNC record payload
+#define TSLOG_MAX_DATA_SIZE         8192     // maximum size of DATA record payload
+#define TSLOG_MAX_ENC_SIZE            48     // maximum size of output from tslogEncode() (excl. data)
+#define TSLOG_DEC_BUF_SIZE         32768     // must be >= 2 * (TSLOG_HEAD_SIZE + TSLOG_MAX_DATA_SIZE)
+#define TSLOG_SYNC_INTERVAL   1000000000     // [ns] max interval between SYNC records
+
+//! Encoder state
+typedef struct TSLOG_ENC_s
+{
+    // Encoder state, don't mess with this
+    bool      init;
+    uint64_t  lastMono;
+    uint64_t  syncMono;
+    int64_t   syncOffs;
+    // Statistics
+    uint32_t  nData;
+    uint32_t  nSync;
+} TSLOG_ENC_t;
+
+//! Decoder state
+typedef struct TSLOG_DEC_s
+{
+    // Decoder state, don't mess with this
+    uint8_t   buf[TSLOG_DEC_BUF_SIZE];
+    int       size;
+    int       offs;
+    bool      synced;
+    uint64_t  lastMono;
+    int64_t   syncOffs;
+    // Statistics
+    uint32_t  nData;
+    uint32_t  nSync;
+    uint32_t  nSkip;  // number of bytes skipped while (re)synchronising
+} TSLOG_DEC_t;
+
+//! Decoded data record
+typedef struct TSLOG_REC_s
+{
+    const uint8_t *data;    //!< Data (valid until the next call to tslogDecAdd() or tslogDecProcess())
+    int            size;    //!< Size of data
+    uint64_t       mono;    //!< Monotonic time [ns] at which the data arrived
+    uint64_t       wall;    //!< Wall-clock (POSIX) time [ns] at which the data arrived
+} TSLOG_REC_t;
+
+//! Get current monotonic (TIME_NS()) and wall-clock (POSIX) time [ns]
+void tslogTime(uint64_t *mono, uint64_t *wall);
+
+//! Check if data is a timestamped log (starts with TSLOG_MAGIC)
+bool tslogDetect(const uint8_t *data, const int size);
+
+//! Initialise encoder
+void tslogEncInit(TSLOG_ENC_t *enc);
+
+//! Encode record head(s) for a chunk of data
+/*!
+    Generates the file header (first call only), a SYNC record (if necessary) and the DATA record head
+    for a chunk of data. The caller shall write the generated bytes followed by the data itself.
+
+    \param[in,out] enc   Encoder state
+    \param[out]    buf   Output buffer, at least TSLOG_MAX_ENC_SIZE bytes
+    \param[in]     size  Size of data, 1...TSLOG_MAX_DATA_SIZE
+    \param[in]     mono  Monotonic time [ns] of the data
+    \param[in]     wall  Wall-clock time [ns] of the data
+
+    \returns the number of bytes generated into \c buf, 0 on error (bad size)
+*/
+int tslogEncode(TSLOG_ENC_t *enc, uint8_t *buf, const int size, const uint64_t mono, const uint64_t wall);
+
+//! Initialise decoder
+void tslogDecInit(TSLOG_DEC_t *dec);
+
+//! Add data to decoder, returns false on overflow (and the data is discarded)
+bool tslogDecAdd(TSLOG_DEC_t *dec, const uint8_t *data, const int size);
+
+//! Get next data record, returns false if more data is needed
+bool tslogDecProcess(TSLOG_DEC_t *dec, TSLOG_REC_t *rec);
+
+//! Reset decoder to search for the next SYNC record (e.g. after seeking in the file)
+void tslogDecResync(TSLOG_DEC_t *dec);
+
+/* ****************************************************************************************************************** */
+#ifdef __cplusplus
+}
+#endif
+#endif // __FF_TSLOG_H__
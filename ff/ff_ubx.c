@@ -23,6 +23,7 @@
 
 #include "ff_stuff.h"
 #include "ff_ubx.h"
+#include "ff_ubx_view.h"
 #include "ff_debug.h"
 
 /* ****************************************************************************************************************** */
@@ -779,28 +780,31 @@ static int _strUbxNav(char *info, const int size, const uint8_t *msg, const int
     {
         return 0;
     }
-    uint32_t iTOW;
-    memcpy(&iTOW, &msg[UBX_HEAD_SIZE + iTowOffs], sizeof(iTOW));
+    const uint32_t iTOW = ubxViewU4(&msg[UBX_HEAD_SIZE + iTowOffs]);
     const int n = snprintf(info, size, "%010.3f", (double)iTOW * 1e-3);
     return n;
 }
 
 static int _strUbxNavPvt(char *info, const int size, const uint8_t *msg, const int msgSize)
 {
-    if (msgSize != UBX_NAV_PVT_V1_SIZE)
+    UBX_VIEW_t view;
+    if (!UBX_NAV_PVT_V1_view(&view, msg, msgSize))
     {
         return 0;
     }
-    UBX_NAV_PVT_V1_GROUP0_t pvt;
-    memcpy(&pvt, &msg[UBX_HEAD_SIZE], sizeof(pvt));
-    int sec = pvt.sec;
-    int msec = (pvt.nano / 1000 + 500) / 1000;
+    const uint8_t *pvt = view.head;
+    const uint8_t flags = UBX_NAV_PVT_V1_GROUP0_flags(pvt);
+    const uint8_t valid = UBX_NAV_PVT_V1_GROUP0_valid(pvt);
+    const uint8_t flags2 = UBX_NAV_PVT_V1_GROUP0_flags2(pvt);
+    const uint8_t fixType = UBX_NAV_PVT_V1_GROUP0_fixType(pvt);
+    int sec = UBX_NAV_PVT_V1_GROUP0_sec(pvt);
+    int msec = (UBX_NAV_PVT_V1_GROUP0_nano(pvt) / 1000 + 500) / 1000;
     if (msec < 0)
     {
         sec -= 1;
         msec = 1000 + msec;
     }
-    const int carrSoln = UBX_NAV_PVT_V1_FLAGS_CARRSOLN_GET(pvt.flags);
+    const int carrSoln = UBX_NAV_PVT_V1_FLAGS_CARRSOLN_GET(flags);
     const char * const fixTypes[] = { "nofix", "dr", "2D", "3D", "3D+DR", "time" };
     const int n = snprintf(info, size,
         "%010.3f"
@@ -809,189 +813,196 @@ static int _strUbxNavPvt(char *info, const int size, const uint8_t *msg, const i
         " %s (%s, %s)"
         " %2d %4.2f"
         " %+11.7f %+12.7f (%5.1f) %+6.0f (%5.1f)",
-        (double)pvt.iTOW * 1e-3,
-        pvt.year, pvt.month, pvt.day,
-        F(pvt.valid, UBX_NAV_PVT_V1_VALID_VALIDDATE) ? (F(pvt.flags2, UBX_NAV_PVT_V1_FLAGS2_CONFDATE) ? 'Y' : 'y') : 'n',
-        pvt.hour, pvt.min, sec, msec,
-        F(pvt.valid, UBX_NAV_PVT_V1_VALID_VALIDTIME) ? (F(pvt.flags2, UBX_NAV_PVT_V1_FLAGS2_CONFTIME) ? 'Y' : 'y') : 'n',
-        pvt.fixType < NUMOF(fixTypes) ? fixTypes[pvt.fixType] : "?",
-            F(pvt.flags, UBX_NAV_PVT_V1_FLAGS_GNSSFIXOK) ? "OK" : "masked",
+        (double)UBX_NAV_PVT_V1_GROUP0_iTOW(pvt) * 1e-3,
+        UBX_NAV_PVT_V1_GROUP0_year(pvt), UBX_NAV_PVT_V1_GROUP0_month(pvt), UBX_NAV_PVT_V1_GROUP0_day(pvt),
+        F(valid, UBX_NAV_PVT_V1_VALID_VALIDDATE) ? (F(flags2, UBX_NAV_PVT_V1_FLAGS2_CONFDATE) ? 'Y' : 'y') : 'n',
+        UBX_NAV_PVT_V1_GROUP0_hour(pvt), UBX_NAV_PVT_V1_GROUP0_min(pvt), sec, msec,
+        F(valid, UBX_NAV_PVT_V1_VALID_VALIDTIME) ? (F(flags2, UBX_NAV_PVT_V1_FLAGS2_CONFTIME) ? 'Y' : 'y') : 'n',
+        fixType < NUMOF(fixTypes) ? fixTypes[fixType] : "?",
+            F(flags, UBX_NAV_PVT_V1_FLAGS_GNSSFIXOK) ? "OK" : "masked",
         carrSoln == 0 ? "none" : (carrSoln == 1 ? "float" : (carrSoln == 2 ? "fixed" : "rtk?")),
-        pvt.numSV, (double)pvt.pDOP * UBX_NAV_PVT_V1_PDOP_SCALE,
-        (double)pvt.lat    * UBX_NAV_PVT_V1_LAT_SCALE,
-        (double)pvt.lon    * UBX_NAV_PVT_V1_LON_SCALE,
-        (double)pvt.hAcc   * UBX_NAV_PVT_V1_HACC_SCALE,
-        (double)pvt.height * UBX_NAV_PVT_V1_HEIGHT_SCALE,
-        (double)pvt.vAcc   * UBX_NAV_PVT_V1_VACC_SCALE
+        UBX_NAV_PVT_V1_GROUP0_numSV(pvt), (double)UBX_NAV_PVT_V1_GROUP0_pDOP(pvt) * UBX_NAV_PVT_V1_PDOP_SCALE,
+        (double)UBX_NAV_PVT_V1_GROUP0_lat(pvt)    * UBX_NAV_PVT_V1_LAT_SCALE,
+        (double)UBX_NAV_PVT_V1_GROUP0_lon(pvt)    * UBX_NAV_PVT_V1_LON_SCALE,
+        (double)UBX_NAV_PVT_V1_GROUP0_hAcc(pvt)   * UBX_NAV_PVT_V1_HACC_SCALE,
+        (double)UBX_NAV_PVT_V1_GROUP0_height(pvt) * UBX_NAV_PVT_V1_HEIGHT_SCALE,
+        (double)UBX_NAV_PVT_V1_GROUP0_vAcc(pvt)   * UBX_NAV_PVT_V1_VACC_SCALE
         );
     return n;
 }
 
 static int _strUbxNavPosecef(char *info, const int size, const uint8_t *msg, const int msgSize)
 {
-    if (msgSize != UBX_NAV_POSECEF_V0_SIZE)
+    UBX_VIEW_t view;
+    if (!UBX_NAV_POSECEF_V0_view(&view, msg, msgSize))
     {
         return 0;
     }
-    UBX_NAV_POSECEF_V0_GROUP0_t pos;
-    memcpy(&pos, &msg[UBX_HEAD_SIZE], sizeof(pos));
+    const uint8_t *pos = view.head;
     const int n = snprintf(info, size, "%010.3f %.2f  %.2f  %.2f  %.2f",
-        (double)pos.iTOW * 1e-3,
-        (double)pos.ecefX * UBX_NAV_POSECEF_V0_ECEF_XYZ_SCALE,
-        (double)pos.ecefY * UBX_NAV_POSECEF_V0_ECEF_XYZ_SCALE,
-        (double)pos.ecefZ * UBX_NAV_POSECEF_V0_ECEF_XYZ_SCALE,
-        (double)pos.pAcc  * UBX_NAV_POSECEF_V0_PACC_SCALE);
+        (double)UBX_NAV_POSECEF_V0_GROUP0_iTOW(pos) * 1e-3,
+        (double)UBX_NAV_POSECEF_V0_GROUP0_ecefX(pos) * UBX_NAV_POSECEF_V0_ECEF_XYZ_SCALE,
+        (double)UBX_NAV_POSECEF_V0_GROUP0_ecefY(pos) * UBX_NAV_POSECEF_V0_ECEF_XYZ_SCALE,
+        (double)UBX_NAV_POSECEF_V0_GROUP0_ecefZ(pos) * UBX_NAV_POSECEF_V0_ECEF_XYZ_SCALE,
+        (double)UBX_NAV_POSECEF_V0_GROUP0_pAcc(pos)  * UBX_NAV_POSECEF_V0_PACC_SCALE);
     return n;
 }
 
 static int _strUbxNavHpposecef(char *info, const int size, const uint8_t *msg, const int msgSize)
 {
-    if ( (msgSize != UBX_NAV_HPPOSECEF_V0_SIZE) || (UBX_NAV_HPPOSECEF_VERSION_GET(msg) != UBX_NAV_HPPOSECEF_V0_VERSION) )
+    UBX_VIEW_t view;
+    if (!UBX_NAV_HPPOSECEF_V0_view(&view, msg, msgSize))
     {
         return 0;
     }
-    UBX_NAV_HPPOSECEF_V0_GROUP0_t pos;
-    memcpy(&pos, &msg[UBX_HEAD_SIZE], sizeof(pos));
-    if (!F(pos.flags, UBX_NAV_HPPOSECEF_V0_FLAGS_INVALIDECEF))
+    const uint8_t *pos = view.head;
+    const uint32_t iTOW = UBX_NAV_HPPOSECEF_V0_GROUP0_iTOW(pos);
+    if (!F(UBX_NAV_HPPOSECEF_V0_GROUP0_flags(pos), UBX_NAV_HPPOSECEF_V0_FLAGS_INVALIDECEF))
     {
         return snprintf(info, size, "%010.3f %.3f %.3f %.3f %.3f",
-            (double)pos.iTOW * 1e-3,
-            ((double)pos.ecefX * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_SCALE) + ((double)pos.ecefXHp * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_HP_SCALE),
-            ((double)pos.ecefY * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_SCALE) + ((double)pos.ecefYHp * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_HP_SCALE),
-            ((double)pos.ecefZ * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_SCALE) + ((double)pos.ecefZHp * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_HP_SCALE),
-            (double)pos.pAcc  * UBX_NAV_HPPOSECEF_V0_PACC_SCALE);
+            (double)iTOW * 1e-3,
+            ((double)UBX_NAV_HPPOSECEF_V0_GROUP0_ecefX(pos) * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_SCALE) + ((double)UBX_NAV_HPPOSECEF_V0_GROUP0_ecefXHp(pos) * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_HP_SCALE),
+            ((double)UBX_NAV_HPPOSECEF_V0_GROUP0_ecefY(pos) * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_SCALE) + ((double)UBX_NAV_HPPOSECEF_V0_GROUP0_ecefYHp(pos) * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_HP_SCALE),
+            ((double)UBX_NAV_HPPOSECEF_V0_GROUP0_ecefZ(pos) * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_SCALE) + ((double)UBX_NAV_HPPOSECEF_V0_GROUP0_ecefZHp(pos) * UBX_NAV_HPPOSECEF_V0_ECEF_XYZ_HP_SCALE),
+            (double)UBX_NAV_HPPOSECEF_V0_GROUP0_pAcc(pos)  * UBX_NAV_HPPOSECEF_V0_PACC_SCALE);
     }
     else
     {
-        return snprintf(info, size, "%010.3f invalid", (double)pos.iTOW * 1e-3);
+        return snprintf(info, size, "%010.3f invalid", (double)iTOW * 1e-3);
     }
 }
 
 static int _strUbxNavRelposned(char *info, const int size, const uint8_t *msg, const int msgSize)
 {
-    if ( (msgSize != UBX_NAV_RELPOSNED_V1_SIZE) || (UBX_NAV_RELPOSNED_VERSION_GET(msg) != UBX_NAV_RELPOSNED_V1_VERSION) )
+    UBX_VIEW_t view;
+    if (!UBX_NAV_RELPOSNED_V1_view(&view, msg, msgSize))
     {
         return 0;
     }
-    UBX_NAV_RELPOSNED_V1_GROUP0_t rel;
-    memcpy(&rel, &msg[UBX_HEAD_SIZE], sizeof(rel));
-    const int carrSoln = UBX_NAV_RELPOSNED_V1_FLAGS_CARRSOLN_GET(rel.flags);
+    const uint8_t *rel = view.head;
+    const uint32_t flags = UBX_NAV_RELPOSNED_V1_GROUP0_flags(rel);
+    const int carrSoln = UBX_NAV_RELPOSNED_V1_FLAGS_CARRSOLN_GET(flags);
     return snprintf(info, size, "%010.3f N %.3f E %.3f D %.3f L %.3f (%.3f) H %.1f (%.1f) %s %s %s pos:%c head:%c moving:%c posMiss:%c obsMiss:%c norm:%c",
-        (double)rel.iTOW * 1e-3,
-        ((double)rel.relPosN * UBX_NAV_RELPOSNED_V1_RELPOSN_E_D_SCALE) + ((double)rel.relPosHPN * UBX_NAV_RELPOSNED_V1_RELPOSHPN_E_D_SCALE),
-        ((double)rel.relPosE * UBX_NAV_RELPOSNED_V1_RELPOSN_E_D_SCALE) + ((double)rel.relPosHPE * UBX_NAV_RELPOSNED_V1_RELPOSHPN_E_D_SCALE),
-        ((double)rel.relPosD * UBX_NAV_RELPOSNED_V1_RELPOSN_E_D_SCALE) + ((double)rel.relPosHPD * UBX_NAV_RELPOSNED_V1_RELPOSHPN_E_D_SCALE),
-        ((double)rel.relPosLength * UBX_NAV_RELPOSNED_V1_RELPOSLENGTH_SCALE) + ((double)rel.relPosHPLength * UBX_NAV_RELPOSNED_V1_RELPOSHPLENGTH_SCALE),
-        ((double)rel.accLength * UBX_NAV_RELPOSNED_V1_ACCLENGTH_SCALE),
-        ((double)rel.relPosHeading * UBX_NAV_RELPOSNED_V1_RELPOSHEADING_SCALE),
-        ((double)rel.accHeading * UBX_NAV_RELPOSNED_V1_ACCHEADING_SCALE),
-        F(rel.flags, UBX_NAV_RELPOSNED_V1_FLAGS_GNSSFIXOK)        ? "OK" : "masked",
-        F(rel.flags, UBX_NAV_RELPOSNED_V1_FLAGS_DIFFSOLN)         ? "diff" : "(diff)",
+        (double)UBX_NAV_RELPOSNED_V1_GROUP0_iTOW(rel) * 1e-3,
+        ((double)UBX_NAV_RELPOSNED_V1_GROUP0_relPosN(rel) * UBX_NAV_RELPOSNED_V1_RELPOSN_E_D_SCALE) + ((double)UBX_NAV_RELPOSNED_V1_GROUP0_relPosHPN(rel) * UBX_NAV_RELPOSNED_V1_RELPOSHPN_E_D_SCALE),
+        ((double)UBX_NAV_RELPOSNED_V1_GROUP0_relPosE(rel) * UBX_NAV_RELPOSNED_V1_RELPOSN_E_D_SCALE) + ((double)UBX_NAV_RELPOSNED_V1_GROUP0_relPosHPE(rel) * UBX_NAV_RELPOSNED_V1_RELPOSHPN_E_D_SCALE),
+        ((double)UBX_NAV_RELPOSNED_V1_GROUP0_relPosD(rel) * UBX_NAV_RELPOSNED_V1_RELPOSN_E_D_SCALE) + ((double)UBX_NAV_RELPOSNED_V1_GROUP0_relPosHPD(rel) * UBX_NAV_RELPOSNED_V1_RELPOSHPN_E_D_SCALE),
+        ((double)UBX_NAV_RELPOSNED_V1_GROUP0_relPosLength(rel) * UBX_NAV_RELPOSNED_V1_RELPOSLENGTH_SCALE) + ((double)UBX_NAV_RELPOSNED_V1_GROUP0_relPosHPLength(rel) * UBX_NAV_RELPOSNED_V1_RELPOSHPLENGTH_SCALE),
+        ((double)UBX_NAV_RELPOSNED_V1_GROUP0_accLength(rel) * UBX_NAV_RELPOSNED_V1_ACCLENGTH_SCALE),
+        ((double)UBX_NAV_RELPOSNED_V1_GROUP0_relPosHeading(rel) * UBX_NAV_RELPOSNED_V1_RELPOSHEADING_SCALE),
+        ((double)UBX_NAV_RELPOSNED_V1_GROUP0_accHeading(rel) * UBX_NAV_RELPOSNED_V1_ACCHEADING_SCALE),
+        F(flags, UBX_NAV_RELPOSNED_V1_FLAGS_GNSSFIXOK)        ? "OK" : "masked",
+        F(flags, UBX_NAV_RELPOSNED_V1_FLAGS_DIFFSOLN)         ? "diff" : "(diff)",
         carrSoln == 0 ? "none" : (carrSoln == 1 ? "float" : (carrSoln == 2 ? "fixed" : "rtk?")),
-        F(rel.flags, UBX_NAV_RELPOSNED_V1_FLAGS_RELPOSVALID)        ? 'Y' : 'N',
-        F(rel.flags, UBX_NAV_RELPOSNED_V1_FLAGS_RELPOSHEADINGVALID) ? 'Y' : 'N',
-        F(rel.flags, UBX_NAV_RELPOSNED_V1_FLAGS_ISMOVING)           ? 'Y' : 'N',
-        F(rel.flags, UBX_NAV_RELPOSNED_V1_FLAGS_REFPOSMISS)         ? 'Y' : 'N',
-        F(rel.flags, UBX_NAV_RELPOSNED_V1_FLAGS_REFOBSMISS)         ? 'Y' : 'N',
-        F(rel.flags, UBX_NAV_RELPOSNED_V1_FLAGS_RELPOSNORMALIZED)   ? 'Y' : 'N');
+        F(flags, UBX_NAV_RELPOSNED_V1_FLAGS_RELPOSVALID)        ? 'Y' : 'N',
+        F(flags, UBX_NAV_RELPOSNED_V1_FLAGS_RELPOSHEADINGVALID) ? 'Y' : 'N',
+        F(flags, UBX_NAV_RELPOSNED_V1_FLAGS_ISMOVING)           ? 'Y' : 'N',
+        F(flags, UBX_NAV_RELPOSNED_V1_FLAGS_REFPOSMISS)         ? 'Y' : 'N',
+        F(flags, UBX_NAV_RELPOSNED_V1_FLAGS_REFOBSMISS)         ? 'Y' : 'N',
+        F(flags, UBX_NAV_RELPOSNED_V1_FLAGS_RELPOSNORMALIZED)   ? 'Y' : 'N');
 }
 
 static int _strUbxNavStatus(char *info, const int size, const uint8_t *msg, const int msgSize)
 {
-    if (msgSize != UBX_NAV_STATUS_V0_SIZE)
+    UBX_VIEW_t view;
+    if (!UBX_NAV_STATUS_V0_view(&view, msg, msgSize))
     {
         return 0;
     }
-    UBX_NAV_STATUS_V0_GROUP0_t sta;
-    memcpy(&sta, &msg[UBX_HEAD_SIZE], sizeof(sta));
+    const uint8_t *sta = view.head;
     return snprintf(info, size, "%010.3f ttff=%.3f sss=%.3f",
-        (double)sta.iTow * 1e-3, (double)sta.ttff * 1e-3, (double)sta.msss * 1e-3);
+        (double)UBX_NAV_STATUS_V0_GROUP0_iTow(sta) * 1e-3, (double)UBX_NAV_STATUS_V0_GROUP0_ttff(sta) * 1e-3, (double)UBX_NAV_STATUS_V0_GROUP0_msss(sta) * 1e-3);
 }
 
 static int _strUbxNavTimegps(char *info, const int size, const uint8_t *msg, const int msgSize)
 {
-    if (msgSize != UBX_NAV_TIMEGPS_V0_SIZE)
+    UBX_VIEW_t view;
+    if (!UBX_NAV_TIMEGPS_V0_view(&view, msg, msgSize))
     {
         return 0;
     }
-    UBX_NAV_TIMEGPS_V0_GROUP0_t gps;
-    memcpy(&gps, &msg[UBX_HEAD_SIZE], sizeof(gps));
+    const uint8_t *gps = view.head;
+    const uint32_t iTow = UBX_NAV_TIMEGPS_V0_GROUP0_iTow(gps);
+    const uint8_t valid = UBX_NAV_TIMEGPS_V0_GROUP0_valid(gps);
     return snprintf(info, size, "%010.3f %04u %c %019.9f %c %e",
-        (double)gps.iTow * UBX_NAV_TIMEGPS_V0_ITOW_SCALE,
-        gps.week, F(gps.valid, UBX_NAV_TIMEGPS_V0_VALID_WEEKVALID) ? 'Y' : 'N',
-        ((double)gps.iTow * UBX_NAV_TIMEGPS_V0_ITOW_SCALE) + ((double)gps.fTOW * UBX_NAV_TIMEGPS_V0_FTOW_SCALE),
-         F(gps.valid, UBX_NAV_TIMEGPS_V0_VALID_TOWVALID) ? 'Y' : 'N',
-         (double)gps.tAcc * UBX_NAV_TIMEGPS_V0_TACC_SCALE);
+        (double)iTow * UBX_NAV_TIMEGPS_V0_ITOW_SCALE,
+        UBX_NAV_TIMEGPS_V0_GROUP0_week(gps), F(valid, UBX_NAV_TIMEGPS_V0_VALID_WEEKVALID) ? 'Y' : 'N',
+        ((double)iTow * UBX_NAV_TIMEGPS_V0_ITOW_SCALE) + ((double)UBX_NAV_TIMEGPS_V0_GROUP0_fTOW(gps) * UBX_NAV_TIMEGPS_V0_FTOW_SCALE),
+         F(valid, UBX_NAV_TIMEGPS_V0_VALID_TOWVALID) ? 'Y' : 'N',
+         (double)UBX_NAV_TIMEGPS_V0_GROUP0_tAcc(gps) * UBX_NAV_TIMEGPS_V0_TACC_SCALE);
 }
 
 static int _strUbxNavTimegal(char *info, const int size, const uint8_t *msg, const int msgSize)
 {
-    if (msgSize != UBX_NAV_TIMEGAL_V0_SIZE)
+    UBX_VIEW_t view;
+    if (!UBX_NAV_TIMEGAL_V0_view(&view, msg, msgSize))
     {
         return 0;
     }
-    UBX_NAV_TIMEGAL_V0_GROUP0_t gal;
-    memcpy(&gal, &msg[UBX_HEAD_SIZE], sizeof(gal));
+    const uint8_t *gal = view.head;
+    const uint8_t valid = UBX_NAV_TIMEGAL_V0_GROUP0_valid(gal);
     return snprintf(info, size, "%010.3f %04u %c %019.9f %c %e",
-        (double)gal.iTow * UBX_NAV_TIMEGAL_V0_ITOW_SCALE,
-        gal.galWno, F(gal.valid, UBX_NAV_TIMEGAL_V0_VALID_GALWNOVALID) ? 'Y' : 'N',
-        (double)gal.galTow + ((double)gal.fGalTow * UBX_NAV_TIMEGAL_V0_FGALTOW_SCALE),
-        F(gal.valid, UBX_NAV_TIMEGAL_V0_VALID_GALTOWVALID) ? 'Y' : 'N',
-        (double)gal.tAcc * UBX_NAV_TIMEGAL_V0_TACC_SCALE);
+        (double)UBX_NAV_TIMEGAL_V0_GROUP0_iTow(gal) * UBX_NAV_TIMEGAL_V0_ITOW_SCALE,
+        UBX_NAV_TIMEGAL_V0_GROUP0_galWno(gal), F(valid, UBX_NAV_TIMEGAL_V0_VALID_GALWNOVALID) ? 'Y' : 'N',
+        (double)UBX_NAV_TIMEGAL_V0_GROUP0_galTow(gal) + ((double)UBX_NAV_TIMEGAL_V0_GROUP0_fGalTow(gal) * UBX_NAV_TIMEGAL_V0_FGALTOW_SCALE),
+        F(valid, UBX_NAV_TIMEGAL_V0_VALID_GALTOWVALID) ? 'Y' : 'N',
+        (double)UBX_NAV_TIMEGAL_V0_GROUP0_tAcc(gal) * UBX_NAV_TIMEGAL_V0_TACC_SCALE);
 }
 
 static int _strUbxNavTimebds(char *info, const int size, const uint8_t *msg, const int msgSize)
 {
-    if (msgSize != UBX_NAV_TIMEBDS_V0_SIZE)
+    UBX_VIEW_t view;
+    if (!UBX_NAV_TIMEBDS_V0_view(&view, msg, msgSize))
     {
         return 0;
     }
-    UBX_NAV_TIMEBDS_V0_GROUP0_t bds;
-    memcpy(&bds, &msg[UBX_HEAD_SIZE], sizeof(bds));
+    const uint8_t *bds = view.head;
+    const uint8_t valid = UBX_NAV_TIMEBDS_V0_GROUP0_valid(bds);
     return snprintf(info, size, "%010.3f %04u %c %019.9f %c %e",
-        (double)bds.iTow * UBX_NAV_TIMEBDS_V0_ITOW_SCALE,
-        bds.week, F(bds.valid, UBX_NAV_TIMEBDS_V0_VALID_WEEKVALID) ? 'Y' : 'N',
-        (double)bds.SOW + ((double)bds.fSOW * UBX_NAV_TIMEBDS_V0_FSOW_SCALE),
-        F(bds.valid, UBX_NAV_TIMEBDS_V0_VALID_SOWVALID) ? 'Y' : 'N',
-        (double)bds.tAcc * UBX_NAV_TIMEGAL_V0_TACC_SCALE);
+        (double)UBX_NAV_TIMEBDS_V0_GROUP0_iTow(bds) * UBX_NAV_TIMEBDS_V0_ITOW_SCALE,
+        UBX_NAV_TIMEBDS_V0_GROUP0_week(bds), F(valid, UBX_NAV_TIMEBDS_V0_VALID_WEEKVALID) ? 'Y' : 'N',
+        (double)UBX_NAV_TIMEBDS_V0_GROUP0_SOW(bds) + ((double)UBX_NAV_TIMEBDS_V0_GROUP0_fSOW(bds) * UBX_NAV_TIMEBDS_V0_FSOW_SCALE),
+        F(valid, UBX_NAV_TIMEBDS_V0_VALID_SOWVALID) ? 'Y' : 'N',
+        (double)UBX_NAV_TIMEBDS_V0_GROUP0_tAcc(bds) * UBX_NAV_TIMEGAL_V0_TACC_SCALE);
 }
 
 static int _strUbxNavTimeglo(char *info, const int size, const uint8_t *msg, const int msgSize)
 {
-    if (msgSize != UBX_NAV_TIMEGLO_V0_SIZE)
+    UBX_VIEW_t view;
+    if (!UBX_NAV_TIMEGLO_V0_view(&view, msg, msgSize))
     {
         return 0;
     }
-    UBX_NAV_TIMEGLO_V0_GROUP0_t glo;
-    memcpy(&glo, &msg[UBX_HEAD_SIZE], sizeof(glo));
+    const uint8_t *glo = view.head;
+    const uint8_t valid = UBX_NAV_TIMEGLO_V0_GROUP0_valid(glo);
     return snprintf(info, size, "%010.3f %04u %03u %c %015.9f %c %e",
-        (double)glo.iTow * UBX_NAV_TIMEGLO_V0_ITOW_SCALE,
-        glo.Nt, glo.N4, F(glo.valid, UBX_NAV_TIMEGLO_V0_VALID_DATEVALID) ? 'Y' : 'N',
-        (double)glo.TOD + ((double)glo.fTOD * UBX_NAV_TIMEGLO_V0_FTOD_SCALE),
-        F(glo.valid, UBX_NAV_TIMEGLO_V0_VALID_TODVALID) ? 'Y' : 'N',
-        (double)glo.tAcc * UBX_NAV_TIMEGAL_V0_TACC_SCALE);
+        (double)UBX_NAV_TIMEGLO_V0_GROUP0_iTow(glo) * UBX_NAV_TIMEGLO_V0_ITOW_SCALE,
+        UBX_NAV_TIMEGLO_V0_GROUP0_Nt(glo), UBX_NAV_TIMEGLO_V0_GROUP0_N4(glo), F(valid, UBX_NAV_TIMEGLO_V0_VALID_DATEVALID) ? 'Y' : 'N',
+        (double)UBX_NAV_TIMEGLO_V0_GROUP0_TOD(glo) + ((double)UBX_NAV_TIMEGLO_V0_GROUP0_fTOD(glo) * UBX_NAV_TIMEGLO_V0_FTOD_SCALE),
+        F(valid, UBX_NAV_TIMEGLO_V0_VALID_TODVALID) ? 'Y' : 'N',
+        (double)UBX_NAV_TIMEGLO_V0_GROUP0_tAcc(glo) * UBX_NAV_TIMEGAL_V0_TACC_SCALE);
 }
 
 static int _strUbxNavSig(char *info, const int size, const uint8_t *msg, const int msgSize)
 {
-    if ( (msgSize < UBX_NAV_SIG_V0_MIN_SIZE) || (UBX_NAV_SIG_VERSION_GET(msg) != UBX_NAV_SIG_V0_VERSION) )
+    UBX_VIEW_t view;
+    if (!UBX_NAV_SIG_V0_view(&view, msg, msgSize))
     {
         return 0;
     }
-    UBX_NAV_SIG_V0_GROUP0_t head;
-    memcpy(&head, &msg[UBX_HEAD_SIZE], sizeof(head));
-    return snprintf(info, size, "%010.3f %d", (double)head.iTOW * 1e-3, head.numSigs);
+    const uint8_t *head = view.head;
+    return snprintf(info, size, "%010.3f %d", (double)UBX_NAV_SIG_V0_GROUP0_iTOW(head) * 1e-3, UBX_NAV_SIG_V0_GROUP0_numSigs(head));
 }
 
 static int _strUbxNavSat(char *info, const int size, const uint8_t *msg, const int msgSize)
 {
-    if ( (msgSize < UBX_NAV_SAT_V1_MIN_SIZE) || (UBX_NAV_SAT_VERSION_GET(msg) != UBX_NAV_SAT_V1_VERSION) )
+    UBX_VIEW_t view;
+    if (!UBX_NAV_SAT_V1_view(&view, msg, msgSize))
     {
         return 0;
     }
-    UBX_NAV_SAT_V1_GROUP0_t head;
-    memcpy(&head, &msg[UBX_HEAD_SIZE], sizeof(head));
-    return snprintf(info, size, "%010.3f %d", (double)head.iTOW * 1e-3, head.numSvs);
+    const uint8_t *head = view.head;
+    return snprintf(info, size, "%010.3f %d", (double)UBX_NAV_SAT_V1_GROUP0_iTOW(head) * 1e-3, UBX_NAV_SAT_V1_GROUP0_numSvs(head));
 }
 
 static int _strUbxInf(char *info, const int size, const uint8_t *msg, const int msgSize)
@@ -1226,42 +1237,43 @@ static int _strUbxCfgValget(char *info, const int size, const uint8_t *msg, cons
 
 static int _strUbxAckAck(char *info, const int size, const uint8_t *msg, const int msgSize, const bool ack)
 {
-    if (msgSize < (int)sizeof(UBX_ACK_ACK_V0_GROUP0_t))
+    UBX_VIEW_t view;
+    if (!UBX_ACK_ACK_V0_view(&view, msg, msgSize))
     {
         return 0;
     }
-    UBX_ACK_ACK_V0_GROUP0_t /* (= UBX_ACK_NAK_V0_GROUP0_t) */ acknak;
-    memcpy(&acknak, &msg[UBX_HEAD_SIZE], sizeof(acknak));
+    const uint8_t *acknak = view.head;
     char tmp[100];
-    ubxMessageNameIds(tmp, sizeof(tmp), acknak.clsId, acknak.msgId);
+    ubxMessageNameIds(tmp, sizeof(tmp), UBX_ACK_ACK_V0_GROUP0_clsId(acknak), UBX_ACK_ACK_V0_GROUP0_msgId(acknak));
     return snprintf(info, size, "%s %s", ack ? "acknowledgement" : "negative-acknowledgement", tmp);
 }
 
 static int _strUbxTimTm2(char *info, const int size, const uint8_t *msg, const int msgSize)
 {
-    if (msgSize != UBX_TIM_TM2_V0_SIZE)
+    UBX_VIEW_t view;
+    if (!UBX_TIM_TM2_V0_view(&view, msg, msgSize))
     {
         return 0;
     }
-    UBX_TIM_TM2_V0_GROUP0_t tm;
-    memcpy(&tm, &msg[UBX_HEAD_SIZE], sizeof(tm));
+    const uint8_t *tm = view.head;
+    const uint8_t flags = UBX_TIM_TM2_V0_GROUP0_flags(tm);
 
-    const uint8_t timeBase = UBX_TIM_TM2_V0_FLAGS_TIMEBASE_GET(tm.flags);
+    const uint8_t timeBase = UBX_TIM_TM2_V0_FLAGS_TIMEBASE_GET(flags);
     const char *timeBaseStr[] = { "RX", "GNSS", "UTC" };
-    const double towR = ((double)tm.towMsR * UBX_TIM_TM2_V0_TOW_SCALE) + ((double)tm.towSubMsR * UBX_TIM_TM2_V0_SUBMS_SCALE);
-    const double towF = ((double)tm.towMsF * UBX_TIM_TM2_V0_TOW_SCALE) + ((double)tm.towSubMsF * UBX_TIM_TM2_V0_SUBMS_SCALE);
+    const double towR = ((double)UBX_TIM_TM2_V0_GROUP0_towMsR(tm) * UBX_TIM_TM2_V0_TOW_SCALE) + ((double)UBX_TIM_TM2_V0_GROUP0_towSubMsR(tm) * UBX_TIM_TM2_V0_SUBMS_SCALE);
+    const double towF = ((double)UBX_TIM_TM2_V0_GROUP0_towMsF(tm) * UBX_TIM_TM2_V0_TOW_SCALE) + ((double)UBX_TIM_TM2_V0_GROUP0_towSubMsF(tm) * UBX_TIM_TM2_V0_SUBMS_SCALE);
 
     return snprintf(info, size, "%04u:%013.6f %04u:%013.6f INT%u %c %c %s %s %s %s %s %u %.6g",
-        tm.wnR, towR, tm.wnF, towF,
-        tm.ch,
-        F(tm.flags, UBX_TIM_TM2_V0_FLAGS_NEWRISINGEDGE) ? 'R' : '-',
-        F(tm.flags, UBX_TIM_TM2_V0_FLAGS_NEWFALLINGEDGE) ? 'F' : '-',
-        UBX_TIM_TM2_V0_FLAGS_MODE_GET(tm.flags) == UBX_TIM_TM2_V0_FLAGS_MODE_SINGLE ? "single" : "running",
-        UBX_TIM_TM2_V0_FLAGS_RUN_GET(tm.flags) == UBX_TIM_TM2_V0_FLAGS_RUN_ARMED ? "armed" : "stopped",
+        UBX_TIM_TM2_V0_GROUP0_wnR(tm), towR, UBX_TIM_TM2_V0_GROUP0_wnF(tm), towF,
+        UBX_TIM_TM2_V0_GROUP0_ch(tm),
+        F(flags, UBX_TIM_TM2_V0_FLAGS_NEWRISINGEDGE) ? 'R' : '-',
+        F(flags, UBX_TIM_TM2_V0_FLAGS_NEWFALLINGEDGE) ? 'F' : '-',
+        UBX_TIM_TM2_V0_FLAGS_MODE_GET(flags) == UBX_TIM_TM2_V0_FLAGS_MODE_SINGLE ? "single" : "running",
+        UBX_TIM_TM2_V0_FLAGS_RUN_GET(flags) == UBX_TIM_TM2_V0_FLAGS_RUN_ARMED ? "armed" : "stopped",
         timeBase < NUMOF(timeBaseStr) ? timeBaseStr[timeBase] : "?",
-        F(tm.flags, UBX_TIM_TM2_V0_FLAGS_UTCACAVAIL) ? "UTC" : "n/a",
-        F(tm.flags, UBX_TIM_TM2_V0_FLAGS_TIMEVALID) ? "valid" : "invalid",
-        tm.count, (double)tm.accEst * UBX_TIM_TM2_V0_ACCEST_SCALE);
+        F(flags, UBX_TIM_TM2_V0_FLAGS_UTCACAVAIL) ? "UTC" : "n/a",
+        F(flags, UBX_TIM_TM2_V0_FLAGS_TIMEVALID) ? "valid" : "invalid",
+        UBX_TIM_TM2_V0_GROUP0_count(tm), (double)UBX_TIM_TM2_V0_GROUP0_accEst(tm) * UBX_TIM_TM2_V0_ACCEST_SCALE);
 }
 // message   11, dt   63, size   36, UBX      UBX-TIM-TM2          2253:061563.388047 2253:061563.588086 INT0 - F running armed GNSS n/a valid 46887 1.3e-08
 // message   43, dt  558, size   36, UBX      UBX-TIM-TM2          2253:061564.387529 2253:061563.588086 INT0 R - running armed GNSS n/a valid 46888 1.3e-08
@@ -0,0 +1,1811 @@
+// flipflip's UBX protocol: typed message views
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+//
+// *** Generated by ff_ubx_view.pl from ff_ubx.h, do not edit. ***
+//
+// Typed, zero-copy views of UBX messages. The view functions (UBX_<CLS>_<MSG>_V<n>_view()) check the
+// message size (and version) once and set up a UBX_VIEW_t. The field accessors
+// (UBX_<CLS>_<MSG>_V<n>_GROUP<m>_<field>()) then read the fields directly from the message. For
+// example:
+//
+//     UBX_VIEW_t view;
+//     if (UBX_NAV_SIG_V0_view(&view, msg, msgSize))
+//     {
+//         for (int ix = 0; ix < view.numGroups; ix++)
+//         {
+//             const uint8_t *sig = UBX_VIEW_GROUP(&view, ix);
+//             const int cno = UBX_NAV_SIG_V0_GROUP1_cno(sig);
+//         }
+//     }
+//
+// In C++ the repeated groups can be iterated using Ff::UbxGroups (ff_cpp.hpp).
+
+#ifndef __FF_UBX_VIEW_H__
+#define __FF_UBX_VIEW_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "ff_ubx.h"
+
+/* ****************************************************************************************************************** */
+
+//! View of a UBX message
+typedef struct UBX_VIEW_s
+{
+    const uint8_t *head;       //!< Payload head (group 0)
+    const uint8_t *groups;     //!< First repeated group (group 1), NULL if the message has none
+    int            numGroups;  //!< Number of repeated groups (0 if the message does not tell the number)
+    int            groupSize;  //!< Size of a repeated group
+} UBX_VIEW_t;
+
+//! Get repeated group ix (0..UBX_VIEW_t.numGroups-1) of a view
+#define UBX_VIEW_GROUP(view, ix) (&(view)->groups[(ix) * (view)->groupSize])
+
+// Little-endian readers
+static inline uint8_t  ubxViewU1(const uint8_t *p) { return p[0]; }
+static inline int8_t   ubxViewI1(const uint8_t *p) { return (int8_t)p[0]; }
+static inline uint16_t ubxViewU2(const uint8_t *p) { return (uint16_t)p[0] | (uint16_t)((uint16_t)p[1] << 8); }
+static inline int16_t  ubxViewI2(const uint8_t *p) { return (int16_t)ubxViewU2(p); }
+static inline uint32_t ubxViewU4(const uint8_t *p) { return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+static inline int32_t  ubxViewI4(const uint8_t *p) { return (int32_t)ubxViewU4(p); }
+static inline float    ubxViewR4(const uint8_t *p) { const uint32_t u = ubxViewU4(p); float r; memcpy(&r, &u, sizeof(r)); return r; }
+static inline double   ubxViewR8(const uint8_t *p) { const uint64_t u = (uint64_t)ubxViewU4(p) | ((uint64_t)ubxViewU4(&p[4]) << 32); double r; memcpy(&r, &u, sizeof(r)); return r; }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-CFG-VALSET (version 0)
+
+#define UBX_CFG_VALSET_V0_GROUP0_SIZE 4 //!< Size of UBX_CFG_VALSET_V0_GROUP0_t
+static inline uint8_t UBX_CFG_VALSET_V0_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint8_t UBX_CFG_VALSET_V0_GROUP0_layers(const uint8_t *grp) { return ubxViewU1(&grp[1]); }
+
+//! Get view of a UBX-CFG-VALSET (version 0) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_CFG_VALSET_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize < (UBX_FRAME_SIZE + UBX_CFG_VALSET_V0_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 0] != UBX_CFG_VALSET_V0_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-CFG-VALSET (version 1)
+
+#define UBX_CFG_VALSET_V1_GROUP0_SIZE 4 //!< Size of UBX_CFG_VALSET_V1_GROUP0_t
+static inline uint8_t UBX_CFG_VALSET_V1_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint8_t UBX_CFG_VALSET_V1_GROUP0_layers(const uint8_t *grp) { return ubxViewU1(&grp[1]); }
+static inline uint8_t UBX_CFG_VALSET_V1_GROUP0_transaction(const uint8_t *grp) { return ubxViewU1(&grp[2]); }
+
+//! Get view of a UBX-CFG-VALSET (version 1) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_CFG_VALSET_V1_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize < (UBX_FRAME_SIZE + UBX_CFG_VALSET_V1_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 0] != UBX_CFG_VALSET_V1_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-CFG-VALGET (version 0)
+
+#define UBX_CFG_VALGET_V0_GROUP0_SIZE 4 //!< Size of UBX_CFG_VALGET_V0_GROUP0_t
+static inline uint8_t UBX_CFG_VALGET_V0_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint8_t UBX_CFG_VALGET_V0_GROUP0_layer(const uint8_t *grp) { return ubxViewU1(&grp[1]); }
+static inline uint16_t UBX_CFG_VALGET_V0_GROUP0_position(const uint8_t *grp) { return ubxViewU2(&grp[2]); }
+
+//! Get view of a UBX-CFG-VALGET (version 0) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_CFG_VALGET_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize < (UBX_FRAME_SIZE + UBX_CFG_VALGET_V0_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 0] != UBX_CFG_VALGET_V0_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-CFG-VALGET (version 1)
+
+#define UBX_CFG_VALGET_V1_GROUP0_SIZE 4 //!< Size of UBX_CFG_VALGET_V1_GROUP0_t
+static inline uint8_t UBX_CFG_VALGET_V1_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint8_t UBX_CFG_VALGET_V1_GROUP0_layer(const uint8_t *grp) { return ubxViewU1(&grp[1]); }
+static inline uint16_t UBX_CFG_VALGET_V1_GROUP0_position(const uint8_t *grp) { return ubxViewU2(&grp[2]); }
+
+//! Get view of a UBX-CFG-VALGET (version 1) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_CFG_VALGET_V1_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize < (UBX_FRAME_SIZE + UBX_CFG_VALGET_V1_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 0] != UBX_CFG_VALGET_V1_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-CFG-VALDEL (version 1)
+
+#define UBX_CFG_VALDEL_V1_GROUP0_SIZE 4 //!< Size of UBX_CFG_VALDEL_V1_GROUP0_t
+static inline uint8_t UBX_CFG_VALDEL_V1_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint8_t UBX_CFG_VALDEL_V1_GROUP0_layers(const uint8_t *grp) { return ubxViewU1(&grp[1]); }
+static inline uint8_t UBX_CFG_VALDEL_V1_GROUP0_transaction(const uint8_t *grp) { return ubxViewU1(&grp[2]); }
+
+//! Get view of a UBX-CFG-VALDEL (version 1) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_CFG_VALDEL_V1_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize < (UBX_FRAME_SIZE + UBX_CFG_VALDEL_V1_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 0] != UBX_CFG_VALDEL_V1_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-CFG-RST (version 0)
+
+#define UBX_CFG_RST_V0_GROUP0_SIZE 4 //!< Size of UBX_CFG_RST_V0_GROUP0_t
+static inline uint16_t UBX_CFG_RST_V0_GROUP0_navBbrMask(const uint8_t *grp) { return ubxViewU2(&grp[0]); }
+static inline uint8_t UBX_CFG_RST_V0_GROUP0_resetMode(const uint8_t *grp) { return ubxViewU1(&grp[2]); }
+
+//! Get view of a UBX-CFG-RST (version 0) message, returns false if the message is too short
+static inline bool UBX_CFG_RST_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_CFG_RST_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-CFG-CFG (version 0)
+
+#define UBX_CFG_CFG_V0_GROUP0_SIZE 12 //!< Size of UBX_CFG_CFG_V0_GROUP0_t
+static inline uint32_t UBX_CFG_CFG_V0_GROUP0_clearMask(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline uint32_t UBX_CFG_CFG_V0_GROUP0_saveMask(const uint8_t *grp) { return ubxViewU4(&grp[4]); }
+static inline uint32_t UBX_CFG_CFG_V0_GROUP0_loadMask(const uint8_t *grp) { return ubxViewU4(&grp[8]); }
+
+#define UBX_CFG_CFG_V0_GROUP1_SIZE 1 //!< Size of UBX_CFG_CFG_V0_GROUP1_t
+static inline uint8_t UBX_CFG_CFG_V0_GROUP1_deviceMask(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+
+//! Get view of a UBX-CFG-CFG (version 0) message, returns false if the message is too short
+static inline bool UBX_CFG_CFG_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize < (UBX_FRAME_SIZE + UBX_CFG_CFG_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = &msg[UBX_HEAD_SIZE + UBX_CFG_CFG_V0_GROUP0_SIZE];
+    view->groupSize = UBX_CFG_CFG_V0_GROUP1_SIZE;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-MON-VER (version 0)
+
+#define UBX_MON_VER_V0_GROUP0_SIZE 40 //!< Size of UBX_MON_VER_V0_GROUP0_t
+static inline const char *UBX_MON_VER_V0_GROUP0_swVersion(const uint8_t *grp) { return (const char *)&grp[0]; } //!< char [30]
+static inline const char *UBX_MON_VER_V0_GROUP0_hwVersion(const uint8_t *grp) { return (const char *)&grp[30]; } //!< char [10]
+
+#define UBX_MON_VER_V0_GROUP1_SIZE 30 //!< Size of UBX_MON_VER_V0_GROUP1_t
+static inline const char *UBX_MON_VER_V0_GROUP1_extension(const uint8_t *grp) { return (const char *)&grp[0]; } //!< char [30]
+
+//! Get view of a UBX-MON-VER (version 0) message, returns false if the message is too short
+static inline bool UBX_MON_VER_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize < (UBX_FRAME_SIZE + UBX_MON_VER_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = &msg[UBX_HEAD_SIZE + UBX_MON_VER_V0_GROUP0_SIZE];
+    view->groupSize = UBX_MON_VER_V0_GROUP1_SIZE;
+    view->numGroups = (msgSize - UBX_FRAME_SIZE - UBX_MON_VER_V0_GROUP0_SIZE) / UBX_MON_VER_V0_GROUP1_SIZE;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-MON-HW (version 0)
+
+#define UBX_MON_HW_V0_GROUP0_SIZE 60 //!< Size of UBX_MON_HW_V0_GROUP0_t
+static inline uint32_t UBX_MON_HW_V0_GROUP0_pinSel(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline uint32_t UBX_MON_HW_V0_GROUP0_pinBank(const uint8_t *grp) { return ubxViewU4(&grp[4]); }
+static inline uint32_t UBX_MON_HW_V0_GROUP0_pinDir(const uint8_t *grp) { return ubxViewU4(&grp[8]); }
+static inline uint32_t UBX_MON_HW_V0_GROUP0_pinVal(const uint8_t *grp) { return ubxViewU4(&grp[12]); }
+static inline uint16_t UBX_MON_HW_V0_GROUP0_noisePerMS(const uint8_t *grp) { return ubxViewU2(&grp[16]); }
+static inline uint16_t UBX_MON_HW_V0_GROUP0_agcCnt(const uint8_t *grp) { return ubxViewU2(&grp[18]); }
+static inline uint8_t UBX_MON_HW_V0_GROUP0_aStatus(const uint8_t *grp) { return ubxViewU1(&grp[20]); }
+static inline uint8_t UBX_MON_HW_V0_GROUP0_aPower(const uint8_t *grp) { return ubxViewU1(&grp[21]); }
+static inline uint8_t UBX_MON_HW_V0_GROUP0_flags(const uint8_t *grp) { return ubxViewU1(&grp[22]); }
+static inline uint32_t UBX_MON_HW_V0_GROUP0_usedMask(const uint8_t *grp) { return ubxViewU4(&grp[24]); }
+static inline const uint8_t *UBX_MON_HW_V0_GROUP0_VP(const uint8_t *grp) { return (const uint8_t *)&grp[28]; } //!< uint8_t [17]
+static inline uint8_t UBX_MON_HW_V0_GROUP0_jamInd(const uint8_t *grp) { return ubxViewU1(&grp[45]); }
+static inline uint32_t UBX_MON_HW_V0_GROUP0_pinIrq(const uint8_t *grp) { return ubxViewU4(&grp[48]); }
+static inline uint32_t UBX_MON_HW_V0_GROUP0_pullH(const uint8_t *grp) { return ubxViewU4(&grp[52]); }
+static inline uint32_t UBX_MON_HW_V0_GROUP0_pullL(const uint8_t *grp) { return ubxViewU4(&grp[56]); }
+
+//! Get view of a UBX-MON-HW (version 0) message, returns false if the message is too short
+static inline bool UBX_MON_HW_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_MON_HW_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-MON-HW2 (version 0)
+
+#define UBX_MON_HW2_V0_GROUP0_SIZE 28 //!< Size of UBX_MON_HW2_V0_GROUP0_t
+static inline int8_t UBX_MON_HW2_V0_GROUP0_ofsI(const uint8_t *grp) { return ubxViewI1(&grp[0]); }
+static inline uint8_t UBX_MON_HW2_V0_GROUP0_magI(const uint8_t *grp) { return ubxViewU1(&grp[1]); }
+static inline int8_t UBX_MON_HW2_V0_GROUP0_ofsQ(const uint8_t *grp) { return ubxViewI1(&grp[2]); }
+static inline uint8_t UBX_MON_HW2_V0_GROUP0_magQ(const uint8_t *grp) { return ubxViewU1(&grp[3]); }
+static inline uint8_t UBX_MON_HW2_V0_GROUP0_cfgSource(const uint8_t *grp) { return ubxViewU1(&grp[4]); }
+static inline uint32_t UBX_MON_HW2_V0_GROUP0_lowLevCfg(const uint8_t *grp) { return ubxViewU4(&grp[8]); }
+static inline uint32_t UBX_MON_HW2_V0_GROUP0_postStatus(const uint8_t *grp) { return ubxViewU4(&grp[20]); }
+
+//! Get view of a UBX-MON-HW2 (version 0) message, returns false if the message is too short
+static inline bool UBX_MON_HW2_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_MON_HW2_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-MON-HW3 (version 0)
+
+#define UBX_MON_HW3_V0_GROUP0_SIZE 22 //!< Size of UBX_MON_HW3_V0_GROUP0_t
+static inline uint8_t UBX_MON_HW3_V0_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint8_t UBX_MON_HW3_V0_GROUP0_nPins(const uint8_t *grp) { return ubxViewU1(&grp[1]); }
+static inline uint8_t UBX_MON_HW3_V0_GROUP0_flags(const uint8_t *grp) { return ubxViewU1(&grp[2]); }
+static inline const char *UBX_MON_HW3_V0_GROUP0_hwVersion(const uint8_t *grp) { return (const char *)&grp[3]; } //!< char [10]
+
+#define UBX_MON_HW3_V0_GROUP1_SIZE 6 //!< Size of UBX_MON_HW3_V0_GROUP1_t
+static inline uint16_t UBX_MON_HW3_V0_GROUP1_pinId(const uint8_t *grp) { return ubxViewU2(&grp[0]); }
+static inline uint16_t UBX_MON_HW3_V0_GROUP1_pinMask(const uint8_t *grp) { return ubxViewU2(&grp[2]); }
+static inline uint8_t UBX_MON_HW3_V0_GROUP1_VP(const uint8_t *grp) { return ubxViewU1(&grp[4]); }
+
+//! Get view of a UBX-MON-HW3 (version 0) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_MON_HW3_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize < (UBX_FRAME_SIZE + UBX_MON_HW3_V0_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 0] != UBX_MON_HW3_V0_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = &msg[UBX_HEAD_SIZE + UBX_MON_HW3_V0_GROUP0_SIZE];
+    view->groupSize = UBX_MON_HW3_V0_GROUP1_SIZE;
+    view->numGroups = UBX_MON_HW3_V0_GROUP0_nPins(view->head);
+    return msgSize >= (UBX_FRAME_SIZE + UBX_MON_HW3_V0_GROUP0_SIZE + (view->numGroups * UBX_MON_HW3_V0_GROUP1_SIZE));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-MON-TEMP (version 0)
+
+#define UBX_MON_TEMP_V0_GROUP0_SIZE 12 //!< Size of UBX_MON_TEMP_V0_GROUP0_t
+static inline uint8_t UBX_MON_TEMP_V0_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline int16_t UBX_MON_TEMP_V0_GROUP0_temperature(const uint8_t *grp) { return ubxViewI2(&grp[4]); }
+static inline uint8_t UBX_MON_TEMP_V0_GROUP0_unknown(const uint8_t *grp) { return ubxViewU1(&grp[6]); }
+
+//! Get view of a UBX-MON-TEMP (version 0) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_MON_TEMP_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_MON_TEMP_V0_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 0] != UBX_MON_TEMP_V0_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-ACK-ACK (version 0)
+
+#define UBX_ACK_ACK_V0_GROUP0_SIZE 2 //!< Size of UBX_ACK_ACK_V0_GROUP0_t
+static inline uint8_t UBX_ACK_ACK_V0_GROUP0_clsId(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint8_t UBX_ACK_ACK_V0_GROUP0_msgId(const uint8_t *grp) { return ubxViewU1(&grp[1]); }
+
+//! Get view of a UBX-ACK-ACK (version 0) message, returns false if the message is too short
+static inline bool UBX_ACK_ACK_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_ACK_ACK_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-ACK-NAK (version 0)
+
+#define UBX_ACK_NAK_V0_GROUP0_SIZE 2 //!< Size of UBX_ACK_NAK_V0_GROUP0_t
+static inline uint8_t UBX_ACK_NAK_V0_GROUP0_clsId(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint8_t UBX_ACK_NAK_V0_GROUP0_msgId(const uint8_t *grp) { return ubxViewU1(&grp[1]); }
+
+//! Get view of a UBX-ACK-NAK (version 0) message, returns false if the message is too short
+static inline bool UBX_ACK_NAK_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_ACK_NAK_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-NAV-COV (version 0)
+
+#define UBX_NAV_COV_V0_GROUP0_SIZE 64 //!< Size of UBX_NAV_COV_V0_GROUP0_t
+static inline uint32_t UBX_NAV_COV_V0_GROUP0_iTOW(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline uint8_t UBX_NAV_COV_V0_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[4]); }
+static inline uint8_t UBX_NAV_COV_V0_GROUP0_posCovValid(const uint8_t *grp) { return ubxViewU1(&grp[5]); }
+static inline uint8_t UBX_NAV_COV_V0_GROUP0_velCovValid(const uint8_t *grp) { return ubxViewU1(&grp[6]); }
+static inline float UBX_NAV_COV_V0_GROUP0_posCovNN(const uint8_t *grp) { return ubxViewR4(&grp[16]); }
+static inline float UBX_NAV_COV_V0_GROUP0_posCovNE(const uint8_t *grp) { return ubxViewR4(&grp[20]); }
+static inline float UBX_NAV_COV_V0_GROUP0_posCovND(const uint8_t *grp) { return ubxViewR4(&grp[24]); }
+static inline float UBX_NAV_COV_V0_GROUP0_posCovEE(const uint8_t *grp) { return ubxViewR4(&grp[28]); }
+static inline float UBX_NAV_COV_V0_GROUP0_posCovED(const uint8_t *grp) { return ubxViewR4(&grp[32]); }
+static inline float UBX_NAV_COV_V0_GROUP0_posCovDD(const uint8_t *grp) { return ubxViewR4(&grp[36]); }
+static inline float UBX_NAV_COV_V0_GROUP0_velCovNN(const uint8_t *grp) { return ubxViewR4(&grp[40]); }
+static inline float UBX_NAV_COV_V0_GROUP0_velCovNE(const uint8_t *grp) { return ubxViewR4(&grp[44]); }
+static inline float UBX_NAV_COV_V0_GROUP0_velCovND(const uint8_t *grp) { return ubxViewR4(&grp[48]); }
+static inline float UBX_NAV_COV_V0_GROUP0_velCovEE(const uint8_t *grp) { return ubxViewR4(&grp[52]); }
+static inline float UBX_NAV_COV_V0_GROUP0_velCovED(const uint8_t *grp) { return ubxViewR4(&grp[56]); }
+static inline float UBX_NAV_COV_V0_GROUP0_velCovDD(const uint8_t *grp) { return ubxViewR4(&grp[60]); }
+
+//! Get view of a UBX-NAV-COV (version 0) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_NAV_COV_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_NAV_COV_V0_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 4] != UBX_NAV_COV_V0_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-NAV-EELL (version 0)
+
+#define UBX_NAV_EELL_V0_GROUP0_SIZE 16 //!< Size of UBX_NAV_EELL_V0_GROUP0_t
+static inline uint32_t UBX_NAV_EELL_V0_GROUP0_iTOW(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline uint8_t UBX_NAV_EELL_V0_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[4]); }
+static inline uint16_t UBX_NAV_EELL_V0_GROUP0_errEllipseOrient(const uint8_t *grp) { return ubxViewU2(&grp[6]); }
+static inline uint32_t UBX_NAV_EELL_V0_GROUP0_errEllipseMajor(const uint8_t *grp) { return ubxViewU4(&grp[8]); }
+static inline uint32_t UBX_NAV_EELL_V0_GROUP0_errEllipseMinor(const uint8_t *grp) { return ubxViewU4(&grp[12]); }
+
+//! Get view of a UBX-NAV-EELL (version 0) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_NAV_EELL_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize < (UBX_FRAME_SIZE + UBX_NAV_EELL_V0_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 4] != UBX_NAV_EELL_V0_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-NAV-EOE (version 0)
+
+#define UBX_NAV_EOE_V0_GROUP0_SIZE 4 //!< Size of UBX_NAV_EOE_V0_GROUP0_t
+static inline uint32_t UBX_NAV_EOE_V0_GROUP0_iTOW(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+
+//! Get view of a UBX-NAV-EOE (version 0) message, returns false if the message is too short
+static inline bool UBX_NAV_EOE_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_NAV_EOE_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-NAV-HPPOSECEF (version 0)
+
+#define UBX_NAV_HPPOSECEF_V0_GROUP0_SIZE 28 //!< Size of UBX_NAV_HPPOSECEF_V0_GROUP0_t
+static inline uint8_t UBX_NAV_HPPOSECEF_V0_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint32_t UBX_NAV_HPPOSECEF_V0_GROUP0_iTOW(const uint8_t *grp) { return ubxViewU4(&grp[4]); }
+static inline int32_t UBX_NAV_HPPOSECEF_V0_GROUP0_ecefX(const uint8_t *grp) { return ubxViewI4(&grp[8]); }
+static inline int32_t UBX_NAV_HPPOSECEF_V0_GROUP0_ecefY(const uint8_t *grp) { return ubxViewI4(&grp[12]); }
+static inline int32_t UBX_NAV_HPPOSECEF_V0_GROUP0_ecefZ(const uint8_t *grp) { return ubxViewI4(&grp[16]); }
+static inline int8_t UBX_NAV_HPPOSECEF_V0_GROUP0_ecefXHp(const uint8_t *grp) { return ubxViewI1(&grp[20]); }
+static inline int8_t UBX_NAV_HPPOSECEF_V0_GROUP0_ecefYHp(const uint8_t *grp) { return ubxViewI1(&grp[21]); }
+static inline int8_t UBX_NAV_HPPOSECEF_V0_GROUP0_ecefZHp(const uint8_t *grp) { return ubxViewI1(&grp[22]); }
+static inline uint8_t UBX_NAV_HPPOSECEF_V0_GROUP0_flags(const uint8_t *grp) { return ubxViewU1(&grp[23]); }
+static inline uint32_t UBX_NAV_HPPOSECEF_V0_GROUP0_pAcc(const uint8_t *grp) { return ubxViewU4(&grp[24]); }
+
+//! Get view of a UBX-NAV-HPPOSECEF (version 0) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_NAV_HPPOSECEF_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_NAV_HPPOSECEF_V0_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 0] != UBX_NAV_HPPOSECEF_V0_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-NAV-HPPOSLLH (version 0)
+
+#define UBX_NAV_HPPOSLLH_V0_GROUP0_SIZE 36 //!< Size of UBX_NAV_HPPOSLLH_V0_GROUP0_t
+static inline uint8_t UBX_NAV_HPPOSLLH_V0_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint8_t UBX_NAV_HPPOSLLH_V0_GROUP0_flags(const uint8_t *grp) { return ubxViewU1(&grp[3]); }
+static inline uint32_t UBX_NAV_HPPOSLLH_V0_GROUP0_iTOW(const uint8_t *grp) { return ubxViewU4(&grp[4]); }
+static inline int32_t UBX_NAV_HPPOSLLH_V0_GROUP0_lon(const uint8_t *grp) { return ubxViewI4(&grp[8]); }
+static inline int32_t UBX_NAV_HPPOSLLH_V0_GROUP0_lat(const uint8_t *grp) { return ubxViewI4(&grp[12]); }
+static inline int32_t UBX_NAV_HPPOSLLH_V0_GROUP0_height(const uint8_t *grp) { return ubxViewI4(&grp[16]); }
+static inline int32_t UBX_NAV_HPPOSLLH_V0_GROUP0_hMSL(const uint8_t *grp) { return ubxViewI4(&grp[20]); }
+static inline int8_t UBX_NAV_HPPOSLLH_V0_GROUP0_lonHp(const uint8_t *grp) { return ubxViewI1(&grp[24]); }
+static inline int8_t UBX_NAV_HPPOSLLH_V0_GROUP0_latHp(const uint8_t *grp) { return ubxViewI1(&grp[25]); }
+static inline int8_t UBX_NAV_HPPOSLLH_V0_GROUP0_heightHp(const uint8_t *grp) { return ubxViewI1(&grp[26]); }
+static inline int8_t UBX_NAV_HPPOSLLH_V0_GROUP0_hMSLHp(const uint8_t *grp) { return ubxViewI1(&grp[27]); }
+static inline uint32_t UBX_NAV_HPPOSLLH_V0_GROUP0_hAcc(const uint8_t *grp) { return ubxViewU4(&grp[28]); }
+static inline uint32_t UBX_NAV_HPPOSLLH_V0_GROUP0_vAcc(const uint8_t *grp) { return ubxViewU4(&grp[32]); }
+
+//! Get view of a UBX-NAV-HPPOSLLH (version 0) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_NAV_HPPOSLLH_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_NAV_HPPOSLLH_V0_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 0] != UBX_NAV_HPPOSLLH_V0_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-NAV-POSECEF (version 0)
+
+#define UBX_NAV_POSECEF_V0_GROUP0_SIZE 20 //!< Size of UBX_NAV_POSECEF_V0_GROUP0_t
+static inline uint32_t UBX_NAV_POSECEF_V0_GROUP0_iTOW(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline int32_t UBX_NAV_POSECEF_V0_GROUP0_ecefX(const uint8_t *grp) { return ubxViewI4(&grp[4]); }
+static inline int32_t UBX_NAV_POSECEF_V0_GROUP0_ecefY(const uint8_t *grp) { return ubxViewI4(&grp[8]); }
+static inline int32_t UBX_NAV_POSECEF_V0_GROUP0_ecefZ(const uint8_t *grp) { return ubxViewI4(&grp[12]); }
+static inline uint32_t UBX_NAV_POSECEF_V0_GROUP0_pAcc(const uint8_t *grp) { return ubxViewU4(&grp[16]); }
+
+//! Get view of a UBX-NAV-POSECEF (version 0) message, returns false if the message is too short
+static inline bool UBX_NAV_POSECEF_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_NAV_POSECEF_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-NAV-PVT (version 1)
+
+#define UBX_NAV_PVT_V1_GROUP0_SIZE 92 //!< Size of UBX_NAV_PVT_V1_GROUP0_t
+static inline uint32_t UBX_NAV_PVT_V1_GROUP0_iTOW(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline uint16_t UBX_NAV_PVT_V1_GROUP0_year(const uint8_t *grp) { return ubxViewU2(&grp[4]); }
+static inline uint8_t UBX_NAV_PVT_V1_GROUP0_month(const uint8_t *grp) { return ubxViewU1(&grp[6]); }
+static inline uint8_t UBX_NAV_PVT_V1_GROUP0_day(const uint8_t *grp) { return ubxViewU1(&grp[7]); }
+static inline uint8_t UBX_NAV_PVT_V1_GROUP0_hour(const uint8_t *grp) { return ubxViewU1(&grp[8]); }
+static inline uint8_t UBX_NAV_PVT_V1_GROUP0_min(const uint8_t *grp) { return ubxViewU1(&grp[9]); }
+static inline uint8_t UBX_NAV_PVT_V1_GROUP0_sec(const uint8_t *grp) { return ubxViewU1(&grp[10]); }
+static inline uint8_t UBX_NAV_PVT_V1_GROUP0_valid(const uint8_t *grp) { return ubxViewU1(&grp[11]); }
+static inline uint32_t UBX_NAV_PVT_V1_GROUP0_tAcc(const uint8_t *grp) { return ubxViewU4(&grp[12]); }
+static inline int32_t UBX_NAV_PVT_V1_GROUP0_nano(const uint8_t *grp) { return ubxViewI4(&grp[16]); }
+static inline uint8_t UBX_NAV_PVT_V1_GROUP0_fixType(const uint8_t *grp) { return ubxViewU1(&grp[20]); }
+static inline uint8_t UBX_NAV_PVT_V1_GROUP0_flags(const uint8_t *grp) { return ubxViewU1(&grp[21]); }
+static inline uint8_t UBX_NAV_PVT_V1_GROUP0_flags2(const uint8_t *grp) { return ubxViewU1(&grp[22]); }
+static inline uint8_t UBX_NAV_PVT_V1_GROUP0_numSV(const uint8_t *grp) { return ubxViewU1(&grp[23]); }
+static inline int32_t UBX_NAV_PVT_V1_GROUP0_lon(const uint8_t *grp) { return ubxViewI4(&grp[24]); }
+static inline int32_t UBX_NAV_PVT_V1_GROUP0_lat(const uint8_t *grp) { return ubxViewI4(&grp[28]); }
+static inline int32_t UBX_NAV_PVT_V1_GROUP0_height(const uint8_t *grp) { return ubxViewI4(&grp[32]); }
+static inline int32_t UBX_NAV_PVT_V1_GROUP0_hMSL(const uint8_t *grp) { return ubxViewI4(&grp[36]); }
+static inline uint32_t UBX_NAV_PVT_V1_GROUP0_hAcc(const uint8_t *grp) { return ubxViewU4(&grp[40]); }
+static inline uint32_t UBX_NAV_PVT_V1_GROUP0_vAcc(const uint8_t *grp) { return ubxViewU4(&grp[44]); }
+static inline int32_t UBX_NAV_PVT_V1_GROUP0_velN(const uint8_t *grp) { return ubxViewI4(&grp[48]); }
+static inline int32_t UBX_NAV_PVT_V1_GROUP0_velE(const uint8_t *grp) { return ubxViewI4(&grp[52]); }
+static inline int32_t UBX_NAV_PVT_V1_GROUP0_velD(const uint8_t *grp) { return ubxViewI4(&grp[56]); }
+static inline int32_t UBX_NAV_PVT_V1_GROUP0_gSpeed(const uint8_t *grp) { return ubxViewI4(&grp[60]); }
+static inline int32_t UBX_NAV_PVT_V1_GROUP0_headMot(const uint8_t *grp) { return ubxViewI4(&grp[64]); }
+static inline uint32_t UBX_NAV_PVT_V1_GROUP0_sAcc(const uint8_t *grp) { return ubxViewU4(&grp[68]); }
+static inline uint32_t UBX_NAV_PVT_V1_GROUP0_headAcc(const uint8_t *grp) { return ubxViewU4(&grp[72]); }
+static inline uint16_t UBX_NAV_PVT_V1_GROUP0_pDOP(const uint8_t *grp) { return ubxViewU2(&grp[76]); }
+static inline uint8_t UBX_NAV_PVT_V1_GROUP0_flags3(const uint8_t *grp) { return ubxViewU1(&grp[78]); }
+static inline int32_t UBX_NAV_PVT_V1_GROUP0_headVeh(const uint8_t *grp) { return ubxViewI4(&grp[84]); }
+static inline int16_t UBX_NAV_PVT_V1_GROUP0_magDec(const uint8_t *grp) { return ubxViewI2(&grp[88]); }
+static inline uint16_t UBX_NAV_PVT_V1_GROUP0_magAcc(const uint8_t *grp) { return ubxViewU2(&grp[90]); }
+
+//! Get view of a UBX-NAV-PVT (version 1) message, returns false if the message is too short
+static inline bool UBX_NAV_PVT_V1_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_NAV_PVT_V1_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-NAV-ATT (version 0)
+
+#define UBX_NAV_ATT_V0_GROUP0_SIZE 32 //!< Size of UBX_NAV_ATT_V0_GROUP0_t
+static inline uint32_t UBX_NAV_ATT_V0_GROUP0_iTOW(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline uint8_t UBX_NAV_ATT_V0_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[4]); }
+static inline int32_t UBX_NAV_ATT_V0_GROUP0_roll(const uint8_t *grp) { return ubxViewI4(&grp[8]); }
+static inline int32_t UBX_NAV_ATT_V0_GROUP0_pitch(const uint8_t *grp) { return ubxViewI4(&grp[12]); }
+static inline int32_t UBX_NAV_ATT_V0_GROUP0_heading(const uint8_t *grp) { return ubxViewI4(&grp[16]); }
+static inline uint32_t UBX_NAV_ATT_V0_GROUP0_accRoll(const uint8_t *grp) { return ubxViewU4(&grp[20]); }
+static inline uint32_t UBX_NAV_ATT_V0_GROUP0_accPitch(const uint8_t *grp) { return ubxViewU4(&grp[24]); }
+static inline uint32_t UBX_NAV_ATT_V0_GROUP0_accHeading(const uint8_t *grp) { return ubxViewU4(&grp[28]); }
+
+//! Get view of a UBX-NAV-ATT (version 0) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_NAV_ATT_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_NAV_ATT_V0_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 4] != UBX_NAV_ATT_V0_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-NAV-RELPOSNED (version 1)
+
+#define UBX_NAV_RELPOSNED_V1_GROUP0_SIZE 64 //!< Size of UBX_NAV_RELPOSNED_V1_GROUP0_t
+static inline uint8_t UBX_NAV_RELPOSNED_V1_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint16_t UBX_NAV_RELPOSNED_V1_GROUP0_refStationId(const uint8_t *grp) { return ubxViewU2(&grp[2]); }
+static inline uint32_t UBX_NAV_RELPOSNED_V1_GROUP0_iTOW(const uint8_t *grp) { return ubxViewU4(&grp[4]); }
+static inline int32_t UBX_NAV_RELPOSNED_V1_GROUP0_relPosN(const uint8_t *grp) { return ubxViewI4(&grp[8]); }
+static inline int32_t UBX_NAV_RELPOSNED_V1_GROUP0_relPosE(const uint8_t *grp) { return ubxViewI4(&grp[12]); }
+static inline int32_t UBX_NAV_RELPOSNED_V1_GROUP0_relPosD(const uint8_t *grp) { return ubxViewI4(&grp[16]); }
+static inline int32_t UBX_NAV_RELPOSNED_V1_GROUP0_relPosLength(const uint8_t *grp) { return ubxViewI4(&grp[20]); }
+static inline int32_t UBX_NAV_RELPOSNED_V1_GROUP0_relPosHeading(const uint8_t *grp) { return ubxViewI4(&grp[24]); }
+static inline int8_t UBX_NAV_RELPOSNED_V1_GROUP0_relPosHPN(const uint8_t *grp) { return ubxViewI1(&grp[32]); }
+static inline int8_t UBX_NAV_RELPOSNED_V1_GROUP0_relPosHPE(const uint8_t *grp) { return ubxViewI1(&grp[33]); }
+static inline int8_t UBX_NAV_RELPOSNED_V1_GROUP0_relPosHPD(const uint8_t *grp) { return ubxViewI1(&grp[34]); }
+static inline int8_t UBX_NAV_RELPOSNED_V1_GROUP0_relPosHPLength(const uint8_t *grp) { return ubxViewI1(&grp[35]); }
+static inline uint32_t UBX_NAV_RELPOSNED_V1_GROUP0_accN(const uint8_t *grp) { return ubxViewU4(&grp[36]); }
+static inline uint32_t UBX_NAV_RELPOSNED_V1_GROUP0_accE(const uint8_t *grp) { return ubxViewU4(&grp[40]); }
+static inline uint32_t UBX_NAV_RELPOSNED_V1_GROUP0_accD(const uint8_t *grp) { return ubxViewU4(&grp[44]); }
+static inline uint32_t UBX_NAV_RELPOSNED_V1_GROUP0_accLength(const uint8_t *grp) { return ubxViewU4(&grp[48]); }
+static inline uint32_t UBX_NAV_RELPOSNED_V1_GROUP0_accHeading(const uint8_t *grp) { return ubxViewU4(&grp[52]); }
+static inline uint32_t UBX_NAV_RELPOSNED_V1_GROUP0_flags(const uint8_t *grp) { return ubxViewU4(&grp[60]); }
+
+//! Get view of a UBX-NAV-RELPOSNED (version 1) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_NAV_RELPOSNED_V1_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_NAV_RELPOSNED_V1_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 0] != UBX_NAV_RELPOSNED_V1_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-NAV-STATUS (version 0)
+
+#define UBX_NAV_STATUS_V0_GROUP0_SIZE 16 //!< Size of UBX_NAV_STATUS_V0_GROUP0_t
+static inline uint32_t UBX_NAV_STATUS_V0_GROUP0_iTow(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline uint8_t UBX_NAV_STATUS_V0_GROUP0_gpsFix(const uint8_t *grp) { return ubxViewU1(&grp[4]); }
+static inline uint8_t UBX_NAV_STATUS_V0_GROUP0_flags(const uint8_t *grp) { return ubxViewU1(&grp[5]); }
+static inline uint8_t UBX_NAV_STATUS_V0_GROUP0_fixStat(const uint8_t *grp) { return ubxViewU1(&grp[6]); }
+static inline uint8_t UBX_NAV_STATUS_V0_GROUP0_flags2(const uint8_t *grp) { return ubxViewU1(&grp[7]); }
+static inline uint32_t UBX_NAV_STATUS_V0_GROUP0_ttff(const uint8_t *grp) { return ubxViewU4(&grp[8]); }
+static inline uint32_t UBX_NAV_STATUS_V0_GROUP0_msss(const uint8_t *grp) { return ubxViewU4(&grp[12]); }
+
+//! Get view of a UBX-NAV-STATUS (version 0) message, returns false if the message is too short
+static inline bool UBX_NAV_STATUS_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_NAV_STATUS_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-NAV-TIMEGPS (version 0)
+
+#define UBX_NAV_TIMEGPS_V0_GROUP0_SIZE 16 //!< Size of UBX_NAV_TIMEGPS_V0_GROUP0_t
+static inline uint32_t UBX_NAV_TIMEGPS_V0_GROUP0_iTow(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline int32_t UBX_NAV_TIMEGPS_V0_GROUP0_fTOW(const uint8_t *grp) { return ubxViewI4(&grp[4]); }
+static inline int16_t UBX_NAV_TIMEGPS_V0_GROUP0_week(const uint8_t *grp) { return ubxViewI2(&grp[8]); }
+static inline int8_t UBX_NAV_TIMEGPS_V0_GROUP0_leapS(const uint8_t *grp) { return ubxViewI1(&grp[10]); }
+static inline uint8_t UBX_NAV_TIMEGPS_V0_GROUP0_valid(const uint8_t *grp) { return ubxViewU1(&grp[11]); }
+static inline uint32_t UBX_NAV_TIMEGPS_V0_GROUP0_tAcc(const uint8_t *grp) { return ubxViewU4(&grp[12]); }
+
+//! Get view of a UBX-NAV-TIMEGPS (version 0) message, returns false if the message is too short
+static inline bool UBX_NAV_TIMEGPS_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_NAV_TIMEGPS_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-NAV-TIMEGAL (version 0)
+
+#define UBX_NAV_TIMEGAL_V0_GROUP0_SIZE 20 //!< Size of UBX_NAV_TIMEGAL_V0_GROUP0_t
+static inline uint32_t UBX_NAV_TIMEGAL_V0_GROUP0_iTow(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline uint32_t UBX_NAV_TIMEGAL_V0_GROUP0_galTow(const uint8_t *grp) { return ubxViewU4(&grp[4]); }
+static inline int32_t UBX_NAV_TIMEGAL_V0_GROUP0_fGalTow(const uint8_t *grp) { return ubxViewI4(&grp[8]); }
+static inline int16_t UBX_NAV_TIMEGAL_V0_GROUP0_galWno(const uint8_t *grp) { return ubxViewI2(&grp[12]); }
+static inline int8_t UBX_NAV_TIMEGAL_V0_GROUP0_leapS(const uint8_t *grp) { return ubxViewI1(&grp[14]); }
+static inline uint8_t UBX_NAV_TIMEGAL_V0_GROUP0_valid(const uint8_t *grp) { return ubxViewU1(&grp[15]); }
+static inline uint32_t UBX_NAV_TIMEGAL_V0_GROUP0_tAcc(const uint8_t *grp) { return ubxViewU4(&grp[16]); }
+
+//! Get view of a UBX-NAV-TIMEGAL (version 0) message, returns false if the message is too short
+static inline bool UBX_NAV_TIMEGAL_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_NAV_TIMEGAL_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-NAV-TIMEBDS (version 0)
+
+#define UBX_NAV_TIMEBDS_V0_GROUP0_SIZE 20 //!< Size of UBX_NAV_TIMEBDS_V0_GROUP0_t
+static inline uint32_t UBX_NAV_TIMEBDS_V0_GROUP0_iTow(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline uint32_t UBX_NAV_TIMEBDS_V0_GROUP0_SOW(const uint8_t *grp) { return ubxViewU4(&grp[4]); }
+static inline int32_t UBX_NAV_TIMEBDS_V0_GROUP0_fSOW(const uint8_t *grp) { return ubxViewI4(&grp[8]); }
+static inline int16_t UBX_NAV_TIMEBDS_V0_GROUP0_week(const uint8_t *grp) { return ubxViewI2(&grp[12]); }
+static inline int8_t UBX_NAV_TIMEBDS_V0_GROUP0_leapS(const uint8_t *grp) { return ubxViewI1(&grp[14]); }
+static inline uint8_t UBX_NAV_TIMEBDS_V0_GROUP0_valid(const uint8_t *grp) { return ubxViewU1(&grp[15]); }
+static inline uint32_t UBX_NAV_TIMEBDS_V0_GROUP0_tAcc(const uint8_t *grp) { return ubxViewU4(&grp[16]); }
+
+//! Get view of a UBX-NAV-TIMEBDS (version 0) message, returns false if the message is too short
+static inline bool UBX_NAV_TIMEBDS_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_NAV_TIMEBDS_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-NAV-TIMEGLO (version 0)
+
+#define UBX_NAV_TIMEGLO_V0_GROUP0_SIZE 20 //!< Size of UBX_NAV_TIMEGLO_V0_GROUP0_t
+static inline uint32_t UBX_NAV_TIMEGLO_V0_GROUP0_iTow(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline uint32_t UBX_NAV_TIMEGLO_V0_GROUP0_TOD(const uint8_t *grp) { return ubxViewU4(&grp[4]); }
+static inline int32_t UBX_NAV_TIMEGLO_V0_GROUP0_fTOD(const uint8_t *grp) { return ubxViewI4(&grp[8]); }
+static inline uint16_t UBX_NAV_TIMEGLO_V0_GROUP0_Nt(const uint8_t *grp) { return ubxViewU2(&grp[12]); }
+static inline uint8_t UBX_NAV_TIMEGLO_V0_GROUP0_N4(const uint8_t *grp) { return ubxViewU1(&grp[14]); }
+static inline uint8_t UBX_NAV_TIMEGLO_V0_GROUP0_valid(const uint8_t *grp) { return ubxViewU1(&grp[15]); }
+static inline uint32_t UBX_NAV_TIMEGLO_V0_GROUP0_tAcc(const uint8_t *grp) { return ubxViewU4(&grp[16]); }
+
+//! Get view of a UBX-NAV-TIMEGLO (version 0) message, returns false if the message is too short
+static inline bool UBX_NAV_TIMEGLO_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_NAV_TIMEGLO_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-NAV-TIMELS (version 0)
+
+#define UBX_NAV_TIMELS_V0_GROUP0_SIZE 24 //!< Size of UBX_NAV_TIMELS_V0_GROUP0_t
+static inline uint32_t UBX_NAV_TIMELS_V0_GROUP0_iTOW(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline uint8_t UBX_NAV_TIMELS_V0_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[4]); }
+static inline uint8_t UBX_NAV_TIMELS_V0_GROUP0_srcOfCurrLs(const uint8_t *grp) { return ubxViewU1(&grp[8]); }
+static inline int8_t UBX_NAV_TIMELS_V0_GROUP0_currLs(const uint8_t *grp) { return ubxViewI1(&grp[9]); }
+static inline uint8_t UBX_NAV_TIMELS_V0_GROUP0_srcOfLsChange(const uint8_t *grp) { return ubxViewU1(&grp[10]); }
+static inline int8_t UBX_NAV_TIMELS_V0_GROUP0_lsChange(const uint8_t *grp) { return ubxViewI1(&grp[11]); }
+static inline int32_t UBX_NAV_TIMELS_V0_GROUP0_timeToLsEvent(const uint8_t *grp) { return ubxViewI4(&grp[12]); }
+static inline uint16_t UBX_NAV_TIMELS_V0_GROUP0_dateOfLsGpsWn(const uint8_t *grp) { return ubxViewU2(&grp[16]); }
+static inline uint16_t UBX_NAV_TIMELS_V0_GROUP0_dateOfLsGpsDn(const uint8_t *grp) { return ubxViewU2(&grp[18]); }
+static inline uint8_t UBX_NAV_TIMELS_V0_GROUP0_valid(const uint8_t *grp) { return ubxViewU1(&grp[23]); }
+
+//! Get view of a UBX-NAV-TIMELS (version 0) message, returns false if the message is too short
+static inline bool UBX_NAV_TIMELS_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_NAV_TIMELS_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-NAV-CLOCK (version 0)
+
+#define UBX_NAV_CLOCK_V0_GROUP0_SIZE 20 //!< Size of UBX_NAV_CLOCK_V0_GROUP0_t
+static inline uint32_t UBX_NAV_CLOCK_V0_GROUP0_iTow(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline int32_t UBX_NAV_CLOCK_V0_GROUP0_clkB(const uint8_t *grp) { return ubxViewI4(&grp[4]); }
+static inline int32_t UBX_NAV_CLOCK_V0_GROUP0_clkD(const uint8_t *grp) { return ubxViewI4(&grp[8]); }
+static inline uint32_t UBX_NAV_CLOCK_V0_GROUP0_tAcc(const uint8_t *grp) { return ubxViewU4(&grp[12]); }
+static inline uint32_t UBX_NAV_CLOCK_V0_GROUP0_fAcc(const uint8_t *grp) { return ubxViewU4(&grp[16]); }
+
+//! Get view of a UBX-NAV-CLOCK (version 0) message, returns false if the message is too short
+static inline bool UBX_NAV_CLOCK_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_NAV_CLOCK_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-NAV-SAT (version 1)
+
+#define UBX_NAV_SAT_V1_GROUP0_SIZE 8 //!< Size of UBX_NAV_SAT_V1_GROUP0_t
+static inline uint32_t UBX_NAV_SAT_V1_GROUP0_iTOW(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline uint8_t UBX_NAV_SAT_V1_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[4]); }
+static inline uint8_t UBX_NAV_SAT_V1_GROUP0_numSvs(const uint8_t *grp) { return ubxViewU1(&grp[5]); }
+
+#define UBX_NAV_SAT_V1_GROUP1_SIZE 12 //!< Size of UBX_NAV_SAT_V1_GROUP1_t
+static inline uint8_t UBX_NAV_SAT_V1_GROUP1_gnssId(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint8_t UBX_NAV_SAT_V1_GROUP1_svId(const uint8_t *grp) { return ubxViewU1(&grp[1]); }
+static inline uint8_t UBX_NAV_SAT_V1_GROUP1_cno(const uint8_t *grp) { return ubxViewU1(&grp[2]); }
+static inline int8_t UBX_NAV_SAT_V1_GROUP1_elev(const uint8_t *grp) { return ubxViewI1(&grp[3]); }
+static inline int16_t UBX_NAV_SAT_V1_GROUP1_azim(const uint8_t *grp) { return ubxViewI2(&grp[4]); }
+static inline int16_t UBX_NAV_SAT_V1_GROUP1_prRes(const uint8_t *grp) { return ubxViewI2(&grp[6]); }
+static inline uint32_t UBX_NAV_SAT_V1_GROUP1_flags(const uint8_t *grp) { return ubxViewU4(&grp[8]); }
+
+//! Get view of a UBX-NAV-SAT (version 1) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_NAV_SAT_V1_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize < (UBX_FRAME_SIZE + UBX_NAV_SAT_V1_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 4] != UBX_NAV_SAT_V1_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = &msg[UBX_HEAD_SIZE + UBX_NAV_SAT_V1_GROUP0_SIZE];
+    view->groupSize = UBX_NAV_SAT_V1_GROUP1_SIZE;
+    view->numGroups = UBX_NAV_SAT_V1_GROUP0_numSvs(view->head);
+    return msgSize >= (UBX_FRAME_SIZE + UBX_NAV_SAT_V1_GROUP0_SIZE + (view->numGroups * UBX_NAV_SAT_V1_GROUP1_SIZE));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-NAV-SIG (version 0)
+
+#define UBX_NAV_SIG_V0_GROUP0_SIZE 8 //!< Size of UBX_NAV_SIG_V0_GROUP0_t
+static inline uint32_t UBX_NAV_SIG_V0_GROUP0_iTOW(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline uint8_t UBX_NAV_SIG_V0_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[4]); }
+static inline uint8_t UBX_NAV_SIG_V0_GROUP0_numSigs(const uint8_t *grp) { return ubxViewU1(&grp[5]); }
+
+#define UBX_NAV_SIG_V0_GROUP1_SIZE 16 //!< Size of UBX_NAV_SIG_V0_GROUP1_t
+static inline uint8_t UBX_NAV_SIG_V0_GROUP1_gnssId(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint8_t UBX_NAV_SIG_V0_GROUP1_svId(const uint8_t *grp) { return ubxViewU1(&grp[1]); }
+static inline uint8_t UBX_NAV_SIG_V0_GROUP1_sigId(const uint8_t *grp) { return ubxViewU1(&grp[2]); }
+static inline uint8_t UBX_NAV_SIG_V0_GROUP1_freqId(const uint8_t *grp) { return ubxViewU1(&grp[3]); }
+static inline int16_t UBX_NAV_SIG_V0_GROUP1_prRes(const uint8_t *grp) { return ubxViewI2(&grp[4]); }
+static inline uint8_t UBX_NAV_SIG_V0_GROUP1_cno(const uint8_t *grp) { return ubxViewU1(&grp[6]); }
+static inline uint8_t UBX_NAV_SIG_V0_GROUP1_qualityInd(const uint8_t *grp) { return ubxViewU1(&grp[7]); }
+static inline uint8_t UBX_NAV_SIG_V0_GROUP1_corrSource(const uint8_t *grp) { return ubxViewU1(&grp[8]); }
+static inline uint8_t UBX_NAV_SIG_V0_GROUP1_ionoModel(const uint8_t *grp) { return ubxViewU1(&grp[9]); }
+static inline uint16_t UBX_NAV_SIG_V0_GROUP1_sigFlags(const uint8_t *grp) { return ubxViewU2(&grp[10]); }
+
+//! Get view of a UBX-NAV-SIG (version 0) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_NAV_SIG_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize < (UBX_FRAME_SIZE + UBX_NAV_SIG_V0_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 4] != UBX_NAV_SIG_V0_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = &msg[UBX_HEAD_SIZE + UBX_NAV_SIG_V0_GROUP0_SIZE];
+    view->groupSize = UBX_NAV_SIG_V0_GROUP1_SIZE;
+    view->numGroups = UBX_NAV_SIG_V0_GROUP0_numSigs(view->head);
+    return msgSize >= (UBX_FRAME_SIZE + UBX_NAV_SIG_V0_GROUP0_SIZE + (view->numGroups * UBX_NAV_SIG_V0_GROUP1_SIZE));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-NAV-VELECEF (version 0)
+
+#define UBX_NAV_VELECEF_V0_GROUP0_SIZE 20 //!< Size of UBX_NAV_VELECEF_V0_GROUP0_t
+static inline uint32_t UBX_NAV_VELECEF_V0_GROUP0_iTOW(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline int32_t UBX_NAV_VELECEF_V0_GROUP0_ecefVX(const uint8_t *grp) { return ubxViewI4(&grp[4]); }
+static inline int32_t UBX_NAV_VELECEF_V0_GROUP0_ecefVY(const uint8_t *grp) { return ubxViewI4(&grp[8]); }
+static inline int32_t UBX_NAV_VELECEF_V0_GROUP0_ecefVZ(const uint8_t *grp) { return ubxViewI4(&grp[12]); }
+static inline uint32_t UBX_NAV_VELECEF_V0_GROUP0_sAcc(const uint8_t *grp) { return ubxViewU4(&grp[16]); }
+
+//! Get view of a UBX-NAV-VELECEF (version 0) message, returns false if the message is too short
+static inline bool UBX_NAV_VELECEF_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_NAV_VELECEF_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-NAV-DOP (version 0)
+
+#define UBX_NAV_DOP_V0_GROUP0_SIZE 18 //!< Size of UBX_NAV_DOP_V0_GROUP0_t
+static inline uint32_t UBX_NAV_DOP_V0_GROUP0_iTOW(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline uint16_t UBX_NAV_DOP_V0_GROUP0_gDOP(const uint8_t *grp) { return ubxViewU2(&grp[4]); }
+static inline uint16_t UBX_NAV_DOP_V0_GROUP0_pDOP(const uint8_t *grp) { return ubxViewU2(&grp[6]); }
+static inline uint16_t UBX_NAV_DOP_V0_GROUP0_tDOP(const uint8_t *grp) { return ubxViewU2(&grp[8]); }
+static inline uint16_t UBX_NAV_DOP_V0_GROUP0_vDOP(const uint8_t *grp) { return ubxViewU2(&grp[10]); }
+static inline uint16_t UBX_NAV_DOP_V0_GROUP0_hDOP(const uint8_t *grp) { return ubxViewU2(&grp[12]); }
+static inline uint16_t UBX_NAV_DOP_V0_GROUP0_nDOP(const uint8_t *grp) { return ubxViewU2(&grp[14]); }
+static inline uint16_t UBX_NAV_DOP_V0_GROUP0_eDOP(const uint8_t *grp) { return ubxViewU2(&grp[16]); }
+
+//! Get view of a UBX-NAV-DOP (version 0) message, returns false if the message is too short
+static inline bool UBX_NAV_DOP_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_NAV_DOP_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-RXM-RAWX (version 1)
+
+#define UBX_RXM_RAWX_V1_GROUP0_SIZE 16 //!< Size of UBX_RXM_RAWX_V1_GROUP0_t
+static inline double UBX_RXM_RAWX_V1_GROUP0_rcvTow(const uint8_t *grp) { return ubxViewR8(&grp[0]); }
+static inline uint16_t UBX_RXM_RAWX_V1_GROUP0_week(const uint8_t *grp) { return ubxViewU2(&grp[8]); }
+static inline int8_t UBX_RXM_RAWX_V1_GROUP0_leapS(const uint8_t *grp) { return ubxViewI1(&grp[10]); }
+static inline uint8_t UBX_RXM_RAWX_V1_GROUP0_numMeas(const uint8_t *grp) { return ubxViewU1(&grp[11]); }
+static inline uint8_t UBX_RXM_RAWX_V1_GROUP0_recStat(const uint8_t *grp) { return ubxViewU1(&grp[12]); }
+static inline uint8_t UBX_RXM_RAWX_V1_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[13]); }
+
+#define UBX_RXM_RAWX_V1_GROUP1_SIZE 32 //!< Size of UBX_RXM_RAWX_V1_GROUP1_t
+static inline double UBX_RXM_RAWX_V1_GROUP1_prMeas(const uint8_t *grp) { return ubxViewR8(&grp[0]); }
+static inline double UBX_RXM_RAWX_V1_GROUP1_cpMeas(const uint8_t *grp) { return ubxViewR8(&grp[8]); }
+static inline float UBX_RXM_RAWX_V1_GROUP1_doMeas(const uint8_t *grp) { return ubxViewR4(&grp[16]); }
+static inline uint8_t UBX_RXM_RAWX_V1_GROUP1_gnssId(const uint8_t *grp) { return ubxViewU1(&grp[20]); }
+static inline uint8_t UBX_RXM_RAWX_V1_GROUP1_svId(const uint8_t *grp) { return ubxViewU1(&grp[21]); }
+static inline uint8_t UBX_RXM_RAWX_V1_GROUP1_sigId(const uint8_t *grp) { return ubxViewU1(&grp[22]); }
+static inline uint8_t UBX_RXM_RAWX_V1_GROUP1_freqId(const uint8_t *grp) { return ubxViewU1(&grp[23]); }
+static inline uint16_t UBX_RXM_RAWX_V1_GROUP1_locktime(const uint8_t *grp) { return ubxViewU2(&grp[24]); }
+static inline uint8_t UBX_RXM_RAWX_V1_GROUP1_cno(const uint8_t *grp) { return ubxViewU1(&grp[26]); }
+static inline uint8_t UBX_RXM_RAWX_V1_GROUP1_prStdev(const uint8_t *grp) { return ubxViewU1(&grp[27]); }
+static inline uint8_t UBX_RXM_RAWX_V1_GROUP1_cpStdev(const uint8_t *grp) { return ubxViewU1(&grp[28]); }
+static inline uint8_t UBX_RXM_RAWX_V1_GROUP1_doStdev(const uint8_t *grp) { return ubxViewU1(&grp[29]); }
+static inline uint8_t UBX_RXM_RAWX_V1_GROUP1_trkStat(const uint8_t *grp) { return ubxViewU1(&grp[30]); }
+
+//! Get view of a UBX-RXM-RAWX (version 1) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_RXM_RAWX_V1_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize < (UBX_FRAME_SIZE + UBX_RXM_RAWX_V1_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 13] != UBX_RXM_RAWX_V1_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = &msg[UBX_HEAD_SIZE + UBX_RXM_RAWX_V1_GROUP0_SIZE];
+    view->groupSize = UBX_RXM_RAWX_V1_GROUP1_SIZE;
+    view->numGroups = UBX_RXM_RAWX_V1_GROUP0_numMeas(view->head);
+    return msgSize >= (UBX_FRAME_SIZE + UBX_RXM_RAWX_V1_GROUP0_SIZE + (view->numGroups * UBX_RXM_RAWX_V1_GROUP1_SIZE));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-RXM-RTCM (version 2)
+
+#define UBX_RXM_RTCM_V2_GROUP0_SIZE 8 //!< Size of UBX_RXM_RTCM_V2_GROUP0_t
+static inline uint8_t UBX_RXM_RTCM_V2_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint8_t UBX_RXM_RTCM_V2_GROUP0_flags(const uint8_t *grp) { return ubxViewU1(&grp[1]); }
+static inline uint16_t UBX_RXM_RTCM_V2_GROUP0_subType(const uint8_t *grp) { return ubxViewU2(&grp[2]); }
+static inline uint16_t UBX_RXM_RTCM_V2_GROUP0_refStation(const uint8_t *grp) { return ubxViewU2(&grp[4]); }
+static inline uint16_t UBX_RXM_RTCM_V2_GROUP0_msgType(const uint8_t *grp) { return ubxViewU2(&grp[6]); }
+
+//! Get view of a UBX-RXM-RTCM (version 2) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_RXM_RTCM_V2_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_RXM_RTCM_V2_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 0] != UBX_RXM_RTCM_V2_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-RXM-SPARTN (version 1)
+
+#define UBX_RXM_SPARTN_V1_GROUP0_SIZE 8 //!< Size of UBX_RXM_SPARTN_V1_GROUP0_t
+static inline uint8_t UBX_RXM_SPARTN_V1_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint8_t UBX_RXM_SPARTN_V1_GROUP0_flags(const uint8_t *grp) { return ubxViewU1(&grp[1]); }
+static inline uint16_t UBX_RXM_SPARTN_V1_GROUP0_subType(const uint8_t *grp) { return ubxViewU2(&grp[2]); }
+static inline uint16_t UBX_RXM_SPARTN_V1_GROUP0_msgType(const uint8_t *grp) { return ubxViewU2(&grp[6]); }
+
+//! Get view of a UBX-RXM-SPARTN (version 1) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_RXM_SPARTN_V1_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_RXM_SPARTN_V1_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 0] != UBX_RXM_SPARTN_V1_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-RXM-SFRBX (version 2)
+
+#define UBX_RXM_SFRBX_V2_GROUP0_SIZE 8 //!< Size of UBX_RXM_SFRBX_V2_GROUP0_t
+static inline uint8_t UBX_RXM_SFRBX_V2_GROUP0_gnssId(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint8_t UBX_RXM_SFRBX_V2_GROUP0_svId(const uint8_t *grp) { return ubxViewU1(&grp[1]); }
+static inline uint8_t UBX_RXM_SFRBX_V2_GROUP0_sigId(const uint8_t *grp) { return ubxViewU1(&grp[2]); }
+static inline uint8_t UBX_RXM_SFRBX_V2_GROUP0_freqId(const uint8_t *grp) { return ubxViewU1(&grp[3]); }
+static inline uint8_t UBX_RXM_SFRBX_V2_GROUP0_numWords(const uint8_t *grp) { return ubxViewU1(&grp[4]); }
+static inline uint8_t UBX_RXM_SFRBX_V2_GROUP0_chn(const uint8_t *grp) { return ubxViewU1(&grp[5]); }
+static inline uint8_t UBX_RXM_SFRBX_V2_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[6]); }
+
+#define UBX_RXM_SFRBX_V2_GROUP1_SIZE 4 //!< Size of UBX_RXM_SFRBX_V2_GROUP1_t
+static inline uint32_t UBX_RXM_SFRBX_V2_GROUP1_dwrd(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+
+//! Get view of a UBX-RXM-SFRBX (version 2) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_RXM_SFRBX_V2_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize < (UBX_FRAME_SIZE + UBX_RXM_SFRBX_V2_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 6] != UBX_RXM_SFRBX_V2_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = &msg[UBX_HEAD_SIZE + UBX_RXM_SFRBX_V2_GROUP0_SIZE];
+    view->groupSize = UBX_RXM_SFRBX_V2_GROUP1_SIZE;
+    view->numGroups = UBX_RXM_SFRBX_V2_GROUP0_numWords(view->head);
+    return msgSize >= (UBX_FRAME_SIZE + UBX_RXM_SFRBX_V2_GROUP0_SIZE + (view->numGroups * UBX_RXM_SFRBX_V2_GROUP1_SIZE));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-MON-RF (version 0)
+
+#define UBX_MON_RF_V0_GROUP0_SIZE 4 //!< Size of UBX_MON_RF_V0_GROUP0_t
+static inline uint8_t UBX_MON_RF_V0_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint8_t UBX_MON_RF_V0_GROUP0_nBlocks(const uint8_t *grp) { return ubxViewU1(&grp[1]); }
+
+#define UBX_MON_RF_V0_GROUP1_SIZE 24 //!< Size of UBX_MON_RF_V0_GROUP1_t
+static inline uint8_t UBX_MON_RF_V0_GROUP1_blockId(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint8_t UBX_MON_RF_V0_GROUP1_flags(const uint8_t *grp) { return ubxViewU1(&grp[1]); }
+static inline uint8_t UBX_MON_RF_V0_GROUP1_antStatus(const uint8_t *grp) { return ubxViewU1(&grp[2]); }
+static inline uint8_t UBX_MON_RF_V0_GROUP1_antPower(const uint8_t *grp) { return ubxViewU1(&grp[3]); }
+static inline uint32_t UBX_MON_RF_V0_GROUP1_postStatus(const uint8_t *grp) { return ubxViewU4(&grp[4]); }
+static inline uint16_t UBX_MON_RF_V0_GROUP1_noisePerMS(const uint8_t *grp) { return ubxViewU2(&grp[12]); }
+static inline uint16_t UBX_MON_RF_V0_GROUP1_agcCnt(const uint8_t *grp) { return ubxViewU2(&grp[14]); }
+static inline uint8_t UBX_MON_RF_V0_GROUP1_jamInd(const uint8_t *grp) { return ubxViewU1(&grp[16]); }
+static inline int8_t UBX_MON_RF_V0_GROUP1_ofsI(const uint8_t *grp) { return ubxViewI1(&grp[17]); }
+static inline uint8_t UBX_MON_RF_V0_GROUP1_magI(const uint8_t *grp) { return ubxViewU1(&grp[18]); }
+static inline int8_t UBX_MON_RF_V0_GROUP1_ofsQ(const uint8_t *grp) { return ubxViewI1(&grp[19]); }
+static inline uint8_t UBX_MON_RF_V0_GROUP1_magQ(const uint8_t *grp) { return ubxViewU1(&grp[20]); }
+
+//! Get view of a UBX-MON-RF (version 0) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_MON_RF_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize < (UBX_FRAME_SIZE + UBX_MON_RF_V0_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 0] != UBX_MON_RF_V0_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = &msg[UBX_HEAD_SIZE + UBX_MON_RF_V0_GROUP0_SIZE];
+    view->groupSize = UBX_MON_RF_V0_GROUP1_SIZE;
+    view->numGroups = UBX_MON_RF_V0_GROUP0_nBlocks(view->head);
+    return msgSize >= (UBX_FRAME_SIZE + UBX_MON_RF_V0_GROUP0_SIZE + (view->numGroups * UBX_MON_RF_V0_GROUP1_SIZE));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-MON-COMMS (version 0)
+
+#define UBX_MON_COMMS_V0_GROUP0_SIZE 8 //!< Size of UBX_MON_COMMS_V0_GROUP0_t
+static inline uint8_t UBX_MON_COMMS_V0_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint8_t UBX_MON_COMMS_V0_GROUP0_nPorts(const uint8_t *grp) { return ubxViewU1(&grp[1]); }
+static inline uint8_t UBX_MON_COMMS_V0_GROUP0_txErrors(const uint8_t *grp) { return ubxViewU1(&grp[2]); }
+static inline const uint8_t *UBX_MON_COMMS_V0_GROUP0_protIds(const uint8_t *grp) { return (const uint8_t *)&grp[4]; } //!< uint8_t [4]
+
+#define UBX_MON_COMMS_V0_GROUP1_SIZE 40 //!< Size of UBX_MON_COMMS_V0_GROUP1_t
+static inline uint16_t UBX_MON_COMMS_V0_GROUP1_portId(const uint8_t *grp) { return ubxViewU2(&grp[0]); }
+static inline uint16_t UBX_MON_COMMS_V0_GROUP1_txPending(const uint8_t *grp) { return ubxViewU2(&grp[2]); }
+static inline uint32_t UBX_MON_COMMS_V0_GROUP1_txBytes(const uint8_t *grp) { return ubxViewU4(&grp[4]); }
+static inline uint8_t UBX_MON_COMMS_V0_GROUP1_txUsage(const uint8_t *grp) { return ubxViewU1(&grp[8]); }
+static inline uint8_t UBX_MON_COMMS_V0_GROUP1_txPeakUsage(const uint8_t *grp) { return ubxViewU1(&grp[9]); }
+static inline uint16_t UBX_MON_COMMS_V0_GROUP1_rxPending(const uint8_t *grp) { return ubxViewU2(&grp[10]); }
+static inline uint32_t UBX_MON_COMMS_V0_GROUP1_rxBytes(const uint8_t *grp) { return ubxViewU4(&grp[12]); }
+static inline uint8_t UBX_MON_COMMS_V0_GROUP1_rxUsage(const uint8_t *grp) { return ubxViewU1(&grp[16]); }
+static inline uint8_t UBX_MON_COMMS_V0_GROUP1_rxPeakUsage(const uint8_t *grp) { return ubxViewU1(&grp[17]); }
+static inline uint16_t UBX_MON_COMMS_V0_GROUP1_overrunErrors(const uint8_t *grp) { return ubxViewU2(&grp[18]); }
+static inline uint16_t UBX_MON_COMMS_V0_GROUP1_msgs(const uint8_t *grp, const int ix) { return ubxViewU2(&grp[20 + (ix * 2)]); } //!< ix = 0..3
+static inline uint32_t UBX_MON_COMMS_V0_GROUP1_skipped(const uint8_t *grp) { return ubxViewU4(&grp[36]); }
+
+//! Get view of a UBX-MON-COMMS (version 0) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_MON_COMMS_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize < (UBX_FRAME_SIZE + UBX_MON_COMMS_V0_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 0] != UBX_MON_COMMS_V0_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = &msg[UBX_HEAD_SIZE + UBX_MON_COMMS_V0_GROUP0_SIZE];
+    view->groupSize = UBX_MON_COMMS_V0_GROUP1_SIZE;
+    view->numGroups = UBX_MON_COMMS_V0_GROUP0_nPorts(view->head);
+    return msgSize >= (UBX_FRAME_SIZE + UBX_MON_COMMS_V0_GROUP0_SIZE + (view->numGroups * UBX_MON_COMMS_V0_GROUP1_SIZE));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-MON-SPAN (version 0)
+
+#define UBX_MON_SPAN_V0_GROUP0_SIZE 4 //!< Size of UBX_MON_SPAN_V0_GROUP0_t
+static inline uint8_t UBX_MON_SPAN_V0_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint8_t UBX_MON_SPAN_V0_GROUP0_numRfBlocks(const uint8_t *grp) { return ubxViewU1(&grp[1]); }
+
+#define UBX_MON_SPAN_V0_GROUP1_SIZE 272 //!< Size of UBX_MON_SPAN_V0_GROUP1_t
+static inline const uint8_t *UBX_MON_SPAN_V0_GROUP1_spectrum(const uint8_t *grp) { return (const uint8_t *)&grp[0]; } //!< uint8_t [256]
+static inline uint32_t UBX_MON_SPAN_V0_GROUP1_span(const uint8_t *grp) { return ubxViewU4(&grp[256]); }
+static inline uint32_t UBX_MON_SPAN_V0_GROUP1_res(const uint8_t *grp) { return ubxViewU4(&grp[260]); }
+static inline uint32_t UBX_MON_SPAN_V0_GROUP1_center(const uint8_t *grp) { return ubxViewU4(&grp[264]); }
+static inline uint8_t UBX_MON_SPAN_V0_GROUP1_pga(const uint8_t *grp) { return ubxViewU1(&grp[268]); }
+
+//! Get view of a UBX-MON-SPAN (version 0) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_MON_SPAN_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize < (UBX_FRAME_SIZE + UBX_MON_SPAN_V0_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 0] != UBX_MON_SPAN_V0_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = &msg[UBX_HEAD_SIZE + UBX_MON_SPAN_V0_GROUP0_SIZE];
+    view->groupSize = UBX_MON_SPAN_V0_GROUP1_SIZE;
+    view->numGroups = UBX_MON_SPAN_V0_GROUP0_numRfBlocks(view->head);
+    return msgSize >= (UBX_FRAME_SIZE + UBX_MON_SPAN_V0_GROUP0_SIZE + (view->numGroups * UBX_MON_SPAN_V0_GROUP1_SIZE));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-ESF-MEAS (version 0)
+
+#define UBX_ESF_MEAS_V0_GROUP0_SIZE 8 //!< Size of UBX_ESF_MEAS_V0_GROUP0_t
+static inline uint32_t UBX_ESF_MEAS_V0_GROUP0_timeTag(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline uint16_t UBX_ESF_MEAS_V0_GROUP0_flags(const uint8_t *grp) { return ubxViewU2(&grp[4]); }
+static inline uint16_t UBX_ESF_MEAS_V0_GROUP0_id(const uint8_t *grp) { return ubxViewU2(&grp[6]); }
+
+#define UBX_ESF_MEAS_V0_GROUP1_SIZE 4 //!< Size of UBX_ESF_MEAS_V0_GROUP1_t
+static inline uint32_t UBX_ESF_MEAS_V0_GROUP1_data(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+
+#define UBX_ESF_MEAS_V0_GROUP2_SIZE 4 //!< Size of UBX_ESF_MEAS_V0_GROUP2_t
+static inline uint32_t UBX_ESF_MEAS_V0_GROUP2_calibTtag(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+
+//! Get view of a UBX-ESF-MEAS (version 0) message, returns false if the message is too short
+static inline bool UBX_ESF_MEAS_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize < (UBX_FRAME_SIZE + UBX_ESF_MEAS_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = &msg[UBX_HEAD_SIZE + UBX_ESF_MEAS_V0_GROUP0_SIZE];
+    view->groupSize = UBX_ESF_MEAS_V0_GROUP1_SIZE;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-ESF-STATUS (version 2)
+
+#define UBX_ESF_STATUS_V2_GROUP0_SIZE 16 //!< Size of UBX_ESF_STATUS_V2_GROUP0_t
+static inline uint32_t UBX_ESF_STATUS_V2_GROUP0_iTOW(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline uint8_t UBX_ESF_STATUS_V2_GROUP0_version(const uint8_t *grp) { return ubxViewU1(&grp[4]); }
+static inline uint8_t UBX_ESF_STATUS_V2_GROUP0_initStatus1(const uint8_t *grp) { return ubxViewU1(&grp[5]); }
+static inline uint8_t UBX_ESF_STATUS_V2_GROUP0_initStatus2(const uint8_t *grp) { return ubxViewU1(&grp[6]); }
+static inline uint8_t UBX_ESF_STATUS_V2_GROUP0_fusionMode(const uint8_t *grp) { return ubxViewU1(&grp[12]); }
+static inline uint8_t UBX_ESF_STATUS_V2_GROUP0_numSens(const uint8_t *grp) { return ubxViewU1(&grp[15]); }
+
+#define UBX_ESF_STATUS_V2_GROUP1_SIZE 4 //!< Size of UBX_ESF_STATUS_V2_GROUP1_t
+static inline uint8_t UBX_ESF_STATUS_V2_GROUP1_sensStatus1(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint8_t UBX_ESF_STATUS_V2_GROUP1_sensStatus2(const uint8_t *grp) { return ubxViewU1(&grp[1]); }
+static inline uint8_t UBX_ESF_STATUS_V2_GROUP1_freq(const uint8_t *grp) { return ubxViewU1(&grp[2]); }
+static inline uint8_t UBX_ESF_STATUS_V2_GROUP1_faults(const uint8_t *grp) { return ubxViewU1(&grp[3]); }
+
+//! Get view of a UBX-ESF-STATUS (version 2) message, returns false if the message is too short or has the wrong version
+static inline bool UBX_ESF_STATUS_V2_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize < (UBX_FRAME_SIZE + UBX_ESF_STATUS_V2_GROUP0_SIZE)) || (msg[UBX_HEAD_SIZE + 4] != UBX_ESF_STATUS_V2_VERSION) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = &msg[UBX_HEAD_SIZE + UBX_ESF_STATUS_V2_GROUP0_SIZE];
+    view->groupSize = UBX_ESF_STATUS_V2_GROUP1_SIZE;
+    view->numGroups = UBX_ESF_STATUS_V2_GROUP0_numSens(view->head);
+    return msgSize >= (UBX_FRAME_SIZE + UBX_ESF_STATUS_V2_GROUP0_SIZE + (view->numGroups * UBX_ESF_STATUS_V2_GROUP1_SIZE));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-TIM-TP (version 0)
+
+#define UBX_TIM_TP_V0_GROUP0_SIZE 16 //!< Size of UBX_TIM_TP_V0_GROUP0_t
+static inline uint32_t UBX_TIM_TP_V0_GROUP0_towMs(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline uint32_t UBX_TIM_TP_V0_GROUP0_towSubMS(const uint8_t *grp) { return ubxViewU4(&grp[4]); }
+static inline int32_t UBX_TIM_TP_V0_GROUP0_qErr(const uint8_t *grp) { return ubxViewI4(&grp[8]); }
+static inline uint16_t UBX_TIM_TP_V0_GROUP0_week(const uint8_t *grp) { return ubxViewU2(&grp[12]); }
+static inline uint8_t UBX_TIM_TP_V0_GROUP0_flags(const uint8_t *grp) { return ubxViewU1(&grp[14]); }
+static inline uint8_t UBX_TIM_TP_V0_GROUP0_refInfo(const uint8_t *grp) { return ubxViewU1(&grp[15]); }
+
+//! Get view of a UBX-TIM-TP (version 0) message, returns false if the message is too short
+static inline bool UBX_TIM_TP_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_TIM_TP_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-TIM-TM2 (version 0)
+
+#define UBX_TIM_TM2_V0_GROUP0_SIZE 28 //!< Size of UBX_TIM_TM2_V0_GROUP0_t
+static inline uint8_t UBX_TIM_TM2_V0_GROUP0_ch(const uint8_t *grp) { return ubxViewU1(&grp[0]); }
+static inline uint8_t UBX_TIM_TM2_V0_GROUP0_flags(const uint8_t *grp) { return ubxViewU1(&grp[1]); }
+static inline uint16_t UBX_TIM_TM2_V0_GROUP0_count(const uint8_t *grp) { return ubxViewU2(&grp[2]); }
+static inline uint16_t UBX_TIM_TM2_V0_GROUP0_wnR(const uint8_t *grp) { return ubxViewU2(&grp[4]); }
+static inline uint16_t UBX_TIM_TM2_V0_GROUP0_wnF(const uint8_t *grp) { return ubxViewU2(&grp[6]); }
+static inline uint32_t UBX_TIM_TM2_V0_GROUP0_towMsR(const uint8_t *grp) { return ubxViewU4(&grp[8]); }
+static inline uint32_t UBX_TIM_TM2_V0_GROUP0_towSubMsR(const uint8_t *grp) { return ubxViewU4(&grp[12]); }
+static inline uint32_t UBX_TIM_TM2_V0_GROUP0_towMsF(const uint8_t *grp) { return ubxViewU4(&grp[16]); }
+static inline uint32_t UBX_TIM_TM2_V0_GROUP0_towSubMsF(const uint8_t *grp) { return ubxViewU4(&grp[20]); }
+static inline uint32_t UBX_TIM_TM2_V0_GROUP0_accEst(const uint8_t *grp) { return ubxViewU4(&grp[24]); }
+
+//! Get view of a UBX-TIM-TM2 (version 0) message, returns false if the message is too short
+static inline bool UBX_TIM_TM2_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_TIM_TM2_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// UBX-TIM-SVIN (version 0)
+
+#define UBX_TIM_SVIN_V0_GROUP0_SIZE 28 //!< Size of UBX_TIM_SVIN_V0_GROUP0_t
+static inline uint32_t UBX_TIM_SVIN_V0_GROUP0_dur(const uint8_t *grp) { return ubxViewU4(&grp[0]); }
+static inline int32_t UBX_TIM_SVIN_V0_GROUP0_meanX(const uint8_t *grp) { return ubxViewI4(&grp[4]); }
+static inline int32_t UBX_TIM_SVIN_V0_GROUP0_meanY(const uint8_t *grp) { return ubxViewI4(&grp[8]); }
+static inline int32_t UBX_TIM_SVIN_V0_GROUP0_meanZ(const uint8_t *grp) { return ubxViewI4(&grp[12]); }
+static inline uint32_t UBX_TIM_SVIN_V0_GROUP0_meanV(const uint8_t *grp) { return ubxViewU4(&grp[16]); }
+static inline uint32_t UBX_TIM_SVIN_V0_GROUP0_obs(const uint8_t *grp) { return ubxViewU4(&grp[20]); }
+static inline uint8_t UBX_TIM_SVIN_V0_GROUP0_valid(const uint8_t *grp) { return ubxViewU1(&grp[24]); }
+static inline uint8_t UBX_TIM_SVIN_V0_GROUP0_active(const uint8_t *grp) { return ubxViewU1(&grp[25]); }
+
+//! Get view of a UBX-TIM-SVIN (version 0) message, returns false if the message is too short
+static inline bool UBX_TIM_SVIN_V0_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)
+{
+    if ( (msgSize != (UBX_FRAME_SIZE + UBX_TIM_SVIN_V0_GROUP0_SIZE)) )
+    {
+        return false;
+    }
+    view->head      = &msg[UBX_HEAD_SIZE];
+    view->groups    = NULL;
+    view->groupSize = 0;
+    view->numGroups = 0;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// Check that the views match the structs in ff_ubx.h
+#ifndef __cplusplus
+#include <stddef.h>
+#include "ff_stuff.h"
+STATIC_ASSERT(offsetof(UBX_CFG_VALSET_V0_GROUP0_t, version) == 0);
+STATIC_ASSERT(offsetof(UBX_CFG_VALSET_V0_GROUP0_t, layers) == 1);
+STATIC_ASSERT(sizeof(UBX_CFG_VALSET_V0_GROUP0_t) == UBX_CFG_VALSET_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_CFG_VALSET_V1_GROUP0_t, version) == 0);
+STATIC_ASSERT(offsetof(UBX_CFG_VALSET_V1_GROUP0_t, layers) == 1);
+STATIC_ASSERT(offsetof(UBX_CFG_VALSET_V1_GROUP0_t, transaction) == 2);
+STATIC_ASSERT(sizeof(UBX_CFG_VALSET_V1_GROUP0_t) == UBX_CFG_VALSET_V1_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_CFG_VALGET_V0_GROUP0_t, version) == 0);
+STATIC_ASSERT(offsetof(UBX_CFG_VALGET_V0_GROUP0_t, layer) == 1);
+STATIC_ASSERT(offsetof(UBX_CFG_VALGET_V0_GROUP0_t, position) == 2);
+STATIC_ASSERT(sizeof(UBX_CFG_VALGET_V0_GROUP0_t) == UBX_CFG_VALGET_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_CFG_VALGET_V1_GROUP0_t, version) == 0);
+STATIC_ASSERT(offsetof(UBX_CFG_VALGET_V1_GROUP0_t, layer) == 1);
+STATIC_ASSERT(offsetof(UBX_CFG_VALGET_V1_GROUP0_t, position) == 2);
+STATIC_ASSERT(sizeof(UBX_CFG_VALGET_V1_GROUP0_t) == UBX_CFG_VALGET_V1_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_CFG_VALDEL_V1_GROUP0_t, version) == 0);
+STATIC_ASSERT(offsetof(UBX_CFG_VALDEL_V1_GROUP0_t, layers) == 1);
+STATIC_ASSERT(offsetof(UBX_CFG_VALDEL_V1_GROUP0_t, transaction) == 2);
+STATIC_ASSERT(sizeof(UBX_CFG_VALDEL_V1_GROUP0_t) == UBX_CFG_VALDEL_V1_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_CFG_RST_V0_GROUP0_t, navBbrMask) == 0);
+STATIC_ASSERT(offsetof(UBX_CFG_RST_V0_GROUP0_t, resetMode) == 2);
+STATIC_ASSERT(sizeof(UBX_CFG_RST_V0_GROUP0_t) == UBX_CFG_RST_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_CFG_CFG_V0_GROUP0_t, clearMask) == 0);
+STATIC_ASSERT(offsetof(UBX_CFG_CFG_V0_GROUP0_t, saveMask) == 4);
+STATIC_ASSERT(offsetof(UBX_CFG_CFG_V0_GROUP0_t, loadMask) == 8);
+STATIC_ASSERT(sizeof(UBX_CFG_CFG_V0_GROUP0_t) == UBX_CFG_CFG_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_CFG_CFG_V0_GROUP1_t, deviceMask) == 0);
+STATIC_ASSERT(sizeof(UBX_CFG_CFG_V0_GROUP1_t) == UBX_CFG_CFG_V0_GROUP1_SIZE);
+STATIC_ASSERT(offsetof(UBX_MON_VER_V0_GROUP0_t, swVersion) == 0);
+STATIC_ASSERT(offsetof(UBX_MON_VER_V0_GROUP0_t, hwVersion) == 30);
+STATIC_ASSERT(sizeof(UBX_MON_VER_V0_GROUP0_t) == UBX_MON_VER_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_MON_VER_V0_GROUP1_t, extension) == 0);
+STATIC_ASSERT(sizeof(UBX_MON_VER_V0_GROUP1_t) == UBX_MON_VER_V0_GROUP1_SIZE);
+STATIC_ASSERT(offsetof(UBX_MON_HW_V0_GROUP0_t, pinSel) == 0);
+STATIC_ASSERT(offsetof(UBX_MON_HW_V0_GROUP0_t, pinBank) == 4);
+STATIC_ASSERT(offsetof(UBX_MON_HW_V0_GROUP0_t, pinDir) == 8);
+STATIC_ASSERT(offsetof(UBX_MON_HW_V0_GROUP0_t, pinVal) == 12);
+STATIC_ASSERT(offsetof(UBX_MON_HW_V0_GROUP0_t, noisePerMS) == 16);
+STATIC_ASSERT(offsetof(UBX_MON_HW_V0_GROUP0_t, agcCnt) == 18);
+STATIC_ASSERT(offsetof(UBX_MON_HW_V0_GROUP0_t, aStatus) == 20);
+STATIC_ASSERT(offsetof(UBX_MON_HW_V0_GROUP0_t, aPower) == 21);
+STATIC_ASSERT(offsetof(UBX_MON_HW_V0_GROUP0_t, flags) == 22);
+STATIC_ASSERT(offsetof(UBX_MON_HW_V0_GROUP0_t, usedMask) == 24);
+STATIC_ASSERT(offsetof(UBX_MON_HW_V0_GROUP0_t, VP) == 28);
+STATIC_ASSERT(offsetof(UBX_MON_HW_V0_GROUP0_t, jamInd) == 45);
+STATIC_ASSERT(offsetof(UBX_MON_HW_V0_GROUP0_t, pinIrq) == 48);
+STATIC_ASSERT(offsetof(UBX_MON_HW_V0_GROUP0_t, pullH) == 52);
+STATIC_ASSERT(offsetof(UBX_MON_HW_V0_GROUP0_t, pullL) == 56);
+STATIC_ASSERT(sizeof(UBX_MON_HW_V0_GROUP0_t) == UBX_MON_HW_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_MON_HW2_V0_GROUP0_t, ofsI) == 0);
+STATIC_ASSERT(offsetof(UBX_MON_HW2_V0_GROUP0_t, magI) == 1);
+STATIC_ASSERT(offsetof(UBX_MON_HW2_V0_GROUP0_t, ofsQ) == 2);
+STATIC_ASSERT(offsetof(UBX_MON_HW2_V0_GROUP0_t, magQ) == 3);
+STATIC_ASSERT(offsetof(UBX_MON_HW2_V0_GROUP0_t, cfgSource) == 4);
+STATIC_ASSERT(offsetof(UBX_MON_HW2_V0_GROUP0_t, lowLevCfg) == 8);
+STATIC_ASSERT(offsetof(UBX_MON_HW2_V0_GROUP0_t, postStatus) == 20);
+STATIC_ASSERT(sizeof(UBX_MON_HW2_V0_GROUP0_t) == UBX_MON_HW2_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_MON_HW3_V0_GROUP0_t, version) == 0);
+STATIC_ASSERT(offsetof(UBX_MON_HW3_V0_GROUP0_t, nPins) == 1);
+STATIC_ASSERT(offsetof(UBX_MON_HW3_V0_GROUP0_t, flags) == 2);
+STATIC_ASSERT(offsetof(UBX_MON_HW3_V0_GROUP0_t, hwVersion) == 3);
+STATIC_ASSERT(sizeof(UBX_MON_HW3_V0_GROUP0_t) == UBX_MON_HW3_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_MON_HW3_V0_GROUP1_t, pinId) == 0);
+STATIC_ASSERT(offsetof(UBX_MON_HW3_V0_GROUP1_t, pinMask) == 2);
+STATIC_ASSERT(offsetof(UBX_MON_HW3_V0_GROUP1_t, VP) == 4);
+STATIC_ASSERT(sizeof(UBX_MON_HW3_V0_GROUP1_t) == UBX_MON_HW3_V0_GROUP1_SIZE);
+STATIC_ASSERT(offsetof(UBX_MON_TEMP_V0_GROUP0_t, version) == 0);
+STATIC_ASSERT(offsetof(UBX_MON_TEMP_V0_GROUP0_t, temperature) == 4);
+STATIC_ASSERT(offsetof(UBX_MON_TEMP_V0_GROUP0_t, unknown) == 6);
+STATIC_ASSERT(sizeof(UBX_MON_TEMP_V0_GROUP0_t) == UBX_MON_TEMP_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_ACK_ACK_V0_GROUP0_t, clsId) == 0);
+STATIC_ASSERT(offsetof(UBX_ACK_ACK_V0_GROUP0_t, msgId) == 1);
+STATIC_ASSERT(sizeof(UBX_ACK_ACK_V0_GROUP0_t) == UBX_ACK_ACK_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_ACK_NAK_V0_GROUP0_t, clsId) == 0);
+STATIC_ASSERT(offsetof(UBX_ACK_NAK_V0_GROUP0_t, msgId) == 1);
+STATIC_ASSERT(sizeof(UBX_ACK_NAK_V0_GROUP0_t) == UBX_ACK_NAK_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_COV_V0_GROUP0_t, iTOW) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_COV_V0_GROUP0_t, version) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_COV_V0_GROUP0_t, posCovValid) == 5);
+STATIC_ASSERT(offsetof(UBX_NAV_COV_V0_GROUP0_t, velCovValid) == 6);
+STATIC_ASSERT(offsetof(UBX_NAV_COV_V0_GROUP0_t, posCovNN) == 16);
+STATIC_ASSERT(offsetof(UBX_NAV_COV_V0_GROUP0_t, posCovNE) == 20);
+STATIC_ASSERT(offsetof(UBX_NAV_COV_V0_GROUP0_t, posCovND) == 24);
+STATIC_ASSERT(offsetof(UBX_NAV_COV_V0_GROUP0_t, posCovEE) == 28);
+STATIC_ASSERT(offsetof(UBX_NAV_COV_V0_GROUP0_t, posCovED) == 32);
+STATIC_ASSERT(offsetof(UBX_NAV_COV_V0_GROUP0_t, posCovDD) == 36);
+STATIC_ASSERT(offsetof(UBX_NAV_COV_V0_GROUP0_t, velCovNN) == 40);
+STATIC_ASSERT(offsetof(UBX_NAV_COV_V0_GROUP0_t, velCovNE) == 44);
+STATIC_ASSERT(offsetof(UBX_NAV_COV_V0_GROUP0_t, velCovND) == 48);
+STATIC_ASSERT(offsetof(UBX_NAV_COV_V0_GROUP0_t, velCovEE) == 52);
+STATIC_ASSERT(offsetof(UBX_NAV_COV_V0_GROUP0_t, velCovED) == 56);
+STATIC_ASSERT(offsetof(UBX_NAV_COV_V0_GROUP0_t, velCovDD) == 60);
+STATIC_ASSERT(sizeof(UBX_NAV_COV_V0_GROUP0_t) == UBX_NAV_COV_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_EELL_V0_GROUP0_t, iTOW) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_EELL_V0_GROUP0_t, version) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_EELL_V0_GROUP0_t, errEllipseOrient) == 6);
+STATIC_ASSERT(offsetof(UBX_NAV_EELL_V0_GROUP0_t, errEllipseMajor) == 8);
+STATIC_ASSERT(offsetof(UBX_NAV_EELL_V0_GROUP0_t, errEllipseMinor) == 12);
+STATIC_ASSERT(sizeof(UBX_NAV_EELL_V0_GROUP0_t) == UBX_NAV_EELL_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_EOE_V0_GROUP0_t, iTOW) == 0);
+STATIC_ASSERT(sizeof(UBX_NAV_EOE_V0_GROUP0_t) == UBX_NAV_EOE_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSECEF_V0_GROUP0_t, version) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSECEF_V0_GROUP0_t, iTOW) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSECEF_V0_GROUP0_t, ecefX) == 8);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSECEF_V0_GROUP0_t, ecefY) == 12);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSECEF_V0_GROUP0_t, ecefZ) == 16);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSECEF_V0_GROUP0_t, ecefXHp) == 20);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSECEF_V0_GROUP0_t, ecefYHp) == 21);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSECEF_V0_GROUP0_t, ecefZHp) == 22);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSECEF_V0_GROUP0_t, flags) == 23);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSECEF_V0_GROUP0_t, pAcc) == 24);
+STATIC_ASSERT(sizeof(UBX_NAV_HPPOSECEF_V0_GROUP0_t) == UBX_NAV_HPPOSECEF_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSLLH_V0_GROUP0_t, version) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSLLH_V0_GROUP0_t, flags) == 3);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSLLH_V0_GROUP0_t, iTOW) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSLLH_V0_GROUP0_t, lon) == 8);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSLLH_V0_GROUP0_t, lat) == 12);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSLLH_V0_GROUP0_t, height) == 16);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSLLH_V0_GROUP0_t, hMSL) == 20);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSLLH_V0_GROUP0_t, lonHp) == 24);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSLLH_V0_GROUP0_t, latHp) == 25);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSLLH_V0_GROUP0_t, heightHp) == 26);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSLLH_V0_GROUP0_t, hMSLHp) == 27);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSLLH_V0_GROUP0_t, hAcc) == 28);
+STATIC_ASSERT(offsetof(UBX_NAV_HPPOSLLH_V0_GROUP0_t, vAcc) == 32);
+STATIC_ASSERT(sizeof(UBX_NAV_HPPOSLLH_V0_GROUP0_t) == UBX_NAV_HPPOSLLH_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_POSECEF_V0_GROUP0_t, iTOW) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_POSECEF_V0_GROUP0_t, ecefX) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_POSECEF_V0_GROUP0_t, ecefY) == 8);
+STATIC_ASSERT(offsetof(UBX_NAV_POSECEF_V0_GROUP0_t, ecefZ) == 12);
+STATIC_ASSERT(offsetof(UBX_NAV_POSECEF_V0_GROUP0_t, pAcc) == 16);
+STATIC_ASSERT(sizeof(UBX_NAV_POSECEF_V0_GROUP0_t) == UBX_NAV_POSECEF_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, iTOW) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, year) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, month) == 6);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, day) == 7);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, hour) == 8);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, min) == 9);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, sec) == 10);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, valid) == 11);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, tAcc) == 12);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, nano) == 16);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, fixType) == 20);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, flags) == 21);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, flags2) == 22);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, numSV) == 23);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, lon) == 24);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, lat) == 28);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, height) == 32);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, hMSL) == 36);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, hAcc) == 40);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, vAcc) == 44);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, velN) == 48);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, velE) == 52);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, velD) == 56);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, gSpeed) == 60);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, headMot) == 64);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, sAcc) == 68);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, headAcc) == 72);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, pDOP) == 76);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, flags3) == 78);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, headVeh) == 84);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, magDec) == 88);
+STATIC_ASSERT(offsetof(UBX_NAV_PVT_V1_GROUP0_t, magAcc) == 90);
+STATIC_ASSERT(sizeof(UBX_NAV_PVT_V1_GROUP0_t) == UBX_NAV_PVT_V1_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_ATT_V0_GROUP0_t, iTOW) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_ATT_V0_GROUP0_t, version) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_ATT_V0_GROUP0_t, roll) == 8);
+STATIC_ASSERT(offsetof(UBX_NAV_ATT_V0_GROUP0_t, pitch) == 12);
+STATIC_ASSERT(offsetof(UBX_NAV_ATT_V0_GROUP0_t, heading) == 16);
+STATIC_ASSERT(offsetof(UBX_NAV_ATT_V0_GROUP0_t, accRoll) == 20);
+STATIC_ASSERT(offsetof(UBX_NAV_ATT_V0_GROUP0_t, accPitch) == 24);
+STATIC_ASSERT(offsetof(UBX_NAV_ATT_V0_GROUP0_t, accHeading) == 28);
+STATIC_ASSERT(sizeof(UBX_NAV_ATT_V0_GROUP0_t) == UBX_NAV_ATT_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_RELPOSNED_V1_GROUP0_t, version) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_RELPOSNED_V1_GROUP0_t, refStationId) == 2);
+STATIC_ASSERT(offsetof(UBX_NAV_RELPOSNED_V1_GROUP0_t, iTOW) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_RELPOSNED_V1_GROUP0_t, relPosN) == 8);
+STATIC_ASSERT(offsetof(UBX_NAV_RELPOSNED_V1_GROUP0_t, relPosE) == 12);
+STATIC_ASSERT(offsetof(UBX_NAV_RELPOSNED_V1_GROUP0_t, relPosD) == 16);
+STATIC_ASSERT(offsetof(UBX_NAV_RELPOSNED_V1_GROUP0_t, relPosLength) == 20);
+STATIC_ASSERT(offsetof(UBX_NAV_RELPOSNED_V1_GROUP0_t, relPosHeading) == 24);
+STATIC_ASSERT(offsetof(UBX_NAV_RELPOSNED_V1_GROUP0_t, relPosHPN) == 32);
+STATIC_ASSERT(offsetof(UBX_NAV_RELPOSNED_V1_GROUP0_t, relPosHPE) == 33);
+STATIC_ASSERT(offsetof(UBX_NAV_RELPOSNED_V1_GROUP0_t, relPosHPD) == 34);
+STATIC_ASSERT(offsetof(UBX_NAV_RELPOSNED_V1_GROUP0_t, relPosHPLength) == 35);
+STATIC_ASSERT(offsetof(UBX_NAV_RELPOSNED_V1_GROUP0_t, accN) == 36);
+STATIC_ASSERT(offsetof(UBX_NAV_RELPOSNED_V1_GROUP0_t, accE) == 40);
+STATIC_ASSERT(offsetof(UBX_NAV_RELPOSNED_V1_GROUP0_t, accD) == 44);
+STATIC_ASSERT(offsetof(UBX_NAV_RELPOSNED_V1_GROUP0_t, accLength) == 48);
+STATIC_ASSERT(offsetof(UBX_NAV_RELPOSNED_V1_GROUP0_t, accHeading) == 52);
+STATIC_ASSERT(offsetof(UBX_NAV_RELPOSNED_V1_GROUP0_t, flags) == 60);
+STATIC_ASSERT(sizeof(UBX_NAV_RELPOSNED_V1_GROUP0_t) == UBX_NAV_RELPOSNED_V1_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_STATUS_V0_GROUP0_t, iTow) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_STATUS_V0_GROUP0_t, gpsFix) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_STATUS_V0_GROUP0_t, flags) == 5);
+STATIC_ASSERT(offsetof(UBX_NAV_STATUS_V0_GROUP0_t, fixStat) == 6);
+STATIC_ASSERT(offsetof(UBX_NAV_STATUS_V0_GROUP0_t, flags2) == 7);
+STATIC_ASSERT(offsetof(UBX_NAV_STATUS_V0_GROUP0_t, ttff) == 8);
+STATIC_ASSERT(offsetof(UBX_NAV_STATUS_V0_GROUP0_t, msss) == 12);
+STATIC_ASSERT(sizeof(UBX_NAV_STATUS_V0_GROUP0_t) == UBX_NAV_STATUS_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEGPS_V0_GROUP0_t, iTow) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEGPS_V0_GROUP0_t, fTOW) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEGPS_V0_GROUP0_t, week) == 8);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEGPS_V0_GROUP0_t, leapS) == 10);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEGPS_V0_GROUP0_t, valid) == 11);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEGPS_V0_GROUP0_t, tAcc) == 12);
+STATIC_ASSERT(sizeof(UBX_NAV_TIMEGPS_V0_GROUP0_t) == UBX_NAV_TIMEGPS_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEGAL_V0_GROUP0_t, iTow) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEGAL_V0_GROUP0_t, galTow) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEGAL_V0_GROUP0_t, fGalTow) == 8);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEGAL_V0_GROUP0_t, galWno) == 12);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEGAL_V0_GROUP0_t, leapS) == 14);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEGAL_V0_GROUP0_t, valid) == 15);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEGAL_V0_GROUP0_t, tAcc) == 16);
+STATIC_ASSERT(sizeof(UBX_NAV_TIMEGAL_V0_GROUP0_t) == UBX_NAV_TIMEGAL_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEBDS_V0_GROUP0_t, iTow) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEBDS_V0_GROUP0_t, SOW) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEBDS_V0_GROUP0_t, fSOW) == 8);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEBDS_V0_GROUP0_t, week) == 12);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEBDS_V0_GROUP0_t, leapS) == 14);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEBDS_V0_GROUP0_t, valid) == 15);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEBDS_V0_GROUP0_t, tAcc) == 16);
+STATIC_ASSERT(sizeof(UBX_NAV_TIMEBDS_V0_GROUP0_t) == UBX_NAV_TIMEBDS_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEGLO_V0_GROUP0_t, iTow) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEGLO_V0_GROUP0_t, TOD) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEGLO_V0_GROUP0_t, fTOD) == 8);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEGLO_V0_GROUP0_t, Nt) == 12);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEGLO_V0_GROUP0_t, N4) == 14);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEGLO_V0_GROUP0_t, valid) == 15);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMEGLO_V0_GROUP0_t, tAcc) == 16);
+STATIC_ASSERT(sizeof(UBX_NAV_TIMEGLO_V0_GROUP0_t) == UBX_NAV_TIMEGLO_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMELS_V0_GROUP0_t, iTOW) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMELS_V0_GROUP0_t, version) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMELS_V0_GROUP0_t, srcOfCurrLs) == 8);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMELS_V0_GROUP0_t, currLs) == 9);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMELS_V0_GROUP0_t, srcOfLsChange) == 10);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMELS_V0_GROUP0_t, lsChange) == 11);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMELS_V0_GROUP0_t, timeToLsEvent) == 12);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMELS_V0_GROUP0_t, dateOfLsGpsWn) == 16);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMELS_V0_GROUP0_t, dateOfLsGpsDn) == 18);
+STATIC_ASSERT(offsetof(UBX_NAV_TIMELS_V0_GROUP0_t, valid) == 23);
+STATIC_ASSERT(sizeof(UBX_NAV_TIMELS_V0_GROUP0_t) == UBX_NAV_TIMELS_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_CLOCK_V0_GROUP0_t, iTow) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_CLOCK_V0_GROUP0_t, clkB) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_CLOCK_V0_GROUP0_t, clkD) == 8);
+STATIC_ASSERT(offsetof(UBX_NAV_CLOCK_V0_GROUP0_t, tAcc) == 12);
+STATIC_ASSERT(offsetof(UBX_NAV_CLOCK_V0_GROUP0_t, fAcc) == 16);
+STATIC_ASSERT(sizeof(UBX_NAV_CLOCK_V0_GROUP0_t) == UBX_NAV_CLOCK_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_SAT_V1_GROUP0_t, iTOW) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_SAT_V1_GROUP0_t, version) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_SAT_V1_GROUP0_t, numSvs) == 5);
+STATIC_ASSERT(sizeof(UBX_NAV_SAT_V1_GROUP0_t) == UBX_NAV_SAT_V1_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_SAT_V1_GROUP1_t, gnssId) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_SAT_V1_GROUP1_t, svId) == 1);
+STATIC_ASSERT(offsetof(UBX_NAV_SAT_V1_GROUP1_t, cno) == 2);
+STATIC_ASSERT(offsetof(UBX_NAV_SAT_V1_GROUP1_t, elev) == 3);
+STATIC_ASSERT(offsetof(UBX_NAV_SAT_V1_GROUP1_t, azim) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_SAT_V1_GROUP1_t, prRes) == 6);
+STATIC_ASSERT(offsetof(UBX_NAV_SAT_V1_GROUP1_t, flags) == 8);
+STATIC_ASSERT(sizeof(UBX_NAV_SAT_V1_GROUP1_t) == UBX_NAV_SAT_V1_GROUP1_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_SIG_V0_GROUP0_t, iTOW) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_SIG_V0_GROUP0_t, version) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_SIG_V0_GROUP0_t, numSigs) == 5);
+STATIC_ASSERT(sizeof(UBX_NAV_SIG_V0_GROUP0_t) == UBX_NAV_SIG_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_SIG_V0_GROUP1_t, gnssId) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_SIG_V0_GROUP1_t, svId) == 1);
+STATIC_ASSERT(offsetof(UBX_NAV_SIG_V0_GROUP1_t, sigId) == 2);
+STATIC_ASSERT(offsetof(UBX_NAV_SIG_V0_GROUP1_t, freqId) == 3);
+STATIC_ASSERT(offsetof(UBX_NAV_SIG_V0_GROUP1_t, prRes) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_SIG_V0_GROUP1_t, cno) == 6);
+STATIC_ASSERT(offsetof(UBX_NAV_SIG_V0_GROUP1_t, qualityInd) == 7);
+STATIC_ASSERT(offsetof(UBX_NAV_SIG_V0_GROUP1_t, corrSource) == 8);
+STATIC_ASSERT(offsetof(UBX_NAV_SIG_V0_GROUP1_t, ionoModel) == 9);
+STATIC_ASSERT(offsetof(UBX_NAV_SIG_V0_GROUP1_t, sigFlags) == 10);
+STATIC_ASSERT(sizeof(UBX_NAV_SIG_V0_GROUP1_t) == UBX_NAV_SIG_V0_GROUP1_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_VELECEF_V0_GROUP0_t, iTOW) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_VELECEF_V0_GROUP0_t, ecefVX) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_VELECEF_V0_GROUP0_t, ecefVY) == 8);
+STATIC_ASSERT(offsetof(UBX_NAV_VELECEF_V0_GROUP0_t, ecefVZ) == 12);
+STATIC_ASSERT(offsetof(UBX_NAV_VELECEF_V0_GROUP0_t, sAcc) == 16);
+STATIC_ASSERT(sizeof(UBX_NAV_VELECEF_V0_GROUP0_t) == UBX_NAV_VELECEF_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_NAV_DOP_V0_GROUP0_t, iTOW) == 0);
+STATIC_ASSERT(offsetof(UBX_NAV_DOP_V0_GROUP0_t, gDOP) == 4);
+STATIC_ASSERT(offsetof(UBX_NAV_DOP_V0_GROUP0_t, pDOP) == 6);
+STATIC_ASSERT(offsetof(UBX_NAV_DOP_V0_GROUP0_t, tDOP) == 8);
+STATIC_ASSERT(offsetof(UBX_NAV_DOP_V0_GROUP0_t, vDOP) == 10);
+STATIC_ASSERT(offsetof(UBX_NAV_DOP_V0_GROUP0_t, hDOP) == 12);
+STATIC_ASSERT(offsetof(UBX_NAV_DOP_V0_GROUP0_t, nDOP) == 14);
+STATIC_ASSERT(offsetof(UBX_NAV_DOP_V0_GROUP0_t, eDOP) == 16);
+STATIC_ASSERT(sizeof(UBX_NAV_DOP_V0_GROUP0_t) == UBX_NAV_DOP_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_RXM_RAWX_V1_GROUP0_t, rcvTow) == 0);
+STATIC_ASSERT(offsetof(UBX_RXM_RAWX_V1_GROUP0_t, week) == 8);
+STATIC_ASSERT(offsetof(UBX_RXM_RAWX_V1_GROUP0_t, leapS) == 10);
+STATIC_ASSERT(offsetof(UBX_RXM_RAWX_V1_GROUP0_t, numMeas) == 11);
+STATIC_ASSERT(offsetof(UBX_RXM_RAWX_V1_GROUP0_t, recStat) == 12);
+STATIC_ASSERT(offsetof(UBX_RXM_RAWX_V1_GROUP0_t, version) == 13);
+STATIC_ASSERT(sizeof(UBX_RXM_RAWX_V1_GROUP0_t) == UBX_RXM_RAWX_V1_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_RXM_RAWX_V1_GROUP1_t, prMeas) == 0);
+STATIC_ASSERT(offsetof(UBX_RXM_RAWX_V1_GROUP1_t, cpMeas) == 8);
+STATIC_ASSERT(offsetof(UBX_RXM_RAWX_V1_GROUP1_t, doMeas) == 16);
+STATIC_ASSERT(offsetof(UBX_RXM_RAWX_V1_GROUP1_t, gnssId) == 20);
+STATIC_ASSERT(offsetof(UBX_RXM_RAWX_V1_GROUP1_t, svId) == 21);
+STATIC_ASSERT(offsetof(UBX_RXM_RAWX_V1_GROUP1_t, sigId) == 22);
+STATIC_ASSERT(offsetof(UBX_RXM_RAWX_V1_GROUP1_t, freqId) == 23);
+STATIC_ASSERT(offsetof(UBX_RXM_RAWX_V1_GROUP1_t, locktime) == 24);
+STATIC_ASSERT(offsetof(UBX_RXM_RAWX_V1_GROUP1_t, cno) == 26);
+STATIC_ASSERT(offsetof(UBX_RXM_RAWX_V1_GROUP1_t, prStdev) == 27);
+STATIC_ASSERT(offsetof(UBX_RXM_RAWX_V1_GROUP1_t, cpStdev) == 28);
+STATIC_ASSERT(offsetof(UBX_RXM_RAWX_V1_GROUP1_t, doStdev) == 29);
+STATIC_ASSERT(offsetof(UBX_RXM_RAWX_V1_GROUP1_t, trkStat) == 30);
+STATIC_ASSERT(sizeof(UBX_RXM_RAWX_V1_GROUP1_t) == UBX_RXM_RAWX_V1_GROUP1_SIZE);
+STATIC_ASSERT(offsetof(UBX_RXM_RTCM_V2_GROUP0_t, version) == 0);
+STATIC_ASSERT(offsetof(UBX_RXM_RTCM_V2_GROUP0_t, flags) == 1);
+STATIC_ASSERT(offsetof(UBX_RXM_RTCM_V2_GROUP0_t, subType) == 2);
+STATIC_ASSERT(offsetof(UBX_RXM_RTCM_V2_GROUP0_t, refStation) == 4);
+STATIC_ASSERT(offsetof(UBX_RXM_RTCM_V2_GROUP0_t, msgType) == 6);
+STATIC_ASSERT(sizeof(UBX_RXM_RTCM_V2_GROUP0_t) == UBX_RXM_RTCM_V2_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_RXM_SPARTN_V1_GROUP0_t, version) == 0);
+STATIC_ASSERT(offsetof(UBX_RXM_SPARTN_V1_GROUP0_t, flags) == 1);
+STATIC_ASSERT(offsetof(UBX_RXM_SPARTN_V1_GROUP0_t, subType) == 2);
+STATIC_ASSERT(offsetof(UBX_RXM_SPARTN_V1_GROUP0_t, msgType) == 6);
+STATIC_ASSERT(sizeof(UBX_RXM_SPARTN_V1_GROUP0_t) == UBX_RXM_SPARTN_V1_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_RXM_SFRBX_V2_GROUP0_t, gnssId) == 0);
+STATIC_ASSERT(offsetof(UBX_RXM_SFRBX_V2_GROUP0_t, svId) == 1);
+STATIC_ASSERT(offsetof(UBX_RXM_SFRBX_V2_GROUP0_t, sigId) == 2);
+STATIC_ASSERT(offsetof(UBX_RXM_SFRBX_V2_GROUP0_t, freqId) == 3);
+STATIC_ASSERT(offsetof(UBX_RXM_SFRBX_V2_GROUP0_t, numWords) == 4);
+STATIC_ASSERT(offsetof(UBX_RXM_SFRBX_V2_GROUP0_t, chn) == 5);
+STATIC_ASSERT(offsetof(UBX_RXM_SFRBX_V2_GROUP0_t, version) == 6);
+STATIC_ASSERT(sizeof(UBX_RXM_SFRBX_V2_GROUP0_t) == UBX_RXM_SFRBX_V2_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_RXM_SFRBX_V2_GROUP1_t, dwrd) == 0);
+STATIC_ASSERT(sizeof(UBX_RXM_SFRBX_V2_GROUP1_t) == UBX_RXM_SFRBX_V2_GROUP1_SIZE);
+STATIC_ASSERT(offsetof(UBX_MON_RF_V0_GROUP0_t, version) == 0);
+STATIC_ASSERT(offsetof(UBX_MON_RF_V0_GROUP0_t, nBlocks) == 1);
+STATIC_ASSERT(sizeof(UBX_MON_RF_V0_GROUP0_t) == UBX_MON_RF_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_MON_RF_V0_GROUP1_t, blockId) == 0);
+STATIC_ASSERT(offsetof(UBX_MON_RF_V0_GROUP1_t, flags) == 1);
+STATIC_ASSERT(offsetof(UBX_MON_RF_V0_GROUP1_t, antStatus) == 2);
+STATIC_ASSERT(offsetof(UBX_MON_RF_V0_GROUP1_t, antPower) == 3);
+STATIC_ASSERT(offsetof(UBX_MON_RF_V0_GROUP1_t, postStatus) == 4);
+STATIC_ASSERT(offsetof(UBX_MON_RF_V0_GROUP1_t, noisePerMS) == 12);
+STATIC_ASSERT(offsetof(UBX_MON_RF_V0_GROUP1_t, agcCnt) == 14);
+STATIC_ASSERT(offsetof(UBX_MON_RF_V0_GROUP1_t, jamInd) == 16);
+STATIC_ASSERT(offsetof(UBX_MON_RF_V0_GROUP1_t, ofsI) == 17);
+STATIC_ASSERT(offsetof(UBX_MON_RF_V0_GROUP1_t, magI) == 18);
+STATIC_ASSERT(offsetof(UBX_MON_RF_V0_GROUP1_t, ofsQ) == 19);
+STATIC_ASSERT(offsetof(UBX_MON_RF_V0_GROUP1_t, magQ) == 20);
+STATIC_ASSERT(sizeof(UBX_MON_RF_V0_GROUP1_t) == UBX_MON_RF_V0_GROUP1_SIZE);
+STATIC_ASSERT(offsetof(UBX_MON_COMMS_V0_GROUP0_t, version) == 0);
+STATIC_ASSERT(offsetof(UBX_MON_COMMS_V0_GROUP0_t, nPorts) == 1);
+STATIC_ASSERT(offsetof(UBX_MON_COMMS_V0_GROUP0_t, txErrors) == 2);
+STATIC_ASSERT(offsetof(UBX_MON_COMMS_V0_GROUP0_t, protIds) == 4);
+STATIC_ASSERT(sizeof(UBX_MON_COMMS_V0_GROUP0_t) == UBX_MON_COMMS_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_MON_COMMS_V0_GROUP1_t, portId) == 0);
+STATIC_ASSERT(offsetof(UBX_MON_COMMS_V0_GROUP1_t, txPending) == 2);
+STATIC_ASSERT(offsetof(UBX_MON_COMMS_V0_GROUP1_t, txBytes) == 4);
+STATIC_ASSERT(offsetof(UBX_MON_COMMS_V0_GROUP1_t, txUsage) == 8);
+STATIC_ASSERT(offsetof(UBX_MON_COMMS_V0_GROUP1_t, txPeakUsage) == 9);
+STATIC_ASSERT(offsetof(UBX_MON_COMMS_V0_GROUP1_t, rxPending) == 10);
+STATIC_ASSERT(offsetof(UBX_MON_COMMS_V0_GROUP1_t, rxBytes) == 12);
+STATIC_ASSERT(offsetof(UBX_MON_COMMS_V0_GROUP1_t, rxUsage) == 16);
+STATIC_ASSERT(offsetof(UBX_MON_COMMS_V0_GROUP1_t, rxPeakUsage) == 17);
+STATIC_ASSERT(offsetof(UBX_MON_COMMS_V0_GROUP1_t, overrunErrors) == 18);
+STATIC_ASSERT(offsetof(UBX_MON_COMMS_V0_GROUP1_t, msgs) == 20);
+STATIC_ASSERT(offsetof(UBX_MON_COMMS_V0_GROUP1_t, skipped) == 36);
+STATIC_ASSERT(sizeof(UBX_MON_COMMS_V0_GROUP1_t) == UBX_MON_COMMS_V0_GROUP1_SIZE);
+STATIC_ASSERT(offsetof(UBX_MON_SPAN_V0_GROUP0_t, version) == 0);
+STATIC_ASSERT(offsetof(UBX_MON_SPAN_V0_GROUP0_t, numRfBlocks) == 1);
+STATIC_ASSERT(sizeof(UBX_MON_SPAN_V0_GROUP0_t) == UBX_MON_SPAN_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_MON_SPAN_V0_GROUP1_t, spectrum) == 0);
+STATIC_ASSERT(offsetof(UBX_MON_SPAN_V0_GROUP1_t, span) == 256);
+STATIC_ASSERT(offsetof(UBX_MON_SPAN_V0_GROUP1_t, res) == 260);
+STATIC_ASSERT(offsetof(UBX_MON_SPAN_V0_GROUP1_t, center) == 264);
+STATIC_ASSERT(offsetof(UBX_MON_SPAN_V0_GROUP1_t, pga) == 268);
+STATIC_ASSERT(sizeof(UBX_MON_SPAN_V0_GROUP1_t) == UBX_MON_SPAN_V0_GROUP1_SIZE);
+STATIC_ASSERT(offsetof(UBX_ESF_MEAS_V0_GROUP0_t, timeTag) == 0);
+STATIC_ASSERT(offsetof(UBX_ESF_MEAS_V0_GROUP0_t, flags) == 4);
+STATIC_ASSERT(offsetof(UBX_ESF_MEAS_V0_GROUP0_t, id) == 6);
+STATIC_ASSERT(sizeof(UBX_ESF_MEAS_V0_GROUP0_t) == UBX_ESF_MEAS_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_ESF_MEAS_V0_GROUP1_t, data) == 0);
+STATIC_ASSERT(sizeof(UBX_ESF_MEAS_V0_GROUP1_t) == UBX_ESF_MEAS_V0_GROUP1_SIZE);
+STATIC_ASSERT(offsetof(UBX_ESF_MEAS_V0_GROUP2_t, calibTtag) == 0);
+STATIC_ASSERT(sizeof(UBX_ESF_MEAS_V0_GROUP2_t) == UBX_ESF_MEAS_V0_GROUP2_SIZE);
+STATIC_ASSERT(offsetof(UBX_ESF_STATUS_V2_GROUP0_t, iTOW) == 0);
+STATIC_ASSERT(offsetof(UBX_ESF_STATUS_V2_GROUP0_t, version) == 4);
+STATIC_ASSERT(offsetof(UBX_ESF_STATUS_V2_GROUP0_t, initStatus1) == 5);
+STATIC_ASSERT(offsetof(UBX_ESF_STATUS_V2_GROUP0_t, initStatus2) == 6);
+STATIC_ASSERT(offsetof(UBX_ESF_STATUS_V2_GROUP0_t, fusionMode) == 12);
+STATIC_ASSERT(offsetof(UBX_ESF_STATUS_V2_GROUP0_t, numSens) == 15);
+STATIC_ASSERT(sizeof(UBX_ESF_STATUS_V2_GROUP0_t) == UBX_ESF_STATUS_V2_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_ESF_STATUS_V2_GROUP1_t, sensStatus1) == 0);
+STATIC_ASSERT(offsetof(UBX_ESF_STATUS_V2_GROUP1_t, sensStatus2) == 1);
+STATIC_ASSERT(offsetof(UBX_ESF_STATUS_V2_GROUP1_t, freq) == 2);
+STATIC_ASSERT(offsetof(UBX_ESF_STATUS_V2_GROUP1_t, faults) == 3);
+STATIC_ASSERT(sizeof(UBX_ESF_STATUS_V2_GROUP1_t) == UBX_ESF_STATUS_V2_GROUP1_SIZE);
+STATIC_ASSERT(offsetof(UBX_TIM_TP_V0_GROUP0_t, towMs) == 0);
+STATIC_ASSERT(offsetof(UBX_TIM_TP_V0_GROUP0_t, towSubMS) == 4);
+STATIC_ASSERT(offsetof(UBX_TIM_TP_V0_GROUP0_t, qErr) == 8);
+STATIC_ASSERT(offsetof(UBX_TIM_TP_V0_GROUP0_t, week) == 12);
+STATIC_ASSERT(offsetof(UBX_TIM_TP_V0_GROUP0_t, flags) == 14);
+STATIC_ASSERT(offsetof(UBX_TIM_TP_V0_GROUP0_t, refInfo) == 15);
+STATIC_ASSERT(sizeof(UBX_TIM_TP_V0_GROUP0_t) == UBX_TIM_TP_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_TIM_TM2_V0_GROUP0_t, ch) == 0);
+STATIC_ASSERT(offsetof(UBX_TIM_TM2_V0_GROUP0_t, flags) == 1);
+STATIC_ASSERT(offsetof(UBX_TIM_TM2_V0_GROUP0_t, count) == 2);
+STATIC_ASSERT(offsetof(UBX_TIM_TM2_V0_GROUP0_t, wnR) == 4);
+STATIC_ASSERT(offsetof(UBX_TIM_TM2_V0_GROUP0_t, wnF) == 6);
+STATIC_ASSERT(offsetof(UBX_TIM_TM2_V0_GROUP0_t, towMsR) == 8);
+STATIC_ASSERT(offsetof(UBX_TIM_TM2_V0_GROUP0_t, towSubMsR) == 12);
+STATIC_ASSERT(offsetof(UBX_TIM_TM2_V0_GROUP0_t, towMsF) == 16);
+STATIC_ASSERT(offsetof(UBX_TIM_TM2_V0_GROUP0_t, towSubMsF) == 20);
+STATIC_ASSERT(offsetof(UBX_TIM_TM2_V0_GROUP0_t, accEst) == 24);
+STATIC_ASSERT(sizeof(UBX_TIM_TM2_V0_GROUP0_t) == UBX_TIM_TM2_V0_GROUP0_SIZE);
+STATIC_ASSERT(offsetof(UBX_TIM_SVIN_V0_GROUP0_t, dur) == 0);
+STATIC_ASSERT(offsetof(UBX_TIM_SVIN_V0_GROUP0_t, meanX) == 4);
+STATIC_ASSERT(offsetof(UBX_TIM_SVIN_V0_GROUP0_t, meanY) == 8);
+STATIC_ASSERT(offsetof(UBX_TIM_SVIN_V0_GROUP0_t, meanZ) == 12);
+STATIC_ASSERT(offsetof(UBX_TIM_SVIN_V0_GROUP0_t, meanV) == 16);
+STATIC_ASSERT(offsetof(UBX_TIM_SVIN_V0_GROUP0_t, obs) == 20);
+STATIC_ASSERT(offsetof(UBX_TIM_SVIN_V0_GROUP0_t, valid) == 24);
+STATIC_ASSERT(offsetof(UBX_TIM_SVIN_V0_GROUP0_t, active) == 25);
+STATIC_ASSERT(sizeof(UBX_TIM_SVIN_V0_GROUP0_t) == UBX_TIM_SVIN_V0_GROUP0_SIZE);
+#endif
+
+/* ****************************************************************************************************************** */
+#endif // __FF_UBX_VIEW_H__
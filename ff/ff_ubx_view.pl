@@ -0,0 +1,313 @@
+#!/usr/bin/perl
+####################################################################################################
+# flipflip's UBX protocol: generate typed message views
+#
+# Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+# https://oinkzwurgl.org/hacking/ubloxcfg
+#
+# This program is free software: you can redistribute it and/or modify it under the terms of the
+# GNU General Public License as published by the Free Software Foundation, either version 3 of the
+# License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+# even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+# See the GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along with this program.
+# If not, see <https://www.gnu.org/licenses/>.
+#
+####################################################################################################
+#
+# Usage: ff_ubx_view.pl ff/ff_ubx.h > ff/ff_ubx_view.h
+#
+# For each UBX_<CLS>_<MSG>_V<n>_GROUP<m>_t struct in ff_ubx.h this generates inline accessor
+# functions that read the fields directly from the message (little-endian, unaligned), and for each
+# message a view function that checks the message size (and version) once.
+#
+####################################################################################################
+
+use strict;
+use warnings;
+
+my $IN = shift(@ARGV);
+die("Usage: $0 ff_ubx.h > ff_ubx_view.h\n") unless ($IN);
+
+# Messages with repeated groups (group 1): field in group 0 with the number of groups, or '' for as many as fit
+my %REPEATED =
+(
+    UBX_MON_COMMS_V0  => 'nPorts',
+    UBX_MON_HW3_V0    => 'nPins',
+    UBX_MON_RF_V0     => 'nBlocks',
+    UBX_MON_SPAN_V0   => 'numRfBlocks',
+    UBX_MON_VER_V0    => '',
+    UBX_NAV_SAT_V1    => 'numSvs',
+    UBX_NAV_SIG_V0    => 'numSigs',
+    UBX_RXM_RAWX_V1   => 'numMeas',
+    UBX_RXM_SFRBX_V2  => 'numWords',
+    UBX_ESF_STATUS_V2 => 'numSens',
+);
+
+# Field types: size, reader
+my %TYPES =
+(
+    uint8_t  => [ 1, 'ubxViewU1' ],
+    int8_t   => [ 1, 'ubxViewI1' ],
+    char     => [ 1, 'ubxViewU1' ],
+    uint16_t => [ 2, 'ubxViewU2' ],
+    int16_t  => [ 2, 'ubxViewI2' ],
+    uint32_t => [ 4, 'ubxViewU4' ],
+    int32_t  => [ 4, 'ubxViewI4' ],
+    float    => [ 4, 'ubxViewR4' ],
+    double   => [ 8, 'ubxViewR8' ],
+);
+
+####################################################################################################
+# Parse structs and defines
+
+my @msgs = ();      # message prefixes in order of appearance
+my %groups = ();    # prefix => [ { name, title, size, fields => [ { type, name, num, offs } ] }, ... ]
+my %defines = ();   # defined macros
+
+open(my $fh, '<', $IN) or die("Cannot read $IN: $!\n");
+my $title = '';
+my $group = undef;
+while (my $line = <$fh>)
+{
+    if ($line =~ m{^#define\s+(\w+)})
+    {
+        $defines{$1} = 1;
+    }
+    elsif ($line =~ m{^//!\s*(.+?)\s*$})
+    {
+        $title = $1;
+    }
+    elsif ($line =~ m{^typedef struct (UBX_\w+_V\d+)_GROUP(\d)_s})
+    {
+        my ($prefix, $ix) = ($1, $2);
+        if (!$groups{$prefix})
+        {
+            push(@msgs, $prefix);
+            $groups{$prefix} = [];
+        }
+        $group = { name => "${prefix}_GROUP$ix", title => $title, size => 0, fields => [] };
+        push(@{$groups{$prefix}}, $group);
+    }
+    elsif ($group && ($line =~ m{^\}}))
+    {
+        # UBX payloads are laid out such that all fields are naturally aligned. Some structs are packed,
+        # though, and have no trailing padding.
+        my $packed = ($line =~ m{packed});
+        my $size = $group->{size};
+        my $align = 1;
+        foreach my $field (@{$group->{fields}})
+        {
+            my $fSize = $TYPES{$field->{type}}->[0];
+            die("$group->{name}.$field->{name} is not aligned\n") if (!$packed && ($size % $fSize));
+            $field->{offs} = $size;
+            $size += $fSize * $field->{num};
+            $align = $fSize if ($fSize > $align);
+        }
+        $size += $align - ($size % $align) if (!$packed && ($size % $align)); # trailing padding, like sizeof()
+        $group->{size} = $size;
+        $group = undef;
+        $title = '';
+    }
+    elsif ($group && ($line =~ m{^\s+(\w+)\s+(\w+)(?:\[(\d+)\])?;}))
+    {
+        my ($type, $name, $num) = ($1, $2, $3);
+        die("$group->{name}.$name: unknown type $type\n") unless ($TYPES{$type});
+        push(@{$group->{fields}}, { type => $type, name => $name, num => $num // 1, arr => defined($num) });
+    }
+    elsif ($group && ($line !~ m{^\{}) && ($line !~ m{^\s*//}) && ($line =~ m{\S}))
+    {
+        die("$group->{name}: cannot parse: $line");
+    }
+}
+close($fh);
+
+####################################################################################################
+# Generate
+
+my @out = ();
+push(@out,
+    '// flipflip\'s UBX protocol: typed message views',
+    '//',
+    '// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),',
+    '// https://oinkzwurgl.org/hacking/ubloxcfg',
+    '//',
+    '// This program is free software: you can redistribute it and/or modify it under the terms of the',
+    '// GNU General Public License as published by the Free Software Foundation, either version 3 of the',
+    '// License, or (at your option) any later version.',
+    '//',
+    '// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without',
+    '// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.',
+    '// See the GNU General Public License for more details.',
+    '//',
+    '// You should have received a copy of the GNU General Public License along with this program.',
+    '// If not, see <https://www.gnu.org/licenses/>.',
+    '//',
+    '// *** Generated by ff_ubx_view.pl from ff_ubx.h, do not edit. ***',
+    '//',
+    '// Typed, zero-copy views of UBX messages. The view functions (UBX_<CLS>_<MSG>_V<n>_view()) check the',
+    '// message size (and version) once and set up a UBX_VIEW_t. The field accessors',
+    '// (UBX_<CLS>_<MSG>_V<n>_GROUP<m>_<field>()) then read the fields directly from the message. For',
+    '// example:',
+    '//',
+    '//     UBX_VIEW_t view;',
+    '//     if (UBX_NAV_SIG_V0_view(&view, msg, msgSize))',
+    '//     {',
+    '//         for (int ix = 0; ix < view.numGroups; ix++)',
+    '//         {',
+    '//             const uint8_t *sig = UBX_VIEW_GROUP(&view, ix);',
+    '//             const int cno = UBX_NAV_SIG_V0_GROUP1_cno(sig);',
+    '//         }',
+    '//     }',
+    '//',
+    '// In C++ the repeated groups can be iterated using Ff::UbxGroups (ff_cpp.hpp).',
+    '',
+    '#ifndef __FF_UBX_VIEW_H__',
+    '#define __FF_UBX_VIEW_H__',
+    '',
+    '#include <stdint.h>',
+    '#include <stdbool.h>',
+    '#include <string.h>',
+    '',
+    '#include "ff_ubx.h"',
+    '',
+    '/* ****************************************************************************************************************** */',
+    '',
+    '//! View of a UBX message',
+    'typedef struct UBX_VIEW_s',
+    '{',
+    '    const uint8_t *head;       //!< Payload head (group 0)',
+    '    const uint8_t *groups;     //!< First repeated group (group 1), NULL if the message has none',
+    '    int            numGroups;  //!< Number of repeated groups (0 if the message does not tell the number)',
+    '    int            groupSize;  //!< Size of a repeated group',
+    '} UBX_VIEW_t;',
+    '',
+    '//! Get repeated group ix (0..UBX_VIEW_t.numGroups-1) of a view',
+    '#define UBX_VIEW_GROUP(view, ix) (&(view)->groups[(ix) * (view)->groupSize])',
+    '',
+    '// Little-endian readers',
+    'static inline uint8_t  ubxViewU1(const uint8_t *p) { return p[0]; }',
+    'static inline int8_t   ubxViewI1(const uint8_t *p) { return (int8_t)p[0]; }',
+    'static inline uint16_t ubxViewU2(const uint8_t *p) { return (uint16_t)p[0] | (uint16_t)((uint16_t)p[1] << 8); }',
+    'static inline int16_t  ubxViewI2(const uint8_t *p) { return (int16_t)ubxViewU2(p); }',
+    'static inline uint32_t ubxViewU4(const uint8_t *p) { return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }',
+    'static inline int32_t  ubxViewI4(const uint8_t *p) { return (int32_t)ubxViewU4(p); }',
+    'static inline float    ubxViewR4(const uint8_t *p) { const uint32_t u = ubxViewU4(p); float r; memcpy(&r, &u, sizeof(r)); return r; }',
+    'static inline double   ubxViewR8(const uint8_t *p) { const uint64_t u = (uint64_t)ubxViewU4(p) | ((uint64_t)ubxViewU4(&p[4]) << 32); double r; memcpy(&r, &u, sizeof(r)); return r; }',
+);
+
+my @asserts = ();
+foreach my $prefix (@msgs)
+{
+    my @grps = @{$groups{$prefix}};
+    my ($msgName) = $prefix =~ m{^UBX_(\w+)_V\d+$};
+    $msgName =~ s{_}{-}g;
+    my ($version) = $prefix =~ m{_V(\d+)$};
+    push(@out, '', '// ' . ('-' x 117), '', "// UBX-$msgName (version $version)");
+
+    # Accessors
+    foreach my $grp (@grps)
+    {
+        push(@out, '', "#define $grp->{name}_SIZE $grp->{size} //!< Size of $grp->{name}_t");
+        foreach my $field (@{$grp->{fields}})
+        {
+            next if ($field->{name} =~ m{^reserved});
+            my ($fSize, $reader) = @{$TYPES{$field->{type}}};
+            my $func = "$grp->{name}_$field->{name}";
+            if ($field->{arr} && ($fSize == 1))
+            {
+                my $type = $field->{type} eq 'char' ? 'char' : 'uint8_t';
+                push(@out, "static inline const $type *$func(const uint8_t *grp) { return (const $type *)&grp[$field->{offs}]; } //!< $field->{type} [$field->{num}]");
+            }
+            elsif ($field->{arr})
+            {
+                push(@out, "static inline $field->{type} $func(const uint8_t *grp, const int ix) { return $reader(&grp[$field->{offs} + (ix * $fSize)]); } //!< ix = 0..@{[ $field->{num} - 1 ]}");
+            }
+            else
+            {
+                push(@out, "static inline $field->{type} $func(const uint8_t *grp) { return $reader(&grp[$field->{offs}]); }");
+            }
+            push(@asserts, "STATIC_ASSERT(offsetof($grp->{name}_t, $field->{name}) == $field->{offs});");
+        }
+        push(@asserts, "STATIC_ASSERT(sizeof($grp->{name}_t) == $grp->{name}_SIZE);");
+    }
+
+    # View
+    my $head = $grps[0];
+    my $rep = $#grps > 0 ? $grps[1] : undef;
+    my ($versionField) = grep { $_->{name} eq 'version' } @{$head->{fields}};
+    my $checkVersion = $versionField && $defines{"${prefix}_VERSION"};
+    my $exact = $defines{"${prefix}_SIZE"} && !$rep;
+    my @cond = ( $exact ? "(msgSize != (UBX_FRAME_SIZE + $head->{name}_SIZE))" : "(msgSize < (UBX_FRAME_SIZE + $head->{name}_SIZE))" );
+    if ($checkVersion)
+    {
+        push(@cond, "(msg[UBX_HEAD_SIZE + $versionField->{offs}] != ${prefix}_VERSION)");
+    }
+    push(@out,
+        '',
+        "//! Get view of a UBX-$msgName (version $version) message, returns false if the message is too short" . ($checkVersion ? " or has the wrong version" : ''),
+        "static inline bool ${prefix}_view(UBX_VIEW_t *view, const uint8_t *msg, const int msgSize)",
+        '{',
+        '    if ( ' . join(' || ', @cond) . ' )',
+        '    {',
+        '        return false;',
+        '    }',
+        "    view->head      = &msg[UBX_HEAD_SIZE];",
+    );
+    if ($rep)
+    {
+        my $count = $REPEATED{$prefix};
+        push(@out,
+            "    view->groups    = &msg[UBX_HEAD_SIZE + $head->{name}_SIZE];",
+            "    view->groupSize = $rep->{name}_SIZE;",
+        );
+        if (!defined($count))
+        {
+            push(@out, '    view->numGroups = 0;', '    return true;');
+        }
+        elsif ($count eq '')
+        {
+            push(@out, "    view->numGroups = (msgSize - UBX_FRAME_SIZE - $head->{name}_SIZE) / $rep->{name}_SIZE;", '    return true;');
+        }
+        else
+        {
+            die("$prefix: no $count in $head->{name}\n") unless (grep { $_->{name} eq $count } @{$head->{fields}});
+            push(@out,
+                "    view->numGroups = $head->{name}_$count(view->head);",
+                "    return msgSize >= (UBX_FRAME_SIZE + $head->{name}_SIZE + (view->numGroups * $rep->{name}_SIZE));",
+            );
+        }
+    }
+    else
+    {
+        push(@out,
+            '    view->groups    = NULL;',
+            '    view->groupSize = 0;',
+            '    view->numGroups = 0;',
+            '    return true;',
+        );
+    }
+    push(@out, '}');
+}
+
+push(@out,
+    '',
+    '// ' . ('-' x 117),
+    '',
+    '// Check that the views match the structs in ff_ubx.h',
+    '#ifndef __cplusplus',
+    '#include <stddef.h>',
+    '#include "ff_stuff.h"',
+    @asserts,
+    '#endif',
+    '',
+    '/* ****************************************************************************************************************** */',
+    '#endif // __FF_UBX_VIEW_H__',
+);
+
+print(join("\n", @out), "\n");
+
+####################################################################################################
@@ -0,0 +1,473 @@
+// u-blox 9 positioning receivers configuration library and tool: benchmark utilities
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+// without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "ff_stuff.h"
+#include "ff_debug.h"
+#include "ff_ubx.h"
+#include "ff_nmea.h"
+#include "ff_rtcm3.h"
+#include "ff_crc.h"
+#include "config.h"
+
+#include "bench.h"
+
+/* ****************************************************************************************************************** */
+
+volatile uint32_t gBenchSink;
+
+static double gBenchTime = 1.0; // [s] total time per benchmark (approximately)
+static char **gBenchFilters = NULL;
+static int gBenchNumFilters = 0;
+
+bool benchInit(int argc, char **argv, const char *prog)
+{
+    for (int argIx = 1; argIx < argc; argIx++)
+    {
+        if ( (strcmp(argv[argIx], "-t") == 0) && ((argIx + 1) < argc) )
+        {
+            gBenchTime = atof(argv[argIx + 1]);
+            argIx++;
+        }
+        else if (argv[argIx][0] == '-')
+        {
+            fprintf(stderr, "Usage: %s [-t <seconds>] [<filter> ...]\n", argv[0]);
+            return false;
+        }
+        else
+        {
+            gBenchFilters = &argv[argIx];
+            gBenchNumFilters = argc - argIx;
+            break;
+        }
+    }
+    if (gBenchTime < 0.01)
+    {
+        gBenchTime = 0.01;
+    }
+
+    fprintf(stdout, "{\"name\":\"info\",\"prog\":\"%s\",\"version\":\"%s\",\"githash\":\"%s\",\"runs\":%d,\"time\":%.3f}\n",
+        prog, CONFIG_VERSION, CONFIG_GITHASH, BENCH_NUM_RUNS, gBenchTime);
+    fflush(stdout);
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static uint64_t _runIter(BENCH_FUNC_t func, void *arg, const uint64_t nIter)
+{
+    const uint64_t t0 = TIME_NS();
+    for (uint64_t iter = 0; iter < nIter; iter++)
+    {
+        func(arg);
+    }
+    const uint64_t t1 = TIME_NS();
+    return t1 > t0 ? t1 - t0 : 1;
+}
+
+static int _cmpDouble(const void *a, const void *b)
+{
+    const double da = *(const double *)a;
+    const double db = *(const double *)b;
+    return da < db ? -1 : (da > db ? 1 : 0);
+}
+
+void benchRun(const char *name, BENCH_FUNC_t func, void *arg, const uint64_t bytes, const uint64_t items)
+{
+    if (gBenchNumFilters > 0)
+    {
+        bool match = false;
+        for (int ix = 0; !match && (ix < gBenchNumFilters); ix++)
+        {
+            match = strstr(name, gBenchFilters[ix]) != NULL;
+        }
+        if (!match)
+        {
+            return;
+        }
+    }
+
+    // Warm-up and calibration: find number of iterations for a run
+    const uint64_t tRun = (uint64_t)(gBenchTime * 1e9 / (double)BENCH_NUM_RUNS);
+    uint64_t nIter = 1;
+    while (true)
+    {
+        const uint64_t dt = _runIter(func, arg, nIter);
+        if ( (dt >= (tRun / 10)) || (nIter >= ((uint64_t)1 << 40)) )
+        {
+            nIter = (uint64_t)((double)nIter * (double)tRun / (double)dt);
+            break;
+        }
+        nIter *= 2;
+    }
+    if (nIter < 1)
+    {
+        nIter = 1;
+    }
+
+    // Measure
+    double nsPerIter[BENCH_NUM_RUNS];
+    for (int run = 0; run < BENCH_NUM_RUNS; run++)
+    {
+        nsPerIter[run] = (double)_runIter(func, arg, nIter) / (double)nIter;
+    }
+    qsort(nsPerIter, NUMOF(nsPerIter), sizeof(*nsPerIter), _cmpDouble);
+    const double nsMin = nsPerIter[0];
+    const double nsMed = nsPerIter[BENCH_NUM_RUNS / 2];
+
+    fprintf(stdout, "{\"name\":\"%s\",\"iter\":%" PRIu64 ",\"ns_min\":%.1f,\"ns_med\":%.1f", name, nIter, nsMin, nsMed);
+    if (bytes > 0)
+    {
+        fprintf(stdout, ",\"bytes\":%" PRIu64 ",\"mb_s\":%.3f", bytes, (double)bytes / nsMin * (1e9 / (1024.0 * 1024.0)));
+    }
+    if (items > 0)
+    {
+        fprintf(stdout, ",\"items\":%" PRIu64 ",\"items_s\":%.1f", items, (double)items / nsMin * 1e9);
+    }
+    fputs("}\n", stdout);
+    fflush(stdout);
+}
+
+/* ****************************************************************************************************************** */
+
+// Deterministic pseudo-random numbers (xorshift32)
+static uint32_t _rand(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+// UBX-NAV-PVT, UBX-NAV-SAT, UBX-NAV-SIG and UBX-NAV-EOE for one epoch
+static int _makeUbxEpoch(uint8_t *buf, const uint32_t iTow, uint32_t *rnd, int *nMsgs)
+{
+    int len = 0;
+    uint8_t payload[2000];
+
+    // UBX-NAV-PVT
+    {
+        UBX_NAV_PVT_V1_GROUP0_t pvt;
+        memset(&pvt, 0, sizeof(pvt));
+        pvt.iTOW    = iTow;
+        pvt.year    = 2022;
+        pvt.month   = 6;
+        pvt.day     = 15;
+        pvt.hour    = (iTow / 3600000) % 24;
+        pvt.min     = (iTow / 60000) % 60;
+        pvt.sec     = (iTow / 1000) % 60;
+        pvt.valid   = UBX_NAV_PVT_V1_VALID_VALIDDATE | UBX_NAV_PVT_V1_VALID_VALIDTIME;
+        pvt.fixType = UBX_NAV_PVT_V1_FIXTYPE_3D;
+        pvt.flags   = UBX_NAV_PVT_V1_FLAGS_GNSSFIXOK;
+        pvt.numSV   = 25;
+        pvt.lat     = 473000000 + (int32_t)(_rand(rnd) % 1000);
+        pvt.lon     =  85000000 + (int32_t)(_rand(rnd) % 1000);
+        pvt.height  = 500000;
+        pvt.hMSL    = 450000;
+        pvt.hAcc    = 1500;
+        pvt.vAcc    = 2500;
+        pvt.pDOP    = 120;
+        len += ubxMakeMessage(UBX_NAV_CLSID, UBX_NAV_PVT_MSGID, (const uint8_t *)&pvt, sizeof(pvt), &buf[len]);
+        (*nMsgs)++;
+    }
+
+    // UBX-NAV-SAT, 30 SVs
+    {
+        const int numSvs = 30;
+        UBX_NAV_SAT_V1_GROUP0_t head = { .iTOW = iTow, .version = UBX_NAV_SAT_V1_VERSION, .numSvs = numSvs };
+        memcpy(&payload[0], &head, sizeof(head));
+        for (int ix = 0; ix < numSvs; ix++)
+        {
+            UBX_NAV_SAT_V1_GROUP1_t sv;
+            memset(&sv, 0, sizeof(sv));
+            sv.gnssId = (ix / 10) * 2; // GPS, Galileo, GLONASS
+            sv.svId   = 1 + (ix % 10);
+            sv.cno    = 30 + (_rand(rnd) % 20);
+            sv.elev   = 10 + (ix * 2);
+            sv.azim   = ix * 12;
+            sv.flags  = 0x00001f1f;
+            memcpy(&payload[sizeof(head) + (ix * sizeof(sv))], &sv, sizeof(sv));
+        }
+        len += ubxMakeMessage(UBX_NAV_CLSID, UBX_NAV_SAT_MSGID, payload,
+            sizeof(UBX_NAV_SAT_V1_GROUP0_t) + (numSvs * sizeof(UBX_NAV_SAT_V1_GROUP1_t)), &buf[len]);
+        (*nMsgs)++;
+    }
+
+    // UBX-NAV-SIG, 60 signals
+    {
+        const int numSigs = 60;
+        UBX_NAV_SIG_V0_GROUP0_t head = { .iTOW = iTow, .version = UBX_NAV_SIG_V0_VERSION, .numSigs = numSigs };
+        memcpy(&payload[0], &head, sizeof(head));
+        for (int ix = 0; ix < numSigs; ix++)
+        {
+            UBX_NAV_SIG_V0_GROUP1_t sig;
+            memset(&sig, 0, sizeof(sig));
+            sig.gnssId     = ((ix / 2) / 10) * 2;
+            sig.svId       = 1 + ((ix / 2) % 10);
+            sig.sigId      = (ix % 2) == 0 ? 0 : (sig.gnssId == 2 ? 5 : 3);
+            sig.cno        = 30 + (_rand(rnd) % 20);
+            sig.qualityInd = UBX_NAV_SIG_V0_QUALITYIND_CODELOCK;
+            sig.sigFlags   = 0x0029;
+            memcpy(&payload[sizeof(head) + (ix * sizeof(sig))], &sig, sizeof(sig));
+        }
+        len += ubxMakeMessage(UBX_NAV_CLSID, UBX_NAV_SIG_MSGID, payload,
+            sizeof(UBX_NAV_SIG_V0_GROUP0_t) + (numSigs * sizeof(UBX_NAV_SIG_V0_GROUP1_t)), &buf[len]);
+        (*nMsgs)++;
+    }
+
+    // UBX-NAV-EOE
+    {
+        UBX_NAV_EOE_V0_GROUP0_t eoe = { .iTOW = iTow };
+        len += ubxMakeMessage(UBX_NAV_CLSID, UBX_NAV_EOE_MSGID, (const uint8_t *)&eoe, sizeof(eoe), &buf[len]);
+        (*nMsgs)++;
+    }
+
+    return len;
+}
+
+// NMEA GGA, RMC and GSV for one epoch
+static int _makeNmeaEpoch(uint8_t *buf, const uint32_t iTow, uint32_t *rnd, int *nMsgs)
+{
+    int len = 0;
+    char payload[200];
+    const int hour = (iTow / 3600000) % 24;
+    const int min  = (iTow / 60000) % 60;
+    const int sec  = (iTow / 1000) % 60;
+
+    snprintf(payload, sizeof(payload), "%02d%02d%02d.00,4718.%05u,N,00830.%05u,E,1,12,0.99,450.0,M,48.0,M,,",
+        hour, min, sec, _rand(rnd) % 100000, _rand(rnd) % 100000);
+    len += nmeaMakeMessage("GN", "GGA", payload, (char *)&buf[len]);
+    (*nMsgs)++;
+
+    snprintf(payload, sizeof(payload), "%02d%02d%02d.00,A,4718.%05u,N,00830.%05u,E,0.010,,150622,,,A,V",
+        hour, min, sec, _rand(rnd) % 100000, _rand(rnd) % 100000);
+    len += nmeaMakeMessage("GN", "RMC", payload, (char *)&buf[len]);
+    (*nMsgs)++;
+
+    for (int ix = 1; ix <= 3; ix++)
+    {
+        int plen = snprintf(payload, sizeof(payload), "3,%d,12", ix);
+        for (int sv = 0; sv < 4; sv++)
+        {
+            plen += snprintf(&payload[plen], sizeof(payload) - plen, ",%02d,%02d,%03d,%02d",
+                ((ix - 1) * 4) + sv + 1, 10 + (sv * 15), sv * 90, 30 + (_rand(rnd) % 20));
+        }
+        snprintf(&payload[plen], sizeof(payload) - plen, ",1");
+        len += nmeaMakeMessage("GP", "GSV", payload, (char *)&buf[len]);
+        (*nMsgs)++;
+    }
+
+    return len;
+}
+
+// Set bits in big-endian data
+static void _setBits(uint8_t *data, const int offs, const int size, const uint64_t val)
+{
+    for (int ix = 0; ix < size; ix++)
+    {
+        const int bit = offs + ix;
+        const uint8_t mask = 0x80 >> (bit % 8);
+        if ( ((val >> (size - 1 - ix)) & 0x1) != 0 )
+        {
+            data[bit / 8] |= mask;
+        }
+        else
+        {
+            data[bit / 8] &= ~mask;
+        }
+    }
+}
+
+// RTCM3 message with random payload (MSM messages get a valid time and masks, and random observations)
+static int _makeRtcm3(uint8_t *buf, const int type, const int payloadSize, const uint32_t iTow, uint32_t *rnd, int *nMsgs)
+{
+    buf[0] = RTCM3_PREAMBLE;
+    buf[1] = (payloadSize >> 8) & 0x03;
+    buf[2] = payloadSize & 0xff;
+    uint8_t *payload = &buf[RTCM3_HEAD_SIZE];
+    for (int ix = 0; ix < payloadSize; ix++)
+    {
+        payload[ix] = _rand(rnd) & 0xff;
+    }
+    payload[0] = (type >> 4) & 0xff;
+    payload[1] = ((type & 0x0f) << 4) | (payload[1] & 0x0f);
+    if (type != 4072)
+    {
+        _setBits(payload, 12, 12, 1234); // DF003 reference station ID (in all messages used here)
+    }
+    RTCM3_MSM_GNSS_t gnss;
+    if (rtcm3typeToMsm(type, &gnss, NULL))
+    {
+        if (gnss == RTCM3_MSM_GNSS_GLO)
+        {
+            // GLONASS time = UTC + 3h (assuming 18 leap seconds)
+            const uint32_t gloTow = (iTow + 604800000 - 18000 + 10800000) % 604800000;
+            _setBits(payload, 24,  3, gloTow / 86400000);                           // DF416
+            _setBits(payload, 27, 27, gloTow % 86400000);                           // DF034
+        }
+        else if (gnss == RTCM3_MSM_GNSS_BDS)
+        {
+            _setBits(payload, 24, 30, (iTow + 604800000 - 14000) % 604800000);      // DF427, BeiDou time = GPS time - 14s
+        }
+        else
+        {
+            _setBits(payload, 24, 30, iTow);                                        // DF004 etc.
+        }
+        uint64_t satMask = 0;
+        for (int ix = 0; ix < 10; ix++)
+        {
+            satMask |= (uint64_t)1 << (_rand(rnd) % 32);
+        }
+        const int numSat = __builtin_popcountll(satMask);
+        _setBits(payload,  73, 64, satMask << 32);                                  // DF394
+        _setBits(payload, 137, 32, ((uint64_t)1 << 30) | ((uint64_t)1 << 22));      // DF395
+        _setBits(payload, 169, numSat * 2, ((uint64_t)1 << (numSat * 2)) - 1);      // DF396
+    }
+    const uint32_t crc = crcRtcm3(buf, RTCM3_HEAD_SIZE + payloadSize);
+    buf[RTCM3_HEAD_SIZE + payloadSize + 0] = (crc >> 16) & 0xff;
+    buf[RTCM3_HEAD_SIZE + payloadSize + 1] = (crc >>  8) & 0xff;
+    buf[RTCM3_HEAD_SIZE + payloadSize + 2] =  crc        & 0xff;
+    (*nMsgs)++;
+    return payloadSize + RTCM3_FRAME_SIZE;
+}
+
+bool benchMakeStream(BENCH_DATA_t *data, const BENCH_STREAM_t type, const int size)
+{
+    const int maxEpochSize = 10000;
+    memset(data, 0, sizeof(*data));
+    data->data = malloc(size + maxEpochSize);
+    if (data->data == NULL)
+    {
+        return false;
+    }
+
+    uint32_t rnd = 0x12345678;
+    uint32_t iTow = 300000000;
+    while (data->size < size)
+    {
+        uint8_t *buf = &data->data[data->size];
+        int len = 0;
+        switch (type)
+        {
+            case BENCH_STREAM_UBX:
+                len += _makeUbxEpoch(&buf[len], iTow, &rnd, &data->nMsgs);
+                break;
+            case BENCH_STREAM_MIXED:
+                len += _makeUbxEpoch(&buf[len], iTow, &rnd, &data->nMsgs);
+                len += _makeNmeaEpoch(&buf[len], iTow, &rnd, &data->nMsgs);
+                len += _makeRtcm3(&buf[len], 1005, 19, iTow, &rnd, &data->nMsgs);
+                len += _makeRtcm3(&buf[len], 1077, 400, iTow, &rnd, &data->nMsgs);
+                len += _makeRtcm3(&buf[len], 1087, 300, iTow, &rnd, &data->nMsgs);
+                len += _makeRtcm3(&buf[len], 1097, 350, iTow, &rnd, &data->nMsgs);
+                len += _makeRtcm3(&buf[len], 1127, 300, iTow, &rnd, &data->nMsgs);
+                break;
+            case BENCH_STREAM_GARBAGE:
+            {
+                const int ubxSize = _makeUbxEpoch(&buf[len], iTow, &rnd, &data->nMsgs);
+                len += ubxSize;
+                for (int ix = 0; ix < ubxSize; ix++)
+                {
+                    buf[len++] = _rand(&rnd) & 0xff;
+                }
+                break;
+            }
+        }
+        data->size += len;
+        data->nEpochs++;
+        iTow += 1000;
+    }
+    return true;
+}
+
+void benchFreeStream(BENCH_DATA_t *data)
+{
+    if (data->data != NULL)
+    {
+        free(data->data);
+    }
+    memset(data, 0, sizeof(*data));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool benchParseStream(BENCH_MSGS_t *msgs, const BENCH_DATA_t *data)
+{
+    memset(msgs, 0, sizeof(*msgs));
+    int nAlloc = data->nMsgs + 100;
+    msgs->msgs = calloc(nAlloc, sizeof(PARSER_MSG_t));
+    if (msgs->msgs == NULL)
+    {
+        return false;
+    }
+
+    PARSER_t parser;
+    parserInit(&parser);
+    int offs = 0;
+    while (offs < data->size)
+    {
+        const int size = MIN(data->size - offs, BENCH_CHUNK_SIZE);
+        parserAdd(&parser, &data->data[offs], size);
+        offs += size;
+        PARSER_MSG_t msg;
+        while (parserProcess(&parser, &msg, false) || ((offs >= data->size) && parserFlush(&parser, &msg)))
+        {
+            if ( (msg.type == PARSER_MSGTYPE_GARBAGE) || (msgs->nMsgs >= nAlloc) )
+            {
+                continue;
+            }
+            PARSER_MSG_t *copy = &msgs->msgs[msgs->nMsgs];
+            *copy = msg;
+            uint8_t *msgData = malloc(msg.size);
+            char *msgName = strdup(msg.name);
+            if ( (msgData == NULL) || (msgName == NULL) )
+            {
+                free(msgData);
+                free(msgName);
+                benchFreeMsgs(msgs);
+                return false;
+            }
+            memcpy(msgData, msg.data, msg.size);
+            copy->data = msgData;
+            copy->name = msgName;
+            copy->info = NULL;
+            msgs->nMsgs++;
+        }
+    }
+    return true;
+}
+
+void benchFreeMsgs(BENCH_MSGS_t *msgs)
+{
+    if (msgs->msgs != NULL)
+    {
+        for (int ix = 0; ix < msgs->nMsgs; ix++)
+        {
+            free((void *)msgs->msgs[ix].data);
+            free((void *)msgs->msgs[ix].name);
+        }
+        free(msgs->msgs);
+    }
+    memset(msgs, 0, sizeof(*msgs));
+}
+
+/* ****************************************************************************************************************** */
+// eof
@@ -0,0 +1,101 @@
+// u-blox 9 positioning receivers configuration library and tool: benchmark utilities
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+// without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+//
+// Each benchmark is run repeatedly (BENCH_NUM_RUNS runs of a calibrated number of iterations) and
+// its result is printed as one line of JSON to stdout:
+//
+//   {"name":"parser_ubx","iter":1234,"ns_min":...,"ns_med":...,"mb_s":...,"items_s":...}
+//
+// - iter:    number of iterations per run
+// - ns_min:  fastest run, nanoseconds per iteration
+// - ns_med:  median run, nanoseconds per iteration
+// - mb_s:    throughput [MiB/s] (based on ns_min, only if the benchmark processes bytes)
+// - items_s: throughput [items/s] (based on ns_min, only if the benchmark processes items)
+//
+// The first line is {"name":"info",...} with the version and the git hash of the code.
+
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "ff_parser.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ****************************************************************************************************************** */
+
+#define BENCH_NUM_RUNS        5
+#define BENCH_CHUNK_SIZE   2048  // size of chunks of data fed to the parser (typical port read size)
+
+//! Benchmark function, called once per iteration
+typedef void (*BENCH_FUNC_t)(void *arg);
+
+//! Initialise benchmarks, handle command line (-t <seconds>, name filters), print info line
+bool benchInit(int argc, char **argv, const char *prog);
+
+//! Run benchmark (if it matches the filter), bytes and items processed per iteration can be 0
+void benchRun(const char *name, BENCH_FUNC_t func, void *arg, const uint64_t bytes, const uint64_t items);
+
+//! Sink for results, to prevent the compiler from optimising away the benchmarked code
+extern volatile uint32_t gBenchSink;
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+//! Synthetic stream types
+typedef enum BENCH_STREAM_e
+{
+    BENCH_STREAM_UBX,      //!< Clean UBX (NAV-PVT, NAV-SAT, NAV-SIG, NAV-EOE epochs)
+    BENCH_STREAM_MIXED,    //!< UBX, NMEA (GGA, RMC, GSV) and RTCM3 (1005, 1077, 1087, 1097, 1127)
+    BENCH_STREAM_GARBAGE,  //!< UBX epochs interleaved with random bytes (about 50%)
+} BENCH_STREAM_t;
+
+//! Synthetic stream
+typedef struct BENCH_DATA_s
+{
+    uint8_t *data;   //!< Data
+    int      size;   //!< Size of data
+    int      nMsgs;  //!< Number of (proper) messages in data
+    int      nEpochs;//!< Number of epochs in data
+} BENCH_DATA_t;
+
+//! Make synthetic stream of (about) the given size, the data is deterministic (pseudo-random with fixed seed)
+bool benchMakeStream(BENCH_DATA_t *data, const BENCH_STREAM_t type, const int size);
+
+//! Free synthetic stream
+void benchFreeStream(BENCH_DATA_t *data);
+
+//! Messages of a stream
+typedef struct BENCH_MSGS_s
+{
+    PARSER_MSG_t *msgs;   //!< Messages (name, info and data are copies)
+    int           nMsgs;  //!< Number of messages
+} BENCH_MSGS_t;
+
+//! Parse stream into list of messages (without garbage)
+bool benchParseStream(BENCH_MSGS_t *msgs, const BENCH_DATA_t *data);
+
+//! Free list of messages
+void benchFreeMsgs(BENCH_MSGS_t *msgs);
+
+/* ****************************************************************************************************************** */
+#ifdef __cplusplus
+}
+#endif
+#endif // __BENCH_H__
@@ -0,0 +1,89 @@
+// u-blox 9 positioning receivers configuration library and tool: cfggui benchmarks
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+// without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <cstdlib>
+#include <vector>
+#include <memory>
+
+#include "ff_stuff.h"
+#include "ff_debug.h"
+#include "ff_epoch.h"
+
+#include "database.hpp"
+
+#include "bench.h"
+
+/* ****************************************************************************************************************** */
+
+#define STREAM_SIZE (1024 * 1024)
+
+struct DbBench
+{
+    std::unique_ptr<Database> db;
+    std::vector<EPOCH_t>      epochs;
+};
+
+static void _benchDatabaseAddEpoch(void *arg)
+{
+    DbBench *bench = static_cast<DbBench *>(arg);
+    for (const auto &epoch: bench->epochs)
+    {
+        bench->db->AddEpoch(epoch);
+    }
+    gBenchSink += bench->db->Size();
+}
+
+int main(int argc, char **argv)
+{
+    DEBUG_CFG_t debugCfg = { .level = DEBUG_LEVEL_WARNING, .colour = false, .mark = NULL, .func = NULL, .arg = NULL };
+    debugSetup(&debugCfg);
+
+    if (!benchInit(argc, argv, "bench_cfggui"))
+    {
+        return EXIT_FAILURE;
+    }
+
+    // Epochs from a synthetic stream
+    DbBench bench;
+    BENCH_DATA_t stream;
+    BENCH_MSGS_t msgs;
+    if (!benchMakeStream(&stream, BENCH_STREAM_UBX, STREAM_SIZE) || !benchParseStream(&msgs, &stream))
+    {
+        WARNING("Failed making stream!");
+        return EXIT_FAILURE;
+    }
+    EPOCH_t coll;
+    EPOCH_t epoch;
+    epochInit(&coll);
+    for (int ix = 0; ix < msgs.nMsgs; ix++)
+    {
+        if (epochCollect(&coll, &msgs.msgs[ix], &epoch))
+        {
+            bench.epochs.push_back(epoch);
+        }
+    }
+    benchFreeMsgs(&msgs);
+    benchFreeStream(&stream);
+
+    // Database (the database is full after the first iteration, i.e. the remaining ones measure the steady state)
+    bench.db = std::make_unique<Database>("bench");
+    benchRun("database_addepoch", _benchDatabaseAddEpoch, &bench, 0, bench.epochs.size());
+
+    return EXIT_SUCCESS;
+}
+
+/* ****************************************************************************************************************** */
+// eof
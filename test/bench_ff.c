@@ -0,0 +1,435 @@
+// u-blox 9 positioning receivers configuration library and tool: ff and ubloxcfg benchmarks
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+// without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ff_stuff.h"
+#include "ff_debug.h"
+#include "ff_parser.h"
+#include "ff_epoch.h"
+#include "ff_nmea.h"
+#include "ff_rtcm3.h"
+#include "ff_rtcm3stats.h"
+#include "ff_crc.h"
+#include "ubloxcfg.h"
+
+#include "bench.h"
+
+/* ****************************************************************************************************************** */
+
+#define STREAM_SIZE    (1024 * 1024)
+#define CRC_DATA_SIZE   4096
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static PARSER_t gParser;
+
+static void _benchParser(void *arg)
+{
+    const BENCH_DATA_t *data = (const BENCH_DATA_t *)arg;
+    parserInit(&gParser);
+    PARSER_MSG_t msg;
+    uint32_t n = 0;
+    for (int offs = 0; offs < data->size; offs += BENCH_CHUNK_SIZE)
+    {
+        parserAdd(&gParser, &data->data[offs], MIN(data->size - offs, BENCH_CHUNK_SIZE));
+        while (parserProcess(&gParser, &msg, false))
+        {
+            n += msg.size;
+        }
+    }
+    gBenchSink += n;
+}
+
+static void _benchParserInfo(void *arg)
+{
+    const BENCH_DATA_t *data = (const BENCH_DATA_t *)arg;
+    parserInit(&gParser);
+    PARSER_MSG_t msg;
+    uint32_t n = 0;
+    for (int offs = 0; offs < data->size; offs += BENCH_CHUNK_SIZE)
+    {
+        parserAdd(&gParser, &data->data[offs], MIN(data->size - offs, BENCH_CHUNK_SIZE));
+        while (parserProcess(&gParser, &msg, true))
+        {
+            n += msg.size;
+        }
+    }
+    gBenchSink += n;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static uint8_t gCrcData[CRC_DATA_SIZE];
+
+static void _benchCrcRtcm3(void *arg)     { UNUSED(arg); gBenchSink += crcRtcm3(gCrcData, sizeof(gCrcData)); }
+static void _benchCrcSpartn4(void *arg)   { UNUSED(arg); gBenchSink += crcSpartn4(gCrcData, sizeof(gCrcData)); }
+static void _benchCrcSpartn8(void *arg)   { UNUSED(arg); gBenchSink += crcSpartn8(gCrcData, sizeof(gCrcData)); }
+static void _benchCrcSpartn16(void *arg)  { UNUSED(arg); gBenchSink += crcSpartn16(gCrcData, sizeof(gCrcData)); }
+static void _benchCrcSpartn24(void *arg)  { UNUSED(arg); gBenchSink += crcSpartn24(gCrcData, sizeof(gCrcData)); }
+static void _benchCrcSpartn32(void *arg)  { UNUSED(arg); gBenchSink += crcSpartn32(gCrcData, sizeof(gCrcData)); }
+static void _benchCrcNovatel32(void *arg) { UNUSED(arg); gBenchSink += crcNovatel32(gCrcData, sizeof(gCrcData)); }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static EPOCH_t gColl;
+static EPOCH_t gEpoch;
+
+static void _benchEpochCollect(void *arg)
+{
+    const BENCH_MSGS_t *msgs = (const BENCH_MSGS_t *)arg;
+    epochInit(&gColl);
+    uint32_t n = 0;
+    for (int ix = 0; ix < msgs->nMsgs; ix++)
+    {
+        if (epochCollect(&gColl, &msgs->msgs[ix], &gEpoch))
+        {
+            n += gEpoch.seq;
+        }
+    }
+    gBenchSink += n;
+}
+
+static EPOCH_COLLECTOR_t gCollector;
+
+static void _epochCollector(const BENCH_MSGS_t *msgs, const uint32_t flags)
+{
+    epochCollectorInit(&gCollector, flags);
+    uint32_t n = 0;
+    for (int ix = 0; ix < msgs->nMsgs; ix++)
+    {
+        const EPOCH_t *epoch = epochCollectorAdd(&gCollector, &msgs->msgs[ix]);
+        if (epoch != NULL)
+        {
+            n += epoch->seq;
+        }
+    }
+    gBenchSink += n;
+}
+
+static void _benchEpochCollector(void *arg)      { _epochCollector((const BENCH_MSGS_t *)arg, EPOCH_FLAGS_NONE); }
+static void _benchEpochCollectorNoStr(void *arg) { _epochCollector((const BENCH_MSGS_t *)arg, EPOCH_FLAGS_NOSTR); }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static void _benchNmeaDecode(void *arg)
+{
+    const BENCH_MSGS_t *msgs = (const BENCH_MSGS_t *)arg;
+    NMEA_MSG_t nmea;
+    uint32_t n = 0;
+    for (int ix = 0; ix < msgs->nMsgs; ix++)
+    {
+        if (nmeaDecode(&nmea, msgs->msgs[ix].data, msgs->msgs[ix].size))
+        {
+            n += nmea.type;
+        }
+    }
+    gBenchSink += n;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static void _benchRtcm3Msm(void *arg)
+{
+    const BENCH_MSGS_t *msgs = (const BENCH_MSGS_t *)arg;
+    static RTCM3_MSM_t msm;
+    uint32_t n = 0;
+    for (int ix = 0; ix < msgs->nMsgs; ix++)
+    {
+        if (rtcm3GetMsm(msgs->msgs[ix].data, &msm))
+        {
+            n += msm.numCells;
+        }
+    }
+    gBenchSink += n;
+}
+
+static void _benchRtcm3Stats(void *arg)
+{
+    const BENCH_MSGS_t *msgs = (const BENCH_MSGS_t *)arg;
+    static RTCM3_STATS_t stats;
+    rtcm3StatsInit(&stats);
+    uint64_t tsNs = 1;
+    for (int ix = 0; ix < msgs->nMsgs; ix++)
+    {
+        tsNs += 200000000; // 5 messages per second
+        rtcm3StatsAdd(&stats, &msgs->msgs[ix], tsNs, 1.5e9);
+    }
+    gBenchSink += stats.count;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+#define CFG_KV_PER_MSG 64 // max. number of items in one UBX-CFG-VALSET message
+
+typedef struct CFG_DATA_s
+{
+    UBLOXCFG_KEYVAL_t *keyVal;
+    int                nKeyVal;
+    uint8_t          (*data)[CFG_KV_PER_MSG * (4 + 8)];
+    int               *dataSize;
+    int                nData;
+} CFG_DATA_t;
+
+static bool _makeCfgData(CFG_DATA_t *cfg)
+{
+    memset(cfg, 0, sizeof(*cfg));
+    int nItems = 0;
+    const UBLOXCFG_ITEM_t **items = ubloxcfg_getAllItems(&nItems);
+    cfg->keyVal = calloc(nItems, sizeof(*cfg->keyVal));
+    cfg->nData = (nItems + CFG_KV_PER_MSG - 1) / CFG_KV_PER_MSG;
+    cfg->data = calloc(cfg->nData, sizeof(*cfg->data));
+    cfg->dataSize = calloc(cfg->nData, sizeof(*cfg->dataSize));
+    if ( (cfg->keyVal == NULL) || (cfg->data == NULL) || (cfg->dataSize == NULL) )
+    {
+        return false;
+    }
+    for (int ix = 0; ix < nItems; ix++)
+    {
+        cfg->keyVal[ix].id = items[ix]->id;
+        cfg->keyVal[ix].val._raw = (uint64_t)(ix * 7) & (items[ix]->size == UBLOXCFG_SIZE_BIT ? 0x1 : 0x7f);
+    }
+    cfg->nKeyVal = nItems;
+    for (int ix = 0; ix < cfg->nData; ix++)
+    {
+        const int offs = ix * CFG_KV_PER_MSG;
+        if (!ubloxcfg_makeData(cfg->data[ix], sizeof(cfg->data[ix]), &cfg->keyVal[offs],
+                MIN(cfg->nKeyVal - offs, CFG_KV_PER_MSG), &cfg->dataSize[ix]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void _freeCfgData(CFG_DATA_t *cfg)
+{
+    free(cfg->keyVal);
+    free(cfg->data);
+    free(cfg->dataSize);
+    memset(cfg, 0, sizeof(*cfg));
+}
+
+static void _benchUbloxcfgMakeData(void *arg)
+{
+    CFG_DATA_t *cfg = (CFG_DATA_t *)arg;
+    uint32_t n = 0;
+    for (int ix = 0; ix < cfg->nData; ix++)
+    {
+        const int offs = ix * CFG_KV_PER_MSG;
+        int size = 0;
+        ubloxcfg_makeData(cfg->data[ix], sizeof(cfg->data[ix]), &cfg->keyVal[offs],
+            MIN(cfg->nKeyVal - offs, CFG_KV_PER_MSG), &size);
+        n += size;
+    }
+    gBenchSink += n;
+}
+
+static void _benchUbloxcfgParseData(void *arg)
+{
+    CFG_DATA_t *cfg = (CFG_DATA_t *)arg;
+    UBLOXCFG_KEYVAL_t keyVal[CFG_KV_PER_MSG];
+    uint32_t n = 0;
+    for (int ix = 0; ix < cfg->nData; ix++)
+    {
+        int nKeyVal = 0;
+        ubloxcfg_parseData(cfg->data[ix], cfg->dataSize[ix], keyVal, NUMOF(keyVal), &nKeyVal);
+        n += nKeyVal;
+    }
+    gBenchSink += n;
+}
+
+static void _benchUbloxcfgLookupId(void *arg)
+{
+    CFG_DATA_t *cfg = (CFG_DATA_t *)arg;
+    uint32_t n = 0;
+    for (int ix = 0; ix < cfg->nKeyVal; ix++)
+    {
+        n += (ubloxcfg_getItemById(cfg->keyVal[ix].id) != NULL);
+    }
+    gBenchSink += n;
+}
+
+static void _benchUbloxcfgLookupName(void *arg)
+{
+    UNUSED(arg);
+    int nItems = 0;
+    const UBLOXCFG_ITEM_t **items = ubloxcfg_getAllItems(&nItems);
+    uint32_t n = 0;
+    for (int ix = 0; ix < nItems; ix++)
+    {
+        n += (ubloxcfg_getItemByName(items[ix]->name) != NULL);
+    }
+    gBenchSink += n;
+}
+
+static void _benchUbloxcfgStringify(void *arg)
+{
+    CFG_DATA_t *cfg = (CFG_DATA_t *)arg;
+    char str[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
+    uint32_t n = 0;
+    for (int ix = 0; ix < cfg->nKeyVal; ix++)
+    {
+        const UBLOXCFG_ITEM_t *item = ubloxcfg_getItemById(cfg->keyVal[ix].id);
+        n += ubloxcfg_stringifyValue(str, sizeof(str), item->type, item, &cfg->keyVal[ix].val);
+    }
+    gBenchSink += n;
+}
+
+static void _benchUbloxcfgStringifyValues(void *arg)
+{
+    CFG_DATA_t *cfg = (CFG_DATA_t *)arg;
+    const char **strs = malloc(cfg->nKeyVal * sizeof(*strs));
+    char *buf = ubloxcfg_stringifyValues(cfg->keyVal, cfg->nKeyVal, strs);
+    gBenchSink += (buf != NULL);
+    free(buf);
+    free(strs);
+}
+
+/* ****************************************************************************************************************** */
+
+int main(int argc, char **argv)
+{
+    DEBUG_CFG_t debugCfg = { .level = DEBUG_LEVEL_WARNING, .colour = false, .mark = NULL, .func = NULL, .arg = NULL };
+    debugSetup(&debugCfg);
+
+    if (!benchInit(argc, argv, "bench_ff"))
+    {
+        return EXIT_FAILURE;
+    }
+
+    // Synthetic streams
+    BENCH_DATA_t streams[3];
+    const BENCH_STREAM_t types[3] = { BENCH_STREAM_UBX, BENCH_STREAM_MIXED, BENCH_STREAM_GARBAGE };
+    const char *names[3] = { "ubx", "mixed", "garbage" };
+    BENCH_MSGS_t msgs[3];
+    for (int ix = 0; ix < NUMOF(streams); ix++)
+    {
+        if (!benchMakeStream(&streams[ix], types[ix], STREAM_SIZE) || !benchParseStream(&msgs[ix], &streams[ix]))
+        {
+            WARNING("Failed making %s stream!", names[ix]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Parser
+    for (int ix = 0; ix < NUMOF(streams); ix++)
+    {
+        char name[100];
+        snprintf(name, sizeof(name), "parser_%s", names[ix]);
+        benchRun(name, _benchParser, &streams[ix], streams[ix].size, streams[ix].nMsgs);
+        snprintf(name, sizeof(name), "parser_%s_info", names[ix]);
+        benchRun(name, _benchParserInfo, &streams[ix], streams[ix].size, streams[ix].nMsgs);
+    }
+
+    // CRCs
+    {
+        uint32_t rnd = 42;
+        for (int ix = 0; ix < NUMOF(gCrcData); ix++)
+        {
+            rnd = (rnd * 1103515245) + 12345;
+            gCrcData[ix] = (rnd >> 16) & 0xff;
+        }
+        benchRun("crc_rtcm3",     _benchCrcRtcm3,     NULL, sizeof(gCrcData), 0);
+        benchRun("crc_spartn4",   _benchCrcSpartn4,   NULL, sizeof(gCrcData), 0);
+        benchRun("crc_spartn8",   _benchCrcSpartn8,   NULL, sizeof(gCrcData), 0);
+        benchRun("crc_spartn16",  _benchCrcSpartn16,  NULL, sizeof(gCrcData), 0);
+        benchRun("crc_spartn24",  _benchCrcSpartn24,  NULL, sizeof(gCrcData), 0);
+        benchRun("crc_spartn32",  _benchCrcSpartn32,  NULL, sizeof(gCrcData), 0);
+        benchRun("crc_novatel32", _benchCrcNovatel32, NULL, sizeof(gCrcData), 0);
+    }
+
+    // Epoch collector
+    benchRun("epoch_collect_ubx",   _benchEpochCollect, &msgs[0], 0, msgs[0].nMsgs);
+    benchRun("epoch_collect_mixed", _benchEpochCollect, &msgs[1], 0, msgs[1].nMsgs);
+    benchRun("epoch_collector_ubx",   _benchEpochCollector, &msgs[0], 0, msgs[0].nMsgs);
+    benchRun("epoch_collector_mixed", _benchEpochCollector, &msgs[1], 0, msgs[1].nMsgs);
+    benchRun("epoch_collector_nostr_ubx",   _benchEpochCollectorNoStr, &msgs[0], 0, msgs[0].nMsgs);
+    benchRun("epoch_collector_nostr_mixed", _benchEpochCollectorNoStr, &msgs[1], 0, msgs[1].nMsgs);
+
+    // NMEA decoder
+    {
+        BENCH_MSGS_t nmea = { .msgs = calloc(msgs[1].nMsgs, sizeof(PARSER_MSG_t)), .nMsgs = 0 };
+        for (int ix = 0; (nmea.msgs != NULL) && (ix < msgs[1].nMsgs); ix++)
+        {
+            if (msgs[1].msgs[ix].type == PARSER_MSGTYPE_NMEA)
+            {
+                nmea.msgs[nmea.nMsgs++] = msgs[1].msgs[ix];
+            }
+        }
+        benchRun("nmea_decode", _benchNmeaDecode, &nmea, 0, nmea.nMsgs);
+        free(nmea.msgs);
+    }
+
+    // RTCM3 MSM decoder
+    {
+        BENCH_MSGS_t msm = { .msgs = calloc(msgs[1].nMsgs, sizeof(PARSER_MSG_t)), .nMsgs = 0 };
+        for (int ix = 0; (msm.msgs != NULL) && (ix < msgs[1].nMsgs); ix++)
+        {
+            if ( (msgs[1].msgs[ix].type == PARSER_MSGTYPE_RTCM3) &&
+                 rtcm3typeToMsm(RTCM3_TYPE(msgs[1].msgs[ix].data), NULL, NULL) )
+            {
+                msm.msgs[msm.nMsgs++] = msgs[1].msgs[ix];
+            }
+        }
+        benchRun("rtcm3_msm", _benchRtcm3Msm, &msm, 0, msm.nMsgs);
+        free(msm.msgs);
+    }
+
+    // RTCM3 statistics
+    {
+        BENCH_MSGS_t rtcm3 = { .msgs = calloc(msgs[1].nMsgs, sizeof(PARSER_MSG_t)), .nMsgs = 0 };
+        for (int ix = 0; (rtcm3.msgs != NULL) && (ix < msgs[1].nMsgs); ix++)
+        {
+            if (msgs[1].msgs[ix].type == PARSER_MSGTYPE_RTCM3)
+            {
+                rtcm3.msgs[rtcm3.nMsgs++] = msgs[1].msgs[ix];
+            }
+        }
+        benchRun("rtcm3_stats", _benchRtcm3Stats, &rtcm3, 0, rtcm3.nMsgs);
+        free(rtcm3.msgs);
+    }
+
+    // Configuration library
+    {
+        CFG_DATA_t cfg;
+        if (!_makeCfgData(&cfg))
+        {
+            WARNING("Failed making configuration data!");
+            return EXIT_FAILURE;
+        }
+        benchRun("ubloxcfg_makedata",  _benchUbloxcfgMakeData,  &cfg, 0, cfg.nKeyVal);
+        benchRun("ubloxcfg_parsedata", _benchUbloxcfgParseData, &cfg, 0, cfg.nKeyVal);
+        benchRun("ubloxcfg_lookup_id",   _benchUbloxcfgLookupId,   &cfg, 0, cfg.nKeyVal);
+        benchRun("ubloxcfg_lookup_name", _benchUbloxcfgLookupName, &cfg, 0, cfg.nKeyVal);
+        benchRun("ubloxcfg_stringify",        _benchUbloxcfgStringify,       &cfg, 0, cfg.nKeyVal);
+        benchRun("ubloxcfg_stringify_values", _benchUbloxcfgStringifyValues, &cfg, 0, cfg.nKeyVal);
+        _freeCfgData(&cfg);
+    }
+
+    for (int ix = 0; ix < NUMOF(streams); ix++)
+    {
+        benchFreeMsgs(&msgs[ix]);
+        benchFreeStream(&streams[ix]);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/* ****************************************************************************************************************** */
+// eof
@@ -0,0 +1,1202 @@
+// u-blox 9 positioning receivers configuration library and tool: ff library test program
+//
+// Copyright (c) Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+// without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+#include "ff_stuff.h"
+#include "ff_parser.h"
+#include "ff_nmea.h"
+#include "ff_epoch.h"
+#include "ff_rtcm3.h"
+#include "ff_crc.h"
+#include "ff_align.h"
+#include "ff_rtcm3stats.h"
+#include "ff_time.h"
+#include "ff_tslog.h"
+
+static int gVerbosity = 0;
+
+// Assertion with result printing
+#define TEST(descr, predicate) do { numTests++; \
+        if (predicate) \
+        { \
+            numPass++; \
+            if (gVerbosity > 0) { printf("%03d PASS %s: %s [%s:%d]\n", numTests, descr, # predicate, __FILE__, __LINE__); } \
+        } \
+        else \
+        { \
+            numFail++; \
+            printf("%03d FAIL %s: %s [%s:%d]\n", numTests, descr, # predicate, __FILE__, __LINE__); \
+        } \
+    } while (0)
+
+// Make a NMEA-GN-GGA message for the given time of day
+static void _makeGga(PARSER_MSG_t *msg, uint8_t *buf, const int sec, const uint64_t tsNs)
+{
+    char payload[100];
+    snprintf(payload, sizeof(payload), "12%02d%02d.00,4723.64080,N,00832.94760,E,1,12,0.9,500.0,M,48.0,M,,",
+        sec / 60, sec % 60);
+    memset(msg, 0, sizeof(*msg));
+    msg->type = PARSER_MSGTYPE_NMEA;
+    msg->data = buf;
+    msg->size = nmeaMakeMessage("GN", "GGA", payload, (char *)buf);
+    msg->name = "NMEA-GN-GGA";
+    msg->tsNs = tsNs;
+}
+
+// Make a NMEA message and decode it
+static bool _decodeNmea(NMEA_MSG_t *nmea, const char *talker, const char *formatter, const char *payload)
+{
+    char buf[PARSER_MAX_NMEA_SIZE + 100];
+    const int size = nmeaMakeMessage(talker, formatter, payload, buf);
+    return (size > 0) && nmeaDecode(nmea, (const uint8_t *)buf, size);
+}
+
+// Append bits to big-endian data
+static void _putBits(uint8_t *data, int *offs, const int size, const uint64_t val)
+{
+    for (int ix = 0; ix < size; ix++, (*offs)++)
+    {
+        const uint8_t mask = 0x80 >> (*offs % 8);
+        if ( ((val >> (size - 1 - ix)) & 0x1) != 0 )
+        {
+            data[*offs / 8] |= mask;
+        }
+        else
+        {
+            data[*offs / 8] &= ~mask;
+        }
+    }
+}
+
+// RTCM3 MSM satellite and signal (cell) data, raw values as they go into the message
+typedef struct MSM_SAT_s
+{
+    int roughMs;    // DF397
+    int extInfo;    // extended satellite info (MSM5, MSM7)
+    int roughMod;   // DF398
+    int roughRate;  // DF399 (MSM5, MSM7)
+} MSM_SAT_t;
+
+typedef struct MSM_CELL_s
+{
+    int pr;         // DF400 (MSM4, MSM5) or DF405 (MSM6, MSM7)
+    int cp;         // DF401 or DF406
+    int lock;       // DF402 or DF407
+    int half;       // DF420
+    int cno;        // DF403 or DF408
+    int rate;       // DF404 (MSM5, MSM7)
+} MSM_CELL_t;
+
+// Complete RTCM3 message (header and CRC), returns the message size
+static int _finishRtcm3(uint8_t *buf, const int payloadSize)
+{
+    buf[0] = RTCM3_PREAMBLE;
+    buf[1] = (payloadSize >> 8) & 0x03;
+    buf[2] = payloadSize & 0xff;
+    const uint32_t crc = crcRtcm3(buf, RTCM3_HEAD_SIZE + payloadSize);
+    buf[RTCM3_HEAD_SIZE + payloadSize + 0] = (crc >> 16) & 0xff;
+    buf[RTCM3_HEAD_SIZE + payloadSize + 1] = (crc >>  8) & 0xff;
+    buf[RTCM3_HEAD_SIZE + payloadSize + 2] =  crc        & 0xff;
+    return payloadSize + RTCM3_FRAME_SIZE;
+}
+
+// Make a RTCM3 message with the message type (DF002) and the reference station ID (DF003) or the 4072 sub-type
+static int _makeRtcm3(uint8_t *buf, const int type, const int id, const int payloadSize)
+{
+    uint8_t *payload = &buf[RTCM3_HEAD_SIZE];
+    memset(payload, 0, payloadSize);
+    int offs = 0;
+    _putBits(payload, &offs, 12, type);
+    _putBits(payload, &offs, 12, id);
+    return _finishRtcm3(buf, payloadSize);
+}
+
+// Make a RTCM3 MSM message with time of week (for GLONASS: day of week and time of day) towMs, returns the size
+static int _makeMsm(uint8_t *buf, const int type, const uint32_t towMs, const uint64_t satMask, const uint32_t sigMask,
+    const uint64_t cellMask, const MSM_SAT_t *sats, const MSM_CELL_t *cells)
+{
+    const int msm = type % 10;
+    const bool ext = (msm == 6) || (msm == 7);
+    const bool rate = (msm == 5) || (msm == 7);
+    const int numSat = __builtin_popcountll(satMask);
+    const int numCell = numSat * __builtin_popcount(sigMask);
+    const int numCellUsed = __builtin_popcountll(cellMask);
+
+    uint8_t *payload = &buf[RTCM3_HEAD_SIZE];
+    memset(payload, 0, 1023);
+    int offs = 0;
+    _putBits(payload, &offs, 12, type);            // DF002
+    _putBits(payload, &offs, 12, 1234);            // DF003
+    if ((type / 10) == 108)
+    {
+        _putBits(payload, &offs,  3, towMs / 86400000); // DF416
+        _putBits(payload, &offs, 27, towMs % 86400000); // DF034
+    }
+    else
+    {
+        _putBits(payload, &offs, 30, towMs);            // DF004 etc.
+    }
+    _putBits(payload, &offs, 1, 1);                // DF393
+    _putBits(payload, &offs, 3, 5);                // DF409
+    _putBits(payload, &offs, 7, 0);                // DF001
+    _putBits(payload, &offs, 2, 1);                // DF411
+    _putBits(payload, &offs, 2, 2);                // DF412
+    _putBits(payload, &offs, 1, 1);                // DF417
+    _putBits(payload, &offs, 3, 6);                // DF418
+    _putBits(payload, &offs, 64, satMask);         // DF394
+    _putBits(payload, &offs, 32, sigMask);         // DF395
+    _putBits(payload, &offs, numCell > 64 ? 64 : numCell, cellMask); // DF396
+    for (int ix = 0; ix < numSat; ix++)
+    {
+        _putBits(payload, &offs, 8, sats[ix].roughMs);
+    }
+    for (int ix = 0; rate && (ix < numSat); ix++)
+    {
+        _putBits(payload, &offs, 4, sats[ix].extInfo);
+    }
+    for (int ix = 0; ix < numSat; ix++)
+    {
+        _putBits(payload, &offs, 10, sats[ix].roughMod);
+    }
+    for (int ix = 0; rate && (ix < numSat); ix++)
+    {
+        _putBits(payload, &offs, 14, sats[ix].roughRate);
+    }
+    for (int ix = 0; ix < numCellUsed; ix++)
+    {
+        _putBits(payload, &offs, ext ? 20 : 15, cells[ix].pr);
+    }
+    for (int ix = 0; ix < numCellUsed; ix++)
+    {
+        _putBits(payload, &offs, ext ? 24 : 22, cells[ix].cp);
+    }
+    for (int ix = 0; ix < numCellUsed; ix++)
+    {
+        _putBits(payload, &offs, ext ? 10 : 4, cells[ix].lock);
+    }
+    for (int ix = 0; ix < numCellUsed; ix++)
+    {
+        _putBits(payload, &offs, 1, cells[ix].half);
+    }
+    for (int ix = 0; ix < numCellUsed; ix++)
+    {
+        _putBits(payload, &offs, ext ? 10 : 6, cells[ix].cno);
+    }
+    for (int ix = 0; rate && (ix < numCellUsed); ix++)
+    {
+        _putBits(payload, &offs, 15, cells[ix].rate);
+    }
+
+    return _finishRtcm3(buf, (offs + 7) / 8);
+}
+
+// Parser message for a RTCM3 message
+static void _rtcm3Msg(PARSER_MSG_t *msg, uint8_t *buf, const int size)
+{
+    memset(msg, 0, sizeof(*msg));
+    msg->type = PARSER_MSGTYPE_RTCM3;
+    msg->data = buf;
+    msg->size = size;
+    msg->name = "RTCM3";
+}
+
+// Feed timestamped log to the decoder in chunks, returns the number of records, checks them against the expected ones
+static int _tslogDecode(TSLOG_DEC_t *dec, const uint8_t *log, const int logSize, const int chunkSize,
+    const TSLOG_REC_t *exp, const int numExp, bool *ok)
+{
+    int numRec = 0;
+    *ok = true;
+    for (int offs = 0; offs < logSize; offs += chunkSize)
+    {
+        *ok = *ok && tslogDecAdd(dec, &log[offs], MIN(chunkSize, logSize - offs));
+        TSLOG_REC_t rec;
+        while (tslogDecProcess(dec, &rec))
+        {
+            *ok = *ok && (numRec < numExp) && (rec.size == exp[numRec].size) && (rec.mono == exp[numRec].mono) &&
+                (rec.wall == exp[numRec].wall) && (memcmp(rec.data, exp[numRec].data, rec.size) == 0);
+            numRec++;
+        }
+    }
+    return numRec;
+}
+
+int main(int argc, char **argv)
+{
+    for (int ix = 0; ix < argc; ix++)
+    {
+        if (strcmp(argv[ix], "-v") == 0)
+        {
+            gVerbosity++;
+        }
+    }
+
+    int numTests = 0;
+    int numPass = 0;
+    int numFail = 0;
+
+    // Epoch detection with a single message per epoch (all epochs must come out, none may be lost)
+    {
+        const int numEpochs = 12;
+        const uint64_t periodNs = 1000000000;
+        uint8_t buf[200];
+        PARSER_MSG_t msg;
+
+        EPOCH_t coll;
+        EPOCH_t epoch;
+        epochInit(&coll);
+        int numOut = 0;
+        bool seqOk = true;
+        bool timeOk = true;
+        uint32_t seq = 0;
+        for (int ix = 0; ix < numEpochs; ix++)
+        {
+            _makeGga(&msg, buf, ix, (ix + 1) * periodNs);
+            if (epochCollect(&coll, &msg, &epoch))
+            {
+                seqOk = seqOk && ((numOut == 0) || (epoch.seq == (seq + 1)));
+                timeOk = timeOk && epoch.haveTime && ((int)epoch.second == numOut);
+                seq = epoch.seq;
+                numOut++;
+            }
+        }
+        if (epochTimeout(&coll, (numEpochs + 1) * periodNs, EPOCH_TIMEOUT_NS_DEFAULT, &epoch))
+        {
+            seqOk = seqOk && (epoch.seq == (seq + 1));
+            timeOk = timeOk && epoch.haveTime && ((int)epoch.second == numOut);
+            numOut++;
+        }
+        TEST("epochCollect() GGA-only numOut", (numOut == numEpochs));
+        TEST("epochCollect() GGA-only seq", (seqOk));
+        TEST("epochCollect() GGA-only time", (timeOk));
+
+        EPOCH_COLLECTOR_t *collector = malloc(sizeof(EPOCH_COLLECTOR_t));
+        epochCollectorInit(collector, EPOCH_FLAGS_NOSTR);
+        numOut = 0;
+        seqOk = true;
+        timeOk = true;
+        seq = 0;
+        for (int ix = 0; ix < numEpochs; ix++)
+        {
+            _makeGga(&msg, buf, ix, (ix + 1) * periodNs);
+            const EPOCH_t *ep = epochCollectorAdd(collector, &msg);
+            if (ep != NULL)
+            {
+                seqOk = seqOk && ((numOut == 0) || (ep->seq == (seq + 1)));
+                timeOk = timeOk && ep->haveTime && ((int)ep->second == numOut);
+                seq = ep->seq;
+                numOut++;
+            }
+        }
+        const EPOCH_t *ep = epochCollectorTimeout(collector, (numEpochs + 1) * periodNs, EPOCH_TIMEOUT_NS_DEFAULT);
+        if (ep != NULL)
+        {
+            seqOk = seqOk && (ep->seq == (seq + 1));
+            timeOk = timeOk && ep->haveTime && ((int)ep->second == numOut);
+            numOut++;
+        }
+        free(collector);
+        TEST("epochCollectorAdd() GGA-only numOut", (numOut == numEpochs));
+        TEST("epochCollectorAdd() GGA-only seq", (seqOk));
+        TEST("epochCollectorAdd() GGA-only time", (timeOk));
+    }
+
+    // NMEA GGA heights (altitude is above MSL, height is altitude + geoid separation)
+    {
+        uint8_t buf[200];
+        PARSER_MSG_t msg;
+        NMEA_MSG_t nmea;
+        _makeGga(&msg, buf, 0, 0);
+        TEST("nmeaDecode() GGA", nmeaDecode(&nmea, msg.data, msg.size));
+        TEST("nmeaDecode() GGA heightMsl", (nmea.gga.heightMsl == 500.0));
+        TEST("nmeaDecode() GGA height", (nmea.gga.height == 548.0));
+    }
+
+    // NMEA number parsing, decimal numbers (NMEA-GN-GGA altitude field, empty means not available)
+    {
+        const struct { const char *str; bool ok; double val; } kTests[] =
+        {
+            { "",                           true,  0.0 },
+            { "500.0",                      true,  500.0 },
+            { "-12.5",                      true,  -12.5 },
+            { "+7",                         true,  7.0 },
+            { ".5",                         true,  0.5 },
+            { "-.25",                       true,  -0.25 },
+            { "5.",                         true,  5.0 },
+            { "0",                          true,  0.0 },
+            { "-0.0",                       true,  0.0 },
+            { "123456789.123456",           true,  123456789.123456 },
+            { "0.000000000000001",          true,  1e-15 },
+            { "000000000000000000000012.5", true,  12.5 },              // leading zeros are not significant
+            { "1.00000000000000000000000001", true, 1.0 },              // fraction digits beyond 18 are ignored
+            { "0.1234567890123456789012",   true,  0.123456789012345678 },
+            { "999999999999999999",         true,  999999999999999999.0 },
+            { "1234567890123456789",        false, 0.0 },               // too many integer digits
+            { "+",                          false, 0.0 },
+            { "-",                          false, 0.0 },
+            { ".",                          false, 0.0 },
+            { "-.",                         false, 0.0 },
+            { "1e3",                        false, 0.0 },               // no exponents
+            { "1.5E2",                      false, 0.0 },
+            { "1.2.3",                      false, 0.0 },
+            { "12a",                        false, 0.0 },
+            { " 12",                        false, 0.0 },
+            { "--1",                        false, 0.0 },
+            { "0x10",                       false, 0.0 },
+            { "inf",                        false, 0.0 },
+            { "nan",                        false, 0.0 },
+        };
+        for (int ix = 0; ix < (int)NUMOF(kTests); ix++)
+        {
+            char payload[200];
+            snprintf(payload, sizeof(payload), "120000.00,4723.64080,N,00832.94760,E,1,12,0.9,%s,M,48.0,M,,",
+                kTests[ix].str);
+            NMEA_MSG_t nmea;
+            const bool ok = _decodeNmea(&nmea, "GN", "GGA", payload);
+            char descr[100];
+            snprintf(descr, sizeof(descr), "nmeaDecode() GGA alt \"%s\"", kTests[ix].str);
+            TEST(descr, (ok == kTests[ix].ok));
+            if (kTests[ix].ok)
+            {
+                TEST(descr, (fabs(nmea.gga.heightMsl - kTests[ix].val) <= (fabs(kTests[ix].val) * 1e-15)));
+            }
+        }
+
+        // Up to 15 significant digits the result is exactly the same as from strtod()
+        const char * const kExact[] =
+        {
+            "0.1", "0.2", "0.3", "1.01", "499.6", "-0.007", "47.2852332", "8.565265", "12345.6789012345",
+            "0.000123456789012345", "-99999.9999999999", "299792458.0", ".000001"
+        };
+        for (int ix = 0; ix < (int)NUMOF(kExact); ix++)
+        {
+            char payload[200];
+            snprintf(payload, sizeof(payload), "120000.00,4723.64080,N,00832.94760,E,1,12,0.9,%s,M,,M,,", kExact[ix]);
+            NMEA_MSG_t nmea;
+            char descr[100];
+            snprintf(descr, sizeof(descr), "nmeaDecode() GGA alt \"%s\" exact", kExact[ix]);
+            TEST(descr, _decodeNmea(&nmea, "GN", "GGA", payload) && (nmea.gga.heightMsl == strtod(kExact[ix], NULL)));
+        }
+    }
+
+    // NMEA number parsing, integers (NMEA-GN-ZDA local time zone hours, range -13..13)
+    {
+        const struct { const char *str; bool ok; int val; } kTests[] =
+        {
+            { "",    true,  0 },
+            { "0",   true,  0 },
+            { "5",   true,  5 },
+            { "+5",  true,  5 },
+            { "-5",  true,  -5 },
+            { "-13", true,  -13 },
+            { "013", true,  13 },
+            { "-0",  true,  0 },
+            { "14",  false, 0 },
+            { "-14", false, 0 },
+            { "+",   false, 0 },
+            { "-",   false, 0 },
+            { "5.0", false, 0 },
+            { "5a",  false, 0 },
+            { " 5",  false, 0 },
+            { "--5", false, 0 },
+            { "1e1", false, 0 },
+        };
+        for (int ix = 0; ix < (int)NUMOF(kTests); ix++)
+        {
+            char payload[200];
+            snprintf(payload, sizeof(payload), "120000.00,18,10,2026,%s,00", kTests[ix].str);
+            NMEA_MSG_t nmea;
+            const bool ok = _decodeNmea(&nmea, "GN", "ZDA", payload);
+            char descr[100];
+            snprintf(descr, sizeof(descr), "nmeaDecode() ZDA ltzh \"%s\"", kTests[ix].str);
+            TEST(descr, (ok == kTests[ix].ok) && (!ok || (nmea.zda.ltzh == kTests[ix].val)));
+        }
+    }
+
+    // NMEA number parsing, too long integers (NMEA-GN-GGA number of satellites, must be >= 0)
+    {
+        const struct { const char *str; bool ok; int val; } kTests[] =
+        {
+            { "12",                   true,  12 },
+            { "2147483647",           true,  2147483647 },
+            { "00000000000000000012", true,  12 },
+            { "2147483648",           false, 0 },
+            { "99999999999999999999", false, 0 },
+            { "-1",                   false, 0 },
+        };
+        for (int ix = 0; ix < (int)NUMOF(kTests); ix++)
+        {
+            char payload[200];
+            snprintf(payload, sizeof(payload), "120000.00,4723.64080,N,00832.94760,E,1,%s,0.9,500.0,M,48.0,M,,",
+                kTests[ix].str);
+            NMEA_MSG_t nmea;
+            const bool ok = _decodeNmea(&nmea, "GN", "GGA", payload);
+            char descr[100];
+            snprintf(descr, sizeof(descr), "nmeaDecode() GGA numSv \"%s\"", kTests[ix].str);
+            TEST(descr, (ok == kTests[ix].ok) && (!ok || (nmea.gga.numSv == kTests[ix].val)));
+        }
+    }
+
+    // NMEA number parsing, fixed number of digits (NMEA-GN-GGA time "hhmmss[.sss]")
+    {
+        const struct { const char *str; bool ok; int hour; int minute; double second; } kTests[] =
+        {
+            { "120000",     true,  12,  0,  0.0 },
+            { "235959.999", true,  23, 59, 59.999 },
+            { "000001.5",   true,   0,  0,  1.5 },
+            { "12000",      false,  0,  0,  0.0 },
+            { "1200",       false,  0,  0,  0.0 },
+            { "1a0000",     false,  0,  0,  0.0 },
+            { "12:000",     false,  0,  0,  0.0 },
+            { "-20000",     false,  0,  0,  0.0 },
+            { "120000.0.0", false,  0,  0,  0.0 },
+            { "1200001e1",  false,  0,  0,  0.0 },
+        };
+        for (int ix = 0; ix < (int)NUMOF(kTests); ix++)
+        {
+            char payload[200];
+            snprintf(payload, sizeof(payload), "%s,4723.64080,N,00832.94760,E,1,12,0.9,500.0,M,48.0,M,,",
+                kTests[ix].str);
+            NMEA_MSG_t nmea;
+            const bool ok = _decodeNmea(&nmea, "GN", "GGA", payload);
+            char descr[100];
+            snprintf(descr, sizeof(descr), "nmeaDecode() GGA time \"%s\"", kTests[ix].str);
+            TEST(descr, (ok == kTests[ix].ok) && (nmea.gga.time.valid == kTests[ix].ok) && (!ok ||
+                ( (nmea.gga.time.hour == kTests[ix].hour) && (nmea.gga.time.minute == kTests[ix].minute) &&
+                  (nmea.gga.time.second == kTests[ix].second) )));
+        }
+    }
+
+    // NMEA decoding, one message of each type
+    {
+        NMEA_MSG_t nmea;
+
+        TEST("nmeaDecode() GGA", _decodeNmea(&nmea, "GN", "GGA",
+            "092725.00,4717.11399,N,00833.91590,W,4,08,1.01,499.6,M,48.0,M,1.5,0012"));
+        TEST("nmeaDecode() GGA type", (nmea.type == NMEA_TYPE_GGA));
+        TEST("nmeaDecode() GGA time", nmea.gga.time.valid && (nmea.gga.time.hour == 9) &&
+            (nmea.gga.time.minute == 27) && (nmea.gga.time.second == 25.0));
+        TEST("nmeaDecode() GGA pos", (fabs(nmea.gga.lat - (47.0 + (17.11399 / 60.0))) < 1e-12) &&
+            (fabs(nmea.gga.lon + (8.0 + (33.91590 / 60.0))) < 1e-12));
+        TEST("nmeaDecode() GGA fix", (nmea.gga.fix == NMEA_FIX_RTK_FIXED) && (nmea.gga.numSv == 8) &&
+            (nmea.gga.hDOP == 1.01));
+        TEST("nmeaDecode() GGA diff", (nmea.gga.diffAge == 1.5) && (nmea.gga.diffStation == 12));
+        nmeaFormatInfo(&nmea);
+        TEST("nmeaFormatInfo() GGA",
+            (strcmp(nmea.info, "09:27:25.000 (1) RTK_FIXED +47.2852332   -8.5652650  +548") == 0));
+
+        TEST("nmeaDecode() RMC", _decodeNmea(&nmea, "GN", "RMC",
+            "083559.00,A,4717.11437,S,00833.91522,E,0.004,77.52,091202,1.5,W,A,V"));
+        TEST("nmeaDecode() RMC type", (nmea.type == NMEA_TYPE_RMC));
+        TEST("nmeaDecode() RMC date", nmea.rmc.date.valid && (nmea.rmc.date.year == 2002) &&
+            (nmea.rmc.date.month == 12) && (nmea.rmc.date.day == 9));
+        TEST("nmeaDecode() RMC fix", nmea.rmc.valid && (nmea.rmc.fix == NMEA_FIX_S3D) && (nmea.rmc.lat < 0.0) &&
+            (nmea.rmc.lon > 0.0));
+        TEST("nmeaDecode() RMC spd/cog/mv", (nmea.rmc.spd == 0.004) && (nmea.rmc.cog == 77.52) &&
+            (nmea.rmc.mv == -1.5));
+        nmeaFormatInfo(&nmea);
+        TEST("nmeaFormatInfo() RMC",
+            (strcmp(nmea.info, "2002-12-09 (1) 08:35:59.000 (1) S3D (1) -47.2852395   +8.5652537") == 0));
+
+        TEST("nmeaDecode() GLL", _decodeNmea(&nmea, "GN", "GLL", "4717.11364,N,00833.91565,E,092321.00,A,D"));
+        TEST("nmeaDecode() GLL type", (nmea.type == NMEA_TYPE_GLL));
+        TEST("nmeaDecode() GLL fix", nmea.gll.valid && (nmea.gll.fix == NMEA_FIX_S3D));
+        nmeaFormatInfo(&nmea);
+        TEST("nmeaFormatInfo() GLL", (strcmp(nmea.info, "09:23:21.000 (1) S3D (1) +47.2852273   +8.5652608") == 0));
+
+        TEST("nmeaDecode() GSV", _decodeNmea(&nmea, "GP", "GSV",
+            "3,1,10,23,38,230,44,29,71,156,47,07,29,116,41,40,09,081,36,1"));
+        TEST("nmeaDecode() GSV type", (nmea.type == NMEA_TYPE_GSV));
+        TEST("nmeaDecode() GSV nSvs", (nmea.gsv.nSvs == 4));
+        TEST("nmeaDecode() GSV sv", (nmea.gsv.svs[0].gnss == NMEA_GNSS_GPS) && (nmea.gsv.svs[0].svId == 23) &&
+            (nmea.gsv.svs[0].elev == 38) && (nmea.gsv.svs[0].azim == 230) && (nmea.gsv.svs[0].cno == 44) &&
+            (nmea.gsv.svs[0].sig == NMEA_SIGNAL_GPS_L1CA));
+        TEST("nmeaDecode() GSV sbas", (nmea.gsv.svs[3].gnss == NMEA_GNSS_SBAS) && (nmea.gsv.svs[3].svId == 127) &&
+            (nmea.gsv.svs[3].sig == NMEA_SIGNAL_SBAS_L1CA));
+        nmeaFormatInfo(&nmea);
+        TEST("nmeaFormatInfo() GSV", (strcmp(nmea.info, "1/3 10") == 0));
+        TEST("nmeaDecode() GSV bad elev", !_decodeNmea(&nmea, "GP", "GSV", "1,1,01,23,91,230,44,1"));
+
+        TEST("nmeaDecode() GSA", _decodeNmea(&nmea, "GN", "GSA", "A,3,23,29,07,08,09,18,26,,,,,,1.94,1.18,1.54,1"));
+        TEST("nmeaDecode() GSA type", (nmea.type == NMEA_TYPE_GSA));
+        TEST("nmeaDecode() GSA svs", (nmea.gsa.nSvs == 7) && (nmea.gsa.svs[6].gnss == NMEA_GNSS_GPS) &&
+            (nmea.gsa.svs[6].svId == 26));
+        TEST("nmeaDecode() GSA dop", nmea.gsa.haveDop && (nmea.gsa.vDOP == 1.54));
+        nmeaFormatInfo(&nmea);
+        TEST("nmeaFormatInfo() GSA", (strcmp(nmea.info, "A S3D 1 7 1.94 1.18 1.54") == 0));
+
+        TEST("nmeaDecode() GST", _decodeNmea(&nmea, "GN", "GST", "082356.00,1.8,,,,1.7,1.3,2.2"));
+        TEST("nmeaDecode() GST type", (nmea.type == NMEA_TYPE_GST));
+        TEST("nmeaDecode() GST have", nmea.gst.haveRangeRms && !nmea.gst.haveEllipse && nmea.gst.haveStd);
+        nmeaFormatInfo(&nmea);
+        TEST("nmeaFormatInfo() GST", (strcmp(nmea.info, "08:23:56.000 (1) 1.700 1.300 2.200") == 0));
+        TEST("nmeaDecode() GST negative std", !_decodeNmea(&nmea, "GN", "GST", "082356.00,1.8,,,,-1.7,1.3,2.2"));
+
+        TEST("nmeaDecode() VTG", _decodeNmea(&nmea, "GN", "VTG", "77.52,T,,M,0.004,N,0.008,K,A"));
+        TEST("nmeaDecode() VTG type", (nmea.type == NMEA_TYPE_VTG));
+        TEST("nmeaDecode() VTG have", nmea.vtg.haveCogt && !nmea.vtg.haveCogm && nmea.vtg.haveSog);
+        nmeaFormatInfo(&nmea);
+        TEST("nmeaFormatInfo() VTG", (strcmp(nmea.info, "S3D 77.5 0.0 0.008") == 0));
+        TEST("nmeaDecode() VTG bad cog", !_decodeNmea(&nmea, "GN", "VTG", "360.5,T,,M,0.004,N,0.008,K,A"));
+
+        TEST("nmeaDecode() ZDA", _decodeNmea(&nmea, "GN", "ZDA", "082710.00,16,09,2002,-02,30"));
+        TEST("nmeaDecode() ZDA type", (nmea.type == NMEA_TYPE_ZDA));
+        nmeaFormatInfo(&nmea);
+        TEST("nmeaFormatInfo() ZDA", (strcmp(nmea.info, "2002-09-16 (1) 08:27:10.000 (1) -02:30") == 0));
+        TEST("nmeaDecode() ZDA bad month", !_decodeNmea(&nmea, "GN", "ZDA", "082710.00,16,13,2002,00,00"));
+
+        TEST("nmeaDecode() GNS", _decodeNmea(&nmea, "GN", "GNS",
+            "103600.01,5114.51176,N,00012.29380,W,ANFR,07,1.18,111.5,45.6,,,V"));
+        TEST("nmeaDecode() GNS type", (nmea.type == NMEA_TYPE_GNS));
+        TEST("nmeaDecode() GNS fix", (nmea.gns.fix == NMEA_FIX_RTK_FIXED) && !nmea.gns.valid &&
+            (strcmp(nmea.gns.posMode, "ANFR") == 0));
+        TEST("nmeaDecode() GNS height", (nmea.gns.heightMsl == 111.5) && (nmea.gns.height == (111.5 + 45.6)) &&
+            (nmea.gns.diffAge == -1.0) && (nmea.gns.diffStation == -1));
+        nmeaFormatInfo(&nmea);
+        TEST("nmeaFormatInfo() GNS",
+            (strcmp(nmea.info, "10:36:00.010 (1) RTK_FIXED ANFR (0) +51.2418627   -0.2048967  +157") == 0));
+
+        TEST("nmeaDecode() TXT", _decodeNmea(&nmea, "GN", "TXT", "01,01,02,u-blox ag - www.u-blox.com"));
+        TEST("nmeaDecode() TXT type", (nmea.type == NMEA_TYPE_TXT));
+        TEST("nmeaDecode() TXT fields", (nmea.txt.numMsg == 1) && (nmea.txt.msgNum == 1) && (nmea.txt.msgType == 2));
+        nmeaFormatInfo(&nmea);
+        TEST("nmeaFormatInfo() TXT", (strcmp(nmea.info, "u-blox ag - www.u-blox.com") == 0));
+
+        // Too long text is truncated
+        char payload[300];
+        memset(payload, 'x', sizeof(payload));
+        memcpy(payload, "01,01,02,", 9);
+        payload[sizeof(payload) - 1] = '\0';
+        TEST("nmeaDecode() TXT long", _decodeNmea(&nmea, "GN", "TXT", payload) &&
+            (strlen(nmea.txt.text) == (sizeof(nmea.txt.text) - 1)));
+
+        // Not decoded
+        TEST("nmeaDecode() unknown", !_decodeNmea(&nmea, "GN", "XYZ", "1,2,3") && (nmea.type == NMEA_TYPE_NONE));
+        TEST("nmeaDecode() GGA fields", !_decodeNmea(&nmea, "GN", "GGA", "092725.00,4717.11399,N,00833.91590,E,1"));
+    }
+
+    // RTCM3 MSM decoding
+    {
+        const double kRangeMs = 299792.458; // [m]
+        const double kTol = 1e-6;
+        uint8_t buf[1100];
+        RTCM3_MSM_t msm;
+
+        // GPS MSM4, G05 and G12, signals 2 (1C) and 15 (2L), no G12 2L
+        {
+            const MSM_SAT_t sats[] = { { 70, 0, 512, 0 }, { 75, 0, 256, 0 } };
+            const MSM_CELL_t cells[] =
+            {
+                { 1000,   -2000,    5, 1, 45, 0 },
+                { -16384, -2097152, 0, 0, 30, 0 },  // invalid pseudorange and phase
+                { 16383,  2097151, 15, 0, 63, 0 },
+            };
+            _makeMsm(buf, 1074, 302400000, (UINT64_C(1) << (64 - 5)) | (UINT64_C(1) << (64 - 12)),
+                (UINT32_C(1) << (32 - 2)) | (UINT32_C(1) << (32 - 15)), 0xe, sats, cells);
+            TEST("rtcm3GetMsm() MSM4", rtcm3GetMsm(buf, &msm));
+            TEST("rtcm3GetMsm() MSM4 header", (msm.header.gnss == RTCM3_MSM_GNSS_GPS) &&
+                (msm.header.msm == RTCM3_MSM_TYPE_4) && (msm.header.refStaId == 1234) &&
+                (msm.header.gpsTow == 302400.0) && msm.header.multiMsgBit && (msm.header.iods == 5) &&
+                (msm.header.clkSteering == 1) && (msm.header.extClock == 2) && msm.header.smooth &&
+                (msm.header.smoothInt == 6));
+            TEST("rtcm3GetMsm() MSM4 counts", (msm.header.numSat == 2) && (msm.header.numSig == 2) &&
+                (msm.header.numCell == 4) && (msm.numCells == 3));
+            TEST("rtcm3GetMsm() MSM4 cell ids", (msm.cells[0].svId == 5) && (msm.cells[0].sigId == 2) &&
+                (msm.cells[1].svId == 5) && (msm.cells[1].sigId == 15) && (msm.cells[2].svId == 12) &&
+                (msm.cells[2].sigId == 2) && (msm.cells[2].satIx == 1));
+            TEST("rtcm3GetMsm() MSM4 pr", msm.cells[0].prValid && !msm.cells[1].prValid && msm.cells[2].prValid &&
+                (fabs(msm.cells[0].pseudoRange - ((70.5 + (1000.0 / 16777216.0)) * kRangeMs)) < kTol) &&
+                (fabs(msm.cells[2].pseudoRange - ((75.25 + (16383.0 / 16777216.0)) * kRangeMs)) < kTol));
+            TEST("rtcm3GetMsm() MSM4 cp", msm.cells[0].cpValid && !msm.cells[1].cpValid && msm.cells[2].cpValid &&
+                (fabs(msm.cells[0].phaseRange - ((70.5 - (2000.0 / 536870912.0)) * kRangeMs)) < kTol) &&
+                (fabs(msm.cells[2].phaseRange - ((75.25 + (2097151.0 / 536870912.0)) * kRangeMs)) < kTol));
+            TEST("rtcm3GetMsm() MSM4 lock", (msm.cells[0].lockTime == 512) && (msm.cells[1].lockTime == 0) &&
+                (msm.cells[2].lockTime == 524288));
+            TEST("rtcm3GetMsm() MSM4 half/cno", msm.cells[0].halfCycle && !msm.cells[1].halfCycle &&
+                (msm.cells[0].cno == 45.0f) && (msm.cells[1].cno == 30.0f) && (msm.cells[2].cno == 63.0f));
+            TEST("rtcm3GetMsm() MSM4 rate", !msm.cells[0].rrValid && (msm.cells[0].phaseRangeRate == 0.0));
+        }
+
+        // GLONASS MSM5, R01 (channel -7) and R24 (channel +6, no rough rate), signal 2 (1C)
+        {
+            const MSM_SAT_t sats[] = { { 68, 0, 1, 1000 }, { 69, 13, 1023, -8192 } };
+            const MSM_CELL_t cells[] =
+            {
+                { -1, 1, 1, 0, 40, 5000 },
+                { 0,  0, 0, 1, 20, 7 },
+            };
+            _makeMsm(buf, 1085, 302400000, (UINT64_C(1) << (64 - 1)) | (UINT64_C(1) << (64 - 24)),
+                UINT32_C(1) << (32 - 2), 0x3, sats, cells);
+            TEST("rtcm3GetMsm() MSM5", rtcm3GetMsm(buf, &msm));
+            TEST("rtcm3GetMsm() MSM5 header", (msm.header.gnss == RTCM3_MSM_GNSS_GLO) &&
+                (msm.header.msm == RTCM3_MSM_TYPE_5) && (msm.header.gloTow == ((3 * 86400.0) + 43200.0)) &&
+                (msm.numCells == 2));
+            TEST("rtcm3GetMsm() MSM5 ext", (msm.cells[0].svId == 1) && (msm.cells[0].extInfo == 0) &&
+                (msm.cells[1].svId == 24) && (msm.cells[1].extInfo == 13));
+            TEST("rtcm3GetMsm() MSM5 pr/cp", msm.cells[0].prValid && msm.cells[0].cpValid &&
+                (fabs(msm.cells[0].pseudoRange - ((68.0 + (1.0 / 1024.0) - (1.0 / 16777216.0)) * kRangeMs)) < kTol) &&
+                (fabs(msm.cells[0].phaseRange - ((68.0 + (1.0 / 1024.0) + (1.0 / 536870912.0)) * kRangeMs)) < kTol) &&
+                (fabs(msm.cells[1].pseudoRange - ((69.0 + (1023.0 / 1024.0)) * kRangeMs)) < kTol));
+            TEST("rtcm3GetMsm() MSM5 rate", msm.cells[0].rrValid &&
+                (fabs(msm.cells[0].phaseRangeRate - 1000.5) < kTol) && !msm.cells[1].rrValid &&
+                (msm.cells[1].phaseRangeRate == 0.0));
+            TEST("rtcm3GetMsm() MSM5 half/cno", !msm.cells[0].halfCycle && msm.cells[1].halfCycle &&
+                (msm.cells[0].cno == 40.0f) && (msm.cells[1].cno == 20.0f));
+        }
+
+        // Galileo MSM6, E11 (no rough range) and E30, signal 2 (1C)
+        {
+            const MSM_SAT_t sats[] = { { 255, 0, 0, 0 }, { 80, 0, 100, 0 } };
+            const MSM_CELL_t cells[] =
+            {
+                { 123,     456,      100, 0, 721, 0 },  // invalid because of the rough range
+                { -524288, -8388608, 704, 1, 1023, 0 }, // invalid pseudorange and phase
+            };
+            _makeMsm(buf, 1096, 302400000, (UINT64_C(1) << (64 - 11)) | (UINT64_C(1) << (64 - 30)),
+                UINT32_C(1) << (32 - 2), 0x3, sats, cells);
+            TEST("rtcm3GetMsm() MSM6", rtcm3GetMsm(buf, &msm));
+            TEST("rtcm3GetMsm() MSM6 header", (msm.header.gnss == RTCM3_MSM_GNSS_GAL) &&
+                (msm.header.msm == RTCM3_MSM_TYPE_6) && (msm.header.galTow == 302400.0) && (msm.numCells == 2));
+            TEST("rtcm3GetMsm() MSM6 invalid", !msm.cells[0].prValid && !msm.cells[0].cpValid &&
+                !msm.cells[1].prValid && !msm.cells[1].cpValid && (msm.cells[0].pseudoRange == 0.0) &&
+                (msm.cells[1].phaseRange == 0.0));
+            TEST("rtcm3GetMsm() MSM6 lock", (msm.cells[0].lockTime == 144) && (msm.cells[1].lockTime == 67108864));
+            TEST("rtcm3GetMsm() MSM6 cno", (msm.cells[0].cno == 45.0625f) && (msm.cells[1].cno == 63.9375f));
+            TEST("rtcm3GetMsm() MSM6 rate", !msm.cells[0].rrValid && !msm.cells[1].rrValid);
+        }
+
+        // BeiDou MSM7, C01 and C64 (the satellite mask straddles the 64-bit word read by bits()), 12 signals, with
+        // the DF407 extended lock time indicator table (the lock time doubles with each range of 32 values)
+        {
+            const struct { int ind; uint32_t ms; } kLock[] =
+            {
+                { 0, 0 }, { 63, 63 },                    // 0-63: ind
+                { 64, 64 }, { 95, 126 },                 // 64-95: 2 * ind - 64
+                { 96, 128 }, { 127, 252 },               // 96-127: 4 * ind - 256
+                { 128, 256 },                            // 128-159: 8 * ind - 768
+                { 500, 851968 },                         // 480-511: 16384 * ind - 7340032
+                { 703, 66060288 },                       // 672-703: 1048576 * ind - 671088640
+                { 704, 67108864 },                       // 704: 67108864
+                { 705, 0 }, { 1023, 0 },                 // reserved
+            };
+            MSM_SAT_t sats[] = { { 100, 15, 1000, -8191 }, { 101, 0, 0, 8191 } };
+            MSM_CELL_t cells[2 * NUMOF(kLock)];
+            uint32_t sigMask = 0;
+            for (int ix = 0; ix < (int)NUMOF(kLock); ix++)
+            {
+                sigMask |= UINT32_C(1) << (31 - ix);
+                const MSM_CELL_t cell = { -524287 + ix, 8388607 - ix, kLock[ix].ind, ix % 2, 16 * ix, -16383 + ix };
+                cells[ix] = cell;
+                cells[NUMOF(kLock) + ix] = cell;
+            }
+            const int size = _makeMsm(buf, 1127, 302400000, UINT64_C(0x8000000000000001), sigMask,
+                (UINT64_C(1) << (2 * NUMOF(kLock))) - 1, sats, cells);
+            TEST("rtcm3GetMsm() MSM7", rtcm3GetMsm(buf, &msm));
+            TEST("rtcm3GetMsm() MSM7 header", (msm.header.gnss == RTCM3_MSM_GNSS_BDS) &&
+                (msm.header.msm == RTCM3_MSM_TYPE_7) && (msm.header.bdsTow == 302400.0) &&
+                (msm.header.satMask == UINT64_C(0x8000000000000001)) && (msm.header.sigMask == sigMask) &&
+                (msm.numCells == (2 * (int)NUMOF(kLock))));
+            TEST("rtcm3GetMsm() MSM7 bits straddle", (msm.cells[0].svId == 1) &&
+                (msm.cells[NUMOF(kLock)].svId == 64) && (msm.cells[NUMOF(kLock)].satIx == 1) &&
+                (msm.cells[NUMOF(kLock) - 1].sigId == NUMOF(kLock)));
+            for (int ix = 0; ix < (int)NUMOF(kLock); ix++)
+            {
+                char descr[100];
+                snprintf(descr, sizeof(descr), "rtcm3GetMsm() MSM7 DF407 %d", kLock[ix].ind);
+                TEST(descr, (msm.cells[ix].lockTime == kLock[ix].ms) &&
+                    (msm.cells[NUMOF(kLock) + ix].lockTime == kLock[ix].ms));
+            }
+            const RTCM3_MSM_CELL_t *c0 = &msm.cells[0];
+            const RTCM3_MSM_CELL_t *c1 = &msm.cells[NUMOF(kLock) + 1];
+            TEST("rtcm3GetMsm() MSM7 pr", c0->prValid && c1->prValid &&
+                (fabs(c0->pseudoRange - ((100.0 + (1000.0 / 1024.0) - (524287.0 / 536870912.0)) * kRangeMs)) < kTol) &&
+                (fabs(c1->pseudoRange - ((101.0 - (524286.0 / 536870912.0)) * kRangeMs)) < kTol));
+            TEST("rtcm3GetMsm() MSM7 cp", c0->cpValid && c1->cpValid &&
+                (fabs(c0->phaseRange - ((100.0 + (1000.0 / 1024.0) + (8388607.0 / 2147483648.0)) * kRangeMs)) < kTol) &&
+                (fabs(c1->phaseRange - ((101.0 + (8388606.0 / 2147483648.0)) * kRangeMs)) < kTol));
+            TEST("rtcm3GetMsm() MSM7 rate", c0->rrValid && c1->rrValid &&
+                (fabs(c0->phaseRangeRate - (-8191.0 - 1.6383)) < kTol) &&
+                (fabs(c1->phaseRangeRate - (8191.0 - 1.6382)) < kTol));
+            TEST("rtcm3GetMsm() MSM7 ext/half/cno", (c0->extInfo == 15) && (c1->extInfo == 0) && !c0->halfCycle &&
+                c1->halfCycle && (c0->cno == 0.0f) && (c1->cno == 1.0f) && (msm.cells[11].cno == 11.0f));
+
+            // Truncated frame
+            const int payloadSize = size - RTCM3_FRAME_SIZE;
+            buf[1] = ((payloadSize - 1) >> 8) & 0x03;
+            buf[2] = (payloadSize - 1) & 0xff;
+            TEST("rtcm3GetMsm() MSM7 truncated", !rtcm3GetMsm(buf, &msm) && (msm.numCells == 0));
+            buf[1] = 0;
+            buf[2] = 20;
+            TEST("rtcm3GetMsm() MSM7 truncated header", !rtcm3GetMsm(buf, &msm));
+        }
+
+        // Too many cells (numSat * numSig > 64), and the maximum
+        {
+            const MSM_SAT_t sats[9] = { { 0 } };
+            const MSM_CELL_t cells[64] = { { 0 } };
+            _makeMsm(buf, 1077, 302400000, UINT64_C(0xff80000000000000), 0xff000000, 0, sats, cells);
+            RTCM3_MSM_HEADER_t header;
+            TEST("rtcm3GetMsm() 9x8 cells", !rtcm3GetMsmHeader(buf, &header) && !rtcm3GetMsm(buf, &msm));
+            _makeMsm(buf, 1077, 302400000, UINT64_C(0xff00000000000000), 0xff000000, UINT64_MAX, sats, cells);
+            TEST("rtcm3GetMsm() 8x8 cells", rtcm3GetMsm(buf, &msm) && (msm.numCells == 64) &&
+                (msm.cells[63].svId == 8) && (msm.cells[63].sigId == 8));
+        }
+
+        // MSM1-3 are not decoded
+        {
+            const MSM_SAT_t sats[1] = { { 0 } };
+            const MSM_CELL_t cells[1] = { { 0 } };
+            _makeMsm(buf, 1073, 302400000, UINT64_C(1) << 63, UINT32_C(1) << 31, 1, sats, cells);
+            TEST("rtcm3GetMsm() MSM3", !rtcm3GetMsm(buf, &msm));
+        }
+    }
+
+    // Multi-source time alignment (3 sources, 4 slots, 0.1s tolerance, 0.5s late window)
+    {
+        const ALIGN_CFG_t cfg =
+        {
+            .numSources = 3, .itemSize = sizeof(int), .numSlots = 4, .tolerance = 0.1, .lateWindowNs = 500000000
+        };
+        const uint64_t t0 = 1000000000;
+        ALIGN_STATS_t stats;
+        int val;
+
+        // Complete tuple: output as soon as the last source has its item
+        {
+            ALIGN_t *align = alignInit(&cfg);
+            TEST("alignInit()", (align != NULL));
+            val = 100;
+            TEST("alignAdd() complete 0", alignAdd(align, 0, 10.0, &val, t0) && (alignGet(align, t0) == NULL));
+            val = 101;
+            TEST("alignAdd() complete 1", alignAdd(align, 1, 10.05, &val, t0) && (alignGet(align, t0) == NULL));
+            val = 102;
+            TEST("alignAdd() complete 2", alignAdd(align, 2, 9.95, &val, t0));
+            const ALIGN_TUPLE_t *tuple = alignGet(align, t0);
+            TEST("alignGet() complete", (tuple != NULL) && tuple->complete && (tuple->num == 3) &&
+                (tuple->mask == 0x7) && (tuple->time == 10.0) && (tuple->times[2] == 9.95) &&
+                (*(const int *)tuple->items[0] == 100) && (*(const int *)tuple->items[2] == 102));
+            TEST("alignGet() complete next", (alignGet(align, t0) == NULL) && (alignFlush(align) == NULL));
+            alignGetStats(align, &stats);
+            TEST("alignGetStats() complete", (stats.numAdded == 3) && (stats.numTuples == 1) &&
+                (stats.numComplete == 1) && (stats.numLate == 0) && (stats.numEvicted == 0));
+            alignFree(align);
+        }
+
+        // Incomplete tuple: output once all sources have passed it
+        {
+            ALIGN_t *align = alignInit(&cfg);
+            val = 0;
+            alignAdd(align, 0, 11.0, &val, t0);
+            alignAdd(align, 1, 11.0, &val, t0);
+            alignAdd(align, 0, 12.0, &val, t0);
+            TEST("alignGet() passed not yet", (alignGet(align, t0) == NULL)); // source 2 hasn't been seen yet
+            alignAdd(align, 2, 11.15, &val, t0);                             // too far from 11.0, a new tuple
+            const ALIGN_TUPLE_t *tuple = alignGet(align, t0);
+            TEST("alignGet() passed", (tuple != NULL) && !tuple->complete && (tuple->time == 11.0) &&
+                (tuple->mask == 0x3) && (tuple->items[2] == NULL));
+            TEST("alignGet() passed next", (alignGet(align, t0) == NULL)); // source 1 may still have 11.15
+            alignFree(align);
+        }
+
+        // Late window: incomplete tuple is output when the window expires
+        {
+            ALIGN_t *align = alignInit(&cfg);
+            val = 0;
+            alignAdd(align, 0, 13.0, &val, t0);
+            alignAdd(align, 1, 13.0, &val, t0 + 100000000);
+            TEST("alignGet() late window 0", (alignGet(align, 0) == NULL));
+            TEST("alignGet() late window 1", (alignGet(align, t0 + 499999999) == NULL));
+            const ALIGN_TUPLE_t *tuple = alignGet(align, t0 + 500000000);
+            TEST("alignGet() late window 2", (tuple != NULL) && !tuple->complete && (tuple->mask == 0x3));
+
+            // Item for that tuple is now too late, as is anything older
+            TEST("alignAdd() too late", !alignAdd(align, 2, 13.05, &val, t0 + 600000000));
+            TEST("alignAdd() too late old", !alignAdd(align, 2, 12.0, &val, t0 + 600000000));
+            TEST("alignAdd() not too late", alignAdd(align, 2, 13.2, &val, t0 + 600000000));
+            alignGetStats(align, &stats);
+            TEST("alignGetStats() too late", (stats.numLate == 2) && (stats.numAdded == 3) && (stats.numTuples == 1));
+            alignFree(align);
+        }
+
+        // Duplicate and invalid items
+        {
+            ALIGN_t *align = alignInit(&cfg);
+            val = 0;
+            TEST("alignAdd() first", alignAdd(align, 0, 30.0, &val, t0));
+            TEST("alignAdd() duplicate", !alignAdd(align, 0, 30.02, &val, t0));
+            TEST("alignAdd() bad source", !alignAdd(align, 3, 30.0, &val, t0) && !alignAdd(align, -1, 30.0, &val, t0));
+            TEST("alignAdd() bad time", !alignAdd(align, 1, NAN, &val, t0) && !alignAdd(align, 1, INFINITY, &val, t0));
+            alignGetStats(align, &stats);
+            TEST("alignGetStats() duplicate", (stats.numDuplicate == 1) && (stats.numInvalid == 4) &&
+                (stats.numAdded == 1));
+            alignReset(align);
+            alignGetStats(align, &stats);
+            TEST("alignReset()", (stats.numAdded == 0) && (alignFlush(align) == NULL));
+            alignFree(align);
+        }
+
+        // Eviction: slots are full because the application didn't take out tuples
+        {
+            ALIGN_t *align = alignInit(&cfg);
+            for (int ix = 0; ix < cfg.numSlots; ix++)
+            {
+                val = ix;
+                alignAdd(align, 0, 40.0 + ix, &val, t0);
+            }
+            val = 99;
+            TEST("alignAdd() older than all", !alignAdd(align, 1, 39.0, &val, t0));
+            TEST("alignAdd() evict", alignAdd(align, 0, 40.0 + cfg.numSlots, &val, t0));
+            TEST("alignAdd() evicted", !alignAdd(align, 1, 40.0, &val, t0));
+            alignGetStats(align, &stats);
+            TEST("alignGetStats() evict", (stats.numEvicted == 1) && (stats.numLate == 2));
+
+            // Full slots: oldest tuple is output even though not all sources have passed it
+            const ALIGN_TUPLE_t *tuple = alignGet(align, t0);
+            TEST("alignGet() full", (tuple != NULL) && (tuple->time == 41.0) && (*(const int *)tuple->items[0] == 1));
+            TEST("alignGet() not full", (alignGet(align, t0) == NULL));
+
+            // Flush the remaining tuples in time order
+            bool flushOk = true;
+            for (int ix = 2; ix <= cfg.numSlots; ix++)
+            {
+                tuple = alignFlush(align);
+                flushOk = flushOk && (tuple != NULL) && (tuple->time == (40.0 + ix));
+            }
+            TEST("alignFlush()", flushOk && (alignFlush(align) == NULL));
+            alignFree(align);
+        }
+
+        // Bad configuration
+        {
+            ALIGN_CFG_t badCfg = cfg;
+            badCfg.numSources = ALIGN_MAX_SOURCES + 1;
+            TEST("alignInit() bad config", (alignInit(&badCfg) == NULL) && (alignInit(NULL) == NULL));
+        }
+    }
+
+    // RTCM3 statistics
+    {
+        const double kTol = 1e-6;
+        const int kWno = 2200; // 2022, 18 leap seconds
+        const uint64_t kNs = 1000000000;
+        const MSM_SAT_t sats[1] = { { 0 } };
+        const MSM_CELL_t cells[1] = { { 0 } };
+        uint8_t buf[1100];
+        PARSER_MSG_t msg;
+        RTCM3_STATS_t *stats = malloc(sizeof(RTCM3_STATS_t));
+
+        // GPS MSM at 1 Hz with gaps of two epochs over the end of the week and later, and a second message for the
+        // last epoch (multiple message bit). Arrival 0.25s after the epoch.
+        {
+            rtcm3StatsInit(stats);
+            const struct { int wno; int tow; } kEpochs[] =
+            {
+                { kWno, 604797 }, { kWno, 604798 }, { kWno + 1, 1 }, { kWno + 1, 2 }, { kWno + 1, 5 },
+                { kWno + 1, 5 },
+            };
+            bool addOk = true;
+            for (int ix = 0; ix < (int)NUMOF(kEpochs); ix++)
+            {
+                const double ts = wnoTow2ts(kEpochs[ix].wno, kEpochs[ix].tow) + (ix == 5 ? 0.26 : 0.25);
+                const uint64_t tsNs = (uint64_t)llround((ts - wnoTow2ts(kWno, 0)) * 1e9);
+                _rtcm3Msg(&msg, buf, _makeMsm(buf, 1077, kEpochs[ix].tow * 1000, UINT64_C(1) << 63, UINT32_C(1) << 31,
+                    1, sats, cells));
+                addOk = addOk && rtcm3StatsAdd(stats, &msg, tsNs, ts2posix(ts, 18, true));
+            }
+            const RTCM3_STATS_TYPE_t *type = &stats->types[0];
+            TEST("rtcm3StatsAdd() GPS", addOk && (stats->numTypes == 1) && (stats->count == NUMOF(kEpochs)) &&
+                (type->msgType == 1077) && (type->refStaId == 1234) && (type->count == NUMOF(kEpochs)));
+            TEST("rtcm3StatsAdd() GPS epochs", type->haveTime && (type->lastTime == 5.0) &&
+                (fabs(type->period - 1.0) < kTol) && (type->numEpochs == (NUMOF(kEpochs) - 1)));
+            TEST("rtcm3StatsAdd() GPS gaps", (type->numGaps == 2) && (type->numMissing == 4));
+            TEST("rtcm3StatsAdd() GPS intervals", (type->numIntervals == (NUMOF(kEpochs) - 1)) &&
+                (fabs(type->intervalMin - 0.01) < kTol) && (fabs(type->intervalMax - 3.0) < kTol));
+            TEST("rtcm3StatsAdd() GPS age", (type->numAge == NUMOF(kEpochs)) && (fabs(type->ageMin - 0.25) < kTol) &&
+                (fabs(type->ageMax - 0.26) < kTol) && (fabs(type->ageLast - 0.26) < kTol));
+            TEST("rtcm3StatsAdd() GPS msm", (type->numSat == 1) && (type->numSig == 1) && (type->numCell == 1));
+        }
+
+        // GLONASS MSM with a gap of one epoch over the end of the day, and with unknown day of week (7). Arrival 0.5s
+        // after the epoch.
+        {
+            rtcm3StatsInit(stats);
+            const struct { int dow; int tod; } kEpochs[] =
+            {
+                { 3, 86398 }, { 3, 86399 }, { 4, 1 }, { 4, 2 }, { 7, 3 },
+            };
+            for (int ix = 0; ix < (int)NUMOF(kEpochs); ix++)
+            {
+                // GLONASS time is UTC + 3h
+                const double posix =
+                    (19000.0 * 86400.0) + (double)(kEpochs[ix].dow * 86400) + kEpochs[ix].tod - 10800.0 + 0.5;
+                _rtcm3Msg(&msg, buf, _makeMsm(buf, 1087, ((kEpochs[ix].dow * 86400) + kEpochs[ix].tod) * 1000,
+                    UINT64_C(1) << 63, UINT32_C(1) << 31, 1, sats, cells));
+                rtcm3StatsAdd(stats, &msg, 0, posix);
+            }
+            const RTCM3_STATS_TYPE_t *type = &stats->types[0];
+            TEST("rtcm3StatsAdd() GLO", (stats->numTypes == 1) && (type->msgType == 1087) &&
+                (type->count == NUMOF(kEpochs)) && (type->lastTime == 3.0));
+            TEST("rtcm3StatsAdd() GLO epochs", (type->numEpochs == NUMOF(kEpochs)) && (type->numGaps == 1) &&
+                (type->numMissing == 1) && (fabs(type->period - 1.0) < kTol));
+            TEST("rtcm3StatsAdd() GLO interval", (type->numIntervals == (NUMOF(kEpochs) - 1)) &&
+                (fabs(type->intervalMin - 1.0) < kTol) && (fabs(type->intervalMax - 2.0) < kTol));
+            TEST("rtcm3StatsAdd() GLO age", (type->numAge == NUMOF(kEpochs)) && (fabs(type->ageMin - 0.5) < kTol) &&
+                (fabs(type->ageMax - 0.5) < kTol));
+        }
+
+        // BeiDou MSM over the end of the week (BeiDou time is GPS time - 14s). Arrival 0.75s after the epoch.
+        {
+            rtcm3StatsInit(stats);
+            const struct { int wno; int tow; int bdsTow; } kEpochs[] =
+            {
+                { kWno, 604812, 604798 }, { kWno, 604813, 604799 }, { kWno + 1, 14, 0 }, { kWno + 1, 15, 1 },
+            };
+            for (int ix = 0; ix < (int)NUMOF(kEpochs); ix++)
+            {
+                const double posix = ts2posix(wnoTow2ts(kEpochs[ix].wno, kEpochs[ix].tow) + 0.75, 18, true);
+                _rtcm3Msg(&msg, buf, _makeMsm(buf, 1127, kEpochs[ix].bdsTow * 1000, UINT64_C(1) << 63,
+                    UINT32_C(1) << 31, 1, sats, cells));
+                rtcm3StatsAdd(stats, &msg, 0, posix);
+            }
+            const RTCM3_STATS_TYPE_t *type = &stats->types[0];
+            TEST("rtcm3StatsAdd() BDS age", (type->numAge == NUMOF(kEpochs)) && (fabs(type->ageMin - 0.75) < kTol) &&
+                (fabs(type->ageMax - 0.75) < kTol));
+            TEST("rtcm3StatsAdd() BDS epochs", (type->numGaps == 0) && (type->numEpochs == NUMOF(kEpochs)) &&
+                (type->lastTime == 1.0) && (fabs(type->period - 1.0) < kTol));
+        }
+
+        // Message without epoch time, gap of four messages
+        {
+            rtcm3StatsInit(stats);
+            const int kSec[] = { 0, 1, 2, 7, 8 };
+            for (int ix = 0; ix < (int)NUMOF(kSec); ix++)
+            {
+                _rtcm3Msg(&msg, buf, _makeRtcm3(buf, 1005, 1234, 19));
+                rtcm3StatsAdd(stats, &msg, (kSec[ix] + 1) * kNs, 0.0);
+            }
+            const RTCM3_STATS_TYPE_t *type = &stats->types[0];
+            TEST("rtcm3StatsAdd() 1005", (type->count == NUMOF(kSec)) && !type->haveTime && (type->numAge == 0) &&
+                (type->numGaps == 1) && (type->numMissing == 4) && (type->intervalMin == 1.0) &&
+                (type->intervalMax == 5.0) && (type->bytes == (NUMOF(kSec) * (19 + RTCM3_FRAME_SIZE))));
+            TEST("rtcm3StatsAdd() totals", (stats->firstNs == kNs) && (stats->lastNs == (9 * kNs)) &&
+                (stats->bytes == type->bytes));
+        }
+
+        // Order of types[] (by type, sub-type and station), and table full
+        {
+            rtcm3StatsInit(stats);
+            _rtcm3Msg(&msg, buf, _makeMsm(buf, 1077, 0, UINT64_C(1) << 63, UINT32_C(1) << 31, 1, sats, cells));
+            rtcm3StatsAdd(stats, &msg, 0, 0.0);
+            const struct { int type; int id; } kTypes[] =
+            {
+                { 4072, 1 }, { 1005, 2 }, { 1230, 1 }, { 4072, 0 }, { 1005, 1 }, { 1005, 2 }, { 1077, 5 },
+            };
+            for (int ix = 0; ix < (int)NUMOF(kTypes); ix++)
+            {
+                _rtcm3Msg(&msg, buf, _makeRtcm3(buf, kTypes[ix].type, kTypes[ix].id, 20));
+                rtcm3StatsAdd(stats, &msg, 0, 0.0);
+            }
+            const struct { int type; int sub; int sta; } kOrder[] =
+            {
+                { 1005, 0, 1 }, { 1005, 0, 2 }, { 1077, 0, 5 }, { 1077, 0, 1234 }, { 1230, 0, 1 }, { 4072, 0, -1 },
+                { 4072, 1, -1 },
+            };
+            bool orderOk = (stats->numTypes == NUMOF(kOrder));
+            for (int ix = 0; orderOk && (ix < (int)NUMOF(kOrder)); ix++)
+            {
+                orderOk = (stats->types[ix].msgType == kOrder[ix].type) &&
+                    (stats->types[ix].subType == kOrder[ix].sub) && (stats->types[ix].refStaId == kOrder[ix].sta);
+            }
+            TEST("rtcm3StatsAdd() order", orderOk && (stats->types[1].count == 2));
+            char name[20];
+            rtcm3StatsName(&stats->types[6], name, sizeof(name));
+            TEST("rtcm3StatsName()", (strcmp(name, "4072.1") == 0));
+
+            bool fillOk = true;
+            for (int ix = stats->numTypes; ix < RTCM3_STATS_MAX_TYPES; ix++)
+            {
+                _rtcm3Msg(&msg, buf, _makeRtcm3(buf, 1006, ix, 21));
+                fillOk = fillOk && rtcm3StatsAdd(stats, &msg, 0, 0.0);
+            }
+            _rtcm3Msg(&msg, buf, _makeRtcm3(buf, 1006, 4000, 21));
+            TEST("rtcm3StatsAdd() full", fillOk && (stats->numTypes == RTCM3_STATS_MAX_TYPES) &&
+                !rtcm3StatsAdd(stats, &msg, 0, 0.0) && (stats->numDropped == 1));
+            _rtcm3Msg(&msg, buf, _makeRtcm3(buf, 1005, 1, 19));
+            TEST("rtcm3StatsAdd() full existing", rtcm3StatsAdd(stats, &msg, 0, 0.0) && (stats->types[0].count == 2));
+            bool sortOk = true;
+            for (int ix = 1; ix < stats->numTypes; ix++)
+            {
+                const RTCM3_STATS_TYPE_t *a = &stats->types[ix - 1];
+                const RTCM3_STATS_TYPE_t *b = &stats->types[ix];
+                sortOk = sortOk && ( (a->msgType < b->msgType) || ( (a->msgType == b->msgType) &&
+                    ( (a->subType < b->subType) || ( (a->subType == b->subType) && (a->refStaId < b->refStaId) ) ) ) );
+            }
+            TEST("rtcm3StatsAdd() full order", sortOk);
+
+            // Not RTCM3
+            msg.type = PARSER_MSGTYPE_NMEA;
+            TEST("rtcm3StatsAdd() not RTCM3", !rtcm3StatsAdd(stats, &msg, 0, 0.0));
+        }
+
+        free(stats);
+    }
+
+    // Timestamped log encoder and decoder round-trip
+    {
+        const int kSizes[] = { 1, 100, TSLOG_MAX_DATA_SIZE, 17, 250, 3, 1000, 64, 5, 2048, 77, 300 };
+        const uint64_t kMono0 = 5000000000;
+        const uint64_t kWall0 = UINT64_C(1700000000000000000);
+        uint8_t *data = malloc(TSLOG_DEC_BUF_SIZE);
+        uint8_t *log = malloc(TSLOG_DEC_BUF_SIZE);
+        TSLOG_DEC_t *dec = malloc(sizeof(TSLOG_DEC_t));
+        TSLOG_REC_t exp[NUMOF(kSizes)];
+        int syncOffs[NUMOF(kSizes)]; // offset of SYNC record in the log, -1 if none
+
+        // Data (with plenty of TSLOG_SYNC_CHAR)
+        uint32_t rnd = 42;
+        for (int ix = 0; ix < TSLOG_DEC_BUF_SIZE; ix++)
+        {
+            rnd = (rnd * 1103515245) + 12345;
+            data[ix] = (rnd >> 16) % 5 == 0 ? 0xa5 : (rnd >> 16) & 0xff;
+        }
+
+        // Chunks every 200ms (SYNC at the start and after 1s), then a 2ms wall-clock jump (SYNC) and a monotonic time
+        // going backwards (SYNC)
+        TSLOG_ENC_t enc;
+        tslogEncInit(&enc);
+        int logSize = 0;
+        int dataOffs = 0;
+        bool encOk = true;
+        for (int ix = 0; ix < (int)NUMOF(kSizes); ix++)
+        {
+            uint64_t mono = kMono0 + ((uint64_t)ix * 200000000);
+            uint64_t wall = kWall0 + (mono - kMono0);
+            if (ix >= 10)
+            {
+                wall += 2000000;
+            }
+            if (ix == 11)
+            {
+                mono -= 500000000;
+            }
+            const uint32_t nSync = enc.nSync;
+            const int len = tslogEncode(&enc, &log[logSize], kSizes[ix], mono, wall);
+            encOk = encOk && (len > 0) && (len <= TSLOG_MAX_ENC_SIZE);
+            syncOffs[ix] = enc.nSync != nSync ? logSize + (ix == 0 ? TSLOG_MAGIC_SIZE : 0) : -1;
+            logSize += len;
+            memcpy(&log[logSize], &data[dataOffs], kSizes[ix]);
+            logSize += kSizes[ix];
+            exp[ix].data = &data[dataOffs];
+            exp[ix].size = kSizes[ix];
+            exp[ix].mono = mono;
+            exp[ix].wall = wall;
+            dataOffs += kSizes[ix];
+        }
+        TEST("tslogEncode()", encOk && (enc.nData == NUMOF(kSizes)) && (enc.nSync == 4) && (syncOffs[0] >= 0) &&
+            (syncOffs[5] >= 0) && (syncOffs[10] >= 0) && (syncOffs[11] >= 0));
+        TEST("tslogEncode() bad size", (tslogEncode(&enc, log, 0, kMono0, kWall0) == 0) &&
+            (tslogEncode(&enc, log, TSLOG_MAX_DATA_SIZE + 1, kMono0, kWall0) == 0));
+        TEST("tslogDetect()", tslogDetect(log, logSize) && !tslogDetect(log, TSLOG_MAGIC_SIZE - 1) &&
+            !tslogDetect(&log[1], logSize - 1));
+
+        // Decode, in various chunk sizes
+        const int kChunks[] = { 1, 7, 100, 4096, TSLOG_DEC_BUF_SIZE / 2 };
+        for (int ix = 0; ix < (int)NUMOF(kChunks); ix++)
+        {
+            tslogDecInit(dec);
+            bool ok;
+            const int numRec = _tslogDecode(dec, log, logSize, kChunks[ix], exp, NUMOF(exp), &ok);
+            char descr[100];
+            snprintf(descr, sizeof(descr), "tslogDecProcess() chunks %d", kChunks[ix]);
+            TEST(descr, ok && (numRec == NUMOF(exp)) && (dec->nData == NUMOF(exp)) && (dec->nSync == 4) &&
+                (dec->nSkip == 0));
+        }
+
+        // Bad CRC of the second SYNC record, the data up to the next SYNC record is lost
+        {
+            uint8_t *bad = malloc(logSize);
+            memcpy(bad, log, logSize);
+            bad[syncOffs[5] + TSLOG_HEAD_SIZE + 3] ^= 0x01;
+            const TSLOG_REC_t badExp[] = { exp[0], exp[1], exp[2], exp[3], exp[4], exp[10], exp[11] };
+            tslogDecInit(dec);
+            bool ok;
+            const int numRec = _tslogDecode(dec, bad, logSize, 100, badExp, NUMOF(badExp), &ok);
+            TEST("tslogDecProcess() bad CRC", ok && (numRec == NUMOF(badExp)) && (dec->nSync == 3) &&
+                (dec->nSkip >= (uint32_t)(syncOffs[10] - syncOffs[5])));
+            free(bad);
+        }
+
+        // Garbage (incl. record heads that aren't) before the log. The file header is skipped, too, as the decoder
+        // looks for the next record head.
+        {
+            const uint8_t garbage[] =
+            {
+                0x00, 0xa5, 0xa5, 'D', 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 'S', 0x10, 0x00, 0x01, 0x02, 0x03,
+                0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14,
+                0xa5, 'X', 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 'F', 'F', 'T', 0xa5,
+            };
+            uint8_t *garb = malloc(sizeof(garbage) + logSize);
+            memcpy(garb, garbage, sizeof(garbage));
+            memcpy(&garb[sizeof(garbage)], log, logSize);
+            tslogDecInit(dec);
+            bool ok;
+            const int numRec =
+                _tslogDecode(dec, garb, sizeof(garbage) + logSize, TSLOG_DEC_BUF_SIZE, exp, NUMOF(exp), &ok);
+            TEST("tslogDecProcess() garbage", ok && (numRec == NUMOF(exp)) && (dec->nSync == 4) &&
+                (dec->nSkip == (sizeof(garbage) + TSLOG_MAGIC_SIZE)));
+
+            // Seek into the middle of the log (after the third SYNC record), continue at the next SYNC record
+            tslogDecResync(dec);
+            const int offs = syncOffs[10] + 3;
+            const int numRec2 = _tslogDecode(dec, &log[offs], logSize - offs, 100, &exp[11], 1, &ok);
+            TEST("tslogDecResync()", ok && (numRec2 == 1));
+            free(garb);
+        }
+
+        // Decoder overflow: data is discarded, decoder is not affected
+        {
+            tslogDecInit(dec);
+            TEST("tslogDecAdd() fill", tslogDecAdd(dec, data, TSLOG_DEC_BUF_SIZE - 10));
+            TEST("tslogDecAdd() overflow", !tslogDecAdd(dec, data, 11));
+            TEST("tslogDecAdd() full", tslogDecAdd(dec, data, 10) && !tslogDecAdd(dec, data, 1));
+            tslogDecResync(dec);
+            bool ok;
+            const int numRec = _tslogDecode(dec, log, logSize, TSLOG_DEC_BUF_SIZE, exp, NUMOF(exp), &ok);
+            TEST("tslogDecAdd() overflow resync", ok && (numRec == NUMOF(exp)));
+        }
+
+        free(dec);
+        free(log);
+        free(data);
+    }
+
+    // Analyse results
+    printf("%d tests: %d passed, %d failed\n", numTests, numPass, numFail);
+    if (numFail != 0)
+    {
+        printf("%d/%d tests failed!\n", numFail, numTests);
+        return(EXIT_FAILURE);
+    }
+    else
+    {
+        return(EXIT_SUCCESS);
+    }
+}
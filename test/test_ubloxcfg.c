@@ -126,6 +126,34 @@ int main(int argc, char **argv)
         TEST("lookup item by ID", (fail == NULL));
     }
 
+    // Lookup of all items and message rate configs (perfect hashes)
+    {
+        int numItems = 0;
+        const UBLOXCFG_ITEM_t **allItems = ubloxcfg_getAllItems(&numItems);
+        int numOk = 0;
+        for (int ix = 0; ix < numItems; ix++)
+        {
+            if ( (ubloxcfg_getItemById(allItems[ix]->id) == allItems[ix]) &&
+                 (ubloxcfg_getItemByName(allItems[ix]->name) == allItems[ix]) )
+            {
+                numOk++;
+            }
+        }
+        TEST("lookup all items by ID and name", (numItems > 0) && (numOk == numItems));
+        int numRates = 0;
+        const UBLOXCFG_MSGRATE_t **allRates = ubloxcfg_getAllMsgRateCfgs(&numRates);
+        numOk = 0;
+        for (int ix = 0; ix < numRates; ix++)
+        {
+            if (ubloxcfg_getMsgRateCfg(allRates[ix]->msgName) == allRates[ix])
+            {
+                numOk++;
+            }
+        }
+        TEST("lookup all msg rate cfgs by name", (numRates > 0) && (numOk == numRates));
+        TEST("lookup msg rate cfg by bad name", (ubloxcfg_getMsgRateCfg("UBX-NOPE-NOPE") == NULL));
+    }
+
     // Message output rate configs
     {
         const UBLOXCFG_MSGRATE_t *rates = ubloxcfg_getMsgRateCfg(UBLOXCFG_UBX_NAV_PVT_STR);
@@ -190,6 +218,106 @@ int main(int argc, char **argv)
         //HEXDUMP("test", keyVal, sizeof(keyVal));
     }
 
+    // Decode truncated data, and too short list
+    {
+        int nKeyVal = 0;
+        UBLOXCFG_KEYVAL_t keyVal[NUMOF(testKeyVal)];
+        const bool truncRes = ubloxcfg_parseData(testData, sizeof(testData) - 1, keyVal, NUMOF(keyVal), &nKeyVal);
+        TEST("decode truncated config data", !truncRes && (nKeyVal == (NUMOF(testKeyVal) - 1)) );
+        const bool shortRes = ubloxcfg_parseData(testData, sizeof(testData), keyVal, 3, &nKeyVal);
+        TEST("decode config data to short list", !shortRes && (nKeyVal == 3) && (memcmp(testKeyVal, keyVal, 3 * sizeof(*keyVal)) == 0) );
+    }
+
+    // Encode to too small buffer
+    {
+        int dataSize = 0;
+        uint8_t data[sizeof(testData) - 1];
+        const bool makeDataRes = ubloxcfg_makeData(data, sizeof(data), testKeyVal, NUMOF(testKeyVal), &dataSize);
+        TEST("encode config data to small buffer", !makeDataRes && (memcmp(testData, data, dataSize) == 0) );
+    }
+
+    // Key-value list set operations
+    {
+        UBLOXCFG_KEYVAL_t a[] =
+        {
+            { .id = 0x20fe0011, .val = { ._raw = 1 } },
+            { .id = 0x10fe0001, .val = { ._raw = 1 } },
+            { .id = 0x30fe0022, .val = { ._raw = 2 } },
+            { .id = 0x20fe0011, .val = { ._raw = 1 } }, // duplicate
+            { .id = 0x40fe0033, .val = { ._raw = 3 } },
+        };
+        UBLOXCFG_KEYVAL_t b[] =
+        {
+            { .id = 0x40fe0033, .val = { ._raw = 4 } }, // different value
+            { .id = 0x20fe0011, .val = { ._raw = 1 } }, // same value
+            { .id = 0x50fe0034, .val = { ._raw = 5 } }, // not in a
+        };
+        const int nA = ubloxcfg_sortKeyVal(a, NUMOF(a));
+        const int nB = ubloxcfg_sortKeyVal(b, NUMOF(b));
+        TEST("sort key-value list", (nA == 4) && (a[0].id == 0x10fe0001) && (a[1].id == 0x20fe0011) &&
+            (a[2].id == 0x30fe0022) && (a[3].id == 0x40fe0033) && (nB == 3) && (b[0].id == 0x20fe0011));
+
+        UBLOXCFG_KEYVAL_t res[10];
+        const int nDiff = ubloxcfg_diffKeyVal(a, nA, b, nB, res, NUMOF(res));
+        TEST("diff key-value lists", (nDiff == 2) && (res[0].id == 0x40fe0033) && (res[0].val._raw == 4) &&
+            (res[1].id == 0x50fe0034) && (res[1].val._raw == 5));
+        TEST("diff key-value lists (no difference)", ubloxcfg_diffKeyVal(a, nA, a, nA, res, NUMOF(res)) == 0);
+        TEST("diff key-value lists (too short)", ubloxcfg_diffKeyVal(a, nA, b, nB, res, 1) == -1);
+
+        const int nMerged = ubloxcfg_mergeKeyVal(a, nA, b, nB, res, NUMOF(res));
+        TEST("merge key-value lists", (nMerged == 5) && (res[0].id == 0x10fe0001) && (res[1].id == 0x20fe0011) &&
+            (res[2].id == 0x30fe0022) && (res[3].id == 0x40fe0033) && (res[3].val._raw == 4) && (res[4].id == 0x50fe0034));
+        TEST("merge key-value lists (too short)", ubloxcfg_mergeKeyVal(a, nA, b, nB, res, 4) == -1);
+
+        const int nInter = ubloxcfg_intersectKeyVal(a, nA, b, nB, res, NUMOF(res));
+        TEST("intersect key-value lists", (nInter == 2) && (res[0].id == 0x20fe0011) &&
+            (res[1].id == 0x40fe0033) && (res[1].val._raw == 3));
+    }
+
+    // Configuration snapshots
+    {
+        UBLOXCFG_KEYVAL_t kv[NUMOF(testKeyVal)];
+        memcpy(kv, testKeyVal, sizeof(kv));
+        const int nKv = ubloxcfg_sortKeyVal(kv, NUMOF(kv));
+        UBLOXCFG_SNAPSHOT_t info = { .haveLayer = true, .layer = UBLOXCFG_LAYER_BBR, .rxInfo = "ZED-F9P HPG 1.32" };
+        uint8_t data[UBLOXCFG_SNAPSHOT_MAX_SIZE(NUMOF(kv))];
+        int dataSize = 0;
+        const bool makeRes = ubloxcfg_makeSnapshot(data, sizeof(data), &info, kv, nKv, &dataSize);
+        TEST("make snapshot", makeRes && (dataSize == (24 + 16 + (nKv * 4) + (int)sizeof(testData) - (nKv * 4))));
+
+        UBLOXCFG_SNAPSHOT_t info2;
+        UBLOXCFG_KEYVAL_t kv2[NUMOF(testKeyVal)];
+        int nKv2 = 0;
+        const bool parseRes = ubloxcfg_parseSnapshot(data, dataSize, &info2, kv2, NUMOF(kv2), &nKv2);
+        TEST("parse snapshot", parseRes && (nKv2 == nKv) && (memcmp(kv, kv2, nKv * sizeof(*kv)) == 0));
+        TEST("parse snapshot info", (info2.version == UBLOXCFG_SNAPSHOT_VERSION) && info2.haveLayer &&
+            (info2.layer == UBLOXCFG_LAYER_BBR) && (strcmp(info2.rxInfo, info.rxInfo) == 0) && (info2.nKeyVal == nKv) &&
+            (info2.hash == ubloxcfg_hashKeyVal(kv, nKv)));
+        TEST("parse snapshot info only", ubloxcfg_parseSnapshot(data, dataSize, &info2, NULL, 0, NULL) && (info2.nKeyVal == nKv));
+
+        TEST("make snapshot (unsorted)", !ubloxcfg_makeSnapshot(data, sizeof(data), NULL, testKeyVal, NUMOF(testKeyVal), &dataSize));
+        TEST("make snapshot (too small)", !ubloxcfg_makeSnapshot(data, 30, NULL, kv, nKv, &dataSize));
+        TEST("make snapshot (empty)", ubloxcfg_makeSnapshot(data, sizeof(data), NULL, NULL, 0, &dataSize) && (dataSize == 24));
+        TEST("parse snapshot (empty)", ubloxcfg_parseSnapshot(data, dataSize, &info2, kv2, NUMOF(kv2), &nKv2) &&
+            (nKv2 == 0) && !info2.haveLayer && (info2.rxInfo[0] == '\0'));
+
+        // Corrupt data
+        ubloxcfg_makeSnapshot(data, sizeof(data), &info, kv, nKv, &dataSize);
+        TEST("parse snapshot (too short)", !ubloxcfg_parseSnapshot(data, dataSize - 1, NULL, kv2, NUMOF(kv2), &nKv2));
+        TEST("parse snapshot (too small list)", !ubloxcfg_parseSnapshot(data, dataSize, NULL, kv2, nKv - 1, &nKv2));
+        data[dataSize - 1] ^= 0x01;
+        TEST("parse snapshot (bad hash)", !ubloxcfg_parseSnapshot(data, dataSize, NULL, kv2, NUMOF(kv2), &nKv2));
+        data[0] = 'X';
+        TEST("parse snapshot (bad magic)", !ubloxcfg_parseSnapshot(data, dataSize, NULL, NULL, 0, NULL));
+
+        // Same content, same hash
+        const uint64_t hash = ubloxcfg_hashKeyVal(kv, nKv);
+        kv[0].val._raw ^= 0x01;
+        TEST("hash different content", hash != ubloxcfg_hashKeyVal(kv, nKv));
+        kv[0].val._raw ^= 0x01;
+        TEST("hash same content", hash == ubloxcfg_hashKeyVal(kv, nKv));
+    }
+
     // Stringify values
     {
         typedef struct TEST_VAL_STR_s
@@ -414,6 +542,46 @@ int main(int argc, char **argv)
         }
     }
 
+    // Stringify many values
+    {
+        const UBLOXCFG_KEYVAL_t kv[] =
+        {
+            UBLOXCFG_KEYVAL_ANY( CFG_UBLOXCFGTEST_U1,  42 ),
+            UBLOXCFG_KEYVAL_ENU( CFG_UBLOXCFGTEST_E1,  MINUS_ONE ),
+            UBLOXCFG_KEYVAL_ANY( CFG_UBLOXCFGTEST_X8,  0xffffffffffffffff ),
+            { .id = 0x10fe0ff1, .val = { .L  = true   } },
+            { .id = 0x30fe0ff3, .val = { .X2 = 0x1234 } },
+            UBLOXCFG_KEYVAL_ANY( CFG_UBLOXCFGTEST_I8,  INT64_MIN ),
+            { .id = UBLOXCFG_CFG_NAVSPG_SIGATTCOMP_ID, .val = { .E1 = -1 } },
+        };
+        const char *expStrs[] =
+        {
+            "42", "-1 (MINUS_ONE)", "0xffffffffffffffff (FIRST|SECOND|LAST|0x7ffffffffffffffc)", "1 (true)", "0x1234 (n/a)",
+            "-9223372036854775808", "255 (AUTO)"
+        };
+        const char *strs[NUMOF(kv)];
+        char *buf = ubloxcfg_stringifyValues(kv, NUMOF(kv), strs);
+        TEST("stringify values", (buf != NULL));
+        for (int ix = 0; (buf != NULL) && (ix < (int)NUMOF(kv)); ix++)
+        {
+            char descr[100];
+            snprintf(descr, sizeof(descr), "stringify values %d (%s)", ix + 1, expStrs[ix]);
+            TEST(descr, (strcmp(strs[ix], expStrs[ix]) == 0));
+        }
+        free(buf);
+
+        // Many values, must grow the buffer
+        UBLOXCFG_KEYVAL_t manyKv[1000];
+        const char *manyStrs[NUMOF(manyKv)];
+        for (int ix = 0; ix < (int)NUMOF(manyKv); ix++)
+        {
+            manyKv[ix] = (UBLOXCFG_KEYVAL_t)UBLOXCFG_KEYVAL_ANY( CFG_UBLOXCFGTEST_X8,  0xffffffffffffffff );
+        }
+        buf = ubloxcfg_stringifyValues(manyKv, NUMOF(manyKv), manyStrs);
+        TEST("stringify many values", (buf != NULL) && (strcmp(manyStrs[NUMOF(manyKv) - 1], expStrs[2]) == 0));
+        free(buf);
+    }
+
     // Split stringified value
     {
         char str[100];
@@ -516,7 +684,7 @@ int main(int argc, char **argv)
             { .str = "18446744073709551614", .type = UBLOXCFG_TYPE_U8, .val = { .U8 = (UINT64_MAX-1) }, .expectedRes = true  },
             { .str = "18446744073709551615", .type = UBLOXCFG_TYPE_U8, .val = { .U8 = UINT64_MAX     }, .expectedRes = true  },
             { .str = "0xffffffffffffffff",   .type = UBLOXCFG_TYPE_U8, .val = { .U8 = UINT64_MAX     }, .expectedRes = true  },
-          //{ .str = "18446744073709551616", .type = UBLOXCFG_TYPE_U8, .val = { ._raw = 0            }, .expectedRes = false }, // FIXME: why does this test fail?!
+            { .str = "18446744073709551616", .type = UBLOXCFG_TYPE_U8, .val = { ._raw = 0            }, .expectedRes = false },
 
             { .str = "-128",                 .type = UBLOXCFG_TYPE_I1, .val = { .I1 = INT8_MIN       }, .expectedRes = true  },
             { .str = "127",                  .type = UBLOXCFG_TYPE_I1, .val = { .I1 = INT8_MAX       }, .expectedRes = true  },
@@ -539,7 +707,7 @@ int main(int argc, char **argv)
             { .str = "-9223372036854775808", .type = UBLOXCFG_TYPE_I8, .val = { .I8 = INT64_MIN      }, .expectedRes = true  },
             { .str = "9223372036854775807",  .type = UBLOXCFG_TYPE_I8, .val = { .I8 = INT64_MAX      }, .expectedRes = true  },
             { .str = "+9223372036854775806", .type = UBLOXCFG_TYPE_I8, .val = { .I8 = (INT64_MAX-1)  }, .expectedRes = true  },
-          //{ .str = "9223372036854775808",  .type = UBLOXCFG_TYPE_I8, .val = { ._raw = 0            }, .expectedRes = false }, // FIXME: why does this test fail?
+            { .str = "9223372036854775808",  .type = UBLOXCFG_TYPE_I8, .val = { ._raw = 0            }, .expectedRes = false },
             { .str = "0xffffffffffffffff",   .type = UBLOXCFG_TYPE_I8, .val = { .I8 = -1             }, .expectedRes = true  },
 
             { .str = "0",                                                             .type = UBLOXCFG_TYPE_R4, .val = { .R4 = 0.0         }, .expectedRes = true  },
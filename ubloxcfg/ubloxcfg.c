@@ -38,6 +38,26 @@
 #  error This needs C99 or later!
 #endif
 
+// Hash function, must match hash() in ubloxcfg_gen.pl
+static uint32_t hashKey(const uint32_t seed, const uint8_t *data, const int size)
+{
+    uint32_t h = UINT32_C(0x811c9dc5) ^ seed;
+    for (int ix = 0; ix < size; ix++)
+    {
+        h = (h ^ data[ix]) * UINT32_C(0x01000193);
+    }
+    return h ^ (h >> 16);
+}
+
+// Lookup key in perfect hash generated by ubloxcfg_gen.pl, returns index of the candidate (which the caller must
+// compare to the key) or -1 if there is none
+static int hashLookup(const _UBLOXCFG_HASH_t *hash, const uint8_t *key, const int size)
+{
+    const uint16_t disp = hash->disp[ hashKey(0, key, size) & (uint32_t)(hash->numBuckets - 1) ];
+    const uint16_t index = hash->index[ hashKey(disp, key, size) & (uint32_t)(hash->size - 1) ];
+    return index != 0xffff ? (int)index : -1;
+}
+
 const UBLOXCFG_ITEM_t *ubloxcfg_getItemByName(const char *name)
 {
     if ( (name == NULL) || (strlen(name) < 2) )
@@ -59,13 +79,10 @@ const UBLOXCFG_ITEM_t *ubloxcfg_getItemByName(const char *name)
     else
     {
         const UBLOXCFG_ITEM_t **allItems = (const UBLOXCFG_ITEM_t **)_ubloxcfg_allItems();
-        for (int ix = 0; ix < _UBLOXCFG_NUM_ITEMS; ix++)
+        const int ix = hashLookup(_ubloxcfg_itemsByName(), (const uint8_t *)name, (int)strlen(name));
+        if ( (ix >= 0) && (strcmp(allItems[ix]->name, name) == 0) )
         {
-            if (strcmp(allItems[ix]->name, name) == 0)
-            {
-                item = allItems[ix];
-                break;
-            }
+            item = allItems[ix];
         }
     }
     return item;
@@ -75,13 +92,11 @@ const UBLOXCFG_ITEM_t *ubloxcfg_getItemById(const uint32_t id)
 {
     const UBLOXCFG_ITEM_t *item = NULL;
     const UBLOXCFG_ITEM_t **allItems = (const UBLOXCFG_ITEM_t **)_ubloxcfg_allItems();
-    for (int ix = 0; ix < _UBLOXCFG_NUM_ITEMS; ix++)
+    const uint8_t key[4] = { id & 0xff, (id >> 8) & 0xff, (id >> 16) & 0xff, (id >> 24) & 0xff };
+    const int ix = hashLookup(_ubloxcfg_itemsById(), key, sizeof(key));
+    if ( (ix >= 0) && (allItems[ix]->id == id) )
     {
-        if (allItems[ix]->id == id)
-        {
-            item = allItems[ix];
-            break;
-        }
+        item = allItems[ix];
     }
     return item;
 }
@@ -100,13 +115,10 @@ const UBLOXCFG_MSGRATE_t *ubloxcfg_getMsgRateCfg(const char *msgName)
     }
     const UBLOXCFG_MSGRATE_t *rates = NULL;
     const UBLOXCFG_MSGRATE_t **allRates = (const UBLOXCFG_MSGRATE_t **)_ubloxcfg_allRates();
-    for (int ix = 0; ix < _UBLOXCFG_NUM_RATES; ix++)
+    const int ix = hashLookup(_ubloxcfg_ratesByName(), (const uint8_t *)msgName, (int)strlen(msgName));
+    if ( (ix >= 0) && (strcmp(allRates[ix]->msgName, msgName) == 0) )
     {
-        if (strcmp(allRates[ix]->msgName, msgName) == 0)
-        {
-            rates = allRates[ix];
-            break;
-        }
+        rates = allRates[ix];
     }
     return rates;
 }
@@ -117,6 +129,16 @@ const UBLOXCFG_MSGRATE_t **ubloxcfg_getAllMsgRateCfgs(int *num)
     return (const UBLOXCFG_MSGRATE_t **)_ubloxcfg_allRates();
 }
 
+// Value size [bytes] by UBLOXCFG_ID2SIZE(), 0 = invalid
+static const int valSizes[16] =
+{
+    [UBLOXCFG_SIZE_BIT] = 1, [UBLOXCFG_SIZE_ONE] = 1, [UBLOXCFG_SIZE_TWO] = 2, [UBLOXCFG_SIZE_FOUR] = 4, [UBLOXCFG_SIZE_EIGHT] = 8
+};
+
+// Note: Keys and values are copied as they are in memory, as the library works on little-endian machines only
+// (see UBLOXCFG_VALUE_t). Values are copied using unaligned loads and stores of the value size, or a full 8 bytes
+// while there's enough space.
+
 bool ubloxcfg_makeData(uint8_t *data, const int size, const UBLOXCFG_KEYVAL_t *keyVal, const int nKeyVal, int *dataSize)
 {
     if ( (data == NULL) || (size <= 0) || (keyVal == NULL) || (nKeyVal < 1) || (dataSize == NULL) )
@@ -126,85 +148,27 @@ bool ubloxcfg_makeData(uint8_t *data, const int size, const UBLOXCFG_KEYVAL_t *k
 
     bool res = true;
     int dataIx = 0;
-    memset(data, 0, size);
-
-    for (int kvIx = 0; res && (kvIx < nKeyVal); kvIx++)
+    for (int kvIx = 0; kvIx < nKeyVal; kvIx++)
     {
-        // enough space for key?
-        if ( (size - dataIx) < 4 )
+        const UBLOXCFG_KEYVAL_t *kv = &keyVal[kvIx];
+        const int valSize = valSizes[UBLOXCFG_ID2SIZE(kv->id)];
+        const int remSize = size - dataIx;
+        // Invalid size, or not enough space for key and value
+        if ( (valSize == 0) || (remSize < (4 + valSize)) )
         {
             res = false;
             break;
         }
-
-        // encode key ID
-        const UBLOXCFG_KEYVAL_t *kv = &keyVal[kvIx];
-        const uint32_t key = kv->id;
-        data[dataIx++] = (key >>  0) & 0xff;
-        data[dataIx++] = (key >>  8) & 0xff;
-        data[dataIx++] = (key >> 16) & 0xff;
-        data[dataIx++] = (key >> 24) & 0xff;
-
-        // encode value, and also check that there's enough space left in data
-        const UBLOXCFG_SIZE_t valSize = UBLOXCFG_ID2SIZE(kv->id);
-        const UBLOXCFG_VALUE_t val = kv->val;
-        switch (valSize)
+        memcpy(&data[dataIx], &kv->id, 4);
+        if (remSize >= (4 + 8))
         {
-            case UBLOXCFG_SIZE_BIT:
-                if ( (size - dataIx) < 1 )
-                {
-                    res = false;
-                    break;
-                }
-                data[dataIx++] = val._bytes[0];
-                break;
-            case UBLOXCFG_SIZE_ONE:
-                if ( (size - dataIx) < 1 )
-                {
-                    res = false;
-                    break;
-                }
-                data[dataIx++] = val._bytes[0];
-                break;
-            case UBLOXCFG_SIZE_TWO:
-                if ( (size - dataIx) < 2 )
-                {
-                    res = false;
-                    break;
-                }
-                data[dataIx++] = val._bytes[0];
-                data[dataIx++] = val._bytes[1];
-                break;
-            case UBLOXCFG_SIZE_FOUR:
-                if ( (size - dataIx) < 4 )
-                {
-                    res = false;
-                    break;
-                }
-                data[dataIx++] = val._bytes[0];
-                data[dataIx++] = val._bytes[1];
-                data[dataIx++] = val._bytes[2];
-                data[dataIx++] = val._bytes[3];
-                break;
-            case UBLOXCFG_SIZE_EIGHT:
-                if ( (size - dataIx) < 8 )
-                {
-                    res = false;
-                    break;
-                }
-                data[dataIx++] = val._bytes[0];
-                data[dataIx++] = val._bytes[1];
-                data[dataIx++] = val._bytes[2];
-                data[dataIx++] = val._bytes[3];
-                data[dataIx++] = val._bytes[4];
-                data[dataIx++] = val._bytes[5];
-                data[dataIx++] = val._bytes[6];
-                data[dataIx++] = val._bytes[7];
-                break;
-            default:
-                res = false;
-                break;
+            memcpy(&data[dataIx + 4], kv->val._bytes, 8);
+        }
+        else
+        {
+            memcpy(&data[dataIx + 4], kv->val._bytes, valSize);
         }
+        dataIx += 4 + valSize;
     }
     *dataSize = dataIx;
 
@@ -221,116 +185,336 @@ bool ubloxcfg_parseData(const uint8_t *data, const int size, UBLOXCFG_KEYVAL_t *
     bool res = true;
     int kvIx = 0;
     int dataIx = 0;
-    memset(keyVal, 0, maxKeyVal * sizeof(*keyVal));
-
-    while (res)
+    while (res && (dataIx <= (size - 4)))
     {
-        // next key?
-        if ( dataIx > (size - 4) )
+        if (kvIx >= maxKeyVal)
         {
+            res = false;
             break;
         }
-        const uint8_t k0 = data[dataIx++];
-        const uint8_t k1 = data[dataIx++];
-        const uint8_t k2 = data[dataIx++];
-        const uint8_t k3 = data[dataIx++];
-        const uint32_t id = k0 | (k1 << 8) | (k2 << 16) | (k3 << 24);
-        const UBLOXCFG_SIZE_t valSize = UBLOXCFG_ID2SIZE(id);
-        UBLOXCFG_VALUE_t val;
-        val.U8 = 0;
-        switch (valSize)
+        uint32_t id;
+        memcpy(&id, &data[dataIx], 4);
+        const uint8_t *pVal = &data[dataIx + 4];
+        const int remSize = size - dataIx - 4;
+        UBLOXCFG_VALUE_t val = { ._raw = 0 };
+        // Note: Each size has its own branch (rather than a table lookup of the size). As the sizes are (usually)
+        // predictable this allows the CPU to run ahead to the next key instead of waiting for the current key to load.
+        switch (UBLOXCFG_ID2SIZE(id))
         {
             case UBLOXCFG_SIZE_BIT:
-                if ( dataIx > (size - 1) )
-                {
-                    res = false;
-                    break;
-                }
-                else
-                {
-                    val._bytes[0] = data[dataIx++];
-                }
-                break;
             case UBLOXCFG_SIZE_ONE:
-                if ( dataIx > (size - 1) )
-                {
-                    res = false;
-                    break;
-                }
-                else
-                {
-                    val._bytes[0] = data[dataIx++];
-                }
+                if (remSize < 1) { res = false; break; }
+                val._bytes[0] = pVal[0];
+                dataIx += 4 + 1;
                 break;
             case UBLOXCFG_SIZE_TWO:
-                if ( dataIx > (size - 1) )
-                {
-                    res = false;
-                    break;
-                }
-                else
-                {
-                    val._bytes[0] = data[dataIx++];
-                    val._bytes[1] = data[dataIx++];
-                }
+                if (remSize < 2) { res = false; break; }
+                memcpy(&val._raw, pVal, 2);
+                dataIx += 4 + 2;
                 break;
             case UBLOXCFG_SIZE_FOUR:
-                if ( dataIx > (size - 1) )
-                {
-                    res = false;
-                    break;
-                }
-                else
-                {
-                    val._bytes[0] = data[dataIx++];
-                    val._bytes[1] = data[dataIx++];
-                    val._bytes[2] = data[dataIx++];
-                    val._bytes[3] = data[dataIx++];
-                }
+                if (remSize < 4) { res = false; break; }
+                memcpy(&val._raw, pVal, 4);
+                dataIx += 4 + 4;
                 break;
             case UBLOXCFG_SIZE_EIGHT:
-                if ( dataIx > (size - 1) )
-                {
-                    res = false;
-                    break;
-                }
-                else
-                {
-                    val._bytes[0] = data[dataIx++];
-                    val._bytes[1] = data[dataIx++];
-                    val._bytes[2] = data[dataIx++];
-                    val._bytes[3] = data[dataIx++];
-                    val._bytes[4] = data[dataIx++];
-                    val._bytes[5] = data[dataIx++];
-                    val._bytes[6] = data[dataIx++];
-                    val._bytes[7] = data[dataIx++];
-                }
+                if (remSize < 8) { res = false; break; }
+                memcpy(&val._raw, pVal, 8);
+                dataIx += 4 + 8;
                 break;
             default:
                 res = false;
                 break;
         }
-
         if (res)
         {
-            // enough space in list?
-            if (kvIx < maxKeyVal)
+            UBLOXCFG_KEYVAL_t *kv = &keyVal[kvIx++];
+            memset(kv, 0, sizeof(*kv)); // including padding, so that lists can be compared using memcmp()
+            kv->id = id;
+            kv->val = val;
+        }
+    }
+
+    *nKeyVal = kvIx;
+
+    return res;
+}
+
+static int keyValCmp(const void *a, const void *b)
+{
+    const uint32_t idA = ((const UBLOXCFG_KEYVAL_t *)a)->id;
+    const uint32_t idB = ((const UBLOXCFG_KEYVAL_t *)b)->id;
+    return idA < idB ? -1 : (idA > idB ? 1 : 0);
+}
+
+int ubloxcfg_sortKeyVal(UBLOXCFG_KEYVAL_t *keyVal, const int nKeyVal)
+{
+    if ( (keyVal == NULL) || (nKeyVal < 2) )
+    {
+        return nKeyVal < 0 ? 0 : nKeyVal;
+    }
+    qsort(keyVal, nKeyVal, sizeof(*keyVal), keyValCmp);
+    int num = 1;
+    for (int ix = 1; ix < nKeyVal; ix++)
+    {
+        if (keyVal[ix].id != keyVal[num - 1].id)
+        {
+            keyVal[num++] = keyVal[ix];
+        }
+    }
+    return num;
+}
+
+// The set operations walk both sorted lists in parallel, O(n + m)
+
+int ubloxcfg_diffKeyVal(const UBLOXCFG_KEYVAL_t *from, const int nFrom, const UBLOXCFG_KEYVAL_t *to, const int nTo,
+    UBLOXCFG_KEYVAL_t *diff, const int maxDiff)
+{
+    int num = 0;
+    int fromIx = 0;
+    for (int toIx = 0; toIx < nTo; toIx++)
+    {
+        while ( (fromIx < nFrom) && (from[fromIx].id < to[toIx].id) )
+        {
+            fromIx++;
+        }
+        if ( (fromIx >= nFrom) || (from[fromIx].id != to[toIx].id) || (from[fromIx].val._raw != to[toIx].val._raw) )
+        {
+            if (num >= maxDiff)
             {
-                keyVal[kvIx].id = id;
-                keyVal[kvIx].val = val;
-                kvIx++;
+                return -1;
             }
-            // output list too short, abort
-            else
+            diff[num++] = to[toIx];
+        }
+    }
+    return num;
+}
+
+int ubloxcfg_mergeKeyVal(const UBLOXCFG_KEYVAL_t *base, const int nBase, const UBLOXCFG_KEYVAL_t *upd, const int nUpd,
+    UBLOXCFG_KEYVAL_t *merged, const int maxMerged)
+{
+    int num = 0;
+    int baseIx = 0;
+    int updIx = 0;
+    while ( (baseIx < nBase) || (updIx < nUpd) )
+    {
+        if (num >= maxMerged)
+        {
+            return -1;
+        }
+        if ( (updIx >= nUpd) || ( (baseIx < nBase) && (base[baseIx].id < upd[updIx].id) ) )
+        {
+            merged[num++] = base[baseIx++];
+        }
+        else
+        {
+            if ( (baseIx < nBase) && (base[baseIx].id == upd[updIx].id) )
             {
-                res = 0;
+                baseIx++;
             }
+            merged[num++] = upd[updIx++];
         }
     }
+    return num;
+}
 
-    *nKeyVal = kvIx;
+int ubloxcfg_intersectKeyVal(const UBLOXCFG_KEYVAL_t *keyVal, const int nKeyVal, const UBLOXCFG_KEYVAL_t *other, const int nOther,
+    UBLOXCFG_KEYVAL_t *inter, const int maxInter)
+{
+    int num = 0;
+    int otherIx = 0;
+    for (int ix = 0; (ix < nKeyVal) && (otherIx < nOther); ix++)
+    {
+        while ( (otherIx < nOther) && (other[otherIx].id < keyVal[ix].id) )
+        {
+            otherIx++;
+        }
+        if ( (otherIx < nOther) && (other[otherIx].id == keyVal[ix].id) )
+        {
+            if (num >= maxInter)
+            {
+                return -1;
+            }
+            inter[num++] = keyVal[ix];
+        }
+    }
+    return num;
+}
 
-    return res;
+// Snapshot layout (all little-endian):
+//   0  magic (4 bytes)
+//   4  U1 version
+//   5  U1 layer (0xff = none)
+//   6  U2 size of receiver info string
+//   8  U4 number of key-value pairs
+//  12  U4 size of values
+//  16  U8 content hash
+//  24  receiver info string (not nul-terminated)
+//  ..  U4 IDs (sorted)
+//  ..  values (each of the size of the ID)
+#define SNAPSHOT_HEAD_SIZE 24
+#define SNAPSHOT_NO_LAYER  0xff
+static const uint8_t snapshotMagic[4] = { 0x89, 'U', 'C', 'S' };
+
+// FNV-1a (64 bit)
+#define HASH64_INIT UINT64_C(0xcbf29ce484222325)
+static uint64_t hash64(uint64_t h, const uint8_t *data, const int size)
+{
+    for (int ix = 0; ix < size; ix++)
+    {
+        h = (h ^ data[ix]) * UINT64_C(0x00000100000001b3);
+    }
+    return h;
+}
+
+uint64_t ubloxcfg_hashKeyVal(const UBLOXCFG_KEYVAL_t *keyVal, const int nKeyVal)
+{
+    uint64_t h = HASH64_INIT;
+    for (int ix = 0; ix < nKeyVal; ix++)
+    {
+        h = hash64(h, (const uint8_t *)&keyVal[ix].id, 4);
+    }
+    for (int ix = 0; ix < nKeyVal; ix++)
+    {
+        h = hash64(h, keyVal[ix].val._bytes, valSizes[UBLOXCFG_ID2SIZE(keyVal[ix].id)]);
+    }
+    return h;
+}
+
+bool ubloxcfg_makeSnapshot(uint8_t *data, const int size, const UBLOXCFG_SNAPSHOT_t *info,
+    const UBLOXCFG_KEYVAL_t *keyVal, const int nKeyVal, int *dataSize)
+{
+    if ( (data == NULL) || (dataSize == NULL) || (nKeyVal < 0) || ((keyVal == NULL) && (nKeyVal > 0)) )
+    {
+        return false;
+    }
+
+    // Check list (must be sorted, without duplicates and with valid sizes), calculate size
+    int valuesSize = 0;
+    for (int ix = 0; ix < nKeyVal; ix++)
+    {
+        const int valSize = valSizes[UBLOXCFG_ID2SIZE(keyVal[ix].id)];
+        if ( (valSize == 0) || ( (ix > 0) && (keyVal[ix].id <= keyVal[ix - 1].id) ) )
+        {
+            return false;
+        }
+        valuesSize += valSize;
+    }
+    uint16_t infoSize = 0;
+    while ( (info != NULL) && (infoSize < UBLOXCFG_SNAPSHOT_MAX_RXINFO) && (info->rxInfo[infoSize] != '\0') )
+    {
+        infoSize++;
+    }
+    const int idsOffs = SNAPSHOT_HEAD_SIZE + infoSize;
+    const int valsOffs = idsOffs + (nKeyVal * 4);
+    const int totSize = valsOffs + valuesSize;
+    if (totSize > size)
+    {
+        return false;
+    }
+
+    // IDs and values
+    int valIx = valsOffs;
+    for (int ix = 0; ix < nKeyVal; ix++)
+    {
+        const UBLOXCFG_KEYVAL_t *kv = &keyVal[ix];
+        const int valSize = valSizes[UBLOXCFG_ID2SIZE(kv->id)];
+        memcpy(&data[idsOffs + (ix * 4)], &kv->id, 4);
+        memcpy(&data[valIx], kv->val._bytes, valSize);
+        valIx += valSize;
+    }
+
+    // Header
+    const uint32_t numKv = nKeyVal;
+    const uint32_t valsSize = valuesSize;
+    const uint64_t hash = hash64(HASH64_INIT, &data[idsOffs], totSize - idsOffs);
+    memcpy(&data[0], snapshotMagic, sizeof(snapshotMagic));
+    data[4] = UBLOXCFG_SNAPSHOT_VERSION;
+    data[5] = ( (info != NULL) && info->haveLayer ) ? (uint8_t)info->layer : SNAPSHOT_NO_LAYER;
+    memcpy(&data[6], &infoSize, 2);
+    memcpy(&data[8], &numKv, 4);
+    memcpy(&data[12], &valsSize, 4);
+    memcpy(&data[16], &hash, 8);
+    if (infoSize > 0)
+    {
+        memcpy(&data[SNAPSHOT_HEAD_SIZE], info->rxInfo, infoSize);
+    }
+
+    *dataSize = totSize;
+    return true;
+}
+
+bool ubloxcfg_parseSnapshot(const uint8_t *data, const int size, UBLOXCFG_SNAPSHOT_t *info,
+    UBLOXCFG_KEYVAL_t *keyVal, const int maxKeyVal, int *nKeyVal)
+{
+    if ( (data == NULL) || (size < SNAPSHOT_HEAD_SIZE) || (memcmp(data, snapshotMagic, sizeof(snapshotMagic)) != 0) ||
+         (data[4] != UBLOXCFG_SNAPSHOT_VERSION) || ( (keyVal != NULL) && (nKeyVal == NULL) ) )
+    {
+        return false;
+    }
+
+    // Header
+    uint16_t infoSize;
+    uint32_t numKv;
+    uint32_t valsSize;
+    uint64_t hash;
+    memcpy(&infoSize, &data[6], 2);
+    memcpy(&numKv, &data[8], 4);
+    memcpy(&valsSize, &data[12], 4);
+    memcpy(&hash, &data[16], 8);
+    const int idsOffs = SNAPSHOT_HEAD_SIZE + infoSize;
+    if ( (infoSize > UBLOXCFG_SNAPSHOT_MAX_RXINFO) || (numKv > (uint32_t)(size / 4)) || (valsSize > (uint32_t)size) ||
+         (size != (idsOffs + (int)(numKv * 4) + (int)valsSize)) )
+    {
+        return false;
+    }
+    if (info != NULL)
+    {
+        memset(info, 0, sizeof(*info));
+        info->version   = data[4];
+        info->haveLayer = (data[5] != SNAPSHOT_NO_LAYER);
+        info->layer     = info->haveLayer ? (UBLOXCFG_LAYER_t)data[5] : UBLOXCFG_LAYER_RAM;
+        memcpy(info->rxInfo, &data[SNAPSHOT_HEAD_SIZE], infoSize);
+        info->nKeyVal   = numKv;
+        info->hash      = hash;
+    }
+
+    // Only the header is wanted
+    if (keyVal == NULL)
+    {
+        return true;
+    }
+
+    // Key-value pairs
+    if ( ((int)numKv > maxKeyVal) || (hash64(HASH64_INIT, &data[idsOffs], size - idsOffs) != hash) )
+    {
+        return false;
+    }
+    int valIx = idsOffs + (numKv * 4);
+    uint32_t prevId = 0;
+    for (int ix = 0; ix < (int)numKv; ix++)
+    {
+        uint32_t id;
+        memcpy(&id, &data[idsOffs + (ix * 4)], 4);
+        const int valSize = valSizes[UBLOXCFG_ID2SIZE(id)];
+        if ( (valSize == 0) || ( (ix > 0) && (id <= prevId) ) || ((valIx + valSize) > size) )
+        {
+            return false;
+        }
+        UBLOXCFG_KEYVAL_t *kv = &keyVal[ix];
+        memset(kv, 0, sizeof(*kv));
+        kv->id = id;
+        memcpy(kv->val._bytes, &data[valIx], valSize);
+        valIx += valSize;
+        prevId = id;
+    }
+    if (valIx != size)
+    {
+        return false;
+    }
+    *nKeyVal = numKv;
+
+    return true;
 }
 
 const char *ubloxcfg_typeStr(UBLOXCFG_TYPE_t type)
@@ -359,72 +543,210 @@ const char *ubloxcfg_typeStr(UBLOXCFG_TYPE_t type)
     return NULL;
 }
 
-bool ubloxcfg_stringifyValue(char *str, const int size, const UBLOXCFG_TYPE_t type, const UBLOXCFG_ITEM_t *item, const UBLOXCFG_VALUE_t *val)
+// Two decimal digits for 0..99
+static const char digitPairs[200] =
 {
-    if ( (str == NULL) || (size <= 0) || ((item != NULL) && (item->type != type)) )
+    '0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+    '1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+    '2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+    '3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+    '4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+    '5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+    '6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+    '7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+    '8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+    '9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9'
+};
+
+// Format unsigned number (decimal), str must have space for 21 characters, returns length of the string
+static int fmtUnsigned(char *str, uint64_t val)
+{
+    char tmp[20];
+    int pos = sizeof(tmp);
+    while (val >= 100)
+    {
+        const int ix = (int)(val % 100) * 2;
+        val /= 100;
+        tmp[--pos] = digitPairs[ix + 1];
+        tmp[--pos] = digitPairs[ix];
+    }
+    if (val >= 10)
+    {
+        const int ix = (int)val * 2;
+        tmp[--pos] = digitPairs[ix + 1];
+        tmp[--pos] = digitPairs[ix];
+    }
+    else
+    {
+        tmp[--pos] = '0' + (char)val;
+    }
+    const int len = sizeof(tmp) - pos;
+    memcpy(str, &tmp[pos], len);
+    str[len] = '\0';
+    return len;
+}
+
+// Format signed number (decimal), str must have space for 21 characters, returns length of the string
+static int fmtSigned(char *str, const int64_t val)
+{
+    if (val < 0)
+    {
+        str[0] = '-';
+        return 1 + fmtUnsigned(&str[1], UINT64_C(0) - (uint64_t)val);
+    }
+    return fmtUnsigned(str, (uint64_t)val);
+}
+
+// Format hex number ("0x" and numDigits digits), str must have space for numDigits + 3 characters, returns length
+static int fmtHex(char *str, uint64_t val, const int numDigits)
+{
+    static const char hexDigits[] = "0123456789abcdef";
+    str[0] = '0';
+    str[1] = 'x';
+    for (int ix = numDigits + 1; ix > 1; ix--)
+    {
+        str[ix] = hexDigits[val & 0xf];
+        val >>= 4;
+    }
+    str[numDigits + 2] = '\0';
+    return numDigits + 2;
+}
+
+// Append string, returns false if there's not enough space left in str
+static bool appendStr(char *str, const int size, int *len, const char *app, const int appLen)
+{
+    if ((*len + appLen) >= size)
     {
         return false;
     }
+    memcpy(&str[*len], app, appLen);
+    *len += appLen;
+    str[*len] = '\0';
+    return true;
+}
+
+// Find constant of an item by name (first len characters of str), returns NULL if there is no such constant
+static const UBLOXCFG_CONST_t *findConstByName(const UBLOXCFG_ITEM_t *item, const char *str, const int len)
+{
+    uint8_t key[4 + 60];
+    if ( (item->nConsts < 1) || (len < 1) || (len > (int)(sizeof(key) - 4)) )
+    {
+        return NULL;
+    }
+    memcpy(&key[0], &item->id, 4);
+    memcpy(&key[4], str, len);
+    const int ix = hashLookup(_ubloxcfg_constsByName(), key, 4 + len);
+    if (ix >= 0)
+    {
+        const _UBLOXCFG_CONSTREF_t *ref = &_ubloxcfg_constsByNameRefs()[ix];
+        if (ref->id == item->id)
+        {
+            const UBLOXCFG_CONST_t *cnst = &item->consts[ref->ix];
+            if ( (strncmp(cnst->name, str, len) == 0) && (cnst->name[len] == '\0') )
+            {
+                return cnst;
+            }
+        }
+    }
+    return NULL;
+}
+
+// Find enum (E type) constant of an item by value, returns NULL if there is no such constant
+static const UBLOXCFG_CONST_t *findEnumByValue(const UBLOXCFG_ITEM_t *item, const int32_t value)
+{
+    if (item->nConsts < 1)
+    {
+        return NULL;
+    }
+    uint8_t key[4 + 4];
+    memcpy(&key[0], &item->id, 4);
+    memcpy(&key[4], &value, 4);
+    const int ix = hashLookup(_ubloxcfg_enumsByValue(), key, sizeof(key));
+    if (ix >= 0)
+    {
+        const _UBLOXCFG_CONSTREF_t *ref = &_ubloxcfg_enumsByValueRefs()[ix];
+        if (ref->id == item->id)
+        {
+            // Constants can be given unsigned (e.g. 255 for an E1), compare the value of the item size
+            const int32_t cnstVal = item->consts[ref->ix].val.E;
+            bool match = false;
+            switch (item->size)
+            {
+                case UBLOXCFG_SIZE_ONE:  match = ((int8_t)cnstVal  == (int8_t)value);  break;
+                case UBLOXCFG_SIZE_TWO:  match = ((int16_t)cnstVal == (int16_t)value); break;
+                case UBLOXCFG_SIZE_FOUR: match = (cnstVal == value);                  break;
+                case UBLOXCFG_SIZE_BIT:
+                case UBLOXCFG_SIZE_EIGHT:
+                    break;
+            }
+            if (match)
+            {
+                return &item->consts[ref->ix];
+            }
+        }
+    }
+    return NULL;
+}
+
+// Stringify value, returns the length of the string, or -1 on failure
+static int stringifyValue(char *str, const int size, const UBLOXCFG_TYPE_t type, const UBLOXCFG_ITEM_t *item, const UBLOXCFG_VALUE_t *val)
+{
+    if ( (str == NULL) || (size <= 0) || ((item != NULL) && (item->type != type)) )
+    {
+        return -1;
+    }
 
     str[0] = '\0';
-    bool res = false;
+    int len = -1;
 
     switch (type)
     {
         case UBLOXCFG_TYPE_U1:
             if (size >= 4) // 0..255
             {
-                snprintf(str, size, "%" PRIu8, val->U1);
-                res = true;
+                len = fmtUnsigned(str, val->U1);
             }
             break;
         case UBLOXCFG_TYPE_U2:
             if (size >= 6) // 0..65535
             {
-                snprintf(str, size, "%" PRIu16, val->U2);
-                res = true;
+                len = fmtUnsigned(str, val->U2);
             }
             break;
         case UBLOXCFG_TYPE_U4:
             if (size >= 11) // 0..4294967295
             {
-                snprintf(str, size, "%" PRIu32, val->U4);
-                res = true;
+                len = fmtUnsigned(str, val->U4);
             }
             break;
         case UBLOXCFG_TYPE_U8:
             if (size >= 21) // 0..18446744073709551615
             {
-                snprintf(str, size, "%" PRIu64, val->U8);
-                res = true;
+                len = fmtUnsigned(str, val->U8);
             }
             break;
         case UBLOXCFG_TYPE_I1:
             if (size >= 5) // -128..127
             {
-                snprintf(str, size, "%" PRIi8, val->I1);
-                res = true;
+                len = fmtSigned(str, val->I1);
             }
             break;
         case UBLOXCFG_TYPE_I2:
             if (size >= 7) // -32768..32767
             {
-                snprintf(str, size, "%" PRIi16, val->I2);
-                res = true;
+                len = fmtSigned(str, val->I2);
             }
             break;
         case UBLOXCFG_TYPE_I4:
             if (size >= 12) // −2147483648..2147483647
             {
-                snprintf(str, size, "%" PRIi32, val->I4);
-                res = true;
+                len = fmtSigned(str, val->I4);
             }
             break;
         case UBLOXCFG_TYPE_I8:
             if (size >= 21) // -9223372036854775808..9223372036854775807
             {
-                snprintf(str, size, "%" PRIi64, val->I8);
-                res = true;
+                len = fmtSigned(str, val->I8);
             }
             break;
         case UBLOXCFG_TYPE_X1:
@@ -433,58 +755,54 @@ bool ubloxcfg_stringifyValue(char *str, const int size, const UBLOXCFG_TYPE_t ty
         case UBLOXCFG_TYPE_X8:
             if (size >= (19 + 20)) // 0x00 (...) // 0x0000 (...) // 0x00000000 (...) // 0x0000000000000000 (...)
             {
-                const char *fmt1 = NULL;
-                const char *fmt2 = NULL;
+                int numDigits = 0;
                 uint64_t valX = 0;
                 switch (type)
                 {
-                    case UBLOXCFG_TYPE_X1: fmt1 = "0x%02"  PRIx64 " "; fmt2 = "|0x%02"  PRIx64; valX = val->X1; break;
-                    case UBLOXCFG_TYPE_X2: fmt1 = "0x%04"  PRIx64 " "; fmt2 = "|0x%04"  PRIx64; valX = val->X2; break;
-                    case UBLOXCFG_TYPE_X4: fmt1 = "0x%08"  PRIx64 " "; fmt2 = "|0x%08"  PRIx64; valX = val->X4; break;
-                    case UBLOXCFG_TYPE_X8: fmt1 = "0x%016" PRIx64 " "; fmt2 = "|0x%016" PRIx64; valX = val->X8; break;
+                    case UBLOXCFG_TYPE_X1: numDigits =  2; valX = val->X1; break;
+                    case UBLOXCFG_TYPE_X2: numDigits =  4; valX = val->X2; break;
+                    case UBLOXCFG_TYPE_X4: numDigits =  8; valX = val->X4; break;
+                    case UBLOXCFG_TYPE_X8: numDigits = 16; valX = val->X8; break;
                     default: break;
                 }
                 // render hex value
-                int len = snprintf(str, size, fmt1, valX);
-                const int ixBracket = len;
+                int n = fmtHex(str, valX, numDigits);
+                str[n++] = ' ';
+                str[n++] = '(';
+                bool ok = true;
+                bool sep = false;
                 // add constant names for known bits
                 uint64_t usedBits = 0;
                 if (item != NULL)
                 {
-                    for (int ix = 0; ix < item->nConsts; ix++)
+                    for (int ix = 0; ok && (ix < item->nConsts); ix++)
                     {
                         if ((item->consts[ix].val.X & valX) != 0)
                         {
-                            len += snprintf(&str[len], size - len, "|%s", item->consts[ix].name);
+                            ok = (!sep || appendStr(str, size, &n, "|", 1)) &&
+                                appendStr(str, size, &n, item->consts[ix].name, strlen(item->consts[ix].name));
                             usedBits |= item->consts[ix].val.X;
-                            if ((size - len - 1) <= 0)
-                            {
-                                break;
-                            }
+                            sep = true;
                         }
                     }
                 }
                 // add hex value of remaining bits (for which no constant was defined)
-                if ((size - len - 1) > 0)
+                const uint64_t unusedBits = valX & (~usedBits);
+                if (ok && (unusedBits == valX))
                 {
-                    const uint64_t unusedBits = valX & (~usedBits);
-                    if (unusedBits == valX)
-                    {
-                        strncat(&str[len], "|n/a", size - len);
-                        len += 4;
-                    }
-                    else if (unusedBits != 0)
-                    {
-                        len += snprintf(&str[len], size - len, fmt2, unusedBits);
-                    }
+                    ok = appendStr(str, size, &n, "n/a", 3);
                 }
-                // fix up and terminate string
-                str[ixBracket] = '('; // "|" --> "("
-                if ((size - len - 1) > 0)
+                else if (ok && (unusedBits != 0))
                 {
-                    str[len++] = ')';
-                    str[len] = '\0';
-                    res = true;
+                    char hex[20];
+                    hex[0] = '|';
+                    const int hexLen = 1 + fmtHex(&hex[1], unusedBits, numDigits);
+                    ok = appendStr(str, size, &n, hex, hexLen);
+                }
+                // terminate string
+                if (ok && appendStr(str, size, &n, ")", 1))
+                {
+                    len = n;
                 }
             }
             break;
@@ -501,49 +819,125 @@ bool ubloxcfg_stringifyValue(char *str, const int size, const UBLOXCFG_TYPE_t ty
                     case UBLOXCFG_TYPE_E4: valE = val->E4; break;
                     default: break;
                 }
-                if (item != NULL)
+                const UBLOXCFG_CONST_t *cnst = item != NULL ? findEnumByValue(item, valE) : NULL;
+                if (cnst != NULL)
                 {
-                    for (int ix = 0; ix < item->nConsts; ix++)
+                    int n = 0;
+                    if (appendStr(str, size, &n, cnst->value, strlen(cnst->value)) &&
+                        appendStr(str, size, &n, " (", 2) &&
+                        appendStr(str, size, &n, cnst->name, strlen(cnst->name)) &&
+                        appendStr(str, size, &n, ")", 1))
                     {
-                        if ((int8_t)item->consts[ix].val.E == valE)
-                        {
-                            snprintf(str, size, "%s (%s)", item->consts[ix].value, item->consts[ix].name);
-                            res = true;
-                            break;
-                        }
+                        len = n;
                     }
                 }
-                if (!res)
+                else
                 {
-                    snprintf(str, size, "%" PRIi8 " (n/a)", valE);
-                    res = true;
+                    len = fmtSigned(str, valE);
+                    memcpy(&str[len], " (n/a)", 7);
+                    len += 6;
                 }
             }
             break;
         case UBLOXCFG_TYPE_R4:
             if (size >= 30) // -1.17549435082228750796874e-38..3.40282346638528859811704e+38
             {
-                snprintf(str, size, "%.24g", val->R4);
-                res = true;
+                len = snprintf(str, size, "%.24g", val->R4);
             }
             break;
         case UBLOXCFG_TYPE_R8:
             if (size >= 61) //-2.22507385850720138309023271733240406421921598046233183e-308..1.79769313486231570814527423731704356798070567525844997e+308
             {
-                snprintf(str, size, "%.54g", val->R8);
-                res = true;
+                len = snprintf(str, size, "%.54g", val->R8);
             }
             break;
         case UBLOXCFG_TYPE_L:
             if (size >= 10)
             {
-                snprintf(str, size, val->L ? "1 (true)" : "0 (false)");
-                res = true;
+                len = val->L ? 8 : 9;
+                memcpy(str, val->L ? "1 (true)" : "0 (false)", len + 1);
             }
             break;
     }
 
-    return res;
+    if (len < 0)
+    {
+        str[0] = '\0';
+    }
+    return len;
+}
+
+bool ubloxcfg_stringifyValue(char *str, const int size, const UBLOXCFG_TYPE_t type, const UBLOXCFG_ITEM_t *item, const UBLOXCFG_VALUE_t *val)
+{
+    return stringifyValue(str, size, type, item, val) >= 0;
+}
+
+char *ubloxcfg_stringifyValues(const UBLOXCFG_KEYVAL_t *keyVal, const int nKeyVal, const char **strs)
+{
+    if ( (keyVal == NULL) || (nKeyVal < 1) || (strs == NULL) )
+    {
+        return NULL;
+    }
+
+    // Most values are short, grow the buffer as necessary
+    int bufSize = (nKeyVal * 16) + UBLOXCFG_MAX_KEYVAL_STR_SIZE;
+    char *buf = malloc(bufSize);
+    int bufLen = 0;
+    for (int ix = 0; (buf != NULL) && (ix < nKeyVal); ix++)
+    {
+        if ((bufSize - bufLen) < UBLOXCFG_MAX_KEYVAL_STR_SIZE)
+        {
+            bufSize *= 2;
+            char *newBuf = realloc(buf, bufSize);
+            if (newBuf == NULL)
+            {
+                free(buf);
+                buf = NULL;
+                break;
+            }
+            buf = newBuf;
+        }
+
+        // Unknown items stringify as X type of the size of the item (and L for one bit items)
+        const UBLOXCFG_ITEM_t *item = ubloxcfg_getItemById(keyVal[ix].id);
+        UBLOXCFG_TYPE_t type = UBLOXCFG_TYPE_X8;
+        if (item != NULL)
+        {
+            type = item->type;
+        }
+        else
+        {
+            switch (UBLOXCFG_ID2SIZE(keyVal[ix].id))
+            {
+                case UBLOXCFG_SIZE_BIT:   type = UBLOXCFG_TYPE_L;  break;
+                case UBLOXCFG_SIZE_ONE:   type = UBLOXCFG_TYPE_X1; break;
+                case UBLOXCFG_SIZE_TWO:   type = UBLOXCFG_TYPE_X2; break;
+                case UBLOXCFG_SIZE_FOUR:  type = UBLOXCFG_TYPE_X4; break;
+                case UBLOXCFG_SIZE_EIGHT: type = UBLOXCFG_TYPE_X8; break;
+            }
+        }
+
+        const int len = stringifyValue(&buf[bufLen], UBLOXCFG_MAX_KEYVAL_STR_SIZE, type, item, &keyVal[ix].val);
+        if (len < 0)
+        {
+            free(buf);
+            buf = NULL;
+            break;
+        }
+        bufLen += len + 1;
+    }
+
+    // The buffer may have moved while growing, so set the pointers only now
+    if (buf != NULL)
+    {
+        const char *str = buf;
+        for (int ix = 0; ix < nKeyVal; ix++)
+        {
+            strs[ix] = str;
+            str += strlen(str) + 1;
+        }
+    }
+    return buf;
 }
 
 bool ubloxcfg_splitValueStr(char *str, char **valueStr, char **prettyStr)
@@ -685,8 +1079,7 @@ bool ubloxcfg_valueFromString(const char *str, UBLOXCFG_TYPE_t type, const UBLOX
     int64_t  valSigned;
     float    valFloat;
     double   valDouble;
-    int      numChar;
-    const int len = strlen(str);
+    char    *end;
     memset(value, 0, sizeof(*value));
     switch (type)
     {
@@ -820,14 +1213,16 @@ bool ubloxcfg_valueFromString(const char *str, UBLOXCFG_TYPE_t type, const UBLOX
             }
             break;
         case UBLOXCFG_TYPE_R4:
-            if ( (sscanf(str, "%f%n", &valFloat, &numChar) == 1) && (numChar == len) )
+            valFloat = strtof(str, &end);
+            if ( (end != str) && (*end == '\0') )
             {
                 value->R4 = valFloat;
                 res = true;
             }
             break;
         case UBLOXCFG_TYPE_R8:
-            if ( (sscanf(str, "%lf%n", &valDouble, &numChar) == 1) && (numChar == len) )
+            valDouble = strtod(str, &end);
+            if ( (end != str) && (*end == '\0') )
             {
                 value->R8 = valDouble;
                 res = true;
@@ -873,6 +1268,42 @@ bool ubloxcfg_valueFromString(const char *str, UBLOXCFG_TYPE_t type, const UBLOX
     return res;
 }
 
+// Parse digits (base 8, 10 or 16), returns the number of characters parsed, or -1 if the value doesn't fit
+static int parseDigits(const char *str, const int base, uint64_t *val)
+{
+    uint64_t value = 0;
+    int num = 0;
+    while (true)
+    {
+        const char c = str[num];
+        int digit = 16;
+        if ( (c >= '0') && (c <= '9') )
+        {
+            digit = c - '0';
+        }
+        else if ( (c >= 'a') && (c <= 'f') )
+        {
+            digit = c - 'a' + 10;
+        }
+        else if ( (c >= 'A') && (c <= 'F') )
+        {
+            digit = c - 'A' + 10;
+        }
+        if (digit >= base)
+        {
+            break;
+        }
+        if (value > ((UINT64_MAX - digit) / base))
+        {
+            return -1;
+        }
+        value = (value * base) + digit;
+        num++;
+    }
+    *val = value;
+    return num;
+}
+
 static bool strToValUnsigned(const char *str, const UBLOXCFG_TYPE_t type, uint64_t *val)
 {
     if ( (str == NULL) || (val == NULL) )
@@ -885,7 +1316,6 @@ static bool strToValUnsigned(const char *str, const UBLOXCFG_TYPE_t type, uint64
         return false;
     }
 
-    bool res = false;
     uint64_t max = 0;
     switch (type)
     {
@@ -907,37 +1337,23 @@ static bool strToValUnsigned(const char *str, const UBLOXCFG_TYPE_t type, uint64
             break;
         default: break;
     }
-    uint64_t value;
-    if (len < 1)
-    {
-        return false;
-    }
+    uint64_t value = 0;
+    bool res = false;
     // hex
-    else if ( (len > 1) && (str[0] == '0') && (str[1] == 'x') )
+    if ( (len > 1) && (str[0] == '0') && (str[1] == 'x') )
     {
-        int numChar = 0;
-        if ( (len > 2) && (sscanf(str, "%" SCNx64"%n", &value, &numChar) == 1) && (numChar == len) )
-        {
-            res = true;
-        }
+        res = (len > 2) && (parseDigits(&str[2], 16, &value) == (len - 2));
     }
     // octal
     else if (str[0] == '0')
     {
-        int numChar = 0;
-        if ( (sscanf(str, "%" SCNo64"%n", &value, &numChar) == 1) && (numChar == len) )
-        {
-            res = true;
-        }
+        res = (parseDigits(str, 8, &value) == len);
     }
     // dec
     else
     {
-        int numChar = 0;
-        if ( (sscanf(str, "%" SCNu64"%n", &value, &numChar) == 1) && (numChar == len) )
-        {
-            res = true;
-        }
+        const int offs = str[0] == '+' ? 1 : 0;
+        res = (len > offs) && (parseDigits(&str[offs], 10, &value) == (len - offs));
     }
 
     if (res)
@@ -986,13 +1402,12 @@ static bool strToValSigned(const char *str, UBLOXCFG_TYPE_t type, int64_t *val)
             break;
         default: break;
     }
-    int64_t value;
+    int64_t value = 0;
     // hex
     if ( (len > 1) && (str[0] == '0') && (str[1] == 'x') )
     {
         uint64_t valUnsigned;
-        int numChar = 0;
-        if ( (len > 2) && ( sscanf(str, "%" SCNx64"%n", &valUnsigned, &numChar) == 1) && (numChar ==len) )
+        if ( (len > 2) && (parseDigits(&str[2], 16, &valUnsigned) == (len - 2)) )
         {
             // sign extend to size
             switch (type)
@@ -1018,12 +1433,26 @@ static bool strToValSigned(const char *str, UBLOXCFG_TYPE_t type, int64_t *val)
             res = true;
         }
     }
-    // dec
+    // dec (or, with sign, hex and octal)
     else
     {
-        int numChar = 0;
-        if ( (sscanf(str, "%" SCNi64"%n", &value, &numChar) == 1) && (numChar == len) )
+        const bool neg = (str[0] == '-');
+        int offs = (neg || (str[0] == '+')) ? 1 : 0;
+        int base = 10;
+        if ( (str[offs] == '0') && ((str[offs + 1] == 'x') || (str[offs + 1] == 'X')) )
+        {
+            base = 16;
+            offs += 2;
+        }
+        else if (str[offs] == '0')
         {
+            base = 8;
+        }
+        uint64_t mag = 0;
+        if ( (len > offs) && (parseDigits(&str[offs], base, &mag) == (len - offs)) &&
+             (mag <= (neg ? (UINT64_C(1) << 63) : (uint64_t)INT64_MAX)) )
+        {
+            value = neg ? (int64_t)(UINT64_C(0) - mag) : (int64_t)mag;
             res = true;
         }
     }
@@ -1038,7 +1467,7 @@ static bool strToValSigned(const char *str, UBLOXCFG_TYPE_t type, int64_t *val)
 
 static bool findConstValue(const char *str, const UBLOXCFG_ITEM_t *item, uint64_t *val)
 {
-    if ( (item == NULL) || (val == NULL) || (str == NULL) || (strlen(str) < 1) )
+    if ( (item == NULL) || (val == NULL) || (str == NULL) || (str[0] == '\0') )
     {
         return false;
     }
@@ -1049,18 +1478,17 @@ static bool findConstValue(const char *str, const UBLOXCFG_ITEM_t *item, uint64_
     // iterate over parts of the string, separated by '|'
     const char sep = '|';
     const char *pStr = str;
-    const char *pSep = strchr(pStr, sep);
-    while (*pStr != '\0')
+    while (true)
     {
         // number of characters at beginning of pStr to compare
-        const int cmpLen = strlen(pStr) - ( (pSep != NULL) ? strlen(pSep) : 0 );
+        const char *pSep = strchr(pStr, sep);
+        const int cmpLen = pSep != NULL ? (int)(pSep - pStr) : (int)strlen(pStr);
 
         // interpret (part of) the string, which can be a 0x.. hex number or a constant name
         if ( (cmpLen > 2) && (pStr[0] == '0') && (pStr[1] == 'x') )
         {
             uint64_t v = 0;
-            int numChar = 0;
-            if ( (cmpLen < 3) || (sscanf(pStr, "%" SCNx64"%n", &v, &numChar) != 1) || (numChar != cmpLen) )
+            if (parseDigits(&pStr[2], 16, &v) != (cmpLen - 2))
             {
                 res = false;
                 break; // bad hex, give up
@@ -1069,28 +1497,19 @@ static bool findConstValue(const char *str, const UBLOXCFG_ITEM_t *item, uint64_
         }
         else
         {
-            bool found = false;
-            for (int ix = 0; (ix < item->nConsts) && !found; ix++)
-            {
-                const int nameLen = strlen(item->consts[ix].name);
-                if ( (nameLen == cmpLen) && (strncmp(item->consts[ix].name, pStr, cmpLen) == 0) )
-                {
-                    valRes |= item->consts[ix].val.X;
-                    found = true;
-                }
-            }
-            if (!found)
+            const UBLOXCFG_CONST_t *cnst = findConstByName(item, pStr, cmpLen);
+            if (cnst == NULL)
             {
                 res = false;
                 break; // bad part of string, give up
             }
+            valRes |= cnst->val.X;
         }
 
         // next part or done
         if (pSep != NULL)
         {
             pStr = pSep + 1;
-            pSep = strchr(pStr, sep);
         }
         else
         {
@@ -1110,14 +1529,11 @@ static bool findEnumValue(const char *str, const UBLOXCFG_ITEM_t *item, int64_t
     bool res = false;
     if (item != NULL)
     {
-        for (int ix = 0; ix < item->nConsts; ix++)
+        const UBLOXCFG_CONST_t *cnst = findConstByName(item, str, strlen(str));
+        if (cnst != NULL)
         {
-            if (strcmp(str, item->consts[ix].name) == 0)
-            {
-                *val = (int64_t)item->consts[ix].val.E;
-                res = true;
-                break;
-            }
+            *val = (int64_t)cnst->val.E;
+            res = true;
         }
     }
     return res;
@@ -313,6 +313,7 @@ typedef struct UBLOXCFG_KEYVAL_s
     An empty list (\c nKeyVal = 0) is a valid input.
 
     \note This function does not validate the contents of the passed list of key-value pairs.
+    \note The contents of \c data after \c dataSize is undefined.
 
     \b Example
     \code{.c}
@@ -357,6 +358,7 @@ bool ubloxcfg_makeData(uint8_t *data, const int size, const UBLOXCFG_KEYVAL_t *k
     An empty data buffer (\c dataSize = 0) is a valid input.
 
     \note This function does not validate the extracted keys.
+    \note Only the first \c nKeyVal entries of \c keyVal are written, the remaining entries are not touched.
 
     \b Example
     \code{.c}
@@ -385,6 +387,132 @@ bool ubloxcfg_makeData(uint8_t *data, const int size, const UBLOXCFG_KEYVAL_t *k
 */
 bool ubloxcfg_parseData(const uint8_t *data, const int size, UBLOXCFG_KEYVAL_t *keyVal, const int maxKeyVal, int *nKeyVal);
 
+//! Sort key-value list by ID and remove duplicates
+/*!
+    Prepares a key-value list for the set operations ubloxcfg_diffKeyVal(), ubloxcfg_mergeKeyVal() and
+    ubloxcfg_intersectKeyVal(), which all require lists sorted by ID and without duplicate IDs.
+
+    \param[in,out] keyVal   List of key-value pairs
+    \param[in]     nKeyVal  Number of key-value pairs
+
+    \returns the number of key-value pairs in the list (after removing duplicates)
+
+    \note If the list contains duplicate IDs it is unspecified which of them is kept.
+*/
+int ubloxcfg_sortKeyVal(UBLOXCFG_KEYVAL_t *keyVal, const int nKeyVal);
+
+//! Difference of two key-value lists
+/*!
+    Determines the key-value pairs that need to be set to get from one configuration to another configuration, that
+    is, the pairs of \c to that are not in \c from or that have a different value in \c from. For example, the
+    items that changed from the default configuration are ubloxcfg_diffKeyVal(default, current).
+
+    \param[in]  from     List of key-value pairs (sorted, see ubloxcfg_sortKeyVal())
+    \param[in]  nFrom    Number of key-value pairs in \c from
+    \param[in]  to       List of key-value pairs (sorted, see ubloxcfg_sortKeyVal())
+    \param[in]  nTo      Number of key-value pairs in \c to
+    \param[out] diff     List of key-value pairs to populate with the difference (sorted), must not overlap the inputs
+    \param[in]  maxDiff  Maximum number of key-value pairs (length of \c diff)
+
+    \returns the number of key-value pairs written to \c diff, or -1 if \c diff is too short
+*/
+int ubloxcfg_diffKeyVal(const UBLOXCFG_KEYVAL_t *from, const int nFrom, const UBLOXCFG_KEYVAL_t *to, const int nTo,
+    UBLOXCFG_KEYVAL_t *diff, const int maxDiff);
+
+//! Merge two key-value lists
+/*!
+    \param[in]  base       List of key-value pairs (sorted, see ubloxcfg_sortKeyVal())
+    \param[in]  nBase      Number of key-value pairs in \c base
+    \param[in]  upd        List of key-value pairs (sorted, see ubloxcfg_sortKeyVal()) that override \c base
+    \param[in]  nUpd       Number of key-value pairs in \c upd
+    \param[out] merged     List of key-value pairs to populate with the union of \c base and \c upd (sorted),
+                           must not overlap the inputs
+    \param[in]  maxMerged  Maximum number of key-value pairs (length of \c merged)
+
+    \returns the number of key-value pairs written to \c merged, or -1 if \c merged is too short
+*/
+int ubloxcfg_mergeKeyVal(const UBLOXCFG_KEYVAL_t *base, const int nBase, const UBLOXCFG_KEYVAL_t *upd, const int nUpd,
+    UBLOXCFG_KEYVAL_t *merged, const int maxMerged);
+
+//! Intersection of two key-value lists
+/*!
+    \param[in]  keyVal   List of key-value pairs (sorted, see ubloxcfg_sortKeyVal())
+    \param[in]  nKeyVal  Number of key-value pairs in \c keyVal
+    \param[in]  other    List of key-value pairs (sorted, see ubloxcfg_sortKeyVal())
+    \param[in]  nOther   Number of key-value pairs in \c other
+    \param[out] inter    List of key-value pairs to populate with the pairs of \c keyVal whose ID is in \c other
+                         (sorted), must not overlap the inputs
+    \param[in]  maxInter Maximum number of key-value pairs (length of \c inter)
+
+    \returns the number of key-value pairs written to \c inter, or -1 if \c inter is too short
+*/
+int ubloxcfg_intersectKeyVal(const UBLOXCFG_KEYVAL_t *keyVal, const int nKeyVal, const UBLOXCFG_KEYVAL_t *other, const int nOther,
+    UBLOXCFG_KEYVAL_t *inter, const int maxInter);
+
+//! Content hash of a key-value list
+/*!
+    \param[in]  keyVal   List of key-value pairs (sorted, see ubloxcfg_sortKeyVal())
+    \param[in]  nKeyVal  Number of key-value pairs
+
+    \returns the hash (64 bit FNV-1a) of the IDs and values, which is the same as the hash in the snapshot made from the
+             list (see ubloxcfg_makeSnapshot())
+
+    Two lists with the same items and values have the same hash. This can be used to compare configurations (e.g. to
+    detect if the configuration of a receiver changed) without comparing all items.
+*/
+uint64_t ubloxcfg_hashKeyVal(const UBLOXCFG_KEYVAL_t *keyVal, const int nKeyVal);
+
+#define UBLOXCFG_SNAPSHOT_VERSION       1  //!< Configuration snapshot format version
+#define UBLOXCFG_SNAPSHOT_MAX_RXINFO  200  //!< Maximum length of the receiver information in a snapshot
+
+//! Maximum size of a configuration snapshot with a number of key-value pairs
+#define UBLOXCFG_SNAPSHOT_MAX_SIZE(nKeyVal) (24 + UBLOXCFG_SNAPSHOT_MAX_RXINFO + ((nKeyVal) * (4 + 8)))
+
+//! Configuration snapshot information
+typedef struct UBLOXCFG_SNAPSHOT_s
+{
+    int              version;    //!< Format version (#UBLOXCFG_SNAPSHOT_VERSION)
+    bool             haveLayer;  //!< The snapshot is from a configuration layer
+    UBLOXCFG_LAYER_t layer;      //!< The configuration layer (if haveLayer is true)
+    char             rxInfo[UBLOXCFG_SNAPSHOT_MAX_RXINFO + 1]; //!< Receiver information (e.g. version string), may be empty
+    int              nKeyVal;    //!< Number of key-value pairs
+    uint64_t         hash;       //!< Content hash (see ubloxcfg_hashKeyVal())
+} UBLOXCFG_SNAPSHOT_t;
+
+//! Make configuration snapshot
+/*!
+    A configuration snapshot is a compact binary representation of a key-value list along with some information (the
+    layer and receiver information) and a content hash. It consists of a small header, the IDs (sorted) and the values
+    (packed).
+
+    \param[out] data      Buffer to write the snapshot to
+    \param[in]  size      Buffer size (see #UBLOXCFG_SNAPSHOT_MAX_SIZE)
+    \param[in]  info      Snapshot information (only \c haveLayer, \c layer and \c rxInfo are used), or NULL
+    \param[in]  keyVal    List of key-value pairs (sorted, see ubloxcfg_sortKeyVal())
+    \param[in]  nKeyVal   Number of key-value pairs
+    \param[out] dataSize  Size of the snapshot
+
+    \returns true if the snapshot was made, false otherwise (\c data too small, list not sorted or bad IDs)
+*/
+bool ubloxcfg_makeSnapshot(uint8_t *data, const int size, const UBLOXCFG_SNAPSHOT_t *info,
+    const UBLOXCFG_KEYVAL_t *keyVal, const int nKeyVal, int *dataSize);
+
+//! Parse configuration snapshot
+/*!
+    \param[in]  data       The snapshot (see ubloxcfg_makeSnapshot())
+    \param[in]  size       Size of the snapshot
+    \param[out] info       Snapshot information, or NULL
+    \param[out] keyVal     List of key-value pairs to populate (sorted), or NULL to only get the \c info
+    \param[in]  maxKeyVal  Maximum number of key-value pairs (length of \c keyVal)
+    \param[out] nKeyVal    Number of key-value pairs written to \c keyVal
+
+    \returns true if the snapshot was valid (and the \c keyVal was big enough), false otherwise
+
+    \note Without \c keyVal only the header of the snapshot is checked. With \c keyVal the content hash is checked, too.
+*/
+bool ubloxcfg_parseSnapshot(const uint8_t *data, const int size, UBLOXCFG_SNAPSHOT_t *info,
+    UBLOXCFG_KEYVAL_t *keyVal, const int maxKeyVal, int *nKeyVal);
+
 //! Stringify item type
 /*!
     \param[in] type  Type
@@ -425,6 +553,20 @@ const char *ubloxcfg_typeStr(UBLOXCFG_TYPE_t type);
 */
 bool ubloxcfg_stringifyValue(char *str, const int size, const UBLOXCFG_TYPE_t type, const UBLOXCFG_ITEM_t *item, const UBLOXCFG_VALUE_t *val);
 
+//! Stringify many values
+/*!
+    \param[in]   keyVal   List of key-value pairs
+    \param[in]   nKeyVal  Number of key-value pairs
+    \param[out]  strs     Pointers to the stringified values (\c nKeyVal entries)
+
+    \returns a buffer with all strings, which the caller must free(), or NULL on failure
+
+    Stringifies the values like ubloxcfg_stringifyValue() does (unknown items like ubloxcfg_stringifyKeyVal() does)
+    into one buffer, which is much faster than doing it one by one for big lists, e.g. all items of a layer. The \c strs
+    point into the returned buffer.
+*/
+char *ubloxcfg_stringifyValues(const UBLOXCFG_KEYVAL_t *keyVal, const int nKeyVal, const char **strs);
+
 //! Split stringified value string
 /*!
     \param[in]   str        The string formatted by ubloxcfg_stringifyValue()
@@ -8062,6 +8062,752 @@ static const UBLOXCFG_ITEM_t * const ubloxcfg_allItems[930] =
     &ubloxcfg_cfgUbloxcfgtestE4
 };
 
+static const uint16_t ubloxcfg_itemsByIdDisp[256] =
+{
+    8, 4, 2, 20, 15, 1, 1, 2, 18, 17, 281, 1, 6, 23, 73, 1,
+    272, 102, 149, 25, 180, 1, 1, 4, 1, 22, 41, 286, 1, 1, 2, 193,
+    38, 156, 8, 265, 1, 101, 257, 130, 41, 4, 2, 38, 667, 125, 162, 259,
+    24, 28, 10, 259, 66, 262, 1, 26, 10, 6, 58, 19, 312, 1, 26, 152,
+    54, 28, 40, 51, 7, 11, 31, 30, 48, 2, 35, 2, 308, 165, 19, 34,
+    2, 93, 99, 291, 23, 56, 52, 130, 7, 52, 3, 1, 1, 113, 355, 19,
+    109, 5, 37, 1, 1, 1, 3, 4, 190, 61, 64, 6, 284, 6, 2, 0,
+    1, 68, 35, 52, 102, 1, 2, 2, 140, 118, 40, 8, 14, 16, 115, 39,
+    6, 35, 313, 25, 258, 6, 146, 232, 499, 144, 90, 38, 19, 3, 1, 73,
+    1, 5, 42, 32, 215, 138, 5, 340, 22, 18, 259, 1, 283, 318, 2, 88,
+    113, 8, 1, 261, 277, 1, 4, 100, 1, 136, 5, 341, 23, 46, 303, 6,
+    338, 265, 332, 78, 279, 37, 63, 4, 37, 10, 241, 1, 42, 35, 9, 134,
+    185, 43, 0, 229, 14, 289, 540, 279, 282, 56, 338, 0, 407, 7, 16, 21,
+    47, 37, 375, 17, 353, 11, 129, 387, 256, 388, 354, 266, 114, 5, 373, 302,
+    297, 330, 1, 210, 71, 30, 261, 196, 126, 370, 0, 298, 314, 287, 657, 436,
+    10, 289, 1, 267, 5, 528, 23, 38, 3, 214, 249, 8, 528, 200, 83, 154
+};
+static const uint16_t ubloxcfg_itemsByIdIndex[1024] =
+{
+    59, 548, 330, 65535, 315, 0, 104, 248, 386, 65535, 535, 686, 384, 658, 910, 65535,
+    401, 429, 625, 31, 90, 536, 140, 231, 489, 547, 497, 213, 791, 331, 215, 91,
+    881, 369, 203, 710, 236, 648, 65535, 157, 129, 149, 843, 65535, 148, 65535, 65535, 65535,
+    915, 572, 38, 65535, 586, 544, 296, 263, 406, 94, 788, 450, 151, 303, 807, 356,
+    35, 125, 636, 867, 191, 605, 827, 130, 175, 402, 553, 174, 65535, 929, 65535, 98,
+    642, 249, 676, 542, 183, 665, 14, 348, 514, 319, 96, 372, 345, 30, 570, 472,
+    620, 924, 640, 354, 711, 198, 11, 447, 709, 669, 456, 584, 801, 321, 772, 65535,
+    887, 65535, 911, 486, 65535, 76, 434, 574, 65535, 889, 109, 677, 208, 894, 685, 24,
+    77, 457, 540, 186, 825, 83, 564, 591, 278, 604, 65535, 218, 260, 504, 720, 117,
+    306, 754, 284, 520, 569, 606, 736, 391, 842, 763, 394, 368, 163, 323, 407, 745,
+    159, 235, 855, 389, 906, 374, 708, 750, 280, 324, 288, 65535, 847, 53, 65535, 65535,
+    271, 153, 395, 101, 758, 398, 556, 513, 576, 70, 637, 65535, 211, 600, 65535, 65535,
+    703, 775, 410, 34, 897, 445, 519, 794, 78, 346, 892, 318, 433, 475, 927, 470,
+    583, 670, 49, 311, 316, 771, 923, 265, 904, 290, 304, 551, 693, 111, 393, 219,
+    493, 477, 146, 698, 483, 818, 343, 65535, 914, 885, 909, 89, 680, 107, 839, 363,
+    42, 639, 420, 21, 152, 103, 783, 65535, 765, 845, 65535, 65535, 164, 603, 706, 325,
+    516, 204, 690, 503, 773, 836, 87, 449, 340, 65535, 294, 65535, 65535, 561, 777, 442,
+    634, 880, 650, 65535, 760, 289, 898, 185, 177, 102, 412, 382, 95, 875, 396, 118,
+    400, 430, 158, 268, 491, 609, 928, 416, 134, 65535, 608, 167, 860, 601, 580, 700,
+    169, 332, 65535, 106, 266, 68, 528, 199, 599, 10, 545, 113, 65535, 737, 405, 699,
+    525, 115, 792, 530, 768, 362, 431, 286, 403, 868, 20, 277, 56, 577, 802, 41,
+    65535, 473, 365, 697, 65535, 776, 757, 578, 33, 65535, 373, 830, 512, 652, 65535, 682,
+    717, 188, 273, 611, 424, 539, 613, 448, 919, 349, 581, 126, 916, 649, 641, 467,
+    128, 903, 51, 505, 557, 226, 357, 60, 202, 65535, 452, 65535, 399, 835, 713, 310,
+    819, 465, 194, 917, 237, 85, 341, 241, 877, 721, 404, 688, 824, 65535, 72, 595,
+    15, 364, 439, 702, 748, 6, 502, 602, 695, 587, 593, 307, 220, 440, 361, 884,
+    81, 210, 65535, 441, 143, 506, 65535, 32, 27, 247, 350, 425, 156, 65535, 18, 787,
+    684, 232, 672, 197, 142, 829, 821, 531, 853, 888, 851, 212, 704, 800, 920, 63,
+    538, 657, 256, 728, 624, 541, 65535, 559, 409, 12, 79, 22, 201, 80, 261, 492,
+    65535, 162, 122, 238, 696, 833, 221, 179, 196, 388, 161, 571, 789, 105, 1, 872,
+    65535, 392, 145, 811, 862, 37, 767, 5, 65535, 563, 65535, 65535, 723, 36, 17, 65535,
+    308, 744, 293, 132, 301, 259, 351, 358, 727, 883, 474, 481, 250, 846, 817, 417,
+    831, 245, 778, 527, 52, 136, 784, 270, 501, 435, 326, 523, 596, 422, 73, 795,
+    65535, 61, 815, 309, 44, 738, 377, 16, 54, 579, 841, 630, 376, 413, 67, 813,
+    380, 925, 82, 243, 458, 328, 725, 810, 753, 627, 781, 283, 764, 13, 626, 229,
+    65535, 295, 287, 522, 62, 336, 344, 378, 908, 837, 170, 65535, 205, 614, 859, 814,
+    181, 793, 629, 26, 274, 616, 230, 257, 902, 428, 65535, 803, 182, 656, 707, 849,
+    895, 643, 360, 65535, 65535, 654, 705, 65535, 743, 555, 224, 526, 622, 234, 313, 408,
+    312, 461, 255, 554, 195, 108, 856, 65535, 498, 589, 252, 383, 550, 292, 123, 752,
+    722, 47, 97, 730, 444, 900, 689, 863, 272, 645, 732, 65535, 592, 907, 484, 302,
+    240, 647, 471, 65535, 482, 610, 834, 300, 93, 623, 667, 7, 832, 375, 137, 279,
+    871, 2, 662, 828, 65535, 490, 239, 718, 133, 4, 468, 124, 337, 799, 691, 178,
+    40, 65535, 633, 71, 65535, 65535, 3, 719, 774, 166, 48, 886, 746, 65535, 99, 891,
+    443, 262, 660, 785, 451, 729, 480, 320, 664, 418, 494, 780, 276, 57, 190, 615,
+    675, 189, 43, 168, 861, 805, 370, 216, 921, 423, 840, 65535, 517, 524, 858, 314,
+    671, 782, 621, 786, 635, 678, 731, 822, 585, 180, 661, 479, 64, 421, 735, 681,
+    414, 901, 823, 566, 367, 820, 594, 740, 598, 242, 769, 739, 597, 246, 193, 487,
+    120, 812, 798, 890, 209, 381, 244, 141, 701, 55, 870, 460, 127, 742, 227, 779,
+    632, 65535, 882, 804, 509, 617, 446, 874, 653, 848, 741, 607, 500, 65535, 534, 65535,
+    184, 628, 866, 165, 65535, 65535, 488, 65535, 638, 864, 65535, 200, 385, 510, 568, 39,
+    854, 116, 110, 724, 546, 267, 687, 155, 173, 726, 285, 160, 674, 338, 339, 469,
+    65535, 65535, 335, 88, 176, 511, 459, 45, 114, 558, 790, 683, 562, 329, 65535, 187,
+    228, 549, 533, 714, 333, 65535, 529, 437, 715, 298, 327, 438, 58, 119, 291, 507,
+    918, 65535, 573, 147, 305, 233, 567, 766, 65, 521, 19, 905, 217, 172, 9, 543,
+    65535, 269, 387, 552, 733, 716, 808, 747, 144, 797, 495, 651, 432, 770, 857, 65535,
+    84, 150, 518, 65535, 759, 8, 826, 893, 223, 65535, 619, 135, 453, 565, 476, 65535,
+    282, 922, 65535, 612, 352, 342, 66, 419, 852, 806, 668, 749, 65535, 355, 100, 322,
+    25, 692, 463, 264, 65535, 838, 206, 69, 659, 712, 317, 28, 359, 214, 679, 258,
+    850, 761, 912, 371, 138, 582, 537, 207, 644, 65535, 755, 254, 588, 411, 590, 876,
+    878, 663, 466, 899, 655, 496, 299, 844, 666, 673, 253, 631, 618, 65535, 65535, 366,
+    454, 251, 694, 532, 65535, 816, 809, 50, 397, 415, 869, 879, 65535, 353, 379, 281,
+    499, 896, 112, 734, 913, 865, 92, 225, 873, 65535, 297, 86, 275, 436, 560, 464,
+    347, 455, 751, 334, 508, 515, 485, 192, 222, 646, 65535, 65535, 756, 23, 462, 74,
+    575, 121, 29, 926, 390, 46, 427, 75, 139, 154, 171, 478, 762, 131, 426, 796
+};
+static const _UBLOXCFG_HASH_t ubloxcfg_itemsById = { .size = 1024, .numBuckets = 256, .disp = ubloxcfg_itemsByIdDisp, .index = ubloxcfg_itemsByIdIndex };
+
+static const uint16_t ubloxcfg_itemsByNameDisp[256] =
+{
+    1, 5, 16, 4, 3, 1, 47, 11, 2, 7, 1, 5, 15, 10, 1, 1,
+    14, 60, 46, 1, 4, 4, 5, 95, 6, 16, 15, 6, 12, 26, 10, 63,
+    61, 2, 22, 7, 1, 6, 2, 30, 3, 4, 21, 2, 20, 40, 10, 12,
+    1, 10, 1, 1, 20, 10, 9, 2, 6, 3, 108, 13, 1, 3, 58, 23,
+    41, 32, 14, 26, 1, 11, 2, 7, 4, 7, 5, 5, 6, 9, 6, 106,
+    14, 15, 1, 63, 33, 3, 2, 20, 81, 3, 2, 18, 12, 11, 1, 2,
+    25, 4, 48, 30, 50, 56, 20, 7, 1, 3, 48, 13, 94, 14, 3, 65,
+    32, 40, 16, 23, 16, 1, 15, 12, 11, 80, 5, 7, 25, 2, 34, 6,
+    188, 15, 1, 28, 3, 3, 12, 46, 160, 133, 1, 7, 11, 33, 2, 1,
+    10, 10, 1, 9, 4, 14, 9, 15, 3, 14, 8, 2, 22, 2, 13, 50,
+    141, 2, 26, 6, 1, 57, 29, 63, 16, 125, 18, 3, 53, 3, 0, 2,
+    27, 41, 5, 27, 34, 11, 42, 15, 7, 2, 32, 75, 1, 40, 1, 60,
+    79, 3, 7, 2, 3, 30, 8, 7, 18, 2, 2, 104, 28, 81, 0, 83,
+    4, 9, 5, 191, 20, 24, 28, 18, 3, 49, 78, 8, 31, 119, 3, 23,
+    58, 71, 19, 8, 15, 1, 1, 32, 4, 345, 9, 57, 121, 27, 2, 43,
+    8, 214, 7, 14, 13, 90, 101, 34, 5, 18, 121, 2, 1, 28, 1, 0
+};
+static const uint16_t ubloxcfg_itemsByNameIndex[1024] =
+{
+    40, 348, 314, 353, 609, 354, 220, 68, 22, 856, 328, 351, 52, 65535, 65535, 367,
+    48, 116, 821, 65535, 861, 112, 682, 154, 528, 369, 895, 830, 885, 530, 253, 775,
+    765, 432, 787, 207, 508, 65535, 749, 670, 283, 161, 66, 705, 826, 339, 237, 859,
+    773, 868, 123, 371, 98, 43, 503, 598, 50, 345, 87, 691, 65535, 675, 138, 581,
+    905, 286, 269, 65535, 730, 65535, 462, 883, 667, 280, 204, 750, 559, 712, 53, 390,
+    679, 141, 5, 63, 305, 468, 474, 77, 85, 176, 540, 690, 836, 331, 525, 644,
+    565, 410, 65535, 380, 8, 173, 65535, 133, 301, 0, 716, 274, 671, 97, 828, 617,
+    14, 871, 248, 760, 300, 776, 590, 801, 221, 388, 650, 291, 130, 109, 711, 268,
+    686, 456, 322, 65535, 39, 65535, 747, 23, 797, 680, 835, 235, 120, 872, 603, 30,
+    784, 111, 108, 413, 382, 193, 599, 149, 909, 597, 880, 125, 65535, 678, 287, 471,
+    65535, 912, 65535, 65535, 453, 589, 570, 65535, 121, 476, 547, 493, 527, 294, 343, 867,
+    4, 553, 318, 20, 51, 308, 591, 17, 906, 718, 357, 658, 632, 255, 317, 832,
+    62, 327, 689, 919, 83, 577, 271, 663, 65535, 926, 114, 347, 813, 769, 181, 65535,
+    628, 441, 289, 660, 777, 762, 490, 506, 512, 281, 44, 67, 265, 655, 377, 561,
+    273, 302, 118, 242, 213, 227, 65535, 362, 346, 630, 674, 625, 809, 92, 49, 107,
+    770, 276, 65535, 442, 564, 886, 74, 372, 151, 65535, 285, 320, 736, 646, 877, 211,
+    18, 259, 394, 767, 64, 196, 303, 717, 200, 65535, 293, 65535, 1, 466, 752, 554,
+    602, 187, 397, 65535, 443, 546, 724, 374, 548, 478, 349, 444, 86, 766, 454, 3,
+    715, 420, 72, 336, 206, 60, 249, 611, 816, 622, 84, 915, 544, 391, 557, 338,
+    131, 65535, 65535, 876, 725, 65535, 857, 465, 216, 607, 806, 792, 166, 177, 461, 574,
+    863, 612, 604, 699, 537, 566, 247, 6, 884, 562, 735, 606, 392, 552, 172, 100,
+    156, 496, 411, 791, 65535, 306, 10, 807, 65535, 218, 739, 894, 759, 486, 309, 556,
+    440, 209, 65535, 695, 688, 197, 569, 812, 80, 664, 270, 395, 571, 59, 427, 479,
+    65535, 851, 70, 879, 137, 334, 79, 526, 823, 378, 849, 910, 65535, 545, 258, 401,
+    406, 65535, 723, 615, 297, 65535, 633, 396, 585, 708, 498, 614, 261, 321, 513, 65535,
+    110, 447, 329, 914, 653, 65535, 65535, 890, 515, 212, 888, 54, 358, 881, 757, 251,
+    65535, 860, 854, 480, 183, 780, 69, 424, 737, 722, 104, 9, 359, 676, 184, 203,
+    310, 657, 487, 171, 626, 360, 781, 191, 91, 892, 208, 706, 408, 379, 182, 179,
+    698, 635, 65535, 567, 368, 911, 16, 162, 920, 494, 918, 458, 245, 774, 616, 222,
+    384, 543, 659, 224, 61, 342, 148, 858, 768, 810, 693, 399, 729, 102, 15, 94,
+    132, 363, 158, 477, 36, 19, 720, 897, 485, 58, 665, 37, 180, 850, 761, 115,
+    710, 333, 596, 819, 580, 65535, 426, 783, 539, 464, 668, 65535, 407, 139, 418, 174,
+    685, 862, 88, 65535, 763, 233, 41, 662, 403, 898, 142, 400, 450, 386, 587, 534,
+    833, 101, 677, 12, 147, 448, 927, 639, 727, 65535, 742, 65535, 376, 925, 143, 623,
+    889, 753, 514, 549, 65535, 475, 65535, 252, 150, 341, 704, 202, 713, 687, 34, 153,
+    105, 523, 103, 649, 592, 186, 538, 748, 373, 814, 845, 518, 796, 840, 136, 238,
+    700, 838, 65535, 229, 365, 469, 620, 601, 536, 822, 853, 304, 65535, 65535, 199, 893,
+    754, 323, 352, 292, 366, 325, 463, 501, 848, 916, 541, 634, 65535, 488, 65535, 575,
+    65535, 652, 703, 495, 46, 170, 419, 631, 800, 839, 516, 56, 811, 904, 122, 483,
+    803, 65535, 790, 817, 524, 873, 38, 874, 772, 65535, 511, 629, 492, 278, 793, 866,
+    409, 65535, 579, 457, 829, 65535, 65535, 256, 13, 636, 65535, 201, 621, 311, 510, 73,
+    168, 586, 28, 89, 299, 236, 264, 298, 11, 654, 65535, 65535, 683, 45, 901, 595,
+    178, 205, 65535, 558, 746, 313, 425, 65535, 782, 230, 731, 185, 656, 78, 608, 398,
+    733, 95, 555, 65535, 624, 428, 709, 907, 164, 57, 846, 350, 865, 145, 417, 385,
+    842, 831, 65535, 500, 672, 756, 55, 75, 81, 467, 96, 316, 482, 908, 332, 65535,
+    576, 254, 246, 887, 681, 825, 192, 903, 452, 600, 129, 7, 827, 794, 519, 93,
+    370, 29, 21, 507, 902, 917, 250, 65535, 805, 244, 745, 65535, 568, 167, 219, 416,
+    751, 613, 473, 65535, 140, 804, 117, 279, 135, 899, 640, 42, 344, 412, 913, 891,
+    65535, 257, 714, 312, 841, 326, 175, 364, 422, 637, 844, 65535, 243, 383, 578, 785,
+    231, 721, 82, 35, 481, 870, 124, 65535, 25, 232, 928, 449, 924, 65535, 929, 459,
+    421, 852, 65, 433, 435, 692, 627, 758, 337, 502, 296, 638, 165, 532, 837, 275,
+    415, 423, 531, 65535, 163, 882, 922, 290, 878, 389, 499, 65535, 319, 65535, 126, 195,
+    505, 65535, 215, 460, 694, 99, 315, 65535, 647, 661, 472, 584, 921, 144, 375, 65535,
+    648, 355, 26, 764, 226, 106, 489, 225, 65535, 707, 651, 439, 65535, 504, 266, 234,
+    550, 65535, 65535, 645, 521, 47, 65535, 741, 431, 786, 594, 239, 446, 241, 436, 900,
+    517, 875, 307, 864, 744, 65535, 560, 701, 445, 71, 65535, 194, 434, 65535, 277, 2,
+    282, 90, 610, 738, 818, 522, 324, 583, 240, 728, 847, 795, 743, 779, 551, 438,
+    387, 497, 451, 190, 65535, 33, 563, 673, 405, 815, 778, 808, 27, 470, 214, 159,
+    361, 263, 618, 65535, 732, 128, 702, 228, 843, 437, 393, 696, 643, 491, 381, 65535,
+    740, 588, 605, 666, 267, 455, 520, 802, 76, 402, 726, 295, 260, 582, 789, 119,
+    855, 330, 157, 272, 134, 169, 65535, 697, 619, 414, 65535, 509, 834, 734, 719, 529,
+    223, 404, 32, 669, 755, 535, 335, 533, 31, 188, 573, 24, 798, 593, 430, 799,
+    923, 641, 284, 572, 771, 642, 155, 869, 356, 217, 262, 65535, 65535, 288, 684, 542,
+    189, 160, 896, 824, 429, 820, 198, 788, 152, 340, 484, 146, 210, 113, 65535, 127
+};
+static const _UBLOXCFG_HASH_t ubloxcfg_itemsByName = { .size = 1024, .numBuckets = 256, .disp = ubloxcfg_itemsByNameDisp, .index = ubloxcfg_itemsByNameIndex };
+
+static const _UBLOXCFG_CONSTREF_t ubloxcfg_constsByNameRefs[294] =
+{
+    { 0x20240011, 0 },
+    { 0x20240011, 1 },
+    { 0x20240011, 2 },
+    { 0x20240011, 3 },
+    { 0x20240011, 4 },
+    { 0x20240011, 5 },
+    { 0x20240013, 0 },
+    { 0x20240013, 1 },
+    { 0x20a30054, 0 },
+    { 0x20a30054, 1 },
+    { 0x20920001, 0 },
+    { 0x20920001, 1 },
+    { 0x20920001, 2 },
+    { 0x20920001, 3 },
+    { 0x20920001, 4 },
+    { 0x20920002, 0 },
+    { 0x20920002, 1 },
+    { 0x20920002, 2 },
+    { 0x20920002, 3 },
+    { 0x20920002, 4 },
+    { 0x20920003, 0 },
+    { 0x20920003, 1 },
+    { 0x20920003, 2 },
+    { 0x20920003, 3 },
+    { 0x20920003, 4 },
+    { 0x20920004, 0 },
+    { 0x20920004, 1 },
+    { 0x20920004, 2 },
+    { 0x20920004, 3 },
+    { 0x20920004, 4 },
+    { 0x20920005, 0 },
+    { 0x20920005, 1 },
+    { 0x20920005, 2 },
+    { 0x20920005, 3 },
+    { 0x20920005, 4 },
+    { 0x20920006, 0 },
+    { 0x20920006, 1 },
+    { 0x20920006, 2 },
+    { 0x20920006, 3 },
+    { 0x20920006, 4 },
+    { 0x20920007, 0 },
+    { 0x20920007, 1 },
+    { 0x20920007, 2 },
+    { 0x20920007, 3 },
+    { 0x20920007, 4 },
+    { 0x20920008, 0 },
+    { 0x20920008, 1 },
+    { 0x20920008, 2 },
+    { 0x20920008, 3 },
+    { 0x20920008, 4 },
+    { 0x20920009, 0 },
+    { 0x20920009, 1 },
+    { 0x20920009, 2 },
+    { 0x20920009, 3 },
+    { 0x20920009, 4 },
+    { 0x2092000a, 0 },
+    { 0x2092000a, 1 },
+    { 0x2092000a, 2 },
+    { 0x2092000a, 3 },
+    { 0x2092000a, 4 },
+    { 0x20410010, 0 },
+    { 0x20410010, 1 },
+    { 0x20410010, 2 },
+    { 0x20140011, 0 },
+    { 0x20140011, 1 },
+    { 0x20110011, 0 },
+    { 0x20110011, 1 },
+    { 0x20110011, 2 },
+    { 0x2011001c, 0 },
+    { 0x2011001c, 1 },
+    { 0x2011001c, 2 },
+    { 0x2011001c, 3 },
+    { 0x2011001c, 4 },
+    { 0x20110021, 0 },
+    { 0x20110021, 1 },
+    { 0x20110021, 2 },
+    { 0x20110021, 3 },
+    { 0x20110021, 4 },
+    { 0x20110021, 5 },
+    { 0x20110021, 6 },
+    { 0x20110021, 7 },
+    { 0x20110021, 8 },
+    { 0x20110021, 9 },
+    { 0x20110021, 10 },
+    { 0x201100d6, 0 },
+    { 0x201100d6, 1 },
+    { 0x201100d6, 2 },
+    { 0x201100d6, 3 },
+    { 0x201100d6, 4 },
+    { 0x201100d6, 5 },
+    { 0x201100d6, 6 },
+    { 0x201100d6, 7 },
+    { 0x201100d6, 8 },
+    { 0x201100d6, 9 },
+    { 0x201100d6, 10 },
+    { 0x201100d6, 11 },
+    { 0x201100d6, 12 },
+    { 0x201100d6, 13 },
+    { 0x201100d6, 14 },
+    { 0x201100d6, 15 },
+    { 0x201100d6, 16 },
+    { 0x201100d6, 17 },
+    { 0x201100d6, 18 },
+    { 0x201100d6, 19 },
+    { 0x201100d6, 20 },
+    { 0x201100d6, 21 },
+    { 0x201100d6, 22 },
+    { 0x201100d6, 23 },
+    { 0x201100d6, 24 },
+    { 0x201100d6, 25 },
+    { 0x201100d6, 26 },
+    { 0x201100d6, 27 },
+    { 0x201100d6, 28 },
+    { 0x201100d6, 29 },
+    { 0x201100d6, 30 },
+    { 0x201100d6, 31 },
+    { 0x201100d6, 32 },
+    { 0x201100d6, 33 },
+    { 0x201100d6, 34 },
+    { 0x201100d6, 35 },
+    { 0x201100d6, 36 },
+    { 0x201100d6, 37 },
+    { 0x201100d6, 38 },
+    { 0x201100d6, 39 },
+    { 0x201100d6, 40 },
+    { 0x201100d6, 41 },
+    { 0x201100d6, 42 },
+    { 0x201100d6, 43 },
+    { 0x201100d6, 44 },
+    { 0x201100d6, 45 },
+    { 0x201100d6, 46 },
+    { 0x201100d6, 47 },
+    { 0x201100d6, 48 },
+    { 0x201100d6, 49 },
+    { 0x201100d6, 50 },
+    { 0x201100d6, 51 },
+    { 0x201100d6, 52 },
+    { 0x201100d6, 53 },
+    { 0x201100d6, 54 },
+    { 0x201100d6, 55 },
+    { 0x201100d6, 56 },
+    { 0x201100d6, 57 },
+    { 0x201100d6, 58 },
+    { 0x201100d6, 59 },
+    { 0x201100d6, 60 },
+    { 0x201100d6, 61 },
+    { 0x201100d6, 62 },
+    { 0x201100d6, 63 },
+    { 0x201100d6, 64 },
+    { 0x20930001, 0 },
+    { 0x20930001, 1 },
+    { 0x20930001, 2 },
+    { 0x20930001, 3 },
+    { 0x20930001, 4 },
+    { 0x20930002, 0 },
+    { 0x20930002, 1 },
+    { 0x20930002, 2 },
+    { 0x20930002, 3 },
+    { 0x20930007, 0 },
+    { 0x20930007, 1 },
+    { 0x20930031, 0 },
+    { 0x20930031, 1 },
+    { 0x20930031, 2 },
+    { 0x20930031, 3 },
+    { 0x20930031, 4 },
+    { 0x20930031, 5 },
+    { 0x20930031, 6 },
+    { 0x20930032, 0 },
+    { 0x20930032, 1 },
+    { 0x20220005, 0 },
+    { 0x20220005, 1 },
+    { 0x20220005, 2 },
+    { 0x20220005, 3 },
+    { 0x20220005, 4 },
+    { 0x20d00001, 0 },
+    { 0x20d00001, 1 },
+    { 0x20d00001, 2 },
+    { 0x20d0000b, 0 },
+    { 0x20d0000b, 1 },
+    { 0x20210003, 0 },
+    { 0x20210003, 1 },
+    { 0x20210003, 2 },
+    { 0x20210003, 3 },
+    { 0x20210003, 4 },
+    { 0x20090009, 0 },
+    { 0x20090009, 1 },
+    { 0x20090009, 2 },
+    { 0x50360006, 0 },
+    { 0x50360006, 1 },
+    { 0x50360006, 2 },
+    { 0x50360006, 3 },
+    { 0x50360006, 4 },
+    { 0x50360006, 5 },
+    { 0x50360006, 6 },
+    { 0x50360006, 7 },
+    { 0x50360006, 8 },
+    { 0x50360006, 9 },
+    { 0x50360006, 10 },
+    { 0x50360006, 11 },
+    { 0x50360006, 12 },
+    { 0x50360006, 13 },
+    { 0x50360006, 14 },
+    { 0x50360006, 15 },
+    { 0x50360006, 16 },
+    { 0x50360006, 17 },
+    { 0x50360006, 18 },
+    { 0x50360006, 19 },
+    { 0x50360006, 20 },
+    { 0x50360006, 21 },
+    { 0x50360006, 22 },
+    { 0x50360006, 23 },
+    { 0x50360006, 24 },
+    { 0x50360006, 25 },
+    { 0x50360006, 26 },
+    { 0x50360006, 27 },
+    { 0x50360006, 28 },
+    { 0x50360006, 29 },
+    { 0x50360006, 30 },
+    { 0x50360006, 31 },
+    { 0x50360006, 32 },
+    { 0x50360006, 33 },
+    { 0x50360006, 34 },
+    { 0x50360006, 35 },
+    { 0x50360006, 36 },
+    { 0x50360006, 37 },
+    { 0x50360006, 38 },
+    { 0x50360006, 39 },
+    { 0x20a70001, 0 },
+    { 0x20a70001, 1 },
+    { 0x20030001, 0 },
+    { 0x20030001, 1 },
+    { 0x20030001, 2 },
+    { 0x20030002, 0 },
+    { 0x20030002, 1 },
+    { 0x20050023, 0 },
+    { 0x20050023, 1 },
+    { 0x20050030, 0 },
+    { 0x20050030, 1 },
+    { 0x2005000c, 0 },
+    { 0x2005000c, 1 },
+    { 0x2005000c, 2 },
+    { 0x2005000c, 3 },
+    { 0x2005000c, 4 },
+    { 0x20050035, 0 },
+    { 0x20050035, 1 },
+    { 0x20050035, 2 },
+    { 0x20050035, 3 },
+    { 0x20a20005, 0 },
+    { 0x20a20005, 1 },
+    { 0x20520002, 0 },
+    { 0x20520002, 1 },
+    { 0x20520002, 2 },
+    { 0x20520002, 3 },
+    { 0x20520003, 0 },
+    { 0x20520003, 1 },
+    { 0x20520004, 0 },
+    { 0x20520004, 1 },
+    { 0x20520004, 2 },
+    { 0x20530002, 0 },
+    { 0x20530002, 1 },
+    { 0x20530002, 2 },
+    { 0x20530002, 3 },
+    { 0x20530003, 0 },
+    { 0x20530003, 1 },
+    { 0x20530004, 0 },
+    { 0x20530004, 1 },
+    { 0x20530004, 2 },
+    { 0x20fe0031, 0 },
+    { 0x20fe0031, 1 },
+    { 0x20fe0031, 2 },
+    { 0x30fe0032, 0 },
+    { 0x30fe0032, 1 },
+    { 0x30fe0032, 2 },
+    { 0x40fe0033, 0 },
+    { 0x40fe0033, 1 },
+    { 0x40fe0033, 2 },
+    { 0x50fe0034, 0 },
+    { 0x50fe0034, 1 },
+    { 0x50fe0034, 2 },
+    { 0x20fe0041, 0 },
+    { 0x20fe0041, 1 },
+    { 0x20fe0041, 2 },
+    { 0x20fe0041, 3 },
+    { 0x20fe0041, 4 },
+    { 0x30fe0042, 0 },
+    { 0x30fe0042, 1 },
+    { 0x30fe0042, 2 },
+    { 0x30fe0042, 3 },
+    { 0x30fe0042, 4 },
+    { 0x40fe0043, 0 },
+    { 0x40fe0043, 1 },
+    { 0x40fe0043, 2 },
+    { 0x40fe0043, 3 },
+    { 0x40fe0043, 4 }
+};
+
+static const uint16_t ubloxcfg_constsByNameDisp[128] =
+{
+    2, 0, 9, 2, 1, 1, 0, 3, 1, 3, 3, 5, 0, 2, 1, 1,
+    1, 1, 2, 6, 1, 1, 2, 1, 2, 16, 2, 4, 2, 1, 1, 2,
+    2, 4, 1, 1, 1, 0, 1, 0, 0, 5, 3, 3, 2, 3, 2, 1,
+    2, 1, 2, 4, 1, 2, 1, 1, 1, 1, 4, 2, 1, 27, 7, 0,
+    1, 0, 1, 1, 0, 3, 5, 2, 4, 2, 1, 1, 7, 1, 3, 1,
+    2, 1, 1, 3, 1, 2, 5, 2, 1, 1, 9, 0, 2, 1, 2, 10,
+    2, 2, 1, 1, 5, 15, 10, 4, 11, 9, 3, 0, 6, 1, 4, 4,
+    2, 1, 2, 8, 11, 7, 5, 20, 8, 24, 1, 1, 3, 1, 1, 2
+};
+static const uint16_t ubloxcfg_constsByNameIndex[512] =
+{
+    150, 65535, 65535, 67, 65535, 52, 68, 82, 65535, 227, 65535, 25, 64, 246, 65535, 65535,
+    116, 65535, 65535, 218, 125, 69, 65535, 154, 208, 65535, 65535, 107, 196, 109, 3, 65535,
+    167, 255, 285, 123, 65535, 115, 65535, 276, 65535, 184, 65535, 269, 88, 60, 65535, 108,
+    83, 189, 16, 134, 137, 65535, 95, 172, 65535, 185, 129, 65535, 65535, 191, 146, 155,
+    65535, 65535, 65535, 65535, 177, 65535, 15, 77, 13, 4, 9, 86, 162, 222, 21, 65535,
+    58, 161, 118, 142, 261, 152, 65535, 213, 279, 1, 65535, 65535, 76, 65535, 65535, 62,
+    65535, 65535, 251, 252, 14, 65535, 104, 27, 44, 23, 286, 65535, 188, 221, 132, 65535,
+    199, 38, 122, 65535, 232, 241, 113, 288, 65535, 65535, 179, 65535, 231, 73, 80, 272,
+    65535, 224, 71, 65535, 289, 43, 65535, 59, 267, 101, 138, 65535, 99, 211, 65535, 144,
+    126, 65535, 65535, 215, 239, 233, 65535, 164, 48, 65535, 235, 159, 84, 253, 230, 180,
+    65535, 6, 11, 65535, 65535, 237, 65535, 65535, 236, 281, 65535, 283, 65535, 56, 65535, 65535,
+    94, 65535, 65535, 65535, 65535, 130, 40, 91, 65535, 204, 28, 65535, 22, 18, 248, 153,
+    151, 65535, 65535, 65535, 212, 65535, 65535, 96, 65535, 175, 243, 65535, 63, 187, 65535, 65535,
+    42, 65535, 65535, 65535, 65535, 263, 65535, 65535, 70, 169, 183, 181, 65535, 5, 65535, 61,
+    275, 65535, 65535, 65535, 98, 210, 176, 65535, 65535, 65535, 174, 65535, 65535, 141, 65535, 186,
+    97, 156, 65535, 49, 65535, 65535, 65535, 65535, 65535, 257, 32, 92, 280, 287, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 53, 65535, 65535, 65535, 65535, 244, 65535,
+    226, 65535, 291, 65535, 19, 10, 205, 65535, 65535, 39, 65535, 234, 74, 65535, 65535, 178,
+    264, 65535, 292, 102, 8, 65535, 37, 65535, 65535, 100, 206, 65535, 158, 238, 254, 247,
+    242, 46, 93, 217, 65535, 65535, 245, 271, 65535, 65535, 203, 157, 24, 65535, 65535, 65535,
+    47, 65535, 41, 197, 65535, 65535, 290, 266, 173, 65535, 65535, 223, 65535, 220, 65535, 128,
+    135, 65535, 26, 65535, 57, 65535, 249, 29, 65535, 65535, 55, 65535, 111, 65535, 65535, 103,
+    65535, 120, 165, 90, 65535, 259, 87, 193, 30, 35, 149, 65, 65535, 200, 2, 65535,
+    207, 65535, 127, 89, 65535, 65535, 65535, 65535, 65535, 262, 119, 265, 65535, 240, 124, 12,
+    66, 65535, 260, 198, 65535, 65535, 65535, 65535, 268, 65535, 50, 81, 273, 228, 65535, 278,
+    131, 51, 65535, 65535, 195, 65535, 117, 17, 256, 145, 282, 54, 168, 65535, 72, 79,
+    216, 65535, 121, 65535, 65535, 65535, 20, 65535, 75, 214, 65535, 209, 284, 65535, 201, 65535,
+    65535, 65535, 182, 45, 65535, 65535, 163, 65535, 65535, 114, 65535, 65535, 139, 171, 65535, 250,
+    229, 136, 65535, 147, 65535, 65535, 65535, 166, 192, 65535, 277, 65535, 143, 65535, 85, 65535,
+    190, 65535, 270, 65535, 7, 225, 65535, 140, 65535, 105, 31, 65535, 170, 219, 194, 65535,
+    0, 65535, 112, 34, 65535, 293, 65535, 202, 148, 274, 65535, 258, 65535, 65535, 65535, 65535,
+    65535, 36, 133, 33, 110, 65535, 65535, 78, 65535, 65535, 65535, 106, 65535, 65535, 65535, 160
+};
+static const _UBLOXCFG_HASH_t ubloxcfg_constsByName = { .size = 512, .numBuckets = 128, .disp = ubloxcfg_constsByNameDisp, .index = ubloxcfg_constsByNameIndex };
+
+static const _UBLOXCFG_CONSTREF_t ubloxcfg_enumsByValueRefs[192] =
+{
+    { 0x20240011, 0 },
+    { 0x20240011, 1 },
+    { 0x20240011, 2 },
+    { 0x20240011, 3 },
+    { 0x20240011, 4 },
+    { 0x20240011, 5 },
+    { 0x20240013, 0 },
+    { 0x20240013, 1 },
+    { 0x20a30054, 0 },
+    { 0x20a30054, 1 },
+    { 0x20410010, 0 },
+    { 0x20410010, 1 },
+    { 0x20410010, 2 },
+    { 0x20140011, 0 },
+    { 0x20140011, 1 },
+    { 0x20110011, 0 },
+    { 0x20110011, 1 },
+    { 0x20110011, 2 },
+    { 0x2011001c, 0 },
+    { 0x2011001c, 1 },
+    { 0x2011001c, 2 },
+    { 0x2011001c, 3 },
+    { 0x2011001c, 4 },
+    { 0x20110021, 0 },
+    { 0x20110021, 1 },
+    { 0x20110021, 2 },
+    { 0x20110021, 3 },
+    { 0x20110021, 4 },
+    { 0x20110021, 5 },
+    { 0x20110021, 6 },
+    { 0x20110021, 7 },
+    { 0x20110021, 8 },
+    { 0x20110021, 9 },
+    { 0x20110021, 10 },
+    { 0x201100d6, 0 },
+    { 0x201100d6, 1 },
+    { 0x201100d6, 2 },
+    { 0x201100d6, 3 },
+    { 0x201100d6, 4 },
+    { 0x201100d6, 5 },
+    { 0x201100d6, 6 },
+    { 0x201100d6, 7 },
+    { 0x201100d6, 8 },
+    { 0x201100d6, 9 },
+    { 0x201100d6, 10 },
+    { 0x201100d6, 11 },
+    { 0x201100d6, 12 },
+    { 0x201100d6, 13 },
+    { 0x201100d6, 14 },
+    { 0x201100d6, 15 },
+    { 0x201100d6, 16 },
+    { 0x201100d6, 17 },
+    { 0x201100d6, 18 },
+    { 0x201100d6, 19 },
+    { 0x201100d6, 20 },
+    { 0x201100d6, 21 },
+    { 0x201100d6, 22 },
+    { 0x201100d6, 23 },
+    { 0x201100d6, 24 },
+    { 0x201100d6, 25 },
+    { 0x201100d6, 26 },
+    { 0x201100d6, 27 },
+    { 0x201100d6, 28 },
+    { 0x201100d6, 29 },
+    { 0x201100d6, 30 },
+    { 0x201100d6, 31 },
+    { 0x201100d6, 32 },
+    { 0x201100d6, 33 },
+    { 0x201100d6, 34 },
+    { 0x201100d6, 35 },
+    { 0x201100d6, 36 },
+    { 0x201100d6, 37 },
+    { 0x201100d6, 38 },
+    { 0x201100d6, 39 },
+    { 0x201100d6, 40 },
+    { 0x201100d6, 41 },
+    { 0x201100d6, 42 },
+    { 0x201100d6, 43 },
+    { 0x201100d6, 44 },
+    { 0x201100d6, 45 },
+    { 0x201100d6, 46 },
+    { 0x201100d6, 47 },
+    { 0x201100d6, 48 },
+    { 0x201100d6, 49 },
+    { 0x201100d6, 50 },
+    { 0x201100d6, 51 },
+    { 0x201100d6, 52 },
+    { 0x201100d6, 53 },
+    { 0x201100d6, 54 },
+    { 0x201100d6, 55 },
+    { 0x201100d6, 56 },
+    { 0x201100d6, 57 },
+    { 0x201100d6, 58 },
+    { 0x201100d6, 59 },
+    { 0x201100d6, 60 },
+    { 0x201100d6, 61 },
+    { 0x201100d6, 62 },
+    { 0x201100d6, 63 },
+    { 0x201100d6, 64 },
+    { 0x20930001, 0 },
+    { 0x20930001, 1 },
+    { 0x20930001, 2 },
+    { 0x20930001, 3 },
+    { 0x20930001, 4 },
+    { 0x20930002, 0 },
+    { 0x20930002, 1 },
+    { 0x20930002, 2 },
+    { 0x20930002, 3 },
+    { 0x20930007, 0 },
+    { 0x20930007, 1 },
+    { 0x20930031, 0 },
+    { 0x20930031, 1 },
+    { 0x20930031, 2 },
+    { 0x20930031, 3 },
+    { 0x20930031, 4 },
+    { 0x20930031, 5 },
+    { 0x20930031, 6 },
+    { 0x20930032, 0 },
+    { 0x20930032, 1 },
+    { 0x20220005, 0 },
+    { 0x20220005, 1 },
+    { 0x20220005, 2 },
+    { 0x20220005, 3 },
+    { 0x20220005, 4 },
+    { 0x20d00001, 0 },
+    { 0x20d00001, 1 },
+    { 0x20d00001, 2 },
+    { 0x20d0000b, 0 },
+    { 0x20d0000b, 1 },
+    { 0x20210003, 0 },
+    { 0x20210003, 1 },
+    { 0x20210003, 2 },
+    { 0x20210003, 3 },
+    { 0x20210003, 4 },
+    { 0x20090009, 0 },
+    { 0x20090009, 1 },
+    { 0x20090009, 2 },
+    { 0x20a70001, 0 },
+    { 0x20a70001, 1 },
+    { 0x20030001, 0 },
+    { 0x20030001, 1 },
+    { 0x20030001, 2 },
+    { 0x20030002, 0 },
+    { 0x20030002, 1 },
+    { 0x20050023, 0 },
+    { 0x20050023, 1 },
+    { 0x20050030, 0 },
+    { 0x20050030, 1 },
+    { 0x2005000c, 0 },
+    { 0x2005000c, 1 },
+    { 0x2005000c, 2 },
+    { 0x2005000c, 3 },
+    { 0x2005000c, 4 },
+    { 0x20050035, 0 },
+    { 0x20050035, 1 },
+    { 0x20050035, 2 },
+    { 0x20050035, 3 },
+    { 0x20a20005, 0 },
+    { 0x20a20005, 1 },
+    { 0x20520002, 0 },
+    { 0x20520002, 1 },
+    { 0x20520002, 2 },
+    { 0x20520002, 3 },
+    { 0x20520003, 0 },
+    { 0x20520003, 1 },
+    { 0x20520004, 0 },
+    { 0x20520004, 1 },
+    { 0x20520004, 2 },
+    { 0x20530002, 0 },
+    { 0x20530002, 1 },
+    { 0x20530002, 2 },
+    { 0x20530002, 3 },
+    { 0x20530003, 0 },
+    { 0x20530003, 1 },
+    { 0x20530004, 0 },
+    { 0x20530004, 1 },
+    { 0x20530004, 2 },
+    { 0x20fe0041, 0 },
+    { 0x20fe0041, 1 },
+    { 0x20fe0041, 2 },
+    { 0x20fe0041, 3 },
+    { 0x20fe0041, 4 },
+    { 0x30fe0042, 0 },
+    { 0x30fe0042, 1 },
+    { 0x30fe0042, 2 },
+    { 0x30fe0042, 3 },
+    { 0x30fe0042, 4 },
+    { 0x40fe0043, 0 },
+    { 0x40fe0043, 1 },
+    { 0x40fe0043, 2 },
+    { 0x40fe0043, 3 },
+    { 0x40fe0043, 4 }
+};
+
+static const uint16_t ubloxcfg_enumsByValueDisp[64] =
+{
+    2, 1, 3, 1, 6, 3, 2, 3, 3, 1, 2, 1, 6, 2, 4, 3,
+    1, 2, 6, 8, 4, 12, 5, 3, 6, 12, 1, 3, 2, 6, 6, 4,
+    2, 1, 2, 3, 28, 7, 16, 1, 2, 0, 4, 1, 4, 5, 4, 1,
+    8, 15, 3, 1, 1, 14, 5, 52, 2, 13, 21, 9, 12, 3, 23, 3
+};
+static const uint16_t ubloxcfg_enumsByValueIndex[256] =
+{
+    109, 65, 72, 98, 26, 65535, 97, 95, 65535, 1, 65535, 11, 65535, 169, 65535, 65535,
+    163, 108, 12, 41, 36, 65535, 65535, 65535, 152, 94, 65535, 100, 71, 65535, 119, 16,
+    61, 148, 161, 67, 66, 107, 73, 65535, 10, 65535, 187, 38, 65535, 65535, 64, 65535,
+    22, 14, 84, 167, 65535, 47, 134, 179, 165, 65535, 93, 65535, 138, 77, 188, 2,
+    65535, 153, 46, 65535, 5, 70, 65535, 90, 65535, 177, 175, 65535, 156, 122, 180, 28,
+    159, 34, 182, 88, 65535, 49, 142, 50, 9, 20, 141, 45, 190, 65535, 65535, 89,
+    65535, 172, 17, 115, 39, 51, 176, 162, 30, 65535, 133, 171, 65535, 151, 65535, 75,
+    82, 57, 74, 105, 118, 178, 111, 174, 65535, 3, 65535, 65535, 140, 33, 44, 150,
+    65535, 35, 65535, 137, 69, 131, 116, 79, 65535, 149, 65535, 102, 68, 63, 29, 58,
+    65535, 185, 65535, 168, 158, 54, 136, 65535, 124, 184, 87, 40, 31, 65535, 155, 6,
+    139, 114, 132, 65535, 15, 18, 76, 19, 160, 65535, 65535, 113, 173, 157, 101, 121,
+    127, 62, 21, 4, 60, 123, 144, 8, 24, 65535, 37, 43, 86, 81, 65535, 104,
+    56, 126, 65535, 91, 117, 65535, 27, 191, 65535, 103, 99, 143, 65535, 65535, 96, 125,
+    147, 183, 65535, 85, 146, 164, 48, 110, 65535, 154, 120, 78, 106, 83, 65535, 129,
+    52, 166, 128, 92, 65535, 130, 32, 59, 65535, 65535, 65535, 42, 13, 65535, 189, 23,
+    7, 65535, 0, 145, 181, 25, 135, 170, 65535, 65535, 80, 186, 53, 65535, 55, 112
+};
+static const _UBLOXCFG_HASH_t ubloxcfg_enumsByValue = { .size = 256, .numBuckets = 64, .disp = ubloxcfg_enumsByValueDisp, .index = ubloxcfg_enumsByValueIndex };
+
 static const UBLOXCFG_MSGRATE_t ubloxcfg_nmeaPubxPosition =
 {
     .msgName   = "NMEA-PUBX-POSITION",
@@ -9351,6 +10097,24 @@ static const UBLOXCFG_MSGRATE_t * const ubloxcfg_allRates[117] =
     &ubloxcfg_ubxTimTp,
     &ubloxcfg_ubxTimVrfy
 };
+
+static const uint16_t ubloxcfg_ratesByNameDisp[32] =
+{
+    4, 1, 1, 6, 18, 3, 1, 35, 78, 45, 82, 0, 14, 53, 5, 47,
+    35, 5, 8, 6, 11, 30, 13, 20, 12, 2, 2, 23, 6, 1, 11, 7
+};
+static const uint16_t ubloxcfg_ratesByNameIndex[128] =
+{
+    66, 54, 17, 16, 79, 1, 107, 90, 65535, 36, 67, 76, 39, 35, 85, 47,
+    58, 65535, 68, 65535, 60, 7, 100, 57, 6, 46, 43, 97, 62, 103, 51, 9,
+    2, 11, 108, 12, 59, 19, 38, 98, 82, 93, 105, 69, 23, 92, 8, 37,
+    114, 5, 81, 65535, 110, 102, 71, 106, 18, 34, 94, 87, 40, 78, 49, 116,
+    3, 88, 86, 101, 73, 45, 65535, 20, 30, 65535, 65535, 65, 44, 72, 83, 75,
+    96, 29, 91, 56, 13, 65535, 10, 115, 74, 42, 48, 25, 112, 109, 77, 65535,
+    95, 21, 28, 65535, 22, 61, 89, 63, 55, 99, 53, 41, 113, 4, 33, 80,
+    50, 52, 26, 65535, 31, 14, 104, 15, 0, 24, 64, 70, 84, 111, 27, 32
+};
+static const _UBLOXCFG_HASH_t ubloxcfg_ratesByName = { .size = 128, .numBuckets = 32, .disp = ubloxcfg_ratesByNameDisp, .index = ubloxcfg_ratesByNameIndex };
 static const char * const ubloxcfg_allSources[6] =
 {
     "u-blox ZED-F9P Interface Description (HPG 1.13) (https://www.u-blox.com/en/docs/UBX-18010854), copyright (c) 2020 u-blox AG",
@@ -9363,7 +10127,14 @@ static const char * const ubloxcfg_allSources[6] =
 
 #ifndef _DOXYGEN_
 const void **_ubloxcfg_allItems(void) { return (const void **)ubloxcfg_allItems; }
+const _UBLOXCFG_HASH_t *_ubloxcfg_itemsById(void) { return &ubloxcfg_itemsById; }
+const _UBLOXCFG_HASH_t *_ubloxcfg_itemsByName(void) { return &ubloxcfg_itemsByName; }
+const _UBLOXCFG_CONSTREF_t *_ubloxcfg_constsByNameRefs(void) { return ubloxcfg_constsByNameRefs; }
+const _UBLOXCFG_HASH_t *_ubloxcfg_constsByName(void) { return &ubloxcfg_constsByName; }
+const _UBLOXCFG_CONSTREF_t *_ubloxcfg_enumsByValueRefs(void) { return ubloxcfg_enumsByValueRefs; }
+const _UBLOXCFG_HASH_t *_ubloxcfg_enumsByValue(void) { return &ubloxcfg_enumsByValue; }
 const void **_ubloxcfg_allRates(void) { return (const void **)ubloxcfg_allRates; }
+const _UBLOXCFG_HASH_t *_ubloxcfg_ratesByName(void) { return &ubloxcfg_ratesByName; }
 const char **_ubloxcfg_allSources(void) { return (const char **)ubloxcfg_allSources; }
 #endif
 
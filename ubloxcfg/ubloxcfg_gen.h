@@ -11841,8 +11841,17 @@ typedef enum UBLOXCFG_CFG_UBLOXCFGTEST_E4_e
 #ifndef _DOXYGEN_
 #define _UBLOXCFG_NUM_ITEMS 930
 const void **_ubloxcfg_allItems(void);
+typedef struct _UBLOXCFG_HASH_s { int size; int numBuckets; const uint16_t *disp; const uint16_t *index; } _UBLOXCFG_HASH_t;
+const _UBLOXCFG_HASH_t *_ubloxcfg_itemsById(void);
+const _UBLOXCFG_HASH_t *_ubloxcfg_itemsByName(void);
+typedef struct _UBLOXCFG_CONSTREF_s { uint32_t id; int ix; } _UBLOXCFG_CONSTREF_t;
+const _UBLOXCFG_CONSTREF_t *_ubloxcfg_constsByNameRefs(void);
+const _UBLOXCFG_HASH_t *_ubloxcfg_constsByName(void);
+const _UBLOXCFG_CONSTREF_t *_ubloxcfg_enumsByValueRefs(void);
+const _UBLOXCFG_HASH_t *_ubloxcfg_enumsByValue(void);
 #define _UBLOXCFG_NUM_RATES 117
 const void **_ubloxcfg_allRates(void);
+const _UBLOXCFG_HASH_t *_ubloxcfg_ratesByName(void);
 #define _UBLOXCFG_MAX_ITEM_LEN 35
 #define _UBLOXCFG_MAX_CONSTS_LEN 449
 #define _UBLOXCFG_NUM_SOURCES 6
@@ -236,6 +236,10 @@ sub genCodeC
                       4 => 'UBLOXCFG_SIZE_FOUR', 8 => 'UBLOXCFG_SIZE_EIGHT');
 
     my @itemStructs = ();
+    my @constsByName = ();
+    my @constsByNameKeys = ();
+    my @enumsByValue = ();
+    my @enumsByValueKeys = ();
     my %msgCfgs = ();
     my $maxItemNameLen = 0;
     my $maxConstNamesLen = 0;
@@ -369,6 +373,25 @@ sub genCodeC
             my $constsStruct = $itemStruct . '_consts';
             $cItem .= sprintf("    .nConsts = %3d, .consts = %s\n", $nConsts, $constsStruct);
 
+            # keys for the constants lookup hashes: item ID and name, item ID and value (E types, first of equal values)
+            my %values = ();
+            for (my $cIx = 0; $cIx < $nConsts; $cIx++)
+            {
+                my $const = $item->{consts}->[$cIx];
+                push(@constsByName, "{ $item->{id}, $cIx }");
+                push(@constsByNameKeys, pack('V', hex($item->{id})) . $const->{name});
+                if ($item->{type} =~ m{^E(\d)$})
+                {
+                    my $bits = 8 * $1;
+                    my $value = ($const->{value} =~ m{^0x}i ? hex($const->{value}) : $const->{value}) & ((1 << $bits) - 1);
+                    $value -= (1 << $bits) if ($value >= (1 << ($bits - 1))); # sign extend, like the value in UBLOXCFG_VALUE_t
+                    next if (exists $values{$value});
+                    $values{$value} = 1;
+                    push(@enumsByValue, "{ $item->{id}, $cIx }");
+                    push(@enumsByValueKeys, pack('V', hex($item->{id})) . pack('V', $value & 0xffffffff));
+                }
+            }
+
             my $cConsts = '';
             $cConsts .= "static const UBLOXCFG_CONST_t ${constsStruct}[$nConsts] =\n";
             $cConsts .= "{\n";
@@ -420,6 +443,29 @@ sub genCodeC
     $hh .= "const void **_ubloxcfg_allItems(void);\n";
     $cc .= "const void **_ubloxcfg_allItems(void) { return (const void **)ubloxcfg_allItems; }\n";
 
+    # generate perfect hashes for looking up items by ID and by name
+    $hh .= "typedef struct _UBLOXCFG_HASH_s { int size; int numBuckets; const uint16_t *disp; const uint16_t *index; } _UBLOXCFG_HASH_t;\n";
+    ($c, $hh, $cc) = genHash($c, $hh, $cc, 'ubloxcfg_itemsById', [ map { pack('V', hex($_->{id})) } @{$items} ]);
+    ($c, $hh, $cc) = genHash($c, $hh, $cc, 'ubloxcfg_itemsByName', [ map { $_->{name} } @{$items} ]);
+
+    # generate perfect hashes for looking up constants by item and name, and enum constants by item and value
+    $hh .= "typedef struct _UBLOXCFG_CONSTREF_s { uint32_t id; int ix; } _UBLOXCFG_CONSTREF_t;\n";
+    foreach my $list ([ 'ubloxcfg_constsByName', \@constsByName, \@constsByNameKeys ],
+                      [ 'ubloxcfg_enumsByValue', \@enumsByValue, \@enumsByValueKeys ])
+    {
+        my ($name, $refs, $keys) = @{$list};
+        my $num = $#{$refs} + 1;
+        $c .= "\n";
+        $c .= "static const _UBLOXCFG_CONSTREF_t ${name}Refs[$num] =\n";
+        $c .= "{\n";
+        $c .= "    $_,\n" for (@{$refs});
+        substr($c, -2, 1, '');
+        $c .= "};\n";
+        $hh .= "const _UBLOXCFG_CONSTREF_t *_${name}Refs(void);\n";
+        $cc .= "const _UBLOXCFG_CONSTREF_t *_${name}Refs(void) { return ${name}Refs; }\n";
+        ($c, $hh, $cc) = genHash($c, $hh, $cc, $name, $keys);
+    }
+
     # generate aliases for message rate configs
     my @msgNames = sort keys %msgCfgs;
     $h .= "\n";
@@ -481,6 +527,7 @@ sub genCodeC
     $hh .= "#define _UBLOXCFG_NUM_RATES $numMsgRates\n";
     $hh .= "const void **_ubloxcfg_allRates(void);\n";
     $cc .= "const void **_ubloxcfg_allRates(void) { return (const void **)ubloxcfg_allRates; }\n";
+    ($c, $hh, $cc) = genHash($c, $hh, $cc, 'ubloxcfg_ratesByName', \@msgNames);
     $hh .= "#define _UBLOXCFG_MAX_ITEM_LEN $maxItemNameLen\n";
     $hh .= "#define _UBLOXCFG_MAX_CONSTS_LEN $maxConstNamesLen\n";
 
@@ -537,6 +584,93 @@ sub genCodeC
     return $errors ? 0 : 1;
 }
 
+####################################################################################################
+# perfect hashes
+
+# Hash function, must match hashKey() in ubloxcfg.c (FNV-1a, seeded, high bits folded into the low bits)
+sub hash
+{
+    my ($seed, $data) = @_;
+    my $h = 0x811c9dc5 ^ $seed;
+    foreach my $byte (unpack('C*', $data))
+    {
+        $h = (($h ^ $byte) * 0x01000193) & 0xffffffff;
+    }
+    return $h ^ ($h >> 16);
+}
+
+# Generate perfect hash ("hash and displace") of the keys: keys are distributed into buckets using
+# hash(0, key), and for each bucket a displacement (seed) is searched, so that hash(disp, key) maps all
+# keys of the bucket to free slots of the table. Lookup is two hashes and one compare.
+sub genHash
+{
+    my ($c, $hh, $cc, $name, $keys) = @_;
+    my $numKeys = $#{$keys} + 1;
+    my $size = 1;
+    $size <<= 1 while ($size < $numKeys);
+    my $numBuckets = $size >> 2;
+    my $empty = 0xffff;
+    die("$name: too many keys") if ($numKeys >= $empty);
+
+    my @buckets = map { [] } (1 .. $numBuckets);
+    for (my $ix = 0; $ix < $numKeys; $ix++)
+    {
+        push(@{$buckets[ hash(0, $keys->[$ix]) & ($numBuckets - 1) ]}, $ix);
+    }
+    my @order = sort { ($#{$buckets[$b]} <=> $#{$buckets[$a]}) || ($a <=> $b) } (0 .. ($numBuckets - 1));
+    my @disp  = (0) x $numBuckets;
+    my @index = ($empty) x $size;
+    foreach my $bucketIx (@order)
+    {
+        next if ($#{$buckets[$bucketIx]} < 0);
+        my $ok = 0;
+        for (my $d = 1; !$ok && ($d < 0xffff); $d++)
+        {
+            my %slots = ();
+            $ok = 1;
+            foreach my $keyIx (@{$buckets[$bucketIx]})
+            {
+                my $slot = hash($d, $keys->[$keyIx]) & ($size - 1);
+                if ( ($index[$slot] != $empty) || $slots{$slot} )
+                {
+                    $ok = 0;
+                    last;
+                }
+                $slots{$slot} = $keyIx;
+            }
+            if ($ok)
+            {
+                $disp[$bucketIx] = $d;
+                $index[$_] = $slots{$_} for (keys %slots);
+            }
+        }
+        die("$name: no displacement for bucket $bucketIx") unless ($ok);
+    }
+    DEBUG("$name: $numKeys keys, $size slots, $numBuckets buckets");
+
+    $c .= "\n";
+    $c .= "static const uint16_t ${name}Disp[$numBuckets] =\n";
+    $c .= "{\n";
+    $c .= join('', map { '    ' . join(', ', @disp[$_ .. MIN($_ + 15, $numBuckets - 1)]) . ",\n" } grep { ($_ % 16) == 0 } (0 .. ($numBuckets - 1)));
+    substr($c, -2, 1, '');
+    $c .= "};\n";
+    $c .= "static const uint16_t ${name}Index[$size] =\n";
+    $c .= "{\n";
+    $c .= join('', map { '    ' . join(', ', @index[$_ .. MIN($_ + 15, $size - 1)]) . ",\n" } grep { ($_ % 16) == 0 } (0 .. ($size - 1)));
+    substr($c, -2, 1, '');
+    $c .= "};\n";
+    $c .= "static const _UBLOXCFG_HASH_t ${name} = { .size = $size, .numBuckets = $numBuckets, .disp = ${name}Disp, .index = ${name}Index };\n";
+    $hh .= "const _UBLOXCFG_HASH_t *_$name(void);\n";
+    $cc .= "const _UBLOXCFG_HASH_t *_$name(void) { return &$name; }\n";
+
+    return ($c, $hh, $cc);
+}
+
+sub MIN
+{
+    return $_[0] < $_[1] ? $_[0] : $_[1];
+}
+
 ####################################################################################################
 # funky functions
 